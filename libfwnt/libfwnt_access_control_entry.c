@@ -28,6 +28,7 @@
 #include <wide_string.h>
 
 #include "libfwnt_access_control_entry.h"
+#include "libfwnt_arena.h"
 #include "libfwnt_debug.h"
 #include "libfwnt_definitions.h"
 #include "libfwnt_libcerror.h"
@@ -42,9 +43,25 @@
 int libfwnt_access_control_entry_initialize(
      libfwnt_access_control_entry_t **access_control_entry,
      libcerror_error_t **error )
+{
+	return( libfwnt_access_control_entry_initialize_with_arena(
+	         access_control_entry,
+	         NULL,
+	         error ) );
+}
+
+/* Creates an access control entry that is allocated from an arena
+ * Make sure the value access_control_entry is referencing, is set to NULL
+ * If arena is NULL the access control entry is allocated on the heap
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_initialize_with_arena(
+     libfwnt_access_control_entry_t **access_control_entry,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error )
 {
 	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
-	static char *function                                                  = "libfwnt_access_control_entry_initialize";
+	static char *function                                                  = "libfwnt_access_control_entry_initialize_with_arena";
 
 	if( access_control_entry == NULL )
 	{
@@ -68,40 +85,64 @@ int libfwnt_access_control_entry_initialize(
 
 		return( -1 );
 	}
-	internal_access_control_entry = memory_allocate_structure(
-	                                 libfwnt_internal_access_control_entry_t );
-
-	if( internal_access_control_entry == NULL )
+	if( arena != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create access control entry.",
-		 function );
+		if( libfwnt_arena_allocate(
+		     arena,
+		     sizeof( libfwnt_internal_access_control_entry_t ),
+		     (void **) &internal_access_control_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create access control entry.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	if( memory_set(
-	     internal_access_control_entry,
-	     0,
-	     sizeof( libfwnt_internal_access_control_entry_t ) ) == NULL )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear access control entry.",
-		 function );
+		internal_access_control_entry = memory_allocate_structure(
+		                                 libfwnt_internal_access_control_entry_t );
 
-		goto on_error;
+		if( internal_access_control_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create access control entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_access_control_entry,
+		     0,
+		     sizeof( libfwnt_internal_access_control_entry_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear access control entry.",
+			 function );
+
+			goto on_error;
+		}
 	}
+	internal_access_control_entry->arena = arena;
+
 	*access_control_entry = (libfwnt_access_control_entry_t *) internal_access_control_entry;
 
 	return( 1 );
 
 on_error:
-	if( internal_access_control_entry != NULL )
+	if( ( internal_access_control_entry != NULL )
+	 && ( arena == NULL ) )
 	{
 		memory_free(
 		 internal_access_control_entry );
@@ -175,9 +216,11 @@ int libfwnt_internal_access_control_entry_free(
 				result = -1;
 			}
 		}
-		memory_free(
-		 *internal_access_control_entry );
-
+		if( ( *internal_access_control_entry )->arena == NULL )
+		{
+			memory_free(
+			 *internal_access_control_entry );
+		}
 		*internal_access_control_entry = NULL;
 	}
 	return( result );
@@ -413,8 +456,9 @@ int libfwnt_access_control_entry_copy_from_byte_stream(
 
 			goto on_error;
 		}
-		if( libfwnt_security_identifier_initialize(
+		if( libfwnt_security_identifier_initialize_with_arena(
 		     &( internal_access_control_entry->security_identifier ),
+		     internal_access_control_entry->arena,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -559,6 +603,217 @@ on_error:
 	return( -1 );
 }
 
+/* Determines if an access control entry type stores a security identifier directly after the access mask
+ * Returns 1 if the type stores the security identifier at offset 8 or 0 if not
+ */
+int libfwnt_access_control_entry_type_has_security_identifier(
+     uint8_t type )
+{
+	switch( type )
+	{
+		case LIBFWNT_ACCESS_ALLOWED:
+		case LIBFWNT_ACCESS_DENIED:
+		case LIBFWNT_SYSTEM_AUDIT:
+		case LIBFWNT_SYSTEM_ALARM:
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK:
+		case LIBFWNT_SYSTEM_MANDATORY_LABEL:
+			return( 1 );
+
+		default:
+			break;
+	}
+	return( 0 );
+}
+
+/* Determines the size of the access control entry as a byte stream
+ * Only access control entries that store the security identifier directly after
+ * the access mask can be converted into a byte stream, since the object types
+ * and application data of other types are not retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_get_byte_stream_size(
+     libfwnt_access_control_entry_t *access_control_entry,
+     size_t *byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_access_control_entry_get_byte_stream_size";
+	size_t security_identifier_size                                        = 0;
+
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry = (libfwnt_internal_access_control_entry_t *) access_control_entry;
+
+	if( byte_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_access_control_entry_type_has_security_identifier(
+	     internal_access_control_entry->type ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access control entry type: 0x%02" PRIx8 ".",
+		 function,
+		 internal_access_control_entry->type );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_get_byte_stream_size(
+	     internal_access_control_entry->security_identifier,
+	     &security_identifier_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve security identifier byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	*byte_stream_size = 8 + security_identifier_size;
+
+	return( 1 );
+}
+
+/* Converts an access control entry into a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_copy_to_byte_stream(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_access_control_entry_copy_to_byte_stream";
+	size_t access_control_entry_size                                       = 0;
+
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry = (libfwnt_internal_access_control_entry_t *) access_control_entry;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_access_control_entry_get_byte_stream_size(
+	     access_control_entry,
+	     &access_control_entry_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access control entry byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < access_control_entry_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream[ 0 ] = internal_access_control_entry->type;
+	byte_stream[ 1 ] = internal_access_control_entry->flags;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( byte_stream[ 2 ] ),
+	 (uint16_t) access_control_entry_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ 4 ] ),
+	 internal_access_control_entry->access_mask );
+
+	if( libfwnt_security_identifier_copy_to_byte_stream(
+	     internal_access_control_entry->security_identifier,
+	     &( byte_stream[ 8 ] ),
+	     byte_stream_size - 8,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier to byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the type
  * Returns 1 if successful or -1 on error
  */
@@ -62,12 +62,21 @@ struct libfwnt_internal_access_control_entry
 	/* The security identifier
 	 */
 	libfwnt_security_identifier_t *security_identifier;
+
+	/* The arena the access control entry is allocated from
+	 */
+	libfwnt_arena_t *arena;
 };
 
 int libfwnt_access_control_entry_initialize(
      libfwnt_access_control_entry_t **access_control_entry,
      libcerror_error_t **error );
 
+int libfwnt_access_control_entry_initialize_with_arena(
+     libfwnt_access_control_entry_t **access_control_entry,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_access_control_entry_free(
      libfwnt_access_control_entry_t **access_control_entry,
@@ -84,6 +93,23 @@ int libfwnt_access_control_entry_copy_from_byte_stream(
      int byte_order,
      libcerror_error_t **error );
 
+int libfwnt_access_control_entry_type_has_security_identifier(
+     uint8_t type );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_get_byte_stream_size(
+     libfwnt_access_control_entry_t *access_control_entry,
+     size_t *byte_stream_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_copy_to_byte_stream(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_access_control_entry_get_type(
      libfwnt_access_control_entry_t *access_control_entry,
@@ -0,0 +1,562 @@
+/*
+ * Windows NT Access Control Entry (ACE) view functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libfwnt_access_control_entry_view.h"
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_security_identifier_view.h"
+#include "libfwnt_types.h"
+
+/* Determines the offset of the security identifier in access control entry data
+ * The security identifier of an object type follows the object flags and the object type
+ * and inherited object type GUIDs that are present according to the object flags
+ * The security identifier offset is 0 if the type has no security identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_view_get_security_identifier_offset(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *security_identifier_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_access_control_entry_view_get_security_identifier_offset";
+	uint32_t object_flags = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: data too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_identifier_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier offset.",
+		 function );
+
+		return( -1 );
+	}
+	switch( data[ 0 ] )
+	{
+		/* Basic types */
+		case LIBFWNT_ACCESS_ALLOWED:
+		case LIBFWNT_ACCESS_DENIED:
+		case LIBFWNT_SYSTEM_AUDIT:
+		case LIBFWNT_SYSTEM_ALARM:
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK:
+		case LIBFWNT_SYSTEM_MANDATORY_LABEL:
+			*security_identifier_offset = 8;
+
+			break;
+
+		/* Object types */
+		case LIBFWNT_ACCESS_ALLOWED_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_OBJECT:
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK_OBJECT:
+			if( data_size < 12 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: object flags offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ 8 ] ),
+			 object_flags );
+
+			*security_identifier_offset = 12;
+
+			/* ACE_OBJECT_TYPE_PRESENT */
+			if( ( object_flags & 0x00000001UL ) != 0 )
+			{
+				*security_identifier_offset += 16;
+			}
+			/* ACE_INHERITED_OBJECT_TYPE_PRESENT */
+			if( ( object_flags & 0x00000002UL ) != 0 )
+			{
+				*security_identifier_offset += 16;
+			}
+			break;
+
+		/* Unknown types */
+		case LIBFWNT_ACCESS_ALLOWED_COMPOUND:
+		default:
+			*security_identifier_offset = 0;
+
+			break;
+	}
+	return( 1 );
+}
+
+/* Sets an access control entry view from a byte stream
+ * The access control entry and its security identifier are validated but not copied,
+ * the view references the byte stream
+ * The byte stream can contain trailing data, the view only covers the access control entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_view_set_from_byte_stream(
+     libfwnt_access_control_entry_view_t *access_control_entry_view,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfwnt_security_identifier_view_t security_identifier_view;
+
+	static char *function              = "libfwnt_access_control_entry_view_set_from_byte_stream";
+	size_t security_identifier_offset  = 0;
+	uint16_t access_control_entry_size = 0;
+
+	if( access_control_entry_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry view.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( byte_stream[ 2 ] ),
+	 access_control_entry_size );
+
+	if( ( access_control_entry_size < 4 )
+	 || ( (size_t) access_control_entry_size > byte_stream_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: access control entry size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_access_control_entry_view_get_security_identifier_offset(
+	     byte_stream,
+	     (size_t) access_control_entry_size,
+	     &security_identifier_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine security identifier offset.",
+		 function );
+
+		return( -1 );
+	}
+	/* Unlike libfwnt_access_control_entry_copy_from_byte_stream the security identifier
+	 * must be stored within the access control entry
+	 */
+	if( security_identifier_offset > 0 )
+	{
+		if( security_identifier_offset > (size_t) access_control_entry_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: security identifier offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwnt_security_identifier_view_set_from_byte_stream(
+		     &security_identifier_view,
+		     &( byte_stream[ security_identifier_offset ] ),
+		     (size_t) access_control_entry_size - security_identifier_offset,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set security identifier view.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	access_control_entry_view->data      = byte_stream;
+	access_control_entry_view->data_size = (size_t) access_control_entry_size;
+
+	return( 1 );
+}
+
+/* Retrieves the type
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_view_get_type(
+     libfwnt_access_control_entry_view_t *access_control_entry_view,
+     uint8_t *type,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_access_control_entry_view_get_type";
+
+	if( access_control_entry_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_control_entry_view->data == NULL )
+	 || ( access_control_entry_view->data_size < 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid access control entry view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+	*type = access_control_entry_view->data[ 0 ];
+
+	return( 1 );
+}
+
+/* Retrieves the flags
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_view_get_flags(
+     libfwnt_access_control_entry_view_t *access_control_entry_view,
+     uint8_t *flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_access_control_entry_view_get_flags";
+
+	if( access_control_entry_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_control_entry_view->data == NULL )
+	 || ( access_control_entry_view->data_size < 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid access control entry view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	*flags = access_control_entry_view->data[ 1 ];
+
+	return( 1 );
+}
+
+/* Retrieves the access mask
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_access_control_entry_view_get_access_mask(
+     libfwnt_access_control_entry_view_t *access_control_entry_view,
+     uint32_t *access_mask,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_access_control_entry_view_get_access_mask";
+
+	if( access_control_entry_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_control_entry_view->data == NULL )
+	 || ( access_control_entry_view->data_size < 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid access control entry view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_mask == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access mask.",
+		 function );
+
+		return( -1 );
+	}
+	switch( access_control_entry_view->data[ 0 ] )
+	{
+		/* Basic types */
+		case LIBFWNT_ACCESS_ALLOWED:
+		case LIBFWNT_ACCESS_DENIED:
+		case LIBFWNT_SYSTEM_AUDIT:
+		case LIBFWNT_SYSTEM_ALARM:
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK:
+		case LIBFWNT_SYSTEM_MANDATORY_LABEL:
+		/* Object types */
+		case LIBFWNT_ACCESS_ALLOWED_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_OBJECT:
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK_OBJECT:
+			break;
+
+		/* Unknown types */
+		case LIBFWNT_ACCESS_ALLOWED_COMPOUND:
+		default:
+			return( 0 );
+	}
+	if( access_control_entry_view->data_size < 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: access mask offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( access_control_entry_view->data[ 4 ] ),
+	 *access_mask );
+
+	return( 1 );
+}
+
+/* Retrieves the security identifier
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_access_control_entry_view_get_security_identifier(
+     libfwnt_access_control_entry_view_t *access_control_entry_view,
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     libcerror_error_t **error )
+{
+	static char *function             = "libfwnt_access_control_entry_view_get_security_identifier";
+	size_t security_identifier_offset = 0;
+	size_t security_identifier_size   = 0;
+
+	if( access_control_entry_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_control_entry_view->data == NULL )
+	 || ( access_control_entry_view->data_size < 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid access control entry view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_identifier_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier view.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_access_control_entry_view_get_security_identifier_offset(
+	     access_control_entry_view->data,
+	     access_control_entry_view->data_size,
+	     &security_identifier_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine security identifier offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_identifier_offset == 0 )
+	{
+		return( 0 );
+	}
+	if( ( security_identifier_offset + 8 ) <= access_control_entry_view->data_size )
+	{
+		security_identifier_size = 8 + ( (size_t) access_control_entry_view->data[ security_identifier_offset + 1 ] * 4 );
+	}
+	if( ( security_identifier_size == 0 )
+	 || ( security_identifier_size > ( access_control_entry_view->data_size - security_identifier_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: security identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	security_identifier_view->data      = &( access_control_entry_view->data[ security_identifier_offset ] );
+	security_identifier_view->data_size = security_identifier_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,79 @@
+/*
+ * Windows NT Access Control Entry (ACE) view functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_ACCESS_CONTROL_ENTRY_VIEW_H )
+#define _LIBFWNT_ACCESS_CONTROL_ENTRY_VIEW_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libfwnt_access_control_entry_view_get_security_identifier_offset(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *security_identifier_offset,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_view_set_from_byte_stream(
+     libfwnt_access_control_entry_view_t *access_control_entry_view,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_view_get_type(
+     libfwnt_access_control_entry_view_t *access_control_entry_view,
+     uint8_t *type,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_view_get_flags(
+     libfwnt_access_control_entry_view_t *access_control_entry_view,
+     uint8_t *flags,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_view_get_access_mask(
+     libfwnt_access_control_entry_view_t *access_control_entry_view,
+     uint32_t *access_mask,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_view_get_security_identifier(
+     libfwnt_access_control_entry_view_t *access_control_entry_view,
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_ACCESS_CONTROL_ENTRY_VIEW_H ) */
+
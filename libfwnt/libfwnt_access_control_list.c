@@ -26,6 +26,7 @@
 
 #include "libfwnt_access_control_entry.h"
 #include "libfwnt_access_control_list.h"
+#include "libfwnt_arena.h"
 #include "libfwnt_definitions.h"
 #include "libfwnt_libcerror.h"
 #include "libfwnt_libcnotify.h"
@@ -38,9 +39,25 @@
 int libfwnt_access_control_list_initialize(
      libfwnt_access_control_list_t **access_control_list,
      libcerror_error_t **error )
+{
+	return( libfwnt_access_control_list_initialize_with_arena(
+	         access_control_list,
+	         NULL,
+	         error ) );
+}
+
+/* Creates an access control list that is allocated from an arena
+ * Make sure the value access_control_list is referencing, is set to NULL
+ * If arena is NULL the access control list is allocated on the heap
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_initialize_with_arena(
+     libfwnt_access_control_list_t **access_control_list,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error )
 {
 	libfwnt_internal_access_control_list_t *internal_access_control_list = NULL;
-	static char *function                                                = "libfwnt_access_control_list_initialize";
+	static char *function                                                = "libfwnt_access_control_list_initialize_with_arena";
 
 	if( access_control_list == NULL )
 	{
@@ -64,40 +81,64 @@ int libfwnt_access_control_list_initialize(
 
 		return( -1 );
 	}
-	internal_access_control_list = memory_allocate_structure(
-	                                libfwnt_internal_access_control_list_t );
-
-	if( internal_access_control_list == NULL )
+	if( arena != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create access control list.",
-		 function );
+		if( libfwnt_arena_allocate(
+		     arena,
+		     sizeof( libfwnt_internal_access_control_list_t ),
+		     (void **) &internal_access_control_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create access control list.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	if( memory_set(
-	     internal_access_control_list,
-	     0,
-	     sizeof( libfwnt_internal_access_control_list_t ) ) == NULL )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear access control list.",
-		 function );
+		internal_access_control_list = memory_allocate_structure(
+		                                libfwnt_internal_access_control_list_t );
 
-		goto on_error;
+		if( internal_access_control_list == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create access control list.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_access_control_list,
+		     0,
+		     sizeof( libfwnt_internal_access_control_list_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear access control list.",
+			 function );
+
+			goto on_error;
+		}
 	}
+	internal_access_control_list->arena = arena;
+
 	*access_control_list = (libfwnt_access_control_list_t *) internal_access_control_list;
 
 	return( 1 );
 
 on_error:
-	if( internal_access_control_list != NULL )
+	if( ( internal_access_control_list != NULL )
+	 && ( arena == NULL ) )
 	{
 		memory_free(
 		 internal_access_control_list );
@@ -172,9 +213,11 @@ int libfwnt_internal_access_control_list_free(
 				result = -1;
 			}
 		}
-		memory_free(
-		 *internal_access_control_list );
-
+		if( ( *internal_access_control_list )->arena == NULL )
+		{
+			memory_free(
+			 *internal_access_control_list );
+		}
 		*internal_access_control_list = NULL;
 	}
 	return( result );
@@ -226,6 +269,17 @@ int libfwnt_access_control_list_copy_from_byte_stream(
 
 		return( -1 );
 	}
+	if( internal_access_control_list->entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid access control list - entries value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( byte_stream == NULL )
 	{
 		libcerror_error_set(
@@ -330,10 +384,31 @@ int libfwnt_access_control_list_copy_from_byte_stream(
 	byte_stream_offset = 8;
 
 /* TODO check bounds of number_of_entries */
-	if( libcdata_array_initialize(
-	     &( internal_access_control_list->entries_array ),
-	     (int) number_of_entries,
-	     error ) != 1 )
+	if( internal_access_control_list->arena != NULL )
+	{
+		if( number_of_entries > 0 )
+		{
+			if( libfwnt_arena_allocate(
+			     internal_access_control_list->arena,
+			     sizeof( libfwnt_access_control_entry_t * ) * number_of_entries,
+			     (void **) &( internal_access_control_list->entries ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create entries.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	else if( libcdata_array_initialize(
+	          &( internal_access_control_list->entries_array ),
+	          (int) number_of_entries,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -348,8 +423,9 @@ int libfwnt_access_control_list_copy_from_byte_stream(
 	     entry_index < number_of_entries;
 	     entry_index++ )
 	{
-		if( libfwnt_access_control_entry_initialize(
+		if( libfwnt_access_control_entry_initialize_with_arena(
 		     (libfwnt_access_control_entry_t **) &internal_access_control_entry,
+		     internal_access_control_list->arena,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -394,7 +470,11 @@ int libfwnt_access_control_list_copy_from_byte_stream(
 		}
 		byte_stream_offset += internal_access_control_entry->size;
 
-		if( libcdata_array_set_entry_by_index(
+		if( internal_access_control_list->entries != NULL )
+		{
+			internal_access_control_list->entries[ entry_index ] = (libfwnt_access_control_entry_t *) internal_access_control_entry;
+		}
+		else if( libcdata_array_set_entry_by_index(
 		     internal_access_control_list->entries_array,
 		     (int) entry_index,
 		     (intptr_t *) internal_access_control_entry,
@@ -412,6 +492,8 @@ int libfwnt_access_control_list_copy_from_byte_stream(
 		}
 		internal_access_control_entry = NULL;
 	}
+	internal_access_control_list->number_of_entries = (int) number_of_entries;
+
 	return( 1 );
 
 on_error:
@@ -428,9 +510,282 @@ on_error:
 		 (int (*)(intptr_t **, libcerror_error_t **)) &libfwnt_internal_access_control_entry_free,
 		 NULL );
 	}
+	internal_access_control_list->entries = NULL;
+
 	return( -1 );
 }
 
+/* Determines the size of the access control list as a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_get_byte_stream_size(
+     libfwnt_access_control_list_t *access_control_list,
+     size_t *byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfwnt_access_control_entry_t *access_control_entry = NULL;
+	static char *function                                = "libfwnt_access_control_list_get_byte_stream_size";
+	size_t access_control_entry_size                     = 0;
+	size_t access_control_list_size                      = 0;
+	int entry_index                                      = 0;
+	int number_of_entries                                = 0;
+
+	if( byte_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_access_control_list_get_number_of_entries(
+	     access_control_list,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	access_control_list_size = 8;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libfwnt_access_control_list_get_entry_by_index(
+		     access_control_list,
+		     entry_index,
+		     &access_control_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve access control entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libfwnt_access_control_entry_get_byte_stream_size(
+		     access_control_entry,
+		     &access_control_entry_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve access control entry: %d byte stream size.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		access_control_list_size += access_control_entry_size;
+	}
+	/* The size of an access control list is stored as a 16-bit value
+	 */
+	if( access_control_list_size > (size_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid access control list size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*byte_stream_size = access_control_list_size;
+
+	return( 1 );
+}
+
+/* Converts an access control list into a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_copy_to_byte_stream(
+     libfwnt_access_control_list_t *access_control_list,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfwnt_access_control_entry_t *access_control_entry = NULL;
+	static char *function                                = "libfwnt_access_control_list_copy_to_byte_stream";
+	size_t access_control_entry_size                     = 0;
+	size_t access_control_list_size                      = 0;
+	size_t byte_stream_offset                            = 0;
+	int entry_index                                      = 0;
+	int number_of_entries                                = 0;
+
+	if( access_control_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_access_control_list_get_byte_stream_size(
+	     access_control_list,
+	     &access_control_list_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access control list byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < access_control_list_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_access_control_list_get_number_of_entries(
+	     access_control_list,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream[ 0 ] = ( (libfwnt_internal_access_control_list_t *) access_control_list )->revision_number;
+	byte_stream[ 1 ] = 0;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( byte_stream[ 2 ] ),
+	 (uint16_t) access_control_list_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( byte_stream[ 4 ] ),
+	 (uint16_t) number_of_entries );
+
+	byte_stream[ 6 ] = 0;
+	byte_stream[ 7 ] = 0;
+
+	byte_stream_offset = 8;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libfwnt_access_control_list_get_entry_by_index(
+		     access_control_list,
+		     entry_index,
+		     &access_control_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve access control entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libfwnt_access_control_entry_get_byte_stream_size(
+		     access_control_entry,
+		     &access_control_entry_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve access control entry: %d byte stream size.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libfwnt_access_control_entry_copy_to_byte_stream(
+		     access_control_entry,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     access_control_list_size - byte_stream_offset,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy access control entry: %d to byte stream.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		byte_stream_offset += access_control_entry_size;
+	}
+	return( 1 );
+}
+
 /* Retrieves the number of access control entries
  * Returns 1 if successful or -1 on error
  */
@@ -455,10 +810,25 @@ int libfwnt_access_control_list_get_number_of_entries(
 	}
 	internal_access_control_list = (libfwnt_internal_access_control_list_t *) access_control_list;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_access_control_list->entries_array,
-	     number_of_entries,
-	     error ) != 1 )
+	if( internal_access_control_list->arena != NULL )
+	{
+		if( number_of_entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid number of entries.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_entries = internal_access_control_list->number_of_entries;
+	}
+	else if( libcdata_array_get_number_of_entries(
+	          internal_access_control_list->entries_array,
+	          number_of_entries,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -497,11 +867,38 @@ int libfwnt_access_control_list_get_entry_by_index(
 	}
 	internal_access_control_list = (libfwnt_internal_access_control_list_t *) access_control_list;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_access_control_list->entries_array,
-	     entry_index,
-	     (intptr_t **) access_control_entry,
-	     error ) != 1 )
+	if( internal_access_control_list->arena != NULL )
+	{
+		if( ( entry_index < 0 )
+		 || ( entry_index >= internal_access_control_list->number_of_entries ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( access_control_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid access control entry.",
+			 function );
+
+			return( -1 );
+		}
+		*access_control_entry = internal_access_control_list->entries[ entry_index ];
+	}
+	else if( libcdata_array_get_entry_by_index(
+	          internal_access_control_list->entries_array,
+	          entry_index,
+	          (intptr_t **) access_control_entry,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
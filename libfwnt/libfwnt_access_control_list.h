@@ -50,12 +50,30 @@ struct libfwnt_internal_access_control_list
 	/* The (access control) entries array
 	 */
 	libcdata_array_t *entries_array;
+
+	/* The (access control) entries, used instead of the entries array
+	 * when the access control list is allocated from an arena
+	 */
+	libfwnt_access_control_entry_t **entries;
+
+	/* The number of (access control) entries
+	 */
+	int number_of_entries;
+
+	/* The arena the access control list is allocated from
+	 */
+	libfwnt_arena_t *arena;
 };
 
 int libfwnt_access_control_list_initialize(
      libfwnt_access_control_list_t **access_control_list,
      libcerror_error_t **error );
 
+int libfwnt_access_control_list_initialize_with_arena(
+     libfwnt_access_control_list_t **access_control_list,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_access_control_list_free(
      libfwnt_access_control_list_t **access_control_list,
@@ -72,6 +90,20 @@ int libfwnt_access_control_list_copy_from_byte_stream(
      int byte_order,
      libcerror_error_t **error );
 
+LIBFWNT_EXTERN \
+int libfwnt_access_control_list_get_byte_stream_size(
+     libfwnt_access_control_list_t *access_control_list,
+     size_t *byte_stream_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_list_copy_to_byte_stream(
+     libfwnt_access_control_list_t *access_control_list,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_access_control_list_get_number_of_entries(
      libfwnt_access_control_list_t *access_control_list,
@@ -0,0 +1,287 @@
+/*
+ * Windows NT Access Control List (ACL) builder functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_access_control_entry.h"
+#include "libfwnt_access_control_list_builder.h"
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_security_identifier.h"
+
+/* Sets the buffer of an access control list builder
+ * The buffer is initialized with an empty access control list
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_builder_set_byte_stream(
+     libfwnt_access_control_list_builder_t *access_control_list_builder,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_access_control_list_builder_set_byte_stream";
+
+	if( access_control_list_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     byte_stream,
+	     0,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream[ 0 ] = LIBFWNT_ACCESS_CONTROL_LIST_BUILDER_REVISION_NUMBER;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( byte_stream[ 2 ] ),
+	 8 );
+
+	access_control_list_builder->data              = byte_stream;
+	access_control_list_builder->data_size         = 8;
+	access_control_list_builder->maximum_data_size = byte_stream_size;
+	access_control_list_builder->number_of_entries = 0;
+
+	return( 1 );
+}
+
+/* Appends an access control entry to the access control list
+ * Only the access control entry types that store the security identifier directly
+ * after the access mask are supported, callback entries are written without
+ * application data
+ * The access control list is not modified if the entry cannot be appended
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_builder_append_entry(
+     libfwnt_access_control_list_builder_t *access_control_list_builder,
+     uint8_t type,
+     uint8_t flags,
+     uint32_t access_mask,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t *access_control_entry_data = NULL;
+	static char *function              = "libfwnt_access_control_list_builder_append_entry";
+	size_t access_control_entry_size   = 0;
+	size_t security_identifier_size    = 0;
+
+	if( access_control_list_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_control_list_builder->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid access control list builder - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_control_list_builder->data_size < 8 )
+	 || ( access_control_list_builder->data_size > access_control_list_builder->maximum_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid access control list builder - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_control_list_builder->number_of_entries == (uint16_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid access control list builder - number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_access_control_entry_type_has_security_identifier(
+	     type ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access control entry type: 0x%02" PRIx8 ".",
+		 function,
+		 type );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_get_byte_stream_size(
+	     security_identifier,
+	     &security_identifier_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve security identifier byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	access_control_entry_size = 8 + security_identifier_size;
+
+	if( access_control_entry_size > ( (size_t) UINT16_MAX - access_control_list_builder->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: access control list size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_control_entry_size > ( access_control_list_builder->maximum_data_size - access_control_list_builder->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	access_control_entry_data = &( access_control_list_builder->data[ access_control_list_builder->data_size ] );
+
+	if( libfwnt_security_identifier_copy_to_byte_stream(
+	     security_identifier,
+	     &( access_control_entry_data[ 8 ] ),
+	     security_identifier_size,
+	     LIBFWNT_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier to byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	access_control_entry_data[ 0 ] = type;
+	access_control_entry_data[ 1 ] = flags;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( access_control_entry_data[ 2 ] ),
+	 (uint16_t) access_control_entry_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( access_control_entry_data[ 4 ] ),
+	 access_mask );
+
+	access_control_list_builder->data_size         += access_control_entry_size;
+	access_control_list_builder->number_of_entries += 1;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( access_control_list_builder->data[ 2 ] ),
+	 (uint16_t) access_control_list_builder->data_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( access_control_list_builder->data[ 4 ] ),
+	 access_control_list_builder->number_of_entries );
+
+	return( 1 );
+}
+
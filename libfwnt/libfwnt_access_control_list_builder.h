@@ -0,0 +1,67 @@
+/*
+ * Windows NT Access Control List (ACL) builder functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_ACCESS_CONTROL_LIST_BUILDER_H )
+#define _LIBFWNT_ACCESS_CONTROL_LIST_BUILDER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The access control list builder writes an access control list directly into
+ * a buffer that is owned by the caller, one access control entry at a time, so
+ * that an access control list can be assembled without allocating memory
+ */
+
+/* The access control list revision used by the builder
+ */
+#define LIBFWNT_ACCESS_CONTROL_LIST_BUILDER_REVISION_NUMBER	2
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_list_builder_set_byte_stream(
+     libfwnt_access_control_list_builder_t *access_control_list_builder,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_list_builder_append_entry(
+     libfwnt_access_control_list_builder_t *access_control_list_builder,
+     uint8_t type,
+     uint8_t flags,
+     uint32_t access_mask,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_ACCESS_CONTROL_LIST_BUILDER_H ) */
+
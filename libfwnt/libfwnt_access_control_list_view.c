@@ -0,0 +1,374 @@
+/*
+ * Windows NT Access Control List (ACL) view functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libfwnt_access_control_entry_view.h"
+#include "libfwnt_access_control_list_view.h"
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+/* Sets an access control list view from a byte stream
+ * The access control list and all its entries are validated but not copied,
+ * the view references the byte stream
+ * Unlike libfwnt_access_control_list_copy_from_byte_stream the entries must be
+ * stored within the size of the access control list
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_view_set_from_byte_stream(
+     libfwnt_access_control_list_view_t *access_control_list_view,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfwnt_access_control_entry_view_t access_control_entry_view;
+
+	static char *function             = "libfwnt_access_control_list_view_set_from_byte_stream";
+	size_t byte_stream_offset         = 0;
+	uint16_t access_control_list_size = 0;
+	uint16_t entry_index              = 0;
+	uint16_t number_of_entries        = 0;
+
+	if( access_control_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list view.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( byte_stream[ 2 ] ),
+	 access_control_list_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( byte_stream[ 4 ] ),
+	 number_of_entries );
+
+	if( ( access_control_list_size < 8 )
+	 || ( (size_t) access_control_list_size > byte_stream_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: access control list size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_offset = 8;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libfwnt_access_control_entry_view_set_from_byte_stream(
+		     &access_control_entry_view,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     (size_t) access_control_list_size - byte_stream_offset,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set access control entry: %" PRIu16 " view.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		byte_stream_offset += access_control_entry_view.data_size;
+	}
+	access_control_list_view->data      = byte_stream;
+	access_control_list_view->data_size = (size_t) access_control_list_size;
+
+	return( 1 );
+}
+
+/* Retrieves the revision number
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_view_get_revision_number(
+     libfwnt_access_control_list_view_t *access_control_list_view,
+     uint8_t *revision_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_access_control_list_view_get_revision_number";
+
+	if( access_control_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_control_list_view->data == NULL )
+	 || ( access_control_list_view->data_size < 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid access control list view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( revision_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid revision number.",
+		 function );
+
+		return( -1 );
+	}
+	*revision_number = access_control_list_view->data[ 0 ];
+
+	return( 1 );
+}
+
+/* Retrieves the number of access control entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_view_get_number_of_entries(
+     libfwnt_access_control_list_view_t *access_control_list_view,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_access_control_list_view_get_number_of_entries";
+	uint16_t value_16bit  = 0;
+
+	if( access_control_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_control_list_view->data == NULL )
+	 || ( access_control_list_view->data_size < 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid access control list view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( access_control_list_view->data[ 4 ] ),
+	 value_16bit );
+
+	*number_of_entries = (int) value_16bit;
+
+	return( 1 );
+}
+
+/* Retrieves a specific access control entry
+ * The entries are stored consecutively, hence the entries preceding the entry are traversed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_view_get_entry_by_index(
+     libfwnt_access_control_list_view_t *access_control_list_view,
+     int entry_index,
+     libfwnt_access_control_entry_view_t *access_control_entry_view,
+     libcerror_error_t **error )
+{
+	static char *function              = "libfwnt_access_control_list_view_get_entry_by_index";
+	size_t data_offset                 = 0;
+	uint16_t access_control_entry_size = 0;
+	uint16_t number_of_entries         = 0;
+	int entry_iterator                 = 0;
+
+	if( access_control_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_control_list_view->data == NULL )
+	 || ( access_control_list_view->data_size < 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid access control list view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( access_control_list_view->data[ 4 ] ),
+	 number_of_entries );
+
+	if( ( entry_index < 0 )
+	 || ( entry_index >= (int) number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_control_entry_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry view.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = 8;
+
+	for( entry_iterator = 0;
+	     entry_iterator <= entry_index;
+	     entry_iterator++ )
+	{
+		if( ( data_offset + 4 ) > access_control_list_view->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: access control entry: %d offset value out of bounds.",
+			 function,
+			 entry_iterator );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( access_control_list_view->data[ data_offset + 2 ] ),
+		 access_control_entry_size );
+
+		if( ( access_control_entry_size < 4 )
+		 || ( (size_t) access_control_entry_size > ( access_control_list_view->data_size - data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: access control entry: %d size value out of bounds.",
+			 function,
+			 entry_iterator );
+
+			return( -1 );
+		}
+		if( entry_iterator < entry_index )
+		{
+			data_offset += access_control_entry_size;
+		}
+	}
+	access_control_entry_view->data      = &( access_control_list_view->data[ data_offset ] );
+	access_control_entry_view->data_size = (size_t) access_control_entry_size;
+
+	return( 1 );
+}
+
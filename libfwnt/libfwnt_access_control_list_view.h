@@ -0,0 +1,68 @@
+/*
+ * Windows NT Access Control List (ACL) view functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_ACCESS_CONTROL_LIST_VIEW_H )
+#define _LIBFWNT_ACCESS_CONTROL_LIST_VIEW_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_list_view_set_from_byte_stream(
+     libfwnt_access_control_list_view_t *access_control_list_view,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_list_view_get_revision_number(
+     libfwnt_access_control_list_view_t *access_control_list_view,
+     uint8_t *revision_number,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_list_view_get_number_of_entries(
+     libfwnt_access_control_list_view_t *access_control_list_view,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_list_view_get_entry_by_index(
+     libfwnt_access_control_list_view_t *access_control_list_view,
+     int entry_index,
+     libfwnt_access_control_entry_view_t *access_control_entry_view,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_ACCESS_CONTROL_LIST_VIEW_H ) */
+
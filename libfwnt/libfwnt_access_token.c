@@ -0,0 +1,994 @@
+/*
+ * Windows NT access token functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_access_token.h"
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_security_descriptor_view.h"
+#include "libfwnt_security_identifier.h"
+#include "libfwnt_types.h"
+
+/* Creates an access token
+ * Make sure the value access_token is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_token_initialize(
+     libfwnt_access_token_t **access_token,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_token_t *internal_access_token = NULL;
+	static char *function                                  = "libfwnt_access_token_initialize";
+
+	if( access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	if( *access_token != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid access token value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_token = memory_allocate_structure(
+	                         libfwnt_internal_access_token_t );
+
+	if( internal_access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create access token.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_access_token,
+	     0,
+	     sizeof( libfwnt_internal_access_token_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear access token.",
+		 function );
+
+		goto on_error;
+	}
+	*access_token = (libfwnt_access_token_t *) internal_access_token;
+
+	return( 1 );
+
+on_error:
+	if( internal_access_token != NULL )
+	{
+		memory_free(
+		 internal_access_token );
+	}
+	return( -1 );
+}
+
+/* Frees an access token
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_token_free(
+     libfwnt_access_token_t **access_token,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_token_t *internal_access_token = NULL;
+	static char *function                                  = "libfwnt_access_token_free";
+
+	if( access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	if( *access_token != NULL )
+	{
+		internal_access_token = (libfwnt_internal_access_token_t *) *access_token;
+		*access_token         = NULL;
+
+		if( internal_access_token->entries != NULL )
+		{
+			memory_free(
+			 internal_access_token->entries );
+		}
+		memory_free(
+		 internal_access_token );
+	}
+	return( 1 );
+}
+
+/* Inserts security identifier data into the hash table of the access token
+ * The hash table is grown when it becomes more than half full
+ * Returns 1 if successful, 0 if the security identifier already was present or -1 on error
+ */
+int libfwnt_internal_access_token_insert_entry(
+     libfwnt_internal_access_token_t *internal_access_token,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_access_token_entry_t *entries = NULL;
+	libfwnt_access_token_entry_t *entry   = NULL;
+	static char *function                 = "libfwnt_internal_access_token_insert_entry";
+	uint32_t entry_index                  = 0;
+	uint32_t hash                         = 0;
+	uint32_t number_of_entries            = 0;
+	uint32_t previous_entry_index         = 0;
+
+	if( internal_access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 8 )
+	 || ( data_size > LIBFWNT_ACCESS_TOKEN_MAXIMUM_SECURITY_IDENTIFIER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_access_token_has_security_identifier(
+	     internal_access_token,
+	     data,
+	     data_size ) != 0 )
+	{
+		return( 0 );
+	}
+	if( internal_access_token->number_of_security_identifiers >= ( INT_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid access token - number of security identifiers value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the hash table at most half full so that probe sequences stay short
+	 */
+	if( ( (uint32_t) internal_access_token->number_of_security_identifiers + 1 ) * 2 > internal_access_token->number_of_entries )
+	{
+		number_of_entries = internal_access_token->number_of_entries * 2;
+
+		if( number_of_entries < 16 )
+		{
+			number_of_entries = 16;
+		}
+		if( (size_t) number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfwnt_access_token_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libfwnt_access_token_entry_t *) memory_allocate(
+		                                            sizeof( libfwnt_access_token_entry_t ) * number_of_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     entries,
+		     0,
+		     sizeof( libfwnt_access_token_entry_t ) * number_of_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entries.",
+			 function );
+
+			memory_free(
+			 entries );
+
+			return( -1 );
+		}
+		for( previous_entry_index = 0;
+		     previous_entry_index < internal_access_token->number_of_entries;
+		     previous_entry_index++ )
+		{
+			entry = &( internal_access_token->entries[ previous_entry_index ] );
+
+			if( entry->data_size == 0 )
+			{
+				continue;
+			}
+			entry_index = entry->hash & ( number_of_entries - 1 );
+
+			while( entries[ entry_index ].data_size != 0 )
+			{
+				entry_index = ( entry_index + 1 ) & ( number_of_entries - 1 );
+			}
+			entries[ entry_index ] = *entry;
+		}
+		if( internal_access_token->entries != NULL )
+		{
+			memory_free(
+			 internal_access_token->entries );
+		}
+		internal_access_token->entries           = entries;
+		internal_access_token->number_of_entries = number_of_entries;
+	}
+	hash = libfwnt_security_identifier_calculate_hash(
+	        data,
+	        data_size );
+
+	entry_index = hash & ( internal_access_token->number_of_entries - 1 );
+
+	while( internal_access_token->entries[ entry_index ].data_size != 0 )
+	{
+		entry_index = ( entry_index + 1 ) & ( internal_access_token->number_of_entries - 1 );
+	}
+	entry = &( internal_access_token->entries[ entry_index ] );
+
+	if( memory_copy(
+	     entry->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier data.",
+		 function );
+
+		return( -1 );
+	}
+	entry->hash      = hash;
+	entry->data_size = data_size;
+
+	internal_access_token->number_of_security_identifiers += 1;
+
+	return( 1 );
+}
+
+/* Determines if security identifier data is in the access token
+ * Returns 1 if the security identifier is present or 0 if not
+ */
+int libfwnt_internal_access_token_has_security_identifier(
+     libfwnt_internal_access_token_t *internal_access_token,
+     const uint8_t *data,
+     size_t data_size )
+{
+	libfwnt_access_token_entry_t *entry = NULL;
+	uint32_t entry_index                = 0;
+	uint32_t hash                       = 0;
+
+	if( internal_access_token->number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	hash = libfwnt_security_identifier_calculate_hash(
+	        data,
+	        data_size );
+
+	entry_index = hash & ( internal_access_token->number_of_entries - 1 );
+
+	/* The hash table is at most half full so an unused entry always ends the probe sequence
+	 */
+	for( entry = &( internal_access_token->entries[ entry_index ] );
+	     entry->data_size != 0;
+	     entry = &( internal_access_token->entries[ entry_index ] ) )
+	{
+		if( ( entry->hash == hash )
+		 && ( entry->data_size == data_size )
+		 && ( memory_compare(
+		       entry->data,
+		       data,
+		       data_size ) == 0 ) )
+		{
+			return( 1 );
+		}
+		entry_index = ( entry_index + 1 ) & ( internal_access_token->number_of_entries - 1 );
+	}
+	return( 0 );
+}
+
+/* Appends a security identifier (SID) to the access token
+ * Appending a security identifier that is already in the access token has no effect
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_token_append_security_identifier(
+     libfwnt_access_token_t *access_token,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t data[ LIBFWNT_ACCESS_TOKEN_MAXIMUM_SECURITY_IDENTIFIER_SIZE ];
+
+	libfwnt_internal_access_token_t *internal_access_token = NULL;
+	static char *function                                  = "libfwnt_access_token_append_security_identifier";
+	size_t data_size                                       = 0;
+
+	if( access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_token = (libfwnt_internal_access_token_t *) access_token;
+
+	if( libfwnt_security_identifier_get_byte_stream_size(
+	     security_identifier,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve security identifier data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_copy_to_byte_stream(
+	     security_identifier,
+	     data,
+	     LIBFWNT_ACCESS_TOKEN_MAXIMUM_SECURITY_IDENTIFIER_SIZE,
+	     LIBFWNT_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_access_token_insert_entry(
+	     internal_access_token,
+	     data,
+	     data_size,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of security identifiers (SIDs) in the access token
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_token_get_number_of_security_identifiers(
+     libfwnt_access_token_t *access_token,
+     int *number_of_security_identifiers,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_token_t *internal_access_token = NULL;
+	static char *function                                  = "libfwnt_access_token_get_number_of_security_identifiers";
+
+	if( access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_token = (libfwnt_internal_access_token_t *) access_token;
+
+	if( number_of_security_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of security identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_security_identifiers = internal_access_token->number_of_security_identifiers;
+
+	return( 1 );
+}
+
+/* Determines if a security identifier (SID) is in the access token
+ * Returns 1 if the security identifier is present, 0 if not or -1 on error
+ */
+int libfwnt_access_token_has_security_identifier(
+     libfwnt_access_token_t *access_token,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t data[ LIBFWNT_ACCESS_TOKEN_MAXIMUM_SECURITY_IDENTIFIER_SIZE ];
+
+	libfwnt_internal_access_token_t *internal_access_token = NULL;
+	static char *function                                  = "libfwnt_access_token_has_security_identifier";
+	size_t data_size                                       = 0;
+
+	if( access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_token = (libfwnt_internal_access_token_t *) access_token;
+
+	if( libfwnt_security_identifier_get_byte_stream_size(
+	     security_identifier,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve security identifier data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_copy_to_byte_stream(
+	     security_identifier,
+	     data,
+	     LIBFWNT_ACCESS_TOKEN_MAXIMUM_SECURITY_IDENTIFIER_SIZE,
+	     LIBFWNT_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier data.",
+		 function );
+
+		return( -1 );
+	}
+	return( libfwnt_internal_access_token_has_security_identifier(
+	         internal_access_token,
+	         data,
+	         data_size ) );
+}
+
+/* Evaluates the access control entries (ACEs) of discretionary access control list (DACL) data
+ * The entries are evaluated in order, an access allowed entry grants the rights that were not
+ * denied by a preceding entry and an access denied entry denies the rights that were not granted
+ * by a preceding entry
+ * Inherit-only entries, object entries that apply to a specific object type and callback
+ * (conditional) entries are skipped
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_access_token_evaluate_access_control_list(
+     libfwnt_internal_access_token_t *internal_access_token,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *granted_access_mask,
+     libcerror_error_t **error )
+{
+	const uint8_t *access_control_entry_data = NULL;
+	static char *function                    = "libfwnt_internal_access_token_evaluate_access_control_list";
+	size_t data_offset                       = 0;
+	size_t security_identifier_offset        = 0;
+	size_t security_identifier_size          = 0;
+	uint32_t access_mask                     = 0;
+	uint32_t denied_access_mask              = 0;
+	uint32_t object_flags                    = 0;
+	uint32_t safe_granted_access_mask        = 0;
+	uint16_t access_control_entry_size       = 0;
+	uint16_t entry_index                     = 0;
+	uint16_t number_of_entries               = 0;
+	uint8_t access_control_entry_type        = 0;
+
+	if( internal_access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: data too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( granted_access_mask == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid granted access mask.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 4 ] ),
+	 number_of_entries );
+
+	data_offset = 8;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		/* Once every right is either granted or denied the remaining entries cannot change the result
+		 */
+		if( ( safe_granted_access_mask | denied_access_mask ) == 0xffffffffUL )
+		{
+			break;
+		}
+		if( data_offset > ( data_size - 4 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: access control entry: %" PRIu16 " offset value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		access_control_entry_data = &( data[ data_offset ] );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( access_control_entry_data[ 2 ] ),
+		 access_control_entry_size );
+
+		if( ( access_control_entry_size < 4 )
+		 || ( (size_t) access_control_entry_size > ( data_size - data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: access control entry: %" PRIu16 " size value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		data_offset += access_control_entry_size;
+
+		/* INHERIT_ONLY_ACE */
+		if( ( access_control_entry_data[ 1 ] & 0x08 ) != 0 )
+		{
+			continue;
+		}
+		access_control_entry_type  = access_control_entry_data[ 0 ];
+		security_identifier_offset = 0;
+
+		switch( access_control_entry_type )
+		{
+			case LIBFWNT_ACCESS_ALLOWED:
+			case LIBFWNT_ACCESS_DENIED:
+				security_identifier_offset = 8;
+
+				break;
+
+			case LIBFWNT_ACCESS_ALLOWED_OBJECT:
+			case LIBFWNT_ACCESS_DENIED_OBJECT:
+				if( access_control_entry_size < 12 )
+				{
+					break;
+				}
+				byte_stream_copy_to_uint32_little_endian(
+				 &( access_control_entry_data[ 8 ] ),
+				 object_flags );
+
+				/* An entry with ACE_OBJECT_TYPE_PRESENT applies to a specific object type
+				 * or property and not to the object as a whole
+				 */
+				if( ( object_flags & 0x00000001UL ) != 0 )
+				{
+					break;
+				}
+				security_identifier_offset = 12;
+
+				/* ACE_INHERITED_OBJECT_TYPE_PRESENT */
+				if( ( object_flags & 0x00000002UL ) != 0 )
+				{
+					security_identifier_offset += 16;
+				}
+				break;
+
+			default:
+				break;
+		}
+		if( security_identifier_offset == 0 )
+		{
+			continue;
+		}
+		if( ( security_identifier_offset + 8 ) > (size_t) access_control_entry_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: access control entry: %" PRIu16 " security identifier offset value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		security_identifier_size = 8 + ( (size_t) access_control_entry_data[ security_identifier_offset + 1 ] * 4 );
+
+		if( security_identifier_size > ( (size_t) access_control_entry_size - security_identifier_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: access control entry: %" PRIu16 " security identifier size value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libfwnt_internal_access_token_has_security_identifier(
+		     internal_access_token,
+		     &( access_control_entry_data[ security_identifier_offset ] ),
+		     security_identifier_size ) == 0 )
+		{
+			continue;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( access_control_entry_data[ 4 ] ),
+		 access_mask );
+
+		if( ( access_control_entry_type == LIBFWNT_ACCESS_ALLOWED )
+		 || ( access_control_entry_type == LIBFWNT_ACCESS_ALLOWED_OBJECT ) )
+		{
+			safe_granted_access_mask |= access_mask & ~denied_access_mask;
+		}
+		else
+		{
+			denied_access_mask |= access_mask & ~safe_granted_access_mask;
+		}
+	}
+	*granted_access_mask = safe_granted_access_mask;
+
+	return( 1 );
+}
+
+/* Retrieves the access mask that a security descriptor grants to the access token
+ * The security descriptor is validated as by libfwnt_security_descriptor_view_set_from_byte_stream
+ * and its discretionary access control list (DACL) is evaluated in place, no memory is allocated
+ * A security descriptor without a DACL grants all standard and specific access rights (0x001fffff)
+ * and an empty DACL grants no access
+ * The implicit rights of the owner are not applied and generic rights are not mapped
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_token_get_granted_access_mask(
+     libfwnt_access_token_t *access_token,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     uint32_t *granted_access_mask,
+     libcerror_error_t **error )
+{
+	libfwnt_access_control_list_view_t access_control_list_view;
+	libfwnt_security_descriptor_view_t security_descriptor_view;
+
+	libfwnt_internal_access_token_t *internal_access_token = NULL;
+	static char *function                                  = "libfwnt_access_token_get_granted_access_mask";
+	uint16_t control_flags                                 = 0;
+	int result                                             = 0;
+
+	if( access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_token = (libfwnt_internal_access_token_t *) access_token;
+
+	if( granted_access_mask == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid granted access mask.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_descriptor_view_set_from_byte_stream(
+	     &security_descriptor_view,
+	     byte_stream,
+	     byte_stream_size,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_descriptor_view_get_control_flags(
+	     &security_descriptor_view,
+	     &control_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve control flags.",
+		 function );
+
+		return( -1 );
+	}
+	/* SE_DACL_PRESENT */
+	if( ( control_flags & 0x0004 ) == 0 )
+	{
+		*granted_access_mask = LIBFWNT_ACCESS_TOKEN_FULL_ACCESS_MASK;
+
+		return( 1 );
+	}
+	result = libfwnt_security_descriptor_view_get_discretionary_acl(
+	          &security_descriptor_view,
+	          &access_control_list_view,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve discretionary access control list.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*granted_access_mask = LIBFWNT_ACCESS_TOKEN_FULL_ACCESS_MASK;
+
+		return( 1 );
+	}
+	if( libfwnt_internal_access_token_evaluate_access_control_list(
+	     internal_access_token,
+	     access_control_list_view.data,
+	     access_control_list_view.data_size,
+	     granted_access_mask,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to evaluate discretionary access control list.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the access masks that multiple security descriptors grant to the access token
+ * The access token is compiled once and reused for every security descriptor,
+ * the granted access mask of byte stream N is stored in granted_access_masks[ N ]
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_token_get_granted_access_masks(
+     libfwnt_access_token_t *access_token,
+     const uint8_t **byte_streams,
+     const size_t *byte_stream_sizes,
+     int number_of_byte_streams,
+     int byte_order,
+     uint32_t *granted_access_masks,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfwnt_access_token_get_granted_access_masks";
+	int byte_stream_index   = 0;
+
+	if( access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_streams == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte streams.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_byte_streams < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of byte streams value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( granted_access_masks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid granted access masks.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_stream_index = 0;
+	     byte_stream_index < number_of_byte_streams;
+	     byte_stream_index++ )
+	{
+		if( libfwnt_access_token_get_granted_access_mask(
+		     access_token,
+		     byte_streams[ byte_stream_index ],
+		     byte_stream_sizes[ byte_stream_index ],
+		     byte_order,
+		     &( granted_access_masks[ byte_stream_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve granted access mask of byte stream: %d.",
+			 function,
+			 byte_stream_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,156 @@
+/*
+ * Windows NT access token functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_ACCESS_TOKEN_H )
+#define _LIBFWNT_ACCESS_TOKEN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The access token is the set of security identifiers (SIDs) of a user and
+ * its groups, compiled into an open addressing hash table of the binary form
+ * of the SIDs, so that the SID of an access control entry (ACE) can be looked
+ * up directly in the security descriptor data without parsing it
+ */
+
+/* The maximum size of the binary form of a SID
+ * 8 bytes header and 15 32-bit sub authorities
+ */
+#define LIBFWNT_ACCESS_TOKEN_MAXIMUM_SECURITY_IDENTIFIER_SIZE	68
+
+/* The access mask granted by a security descriptor without a discretionary
+ * access control list, which are all the standard and specific access rights
+ */
+#define LIBFWNT_ACCESS_TOKEN_FULL_ACCESS_MASK			0x001fffffUL
+
+typedef struct libfwnt_access_token_entry libfwnt_access_token_entry_t;
+
+struct libfwnt_access_token_entry
+{
+	/* The hash of the security identifier data
+	 */
+	uint32_t hash;
+
+	/* The security identifier data size, 0 if the entry is not used
+	 */
+	size_t data_size;
+
+	/* The security identifier data
+	 */
+	uint8_t data[ LIBFWNT_ACCESS_TOKEN_MAXIMUM_SECURITY_IDENTIFIER_SIZE ];
+};
+
+typedef struct libfwnt_internal_access_token libfwnt_internal_access_token_t;
+
+struct libfwnt_internal_access_token
+{
+	/* The entries, which is the hash table
+	 */
+	libfwnt_access_token_entry_t *entries;
+
+	/* The number of entries, which is a power of 2
+	 */
+	uint32_t number_of_entries;
+
+	/* The number of security identifiers
+	 */
+	int number_of_security_identifiers;
+};
+
+LIBFWNT_EXTERN \
+int libfwnt_access_token_initialize(
+     libfwnt_access_token_t **access_token,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_token_free(
+     libfwnt_access_token_t **access_token,
+     libcerror_error_t **error );
+
+int libfwnt_internal_access_token_insert_entry(
+     libfwnt_internal_access_token_t *internal_access_token,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfwnt_internal_access_token_has_security_identifier(
+     libfwnt_internal_access_token_t *internal_access_token,
+     const uint8_t *data,
+     size_t data_size );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_token_append_security_identifier(
+     libfwnt_access_token_t *access_token,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_token_get_number_of_security_identifiers(
+     libfwnt_access_token_t *access_token,
+     int *number_of_security_identifiers,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_token_has_security_identifier(
+     libfwnt_access_token_t *access_token,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error );
+
+int libfwnt_internal_access_token_evaluate_access_control_list(
+     libfwnt_internal_access_token_t *internal_access_token,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *granted_access_mask,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_token_get_granted_access_mask(
+     libfwnt_access_token_t *access_token,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     uint32_t *granted_access_mask,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_token_get_granted_access_masks(
+     libfwnt_access_token_t *access_token,
+     const uint8_t **byte_streams,
+     const size_t *byte_stream_sizes,
+     int number_of_byte_streams,
+     int byte_order,
+     uint32_t *granted_access_masks,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_ACCESS_TOKEN_H ) */
+
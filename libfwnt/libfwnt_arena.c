@@ -0,0 +1,402 @@
+/*
+ * Arena (bump) allocator functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_arena.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+/* Creates an arena
+ * Make sure the value arena is referencing, is set to NULL
+ * The block size is the size of the blocks the arena allocates its memory in,
+ * where 0 represents the default block size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_arena_initialize(
+     libfwnt_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_arena_t *internal_arena = NULL;
+	static char *function                    = "libfwnt_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == 0 )
+	{
+		block_size = LIBFWNT_ARENA_DEFAULT_BLOCK_SIZE;
+	}
+	if( block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid block size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_arena = memory_allocate_structure(
+	                  libfwnt_internal_arena_t );
+
+	if( internal_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_arena,
+	     0,
+	     sizeof( libfwnt_internal_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		goto on_error;
+	}
+	internal_arena->block_size = block_size;
+
+	*arena = (libfwnt_arena_t *) internal_arena;
+
+	return( 1 );
+
+on_error:
+	if( internal_arena != NULL )
+	{
+		memory_free(
+		 internal_arena );
+	}
+	return( -1 );
+}
+
+/* Frees an arena
+ * All memory allocated from the arena is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_arena_free(
+     libfwnt_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libfwnt_arena_block_t *arena_block       = NULL;
+	libfwnt_arena_block_t *next_arena_block  = NULL;
+	libfwnt_internal_arena_t *internal_arena = NULL;
+	static char *function                    = "libfwnt_arena_free";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		internal_arena = (libfwnt_internal_arena_t *) *arena;
+		*arena         = NULL;
+
+		arena_block = internal_arena->first_block;
+
+		while( arena_block != NULL )
+		{
+			next_arena_block = arena_block->next_block;
+
+			memory_free(
+			 arena_block->data );
+
+			memory_free(
+			 arena_block );
+
+			arena_block = next_arena_block;
+		}
+		memory_free(
+		 internal_arena );
+	}
+	return( 1 );
+}
+
+/* Resets an arena
+ * All memory allocated from the arena is released at once, the blocks of
+ * the arena are retained and reused by subsequent allocations
+ * Objects that were allocated from the arena must no longer be used
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_arena_reset(
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error )
+{
+	libfwnt_arena_block_t *arena_block       = NULL;
+	libfwnt_internal_arena_t *internal_arena = NULL;
+	static char *function                    = "libfwnt_arena_reset";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_arena = (libfwnt_internal_arena_t *) arena;
+
+	for( arena_block = internal_arena->first_block;
+	     arena_block != NULL;
+	     arena_block = arena_block->next_block )
+	{
+		arena_block->data_offset = 0;
+	}
+	internal_arena->current_block  = internal_arena->first_block;
+	internal_arena->allocated_size = 0;
+
+	return( 1 );
+}
+
+/* Allocates memory from an arena
+ * The memory is aligned to LIBFWNT_ARENA_ALIGNMENT and cleared, it is released
+ * when the arena is reset or freed and must not be freed individually
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_arena_allocate(
+     libfwnt_arena_t *arena,
+     size_t size,
+     void **data,
+     libcerror_error_t **error )
+{
+	libfwnt_arena_block_t *arena_block       = NULL;
+	libfwnt_internal_arena_t *internal_arena = NULL;
+	static char *function                    = "libfwnt_arena_allocate";
+	size_t block_size                        = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_arena = (libfwnt_internal_arena_t *) arena;
+
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	size = ( size + ( LIBFWNT_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBFWNT_ARENA_ALIGNMENT - 1 );
+
+	arena_block = internal_arena->current_block;
+
+	/* Continue with the next retained block if the current block is full
+	 */
+	if( ( arena_block != NULL )
+	 && ( size > ( arena_block->data_size - arena_block->data_offset ) ) )
+	{
+		arena_block = arena_block->next_block;
+
+		if( ( arena_block != NULL )
+		 && ( size > arena_block->data_size ) )
+		{
+			arena_block = NULL;
+		}
+	}
+	if( arena_block == NULL )
+	{
+		block_size = internal_arena->block_size;
+
+		if( size > block_size )
+		{
+			block_size = size;
+		}
+		arena_block = memory_allocate_structure(
+		               libfwnt_arena_block_t );
+
+		if( arena_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create arena block.",
+			 function );
+
+			return( -1 );
+		}
+		arena_block->data = (uint8_t *) memory_allocate(
+		                                 sizeof( uint8_t ) * block_size );
+
+		if( arena_block->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create arena block data.",
+			 function );
+
+			memory_free(
+			 arena_block );
+
+			return( -1 );
+		}
+		arena_block->data_size   = block_size;
+		arena_block->data_offset = 0;
+
+		/* Insert the block after the current block so that retained blocks are reused
+		 */
+		if( internal_arena->current_block == NULL )
+		{
+			arena_block->next_block     = internal_arena->first_block;
+			internal_arena->first_block = arena_block;
+		}
+		else
+		{
+			arena_block->next_block                   = internal_arena->current_block->next_block;
+			internal_arena->current_block->next_block = arena_block;
+		}
+	}
+	internal_arena->current_block = arena_block;
+
+	*data = &( arena_block->data[ arena_block->data_offset ] );
+
+	arena_block->data_offset += size;
+
+	if( memory_set(
+	     *data,
+	     0,
+	     size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		*data = NULL;
+
+		return( -1 );
+	}
+	internal_arena->allocated_size += size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the memory allocated from an arena since it was created or last reset
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_arena_get_allocated_size(
+     libfwnt_arena_t *arena,
+     size_t *allocated_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_arena_t *internal_arena = NULL;
+	static char *function                    = "libfwnt_arena_get_allocated_size";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_arena = (libfwnt_internal_arena_t *) arena;
+
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	*allocated_size = internal_arena->allocated_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,119 @@
+/*
+ * Arena (bump) allocator functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_ARENA_H )
+#define _LIBFWNT_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default size of an arena block
+ */
+#define LIBFWNT_ARENA_DEFAULT_BLOCK_SIZE	65536
+
+/* The alignment of an arena allocation
+ */
+#define LIBFWNT_ARENA_ALIGNMENT			16
+
+typedef struct libfwnt_arena_block libfwnt_arena_block_t;
+
+struct libfwnt_arena_block
+{
+	/* The next block
+	 */
+	libfwnt_arena_block_t *next_block;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The data offset of the next allocation
+	 */
+	size_t data_offset;
+};
+
+typedef struct libfwnt_internal_arena libfwnt_internal_arena_t;
+
+struct libfwnt_internal_arena
+{
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The first block
+	 */
+	libfwnt_arena_block_t *first_block;
+
+	/* The current block
+	 */
+	libfwnt_arena_block_t *current_block;
+
+	/* The allocated size
+	 */
+	size_t allocated_size;
+};
+
+LIBFWNT_EXTERN \
+int libfwnt_arena_initialize(
+     libfwnt_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_arena_free(
+     libfwnt_arena_t **arena,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_arena_reset(
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error );
+
+int libfwnt_arena_allocate(
+     libfwnt_arena_t *arena,
+     size_t size,
+     void **data,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_arena_get_allocated_size(
+     libfwnt_arena_t *arena,
+     size_t *allocated_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_ARENA_H ) */
+
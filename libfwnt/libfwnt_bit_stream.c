@@ -19,6 +19,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <memory.h>
 #include <types.h>
@@ -157,6 +158,7 @@ int libfwnt_bit_stream_free(
 }
 
 /* Reads bits from the underlying byte stream
+ * The bit buffer is filled 16-bit at a time until it contains at least number of bits
  * Returns 1 on success or -1 on error
  */
 int libfwnt_bit_stream_read(
@@ -178,7 +180,7 @@ int libfwnt_bit_stream_read(
 		return( -1 );
 	}
 	if( ( number_of_bits == 0 )
-	 || ( number_of_bits > 32 ) )
+	 || ( number_of_bits > 48 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -213,6 +215,72 @@ int libfwnt_bit_stream_read(
 	return( 1 );
 }
 
+/* Refills the bit buffer so that it contains at least 48 bits
+ * If sufficient data remains in the byte stream the bit buffer is refilled
+ * with a single 64-bit read, otherwise the tail of the byte stream is read
+ * 16-bit at a time
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_bit_stream_refill(
+     libfwnt_bit_stream_t *bit_stream,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfwnt_bit_stream_refill";
+	uint64_t value_64bit    = 0;
+	uint8_t number_of_words = 0;
+
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) >= LIBFWNT_BIT_STREAM_FAST_REFILL_SIZE )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+		 value_64bit );
+
+		/* Determine how many 16-bit values fit in the bit buffer without exceeding 63 bits
+		 */
+		number_of_words = ( 63 - bit_stream->bit_buffer_size ) >> 4;
+
+		/* Reorder the first 3 little-endian 16-bit values so that the first value is stored in the most significant bits
+		 */
+		value_64bit = ( ( value_64bit & 0x000000000000ffffULL ) << 32 )
+		            | ( value_64bit & 0x00000000ffff0000ULL )
+		            | ( ( value_64bit >> 32 ) & 0x000000000000ffffULL );
+
+		bit_stream->bit_buffer        <<= 16 * number_of_words;
+		bit_stream->bit_buffer         |= value_64bit >> ( 16 * ( 3 - number_of_words ) );
+		bit_stream->bit_buffer_size    += 16 * number_of_words;
+		bit_stream->byte_stream_offset += 2 * number_of_words;
+	}
+	else if( bit_stream->bit_buffer_size < 48 )
+	{
+		if( libfwnt_bit_stream_read(
+		     bit_stream,
+		     48,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read bits.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
 /* Retrieves a value from the bit stream
  * Returns 1 on success or -1 on error
  */
@@ -222,9 +290,7 @@ int libfwnt_bit_stream_get_value(
      uint32_t *value_32bit,
      libcerror_error_t **error )
 {
-	static char *function             = "libfwnt_bit_stream_get_value";
-	uint32_t safe_value_32bit         = 0;
-	uint8_t remaining_bit_buffer_size = 0;
+	static char *function = "libfwnt_bit_stream_get_value";
 
 	if( bit_stream == NULL )
 	{
@@ -282,26 +348,13 @@ int libfwnt_bit_stream_get_value(
 			return( -1 );
 		}
 	}
-	safe_value_32bit = bit_stream->bit_buffer;
+	*value_32bit = libfwnt_bit_stream_peek_value(
+	                bit_stream,
+	                number_of_bits );
 
-	if( number_of_bits < 32 )
-	{
-		safe_value_32bit >>= bit_stream->bit_buffer_size - number_of_bits;
-	}
-	bit_stream->bit_buffer_size -= number_of_bits;
-
-	/* The behavior of "bit_buffer & ( 0xfffffffUL >> 32 )" differs for some compilers.
-	 */
-	if( bit_stream->bit_buffer_size == 0 )
-	{
-		bit_stream->bit_buffer = 0;
-	}
-	else
-	{
-		remaining_bit_buffer_size = 32 - bit_stream->bit_buffer_size;
-		bit_stream->bit_buffer   &= 0xffffffffUL >> remaining_bit_buffer_size;
-	}
-	*value_32bit = safe_value_32bit;
+	libfwnt_bit_stream_consume_bits(
+	 bit_stream,
+	 number_of_bits );
 
 	return( 1 );
 }
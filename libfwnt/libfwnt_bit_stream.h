@@ -31,6 +31,31 @@
 extern "C" {
 #endif
 
+/* The number of bytes that must remain in the byte stream to refill the bit buffer
+ * with a single 64-bit read
+ */
+#define LIBFWNT_BIT_STREAM_FAST_REFILL_SIZE	8
+
+/* Retrieves a value from the bit buffer without consuming the bits
+ * The bit buffer must contain at least number of bits and number of bits
+ * must be 32 or less. This macro has no error checking and is intended
+ * for use after libfwnt_bit_stream_refill
+ */
+#define libfwnt_bit_stream_peek_value( bit_stream, number_of_bits ) \
+	(uint32_t) ( ( ( bit_stream )->bit_buffer >> ( ( bit_stream )->bit_buffer_size - ( number_of_bits ) ) ) \
+	           & ( ( (uint64_t) 1 << ( number_of_bits ) ) - 1 ) )
+
+/* Consumes bits from the bit buffer
+ * The bit buffer must contain at least number of bits
+ */
+#define libfwnt_bit_stream_consume_bits( bit_stream, number_of_bits ) \
+	do \
+	{ \
+		( bit_stream )->bit_buffer_size -= ( number_of_bits ); \
+		( bit_stream )->bit_buffer      &= ( (uint64_t) 1 << ( bit_stream )->bit_buffer_size ) - 1; \
+	} \
+	while( 0 )
+
 typedef struct libfwnt_bit_stream libfwnt_bit_stream_t;
 
 struct libfwnt_bit_stream
@@ -49,7 +74,7 @@ struct libfwnt_bit_stream
 
 	/* The bit buffer
 	 */
-	uint32_t bit_buffer;
+	uint64_t bit_buffer;
 
 	/* The number of bits in the bit buffer
 	 */
@@ -71,6 +96,10 @@ int libfwnt_bit_stream_read(
      uint8_t number_of_bits,
      libcerror_error_t **error );
 
+int libfwnt_bit_stream_refill(
+     libfwnt_bit_stream_t *bit_stream,
+     libcerror_error_t **error );
+
 int libfwnt_bit_stream_get_value(
      libfwnt_bit_stream_t *bit_stream,
      uint8_t number_of_bits,
@@ -0,0 +1,326 @@
+/*
+ * Call (0xe8) instruction translation functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <types.h>
+
+#if defined( _MSC_VER )
+#include <intrin.h>
+#endif
+
+#include "libfwnt_call_instruction.h"
+#include "libfwnt_cpu.h"
+
+#if defined( LIBFWNT_CPU_HAVE_SSE2 ) || defined( LIBFWNT_CPU_HAVE_AVX2 )
+#include <immintrin.h>
+#endif
+
+#if defined( LIBFWNT_CPU_HAVE_NEON )
+#include <arm_neon.h>
+#endif
+
+#if defined( LIBFWNT_CPU_HAVE_SSE2 ) || defined( LIBFWNT_CPU_HAVE_AVX2 ) || defined( LIBFWNT_CPU_HAVE_NEON )
+
+/* Determines the index of the least significant bit that is set in a non-zero value
+ */
+#if defined( _MSC_VER )
+static size_t libfwnt_call_instruction_get_first_bit_index(
+               uint64_t value )
+{
+	unsigned long bit_index = 0;
+
+#if defined( _M_X64 ) || defined( _M_ARM64 )
+	_BitScanForward64(
+	 &bit_index,
+	 value );
+#else
+	if( _BitScanForward(
+	     &bit_index,
+	     (unsigned long) value ) == 0 )
+	{
+		_BitScanForward(
+		 &bit_index,
+		 (unsigned long) ( value >> 32 ) );
+
+		bit_index += 32;
+	}
+#endif
+	return( (size_t) bit_index );
+}
+
+#else
+#define libfwnt_call_instruction_get_first_bit_index( value ) \
+	(size_t) __builtin_ctzll( value )
+
+#endif
+
+#endif /* defined( LIBFWNT_CPU_HAVE_SSE2 ) || defined( LIBFWNT_CPU_HAVE_AVX2 ) || defined( LIBFWNT_CPU_HAVE_NEON ) */
+
+/* The call instruction scan function of the active kernel variant
+ */
+size_t (*libfwnt_call_instruction_scan)(
+        const uint8_t *data,
+        size_t data_size ) = &libfwnt_call_instruction_scan_resolve;
+
+/* Selects the call instruction scan function of the active kernel variant and scans the data
+ * This function is only used if the scan is used before the CPU features were detected
+ */
+size_t libfwnt_call_instruction_scan_resolve(
+        const uint8_t *data,
+        size_t data_size )
+{
+	libfwnt_cpu_initialize();
+
+	return( libfwnt_call_instruction_scan(
+	         data,
+	         data_size ) );
+}
+
+/* Scans the data for a call (0xe8) instruction opcode
+ * Returns the index of the first 0xe8 byte or the data size if there is none
+ */
+size_t libfwnt_call_instruction_scan_scalar(
+        const uint8_t *data,
+        size_t data_size )
+{
+	size_t data_offset = 0;
+
+	if( data == NULL )
+	{
+		return( data_size );
+	}
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		if( data[ data_offset ] == 0xe8 )
+		{
+			break;
+		}
+	}
+	return( data_offset );
+}
+
+#if defined( LIBFWNT_CPU_HAVE_SSE2 )
+
+/* Scans the data for a call (0xe8) instruction opcode using SSE2 instructions
+ * The data is compared 16 bytes at a time and the index is determined from the byte mask
+ * Returns the index of the first 0xe8 byte or the data size if there is none
+ */
+LIBFWNT_CPU_TARGET( "sse2" ) \
+size_t libfwnt_call_instruction_scan_sse2(
+        const uint8_t *data,
+        size_t data_size )
+{
+	__m128i opcode_vector = _mm_set1_epi8( (char) 0xe8 );
+	size_t data_offset    = 0;
+	uint32_t match_mask   = 0;
+
+	if( data == NULL )
+	{
+		return( data_size );
+	}
+	while( ( data_size - data_offset ) >= 16 )
+	{
+		match_mask = (uint32_t) _mm_movemask_epi8(
+		                         _mm_cmpeq_epi8(
+		                          _mm_loadu_si128(
+		                           (const __m128i *) &( data[ data_offset ] ) ),
+		                          opcode_vector ) );
+
+		if( match_mask != 0 )
+		{
+			return( data_offset + libfwnt_call_instruction_get_first_bit_index(
+			                       (uint64_t) match_mask ) );
+		}
+		data_offset += 16;
+	}
+	return( data_offset + libfwnt_call_instruction_scan_scalar(
+	                       &( data[ data_offset ] ),
+	                       data_size - data_offset ) );
+}
+
+#endif /* defined( LIBFWNT_CPU_HAVE_SSE2 ) */
+
+#if defined( LIBFWNT_CPU_HAVE_AVX2 )
+
+/* Scans the data for a call (0xe8) instruction opcode using AVX2 instructions
+ * The data is compared 32 bytes at a time and the index is determined from the byte mask
+ * Returns the index of the first 0xe8 byte or the data size if there is none
+ */
+LIBFWNT_CPU_TARGET( "avx2" ) \
+size_t libfwnt_call_instruction_scan_avx2(
+        const uint8_t *data,
+        size_t data_size )
+{
+	__m256i opcode_vector = _mm256_set1_epi8( (char) 0xe8 );
+	size_t data_offset    = 0;
+	uint32_t match_mask   = 0;
+
+	if( data == NULL )
+	{
+		return( data_size );
+	}
+	while( ( data_size - data_offset ) >= 32 )
+	{
+		match_mask = (uint32_t) _mm256_movemask_epi8(
+		                         _mm256_cmpeq_epi8(
+		                          _mm256_loadu_si256(
+		                           (const __m256i *) &( data[ data_offset ] ) ),
+		                          opcode_vector ) );
+
+		if( match_mask != 0 )
+		{
+			return( data_offset + libfwnt_call_instruction_get_first_bit_index(
+			                       (uint64_t) match_mask ) );
+		}
+		data_offset += 32;
+	}
+	return( data_offset + libfwnt_call_instruction_scan_sse2(
+	                       &( data[ data_offset ] ),
+	                       data_size - data_offset ) );
+}
+
+#endif /* defined( LIBFWNT_CPU_HAVE_AVX2 ) */
+
+#if defined( LIBFWNT_CPU_HAVE_NEON )
+
+/* Scans the data for a call (0xe8) instruction opcode using NEON instructions
+ * NEON has no byte mask instruction, hence the index is determined from the
+ * 64-bit halves of the comparison result
+ * Returns the index of the first 0xe8 byte or the data size if there is none
+ */
+size_t libfwnt_call_instruction_scan_neon(
+        const uint8_t *data,
+        size_t data_size )
+{
+	uint8x16_t opcode_vector = vdupq_n_u8( 0xe8 );
+	uint64x2_t match_vector;
+
+	size_t data_offset       = 0;
+	uint64_t match_mask      = 0;
+
+	if( data == NULL )
+	{
+		return( data_size );
+	}
+	while( ( data_size - data_offset ) >= 16 )
+	{
+		match_vector = vreinterpretq_u64_u8(
+		                vceqq_u8(
+		                 vld1q_u8(
+		                  &( data[ data_offset ] ) ),
+		                 opcode_vector ) );
+
+		match_mask = vgetq_lane_u64(
+		              match_vector,
+		              0 );
+
+		if( match_mask != 0 )
+		{
+			return( data_offset + ( libfwnt_call_instruction_get_first_bit_index(
+			                         match_mask ) / 8 ) );
+		}
+		match_mask = vgetq_lane_u64(
+		              match_vector,
+		              1 );
+
+		if( match_mask != 0 )
+		{
+			return( data_offset + 8 + ( libfwnt_call_instruction_get_first_bit_index(
+			                             match_mask ) / 8 ) );
+		}
+		data_offset += 16;
+	}
+	return( data_offset + libfwnt_call_instruction_scan_scalar(
+	                       &( data[ data_offset ] ),
+	                       data_size - data_offset ) );
+}
+
+#endif /* defined( LIBFWNT_CPU_HAVE_NEON ) */
+
+/* Translates the absolute address of a call (0xe8) instruction into a relative address
+ * The instruction offset is the offset of the 0xe8 byte relative to the start of the data
+ * Returns the translated address
+ */
+uint32_t libfwnt_call_instruction_translate_address(
+          uint32_t address,
+          size_t instruction_offset )
+{
+	if( address > (uint32_t) INT32_MAX )
+	{
+		if( (int32_t) address > ( -1 * (int32_t) instruction_offset ) )
+		{
+			address = (uint32_t) ( (int32_t) address + LIBFWNT_CALL_INSTRUCTION_TRANSLATION_SIZE );
+		}
+	}
+	else if( address < LIBFWNT_CALL_INSTRUCTION_TRANSLATION_SIZE )
+	{
+		address = (uint32_t) ( (int32_t) address - instruction_offset );
+	}
+	return( address );
+}
+
+/* Translates the addresses of the call (0xe8) instructions in the data
+ * A 0xe8 byte from the data offset up to the data end offset is translated,
+ * the 4 bytes of its address are skipped. The caller must ensure the data
+ * contains at least 4 bytes after the data end offset
+ * Returns the data offset after the last translated address or the data end offset
+ */
+size_t libfwnt_call_instruction_translate(
+        uint8_t *data,
+        size_t data_offset,
+        size_t data_end_offset )
+{
+	uint32_t address = 0;
+
+	if( data == NULL )
+	{
+		return( data_end_offset );
+	}
+	while( data_offset < data_end_offset )
+	{
+		data_offset += libfwnt_call_instruction_scan(
+		                &( data[ data_offset ] ),
+		                data_end_offset - data_offset );
+
+		if( data_offset >= data_end_offset )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset + 1 ] ),
+		 address );
+
+		address = libfwnt_call_instruction_translate_address(
+		           address,
+		           data_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( data[ data_offset + 1 ] ),
+		 address );
+
+		data_offset += 5;
+	}
+	return( data_offset );
+}
+
@@ -0,0 +1,95 @@
+/*
+ * Call (0xe8) instruction translation functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_CALL_INSTRUCTION_H )
+#define _LIBFWNT_CALL_INSTRUCTION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_cpu.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the translation, which is fixed for LZX compressed data
+ */
+#define LIBFWNT_CALL_INSTRUCTION_TRANSLATION_SIZE	12000000
+
+/* The minimum size of the data of which call instructions are translated,
+ * call instructions in smaller data are not translated
+ */
+#define LIBFWNT_CALL_INSTRUCTION_MINIMUM_DATA_SIZE	10
+
+/* The call instruction scan function of the active kernel variant
+ */
+extern size_t (*libfwnt_call_instruction_scan)(
+               const uint8_t *data,
+               size_t data_size );
+
+size_t libfwnt_call_instruction_scan_resolve(
+        const uint8_t *data,
+        size_t data_size );
+
+size_t libfwnt_call_instruction_scan_scalar(
+        const uint8_t *data,
+        size_t data_size );
+
+#if defined( LIBFWNT_CPU_HAVE_SSE2 )
+
+size_t libfwnt_call_instruction_scan_sse2(
+        const uint8_t *data,
+        size_t data_size );
+
+#endif /* defined( LIBFWNT_CPU_HAVE_SSE2 ) */
+
+#if defined( LIBFWNT_CPU_HAVE_AVX2 )
+
+size_t libfwnt_call_instruction_scan_avx2(
+        const uint8_t *data,
+        size_t data_size );
+
+#endif /* defined( LIBFWNT_CPU_HAVE_AVX2 ) */
+
+#if defined( LIBFWNT_CPU_HAVE_NEON )
+
+size_t libfwnt_call_instruction_scan_neon(
+        const uint8_t *data,
+        size_t data_size );
+
+#endif /* defined( LIBFWNT_CPU_HAVE_NEON ) */
+
+uint32_t libfwnt_call_instruction_translate_address(
+          uint32_t address,
+          size_t instruction_offset );
+
+size_t libfwnt_call_instruction_translate(
+        uint8_t *data,
+        size_t data_offset,
+        size_t data_end_offset );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_CALL_INSTRUCTION_H ) */
+
@@ -0,0 +1,386 @@
+/*
+ * CPU feature detection and kernel dispatch functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#include <intrin.h>
+#include <immintrin.h>
+
+#elif ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <cpuid.h>
+
+#endif
+
+#include "libfwnt_call_instruction.h"
+#include "libfwnt_cpu.h"
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_match_copy.h"
+
+/* Value to indicate the CPU features were detected
+ */
+static int libfwnt_cpu_is_initialized = 0;
+
+/* The detected CPU features
+ */
+static uint32_t libfwnt_cpu_features = 0;
+
+/* The active kernel variant
+ */
+static int libfwnt_cpu_kernel_variant = LIBFWNT_KERNEL_VARIANT_AUTOMATIC;
+
+/* Detects the CPU features and selects the kernel variant
+ * This function is called when the library is loaded, if supported by the compiler,
+ * and otherwise before the kernel variant is first retrieved or set
+ */
+#if defined( __GNUC__ ) || defined( __clang__ )
+__attribute__ (( constructor ))
+#endif
+void libfwnt_cpu_initialize(
+      void )
+{
+	if( libfwnt_cpu_is_initialized == 0 )
+	{
+		libfwnt_cpu_features = libfwnt_cpu_detect_features();
+
+		libfwnt_cpu_select_kernel_variant(
+		 LIBFWNT_KERNEL_VARIANT_AUTOMATIC );
+
+		libfwnt_cpu_is_initialized = 1;
+	}
+}
+
+/* Detects the features of the CPU
+ * The AVX2 and AVX-512 features are only reported when the operating system
+ * preserves the corresponding registers
+ * Returns the CPU features
+ */
+uint32_t libfwnt_cpu_detect_features(
+          void )
+{
+#if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+	int cpuid_registers[ 4 ];
+
+	uint64_t extended_control_register = 0;
+	int maximum_leaf                   = 0;
+#elif ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+	unsigned int cpuid_registers[ 4 ];
+
+	uint32_t extended_control_register_lower = 0;
+	uint32_t extended_control_register_upper = 0;
+	uint64_t extended_control_register       = 0;
+	unsigned int maximum_leaf                = 0;
+#endif
+	uint32_t cpu_features = 0;
+
+#if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+	__cpuid(
+	 cpuid_registers,
+	 0 );
+
+	maximum_leaf = cpuid_registers[ 0 ];
+
+	if( maximum_leaf >= 1 )
+	{
+		__cpuid(
+		 cpuid_registers,
+		 1 );
+
+		if( ( cpuid_registers[ 3 ] & 0x04000000UL ) != 0 )
+		{
+			cpu_features |= LIBFWNT_CPU_FEATURE_SSE2;
+		}
+		/* Check for OSXSAVE and AVX
+		 */
+		if( ( cpuid_registers[ 2 ] & 0x18000000UL ) == 0x18000000UL )
+		{
+			extended_control_register = (uint64_t) _xgetbv(
+			                                        0 );
+		}
+	}
+	if( maximum_leaf >= 7 )
+	{
+		__cpuidex(
+		 cpuid_registers,
+		 7,
+		 0 );
+	}
+	else
+	{
+		cpuid_registers[ 1 ] = 0;
+	}
+#elif ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+	maximum_leaf = __get_cpuid_max(
+	                0,
+	                NULL );
+
+	if( maximum_leaf >= 1 )
+	{
+		__cpuid(
+		 1,
+		 cpuid_registers[ 0 ],
+		 cpuid_registers[ 1 ],
+		 cpuid_registers[ 2 ],
+		 cpuid_registers[ 3 ] );
+
+		if( ( cpuid_registers[ 3 ] & 0x04000000UL ) != 0 )
+		{
+			cpu_features |= LIBFWNT_CPU_FEATURE_SSE2;
+		}
+		/* Check for OSXSAVE and AVX
+		 */
+		if( ( cpuid_registers[ 2 ] & 0x18000000UL ) == 0x18000000UL )
+		{
+			__asm__ __volatile__ (
+			 "xgetbv"
+			 : "=a" ( extended_control_register_lower ),
+			   "=d" ( extended_control_register_upper )
+			 : "c" ( 0 ) );
+
+			extended_control_register = ( (uint64_t) extended_control_register_upper << 32 )
+			                          | extended_control_register_lower;
+		}
+	}
+	if( maximum_leaf >= 7 )
+	{
+		__cpuid_count(
+		 7,
+		 0,
+		 cpuid_registers[ 0 ],
+		 cpuid_registers[ 1 ],
+		 cpuid_registers[ 2 ],
+		 cpuid_registers[ 3 ] );
+	}
+	else
+	{
+		cpuid_registers[ 1 ] = 0;
+	}
+#endif
+#if ( defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) ) ) || ( ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) ) )
+	/* The operating system must preserve the XMM and YMM registers for AVX2
+	 * and additionally the opmask and ZMM registers for AVX-512
+	 */
+	if( ( extended_control_register & 0x06 ) == 0x06 )
+	{
+		if( ( cpuid_registers[ 1 ] & 0x00000020UL ) != 0 )
+		{
+			cpu_features |= LIBFWNT_CPU_FEATURE_AVX2;
+		}
+		/* Check for AVX-512 foundation and byte and word instructions
+		 */
+		if( ( ( extended_control_register & 0xe6 ) == 0xe6 )
+		 && ( ( cpuid_registers[ 1 ] & 0x40010000UL ) == 0x40010000UL ) )
+		{
+			cpu_features |= LIBFWNT_CPU_FEATURE_AVX512;
+		}
+	}
+#endif
+#if defined( LIBFWNT_CPU_HAVE_NEON )
+	cpu_features |= LIBFWNT_CPU_FEATURE_NEON;
+#endif
+	return( cpu_features );
+}
+
+/* Selects the kernel variant
+ * The automatic kernel variant selects the fastest variant supported by the CPU
+ * Returns 1 if successful, 0 if the kernel variant is not supported or -1 on error
+ */
+int libfwnt_cpu_select_kernel_variant(
+     int kernel_variant )
+{
+	if( kernel_variant == LIBFWNT_KERNEL_VARIANT_AUTOMATIC )
+	{
+		if( libfwnt_cpu_select_kernel_variant(
+		     LIBFWNT_KERNEL_VARIANT_AVX2 ) == 1 )
+		{
+			return( 1 );
+		}
+		if( libfwnt_cpu_select_kernel_variant(
+		     LIBFWNT_KERNEL_VARIANT_SSE2 ) == 1 )
+		{
+			return( 1 );
+		}
+		if( libfwnt_cpu_select_kernel_variant(
+		     LIBFWNT_KERNEL_VARIANT_NEON ) == 1 )
+		{
+			return( 1 );
+		}
+		return( libfwnt_cpu_select_kernel_variant(
+		         LIBFWNT_KERNEL_VARIANT_SCALAR ) );
+	}
+	switch( kernel_variant )
+	{
+		case LIBFWNT_KERNEL_VARIANT_SCALAR:
+			libfwnt_call_instruction_scan = &libfwnt_call_instruction_scan_scalar;
+			libfwnt_match_copy            = &libfwnt_match_copy_scalar;
+			break;
+
+#if defined( LIBFWNT_CPU_HAVE_SSE2 )
+		case LIBFWNT_KERNEL_VARIANT_SSE2:
+			if( ( libfwnt_cpu_features & LIBFWNT_CPU_FEATURE_SSE2 ) == 0 )
+			{
+				return( 0 );
+			}
+			libfwnt_call_instruction_scan = &libfwnt_call_instruction_scan_sse2;
+			libfwnt_match_copy            = &libfwnt_match_copy_sse2;
+			break;
+#else
+		case LIBFWNT_KERNEL_VARIANT_SSE2:
+			return( 0 );
+#endif
+
+#if defined( LIBFWNT_CPU_HAVE_AVX2 )
+		case LIBFWNT_KERNEL_VARIANT_AVX2:
+			if( ( libfwnt_cpu_features & ( LIBFWNT_CPU_FEATURE_SSE2 | LIBFWNT_CPU_FEATURE_AVX2 ) ) != ( LIBFWNT_CPU_FEATURE_SSE2 | LIBFWNT_CPU_FEATURE_AVX2 ) )
+			{
+				return( 0 );
+			}
+			libfwnt_call_instruction_scan = &libfwnt_call_instruction_scan_avx2;
+			libfwnt_match_copy            = &libfwnt_match_copy_avx2;
+			break;
+#else
+		case LIBFWNT_KERNEL_VARIANT_AVX2:
+			return( 0 );
+#endif
+
+#if defined( LIBFWNT_CPU_HAVE_NEON )
+		case LIBFWNT_KERNEL_VARIANT_NEON:
+			if( ( libfwnt_cpu_features & LIBFWNT_CPU_FEATURE_NEON ) == 0 )
+			{
+				return( 0 );
+			}
+			libfwnt_call_instruction_scan = &libfwnt_call_instruction_scan_neon;
+			libfwnt_match_copy            = &libfwnt_match_copy_neon;
+			break;
+#else
+		case LIBFWNT_KERNEL_VARIANT_NEON:
+			return( 0 );
+#endif
+
+		default:
+			return( -1 );
+	}
+	libfwnt_cpu_kernel_variant = kernel_variant;
+
+	return( 1 );
+}
+
+/* Retrieves the features of the CPU as detected by the library
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_get_cpu_features(
+     uint32_t *cpu_features,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_get_cpu_features";
+
+	if( cpu_features == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CPU features.",
+		 function );
+
+		return( -1 );
+	}
+	libfwnt_cpu_initialize();
+
+	*cpu_features = libfwnt_cpu_features;
+
+	return( 1 );
+}
+
+/* Retrieves the active kernel variant
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_get_kernel_variant(
+     int *kernel_variant,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_get_kernel_variant";
+
+	if( kernel_variant == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid kernel variant.",
+		 function );
+
+		return( -1 );
+	}
+	libfwnt_cpu_initialize();
+
+	*kernel_variant = libfwnt_cpu_kernel_variant;
+
+	return( 1 );
+}
+
+/* Sets the active kernel variant
+ * The kernel variant must be supported by the CPU, where automatic selects
+ * the fastest supported variant
+ * This function is not thread-safe and should not be called while data is (de)compressed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_set_kernel_variant(
+     int kernel_variant,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_set_kernel_variant";
+	int result            = 0;
+
+	libfwnt_cpu_initialize();
+
+	result = libfwnt_cpu_select_kernel_variant(
+	          kernel_variant );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported kernel variant: %d.",
+		 function,
+		 kernel_variant );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: kernel variant: %d not supported by CPU.",
+		 function,
+		 kernel_variant );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
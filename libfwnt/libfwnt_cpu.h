@@ -0,0 +1,95 @@
+/*
+ * CPU feature detection and kernel dispatch functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_CPU_H )
+#define _LIBFWNT_CPU_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Determine the kernel variants that can be built
+ * The x86 variants are built with a function target attribute and are only
+ * used when the CPU supports them
+ */
+#if defined( __x86_64__ ) || defined( __i386__ ) || defined( _M_X64 ) || defined( _M_IX86 )
+#if defined( _MSC_VER )
+#define LIBFWNT_CPU_HAVE_SSE2
+
+#if _MSC_VER >= 1800
+#define LIBFWNT_CPU_HAVE_AVX2
+#endif
+
+#elif defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 9 ) ) ) )
+#define LIBFWNT_CPU_HAVE_SSE2
+#define LIBFWNT_CPU_HAVE_AVX2
+#endif
+#endif
+
+#if defined( __aarch64__ ) || defined( _M_ARM64 ) || defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#define LIBFWNT_CPU_HAVE_NEON
+#endif
+
+/* Marks a function to be compiled for a specific instruction set
+ */
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define LIBFWNT_CPU_TARGET( instruction_set ) \
+	__attribute__ (( target( instruction_set ) ))
+#else
+#define LIBFWNT_CPU_TARGET( instruction_set )
+#endif
+
+void libfwnt_cpu_initialize(
+      void );
+
+uint32_t libfwnt_cpu_detect_features(
+          void );
+
+int libfwnt_cpu_select_kernel_variant(
+     int kernel_variant );
+
+LIBFWNT_EXTERN \
+int libfwnt_get_cpu_features(
+     uint32_t *cpu_features,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_get_kernel_variant(
+     int *kernel_variant,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_set_kernel_variant(
+     int kernel_variant,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_CPU_H ) */
+
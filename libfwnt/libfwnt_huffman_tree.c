@@ -179,6 +179,48 @@ int libfwnt_huffman_tree_initialize(
 
 		goto on_error;
 	}
+	( *huffman_tree )->symbol_offsets = (int *) memory_allocate(
+	                                             array_size );
+
+	if( ( *huffman_tree )->symbol_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create symbol offsets.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( maximum_code_size > 0 )
+	 && ( maximum_code_size <= LIBFWNT_HUFFMAN_TREE_LOOKUP_MAXIMUM_CODE_SIZE ) )
+	{
+		if( maximum_code_size < LIBFWNT_HUFFMAN_TREE_LOOKUP_TABLE_BITS )
+		{
+			( *huffman_tree )->lookup_table_size = (size_t) 1 << maximum_code_size;
+		}
+		else
+		{
+			( *huffman_tree )->lookup_table_size = (size_t) 1 << LIBFWNT_HUFFMAN_TREE_LOOKUP_TABLE_BITS;
+		}
+		array_size = sizeof( uint32_t ) * ( *huffman_tree )->lookup_table_size;
+
+		( *huffman_tree )->lookup_table = (uint32_t *) memory_allocate(
+		                                                array_size );
+
+		if( ( *huffman_tree )->lookup_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create lookup table.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	( *huffman_tree )->maximum_code_size = maximum_code_size;
 
 	return( 1 );
@@ -186,6 +228,16 @@ int libfwnt_huffman_tree_initialize(
 on_error:
 	if( *huffman_tree != NULL )
 	{
+		if( ( *huffman_tree )->lookup_table != NULL )
+		{
+			memory_free(
+			 ( *huffman_tree )->lookup_table );
+		}
+		if( ( *huffman_tree )->symbol_offsets != NULL )
+		{
+			memory_free(
+			 ( *huffman_tree )->symbol_offsets );
+		}
 		if( ( *huffman_tree )->code_size_counts != NULL )
 		{
 			memory_free(
@@ -226,6 +278,16 @@ int libfwnt_huffman_tree_free(
 	}
 	if( *huffman_tree != NULL )
 	{
+		if( ( *huffman_tree )->lookup_table != NULL )
+		{
+			memory_free(
+			 ( *huffman_tree )->lookup_table );
+		}
+		if( ( *huffman_tree )->symbol_offsets != NULL )
+		{
+			memory_free(
+			 ( *huffman_tree )->symbol_offsets );
+		}
 		if( ( *huffman_tree )->code_size_counts != NULL )
 		{
 			memory_free(
@@ -295,6 +357,8 @@ int libfwnt_huffman_tree_build(
 
 		return( -1 );
 	}
+	huffman_tree->lookup_table_bits = 0;
+
 	/* Determine the code size frequencies
 	 */
 	array_size = sizeof( int ) * ( huffman_tree->maximum_code_size + 1 );
@@ -311,7 +375,7 @@ int libfwnt_huffman_tree_build(
 		 "%s: unable to clear code size counts.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	for( symbol = 0;
 	     symbol < number_of_code_sizes;
@@ -330,7 +394,7 @@ int libfwnt_huffman_tree_build(
 			 symbol,
 			 code_size );
 
-			goto on_error;
+			return( -1 );
 		}
 		huffman_tree->code_size_counts[ code_size ] += 1;
 	}
@@ -360,7 +424,7 @@ int libfwnt_huffman_tree_build(
 			 "%s: code sizes are over-subscribed.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
 /* TODO
@@ -373,23 +437,11 @@ int libfwnt_huffman_tree_build(
 		 "%s: code sizes are incomplete.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 */
-	symbol_offsets = (int *) memory_allocate(
-	                          array_size );
-
-	if( symbol_offsets == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create symbol offsets.",
-		 function );
+	symbol_offsets = huffman_tree->symbol_offsets;
 
-		goto on_error;
-	}
 	/* Calculate the offsets to sort the symbols per code size
 	 */
 	symbol_offsets[ 0 ] = 0;
@@ -427,24 +479,249 @@ int libfwnt_huffman_tree_build(
 			 symbol,
 			 code_offset );
 
-			goto on_error;
+			return( -1 );
 		}
 		symbol_offsets[ code_size ] += 1;
 
 		huffman_tree->symbols[ code_offset ] = symbol;
 	}
-	memory_free(
-	 symbol_offsets );
+	if( huffman_tree->lookup_table != NULL )
+	{
+		if( libfwnt_huffman_tree_build_lookup_table(
+		     huffman_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build lookup table.",
+			 function );
 
+			return( -1 );
+		}
+	}
 	return( 1 );
+}
 
-on_error:
-	if( symbol_offsets != NULL )
+/* Builds the lookup table from the symbols sorted by code size
+ * The primary lookup table is indexed by the next lookup table bits of the bit stream,
+ * codes that are larger than the lookup table bits are stored in secondary lookup tables
+ * that are indexed by the remaining bits. A lookup table entry consists of:
+ * bits 0 - 5   the code size or the number of bits of the secondary lookup table
+ * bit 7        flag to indicate the entry refers to a secondary lookup table
+ * bits 8 - 31  the symbol or the index of the secondary lookup table
+ * An entry of 0 indicates an unused Huffman code
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_huffman_tree_build_lookup_table(
+     libfwnt_huffman_tree_t *huffman_tree,
+     libcerror_error_t **error )
+{
+	uint32_t *lookup_table         = NULL;
+	static char *function          = "libfwnt_huffman_tree_build_lookup_table";
+	size_t lookup_table_index      = 0;
+	size_t number_of_entries       = 0;
+	size_t number_of_fill_entries  = 0;
+	size_t primary_table_size      = 0;
+	uint32_t huffman_code          = 0;
+	uint32_t lookup_table_entry    = 0;
+	uint8_t code_size              = 0;
+	uint8_t lookup_table_bits      = 0;
+	uint8_t secondary_table_bits   = 0;
+	uint8_t secondary_code_size    = 0;
+	int code_index                 = 0;
+	int code_size_count            = 0;
+	int symbol_index               = 0;
+
+	if( huffman_tree == NULL )
 	{
-		memory_free(
-		 symbol_offsets );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	if( huffman_tree->lookup_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid Huffman tree - missing lookup table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( huffman_tree->maximum_code_size == 0 )
+	 || ( huffman_tree->maximum_code_size > LIBFWNT_HUFFMAN_TREE_LOOKUP_MAXIMUM_CODE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid Huffman tree - maximum code size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	huffman_tree->lookup_table_bits = 0;
+
+	if( huffman_tree->maximum_code_size < LIBFWNT_HUFFMAN_TREE_LOOKUP_TABLE_BITS )
+	{
+		lookup_table_bits = huffman_tree->maximum_code_size;
+	}
+	else
+	{
+		lookup_table_bits = LIBFWNT_HUFFMAN_TREE_LOOKUP_TABLE_BITS;
+	}
+	primary_table_size = (size_t) 1 << lookup_table_bits;
+
+	if( memory_set(
+	     huffman_tree->lookup_table,
+	     0,
+	     sizeof( uint32_t ) * primary_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup table.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the size of the secondary lookup tables, which is the largest code size
+	 * per primary lookup table entry. Since the codes are processed in order of code size
+	 * the last code that shares the primary lookup table entry is the largest.
+	 */
+	huffman_code = 0;
+
+	for( code_size = 1;
+	     code_size <= huffman_tree->maximum_code_size;
+	     code_size++ )
+	{
+		code_size_count = huffman_tree->code_size_counts[ code_size ];
+
+		if( code_size > lookup_table_bits )
+		{
+			secondary_code_size = code_size - lookup_table_bits;
+
+			for( code_index = 0;
+			     code_index < code_size_count;
+			     code_index++ )
+			{
+				lookup_table_index = (size_t) ( ( huffman_code + code_index ) >> secondary_code_size );
+
+				huffman_tree->lookup_table[ lookup_table_index ] = 0x00000080UL | secondary_code_size;
+			}
+		}
+		huffman_code  += code_size_count;
+		huffman_code <<= 1;
+	}
+	number_of_entries = primary_table_size;
+
+	for( lookup_table_index = 0;
+	     lookup_table_index < primary_table_size;
+	     lookup_table_index++ )
+	{
+		lookup_table_entry = huffman_tree->lookup_table[ lookup_table_index ];
+
+		if( ( lookup_table_entry & 0x00000080UL ) != 0 )
+		{
+			secondary_table_bits = (uint8_t) ( lookup_table_entry & 0x0000003fUL );
+
+			huffman_tree->lookup_table[ lookup_table_index ] = ( (uint32_t) number_of_entries << 8 ) | 0x00000080UL | secondary_table_bits;
+
+			number_of_entries += (size_t) 1 << secondary_table_bits;
+		}
+	}
+	if( number_of_entries > huffman_tree->lookup_table_size )
+	{
+		lookup_table = (uint32_t *) memory_reallocate(
+		                             huffman_tree->lookup_table,
+		                             sizeof( uint32_t ) * number_of_entries );
+
+		if( lookup_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize lookup table.",
+			 function );
+
+			return( -1 );
+		}
+		huffman_tree->lookup_table      = lookup_table;
+		huffman_tree->lookup_table_size = number_of_entries;
+	}
+	if( number_of_entries > primary_table_size )
+	{
+		if( memory_set(
+		     &( huffman_tree->lookup_table[ primary_table_size ] ),
+		     0,
+		     sizeof( uint32_t ) * ( number_of_entries - primary_table_size ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear secondary lookup tables.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Fill the lookup tables with the symbols
+	 */
+	huffman_code = 0;
+
+	for( code_size = 1;
+	     code_size <= huffman_tree->maximum_code_size;
+	     code_size++ )
+	{
+		code_size_count = huffman_tree->code_size_counts[ code_size ];
+
+		for( code_index = 0;
+		     code_index < code_size_count;
+		     code_index++ )
+		{
+			lookup_table_entry = ( (uint32_t) huffman_tree->symbols[ symbol_index ] << 8 ) | code_size;
+
+			if( code_size <= lookup_table_bits )
+			{
+				lookup_table_index     = (size_t) huffman_code << ( lookup_table_bits - code_size );
+				number_of_fill_entries = (size_t) 1 << ( lookup_table_bits - code_size );
+			}
+			else
+			{
+				secondary_code_size  = code_size - lookup_table_bits;
+				lookup_table_index   = (size_t) ( huffman_code >> secondary_code_size );
+				secondary_table_bits = (uint8_t) ( huffman_tree->lookup_table[ lookup_table_index ] & 0x0000003fUL );
+
+				lookup_table_index = (size_t) ( huffman_tree->lookup_table[ lookup_table_index ] >> 8 );
+
+				lookup_table_index    += (size_t) ( huffman_code & ( ( 1UL << secondary_code_size ) - 1 ) ) << ( secondary_table_bits - secondary_code_size );
+				number_of_fill_entries = (size_t) 1 << ( secondary_table_bits - secondary_code_size );
+			}
+			while( number_of_fill_entries > 0 )
+			{
+				huffman_tree->lookup_table[ lookup_table_index++ ] = lookup_table_entry;
+
+				number_of_fill_entries--;
+			}
+			huffman_code++;
+			symbol_index++;
+		}
+		huffman_code <<= 1;
+	}
+	huffman_tree->lookup_table_bits = lookup_table_bits;
+
+	return( 1 );
 }
 
 /* Retrieves a symbol based on the Huffman code read from the bit-stream
@@ -456,7 +733,130 @@ int libfwnt_huffman_tree_get_symbol_from_bit_stream(
      uint32_t *symbol,
      libcerror_error_t **error )
 {
-	static char *function  = "libfwnt_huffman_tree_get_symbol_from_bit_stream";
+	static char *function       = "libfwnt_huffman_tree_get_symbol_from_bit_stream";
+	uint32_t lookup_table_entry = 0;
+	uint32_t lookup_table_index = 0;
+	uint8_t code_size           = 0;
+	uint8_t lookup_table_bits   = 0;
+
+	if( huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( symbol == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol.",
+		 function );
+
+		return( -1 );
+	}
+	lookup_table_bits = huffman_tree->lookup_table_bits;
+
+	if( lookup_table_bits == 0 )
+	{
+		return( libfwnt_huffman_tree_get_symbol_from_bit_stream_canonical(
+		         huffman_tree,
+		         bit_stream,
+		         symbol,
+		         error ) );
+	}
+	/* Make sure the bit buffer contains the maximum number of bits
+	 * the bit stream fills the bit buffer with 0 bits past the end of the data
+	 */
+	if( bit_stream->bit_buffer_size < huffman_tree->maximum_code_size )
+	{
+		if( libfwnt_bit_stream_read(
+		     bit_stream,
+		     huffman_tree->maximum_code_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read bits.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	lookup_table_index = libfwnt_bit_stream_peek_value(
+	                      bit_stream,
+	                      lookup_table_bits );
+
+	lookup_table_entry = huffman_tree->lookup_table[ lookup_table_index ];
+
+	if( ( lookup_table_entry & 0x00000080UL ) != 0 )
+	{
+		code_size = (uint8_t) ( lookup_table_entry & 0x0000003fUL );
+
+		lookup_table_index = libfwnt_bit_stream_peek_value(
+		                      bit_stream,
+		                      lookup_table_bits + code_size );
+
+		lookup_table_index &= ( 1UL << code_size ) - 1;
+
+		lookup_table_entry = huffman_tree->lookup_table[ ( lookup_table_entry >> 8 ) + lookup_table_index ];
+	}
+	code_size = (uint8_t) ( lookup_table_entry & 0x0000003fUL );
+
+	if( code_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid Huffman code: 0x%08" PRIx32 ".",
+		 function,
+		 libfwnt_bit_stream_peek_value(
+		  bit_stream,
+		  huffman_tree->maximum_code_size ) );
+
+		return( -1 );
+	}
+	libfwnt_bit_stream_consume_bits(
+	 bit_stream,
+	 code_size );
+
+	*symbol = lookup_table_entry >> 8;
+
+	return( 1 );
+}
+
+/* Retrieves a symbol based on the Huffman code read from the bit-stream
+ * This function walks the canonical Huffman code one bit at a time and is
+ * used when no lookup table is available or to validate the lookup table
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_huffman_tree_get_symbol_from_bit_stream_canonical(
+     libfwnt_huffman_tree_t *huffman_tree,
+     libfwnt_bit_stream_t *bit_stream,
+     uint32_t *symbol,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwnt_huffman_tree_get_symbol_from_bit_stream_canonical";
 	uint32_t safe_symbol   = 0;
 	uint32_t value_32bit   = 0;
 	uint8_t bit_index      = 0;
@@ -537,7 +937,6 @@ int libfwnt_huffman_tree_get_symbol_from_bit_stream(
 	     bit_index <= number_of_bits;
 	     bit_index++ )
 	{
-/* TODO get maximum_code_size of bits into local bit buffer */
 		if( libfwnt_bit_stream_get_value(
 		     bit_stream,
 		     1,
@@ -587,3 +986,385 @@ int libfwnt_huffman_tree_get_symbol_from_bit_stream(
 	return( 1 );
 }
 
+
+/* Determines the code sizes of a length limited Huffman code from the symbol frequencies
+ * Symbols with a frequency of 0 are assigned a code size of 0
+ * If the code exceeds the maximum code size the frequencies are scaled down and the code is rebuilt
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_huffman_tree_get_code_sizes_from_frequencies(
+     const uint32_t *symbol_frequencies,
+     int number_of_symbols,
+     uint8_t maximum_code_size,
+     uint8_t *code_sizes_array,
+     libcerror_error_t **error )
+{
+	uint32_t node_weights[ 2 * LIBFWNT_HUFFMAN_TREE_MAXIMUM_NUMBER_OF_SYMBOLS ];
+	int node_parents[ 2 * LIBFWNT_HUFFMAN_TREE_MAXIMUM_NUMBER_OF_SYMBOLS ];
+	int heap[ LIBFWNT_HUFFMAN_TREE_MAXIMUM_NUMBER_OF_SYMBOLS ];
+	int leaf_symbols[ LIBFWNT_HUFFMAN_TREE_MAXIMUM_NUMBER_OF_SYMBOLS ];
+	uint16_t node_depths[ 2 * LIBFWNT_HUFFMAN_TREE_MAXIMUM_NUMBER_OF_SYMBOLS ];
+
+	static char *function      = "libfwnt_huffman_tree_get_code_sizes_from_frequencies";
+	uint16_t largest_code_size = 0;
+	uint8_t frequency_shift    = 0;
+	int child_index            = 0;
+	int first_node             = 0;
+	int heap_index             = 0;
+	int heap_size              = 0;
+	int node                   = 0;
+	int number_of_leaves       = 0;
+	int number_of_nodes        = 0;
+	int second_node            = 0;
+	int symbol                 = 0;
+
+	if( symbol_frequencies == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_symbols < 0 )
+	 || ( number_of_symbols > LIBFWNT_HUFFMAN_TREE_MAXIMUM_NUMBER_OF_SYMBOLS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of symbols value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_code_size == 0 )
+	 || ( maximum_code_size > 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum code size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( code_sizes_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes array.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     code_sizes_array,
+	     0,
+	     sizeof( uint8_t ) * number_of_symbols ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code sizes array.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < number_of_symbols;
+	     symbol++ )
+	{
+		if( symbol_frequencies[ symbol ] != 0 )
+		{
+			leaf_symbols[ number_of_leaves++ ] = symbol;
+		}
+	}
+	if( number_of_leaves == 0 )
+	{
+		return( 1 );
+	}
+	/* A single symbol still requires a code of 1 bit
+	 */
+	if( number_of_leaves == 1 )
+	{
+		code_sizes_array[ leaf_symbols[ 0 ] ] = 1;
+
+		return( 1 );
+	}
+	if( ( maximum_code_size < 31 )
+	 && ( number_of_leaves > ( 1 << maximum_code_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum code size value too small for number of symbols.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		/* The leaves are stored in the first nodes, the nodes that combine
+		 * 2 other nodes are stored after them, hence the last node is the root
+		 */
+		for( node = 0;
+		     node < number_of_leaves;
+		     node++ )
+		{
+			if( frequency_shift >= 32 )
+			{
+				node_weights[ node ] = 1;
+			}
+			else
+			{
+				node_weights[ node ] = ( ( symbol_frequencies[ leaf_symbols[ node ] ] - 1 ) >> frequency_shift ) + 1;
+			}
+		}
+		/* Create a heap of the nodes ordered by weight, where the lowest weight is on top
+		 */
+		for( heap_size = 0;
+		     heap_size < number_of_leaves;
+		     heap_size++ )
+		{
+			heap_index = heap_size;
+
+			while( heap_index > 0 )
+			{
+				node = heap[ ( heap_index - 1 ) / 2 ];
+
+				if( node_weights[ node ] <= node_weights[ heap_size ] )
+				{
+					break;
+				}
+				heap[ heap_index ] = node;
+				heap_index         = ( heap_index - 1 ) / 2;
+			}
+			heap[ heap_index ] = heap_size;
+		}
+		number_of_nodes = number_of_leaves;
+
+		while( heap_size > 1 )
+		{
+			/* Remove the node with the lowest weight from the heap
+			 */
+			first_node = heap[ 0 ];
+
+			heap_size -= 1;
+			heap[ 0 ]  = heap[ heap_size ];
+
+			heap_index = 0;
+			node       = heap[ 0 ];
+
+			while( ( ( heap_index * 2 ) + 1 ) < heap_size )
+			{
+				child_index = ( heap_index * 2 ) + 1;
+
+				if( ( ( child_index + 1 ) < heap_size )
+				 && ( node_weights[ heap[ child_index + 1 ] ] < node_weights[ heap[ child_index ] ] ) )
+				{
+					child_index += 1;
+				}
+				if( node_weights[ node ] <= node_weights[ heap[ child_index ] ] )
+				{
+					break;
+				}
+				heap[ heap_index ] = heap[ child_index ];
+				heap_index         = child_index;
+			}
+			heap[ heap_index ] = node;
+
+			/* Replace the node with the next lowest weight with a node that combines both
+			 */
+			second_node = heap[ 0 ];
+
+			node_weights[ number_of_nodes ] = node_weights[ first_node ] + node_weights[ second_node ];
+			node_parents[ first_node ]      = number_of_nodes;
+			node_parents[ second_node ]     = number_of_nodes;
+
+			heap[ 0 ] = number_of_nodes++;
+
+			heap_index = 0;
+			node       = heap[ 0 ];
+
+			while( ( ( heap_index * 2 ) + 1 ) < heap_size )
+			{
+				child_index = ( heap_index * 2 ) + 1;
+
+				if( ( ( child_index + 1 ) < heap_size )
+				 && ( node_weights[ heap[ child_index + 1 ] ] < node_weights[ heap[ child_index ] ] ) )
+				{
+					child_index += 1;
+				}
+				if( node_weights[ node ] <= node_weights[ heap[ child_index ] ] )
+				{
+					break;
+				}
+				heap[ heap_index ] = heap[ child_index ];
+				heap_index         = child_index;
+			}
+			heap[ heap_index ] = node;
+		}
+		/* Determine the depth of the nodes from the root down
+		 */
+		largest_code_size = 0;
+
+		node_depths[ number_of_nodes - 1 ] = 0;
+
+		for( node = number_of_nodes - 2;
+		     node >= 0;
+		     node-- )
+		{
+			node_depths[ node ] = node_depths[ node_parents[ node ] ] + 1;
+
+			if( ( node < number_of_leaves )
+			 && ( node_depths[ node ] > largest_code_size ) )
+			{
+				largest_code_size = node_depths[ node ];
+			}
+		}
+		frequency_shift++;
+	}
+	while( largest_code_size > maximum_code_size );
+
+	for( node = 0;
+	     node < number_of_leaves;
+	     node++ )
+	{
+		code_sizes_array[ leaf_symbols[ node ] ] = (uint8_t) node_depths[ node ];
+	}
+	return( 1 );
+}
+
+/* Determines the canonical Huffman codes from the code sizes
+ * The codes are assigned in order of code size and symbol, as expected by libfwnt_huffman_tree_build
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_huffman_tree_get_codes_from_code_sizes(
+     const uint8_t *code_sizes_array,
+     int number_of_code_sizes,
+     uint8_t maximum_code_size,
+     uint32_t *codes_array,
+     libcerror_error_t **error )
+{
+	uint32_t next_codes[ 33 ];
+	int code_size_counts[ 33 ];
+
+	static char *function = "libfwnt_huffman_tree_get_codes_from_code_sizes";
+	uint8_t code_size     = 0;
+	int symbol            = 0;
+
+	if( code_sizes_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid code sizes array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_code_sizes < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of code sizes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_code_size == 0 )
+	 || ( maximum_code_size > 32 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum code size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( codes_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid codes array.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     code_size_counts,
+	     0,
+	     sizeof( int ) * 33 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear code size counts.",
+		 function );
+
+		return( -1 );
+	}
+	for( symbol = 0;
+	     symbol < number_of_code_sizes;
+	     symbol++ )
+	{
+		code_size = code_sizes_array[ symbol ];
+
+		if( code_size > maximum_code_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid symbol: %d code size: %" PRIu8 " value out of bounds.",
+			 function,
+			 symbol,
+			 code_size );
+
+			return( -1 );
+		}
+		code_size_counts[ code_size ] += 1;
+	}
+	code_size_counts[ 0 ] = 0;
+	next_codes[ 0 ]       = 0;
+
+	for( code_size = 1;
+	     code_size <= maximum_code_size;
+	     code_size++ )
+	{
+		next_codes[ code_size ] = ( next_codes[ code_size - 1 ] + code_size_counts[ code_size - 1 ] ) << 1;
+	}
+	for( symbol = 0;
+	     symbol < number_of_code_sizes;
+	     symbol++ )
+	{
+		code_size = code_sizes_array[ symbol ];
+
+		if( code_size == 0 )
+		{
+			codes_array[ symbol ] = 0;
+		}
+		else
+		{
+			codes_array[ symbol ] = next_codes[ code_size ]++;
+		}
+	}
+	return( 1 );
+}
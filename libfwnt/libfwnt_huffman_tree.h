@@ -32,6 +32,18 @@
 extern "C" {
 #endif
 
+/* The maximum number of bits of the primary lookup table
+ */
+#define LIBFWNT_HUFFMAN_TREE_LOOKUP_TABLE_BITS		10
+
+/* The maximum code size for which a lookup table is built
+ */
+#define LIBFWNT_HUFFMAN_TREE_LOOKUP_MAXIMUM_CODE_SIZE	16
+
+/* The maximum number of symbols for which code sizes can be determined
+ */
+#define LIBFWNT_HUFFMAN_TREE_MAXIMUM_NUMBER_OF_SYMBOLS	1024
+
 typedef struct libfwnt_huffman_tree libfwnt_huffman_tree_t;
 
 struct libfwnt_huffman_tree
@@ -47,6 +59,25 @@ struct libfwnt_huffman_tree
 	/* The code size counts array
 	 */
 	int *code_size_counts;
+
+	/* The symbol offsets array
+	 * scratch array used to sort the symbols per code size
+	 */
+	int *symbol_offsets;
+
+	/* The number of bits used to index the primary lookup table
+	 * 0 if no lookup table was built
+	 */
+	uint8_t lookup_table_bits;
+
+	/* The lookup table
+	 * contains the primary lookup table followed by the secondary lookup tables
+	 */
+	uint32_t *lookup_table;
+
+	/* The number of entries allocated for the lookup table
+	 */
+	size_t lookup_table_size;
 };
 
 int libfwnt_huffman_tree_initialize(
@@ -65,12 +96,36 @@ int libfwnt_huffman_tree_build(
      int number_of_code_sizes,
      libcerror_error_t **error );
 
+int libfwnt_huffman_tree_build_lookup_table(
+     libfwnt_huffman_tree_t *huffman_tree,
+     libcerror_error_t **error );
+
 int libfwnt_huffman_tree_get_symbol_from_bit_stream(
      libfwnt_huffman_tree_t *huffman_tree,
      libfwnt_bit_stream_t *bit_stream,
      uint32_t *symbol,
      libcerror_error_t **error );
 
+int libfwnt_huffman_tree_get_symbol_from_bit_stream_canonical(
+     libfwnt_huffman_tree_t *huffman_tree,
+     libfwnt_bit_stream_t *bit_stream,
+     uint32_t *symbol,
+     libcerror_error_t **error );
+
+int libfwnt_huffman_tree_get_code_sizes_from_frequencies(
+     const uint32_t *symbol_frequencies,
+     int number_of_symbols,
+     uint8_t maximum_code_size,
+     uint8_t *code_sizes_array,
+     libcerror_error_t **error );
+
+int libfwnt_huffman_tree_get_codes_from_code_sizes(
+     const uint8_t *code_sizes_array,
+     int number_of_code_sizes,
+     uint8_t maximum_code_size,
+     uint32_t *codes_array,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -24,21 +24,52 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwnt_definitions.h"
 #include "libfwnt_libcerror.h"
 #include "libfwnt_libcnotify.h"
+#include "libfwnt_libcthreads.h"
 #include "libfwnt_lznt1.h"
+#include "libfwnt_match_copy.h"
+#include "libfwnt_unused.h"
 
-/* Compresses data using LZNT1 compression
- * Returns 1 on success or -1 on error
+/* Calculates the match finder hash of the 3 bytes at the start of data
  */
-int libfwnt_lznt1_compress(
+#define libfwnt_lznt1_get_hash( data ) \
+	( (uint32_t) ( ( ( (uint32_t) ( data )[ 0 ] << 16 ) | ( (uint32_t) ( data )[ 1 ] << 8 ) | (uint32_t) ( data )[ 2 ] ) * 0x9e3779b1UL ) >> ( 32 - LIBFWNT_LZNT1_HASH_BITS ) )
+
+/* Adds the position in the uncompressed data to the match finder hash chain
+ */
+#define libfwnt_lznt1_hash_chain_insert( uncompressed_data, uncompressed_data_size, uncompressed_data_offset, hash_table, hash_chain ) \
+	if( ( uncompressed_data_offset + 3 ) <= uncompressed_data_size ) \
+	{ \
+		uint32_t hash_value = libfwnt_lznt1_get_hash( &( ( uncompressed_data )[ uncompressed_data_offset ] ) ); \
+\
+		( hash_chain )[ uncompressed_data_offset ] = ( hash_table )[ hash_value ]; \
+		( hash_table )[ hash_value ]               = (uint16_t) ( uncompressed_data_offset + 1 ); \
+	}
+
+/* Finds the longest match for the uncompressed data offset in the match finder hash chain
+ * The hash table and chain contain the uncompressed data offsets + 1, where 0 marks the end of the chain
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_lznt1_compress_find_match(
      const uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
-     uint8_t *compressed_data,
-     size_t *compressed_data_size,
+     size_t uncompressed_data_offset,
+     const uint16_t *hash_table,
+     const uint16_t *hash_chain,
+     int maximum_chain_length,
+     size_t maximum_match_size,
+     size_t *match_distance,
+     size_t *match_size,
      libcerror_error_t **error )
 {
-	static char *function = "libfwnt_lznt1_compress";
+	static char *function      = "libfwnt_lznt1_compress_find_match";
+	size_t candidate_offset    = 0;
+	size_t candidate_size      = 0;
+	size_t safe_match_distance = 0;
+	size_t safe_match_size     = 0;
+	uint16_t hash_chain_entry  = 0;
 
 	if( uncompressed_data == NULL )
 	{
@@ -51,374 +82,1423 @@ int libfwnt_lznt1_compress(
 
 		return( -1 );
 	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	if( ( uncompressed_data_offset > uncompressed_data_size )
+	 || ( maximum_match_size > ( uncompressed_data_size - uncompressed_data_offset ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data == NULL )
+	if( ( hash_table == NULL )
+	 || ( hash_chain == NULL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid hash table or chain.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_size == NULL )
+	if( match_distance == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data size.",
+		 "%s: invalid match distance.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO implement */
-	return( -1 );
-}
-
-/* Decompresses a LZNT1 compressed chunk
- * Returns 1 on success or -1 on error
- */
-int libfwnt_lznt1_decompress_chunk(
-     const uint8_t *compressed_data,
-     size_t compressed_data_size,
-     size_t *compressed_data_offset,
-     size_t compression_chunk_size,
-     uint8_t *uncompressed_data,
-     size_t *uncompressed_data_size,
-     libcerror_error_t **error )
-{
-	static char *function                   = "libfwnt_lznt1_decompress_chunk";
-	size_t compression_tuple_index          = 0;
-	size_t compression_tuple_threshold      = 0;
-	size_t safe_compressed_data_offset      = 0;
-	size_t safe_uncompressed_data_size      = 0;
-	size_t uncompressed_data_offset         = 0;
-	uint16_t compression_tuple              = 0;
-	uint16_t compression_tuple_offset_shift = 0;
-	uint16_t compression_tuple_size         = 0;
-	uint16_t compression_tuple_size_mask    = 0;
-	int16_t compression_tuple_offset        = 0;
-	uint8_t compression_flag_bit_index      = 0;
-	uint8_t compression_flag_byte           = 0;
-
-	if( compressed_data == NULL )
+	if( match_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid match size.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_size > (size_t) SSIZE_MAX )
+	if( maximum_match_size >= 3 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compressed data size value exceeds maximum.",
-		 function );
+		hash_chain_entry = hash_table[ libfwnt_lznt1_get_hash( &( uncompressed_data[ uncompressed_data_offset ] ) ) ];
 
-		return( -1 );
+		while( ( hash_chain_entry != 0 )
+		    && ( maximum_chain_length > 0 ) )
+		{
+			candidate_offset = (size_t) hash_chain_entry - 1;
+
+			/* Only compare the candidate when it could improve the current match
+			 */
+			if( uncompressed_data[ candidate_offset + safe_match_size ] == uncompressed_data[ uncompressed_data_offset + safe_match_size ] )
+			{
+				for( candidate_size = 0;
+				     candidate_size < maximum_match_size;
+				     candidate_size++ )
+				{
+					if( uncompressed_data[ candidate_offset + candidate_size ] != uncompressed_data[ uncompressed_data_offset + candidate_size ] )
+					{
+						break;
+					}
+				}
+				if( candidate_size > safe_match_size )
+				{
+					safe_match_distance = uncompressed_data_offset - candidate_offset;
+					safe_match_size     = candidate_size;
+
+					if( safe_match_size >= maximum_match_size )
+					{
+						break;
+					}
+				}
+			}
+			hash_chain_entry = hash_chain[ candidate_offset ];
+
+			maximum_chain_length--;
+		}
 	}
-	if( compressed_data_offset == NULL )
+	if( safe_match_size < 3 )
+	{
+		safe_match_distance = 0;
+		safe_match_size     = 0;
+	}
+	*match_distance = safe_match_distance;
+	*match_size     = safe_match_size;
+
+	return( 1 );
+}
+
+/* Compresses a LZNT1 compressed chunk
+ * The compressed data does not contain the compressed chunk header
+ * Returns 1 on success, 0 if the chunk does not compress into less bytes than the uncompressed data or -1 on error
+ */
+int libfwnt_lznt1_compress_chunk(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	uint16_t hash_chain[ LIBFWNT_LZNT1_COMPRESSION_CHUNK_SIZE ];
+	uint16_t hash_table[ 1 << LIBFWNT_LZNT1_HASH_BITS ];
+
+	static char *function                     = "libfwnt_lznt1_compress_chunk";
+	size_t compressed_data_offset             = 0;
+	size_t compression_flag_byte_offset       = 0;
+	size_t compression_tuple_threshold        = 0;
+	size_t match_distance                     = 0;
+	size_t match_size                         = 0;
+	size_t maximum_match_size                 = 0;
+	size_t next_match_distance                = 0;
+	size_t next_match_size                    = 0;
+	size_t safe_compressed_data_size          = 0;
+	size_t uncompressed_data_offset           = 0;
+	uint16_t compression_tuple                = 0;
+	uint16_t compression_tuple_offset_shift   = 0;
+	uint16_t compression_tuple_size_mask      = 0;
+	uint16_t next_compression_tuple_size_mask = 0;
+	uint8_t compression_flag_bit_index        = 0;
+	int has_next_match                        = 0;
+	int is_inserted                           = 0;
+	int maximum_chain_length                  = 0;
+	int use_lazy_matching                     = 0;
+
+	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data offset.",
+		 "%s: invalid uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-	safe_compressed_data_offset = *compressed_data_offset;
-
-	if( safe_compressed_data_offset >= compressed_data_size )
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > (size_t) LIBFWNT_LZNT1_COMPRESSION_CHUNK_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid compressed data offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( compression_chunk_size > (size_t) SSIZE_MAX )
+	switch( compression_level )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid compression chunk size value exceeds maximum.",
-		 function );
+		case LIBFWNT_COMPRESSION_LEVEL_FAST:
+			maximum_chain_length = 1;
+			use_lazy_matching    = 0;
+			break;
 
-		return( -1 );
+		case LIBFWNT_COMPRESSION_LEVEL_DEFAULT:
+		case LIBFWNT_COMPRESSION_LEVEL_NORMAL:
+			maximum_chain_length = 16;
+			use_lazy_matching    = 0;
+			break;
+
+		case LIBFWNT_COMPRESSION_LEVEL_BEST:
+			maximum_chain_length = LIBFWNT_LZNT1_COMPRESSION_CHUNK_SIZE;
+			use_lazy_matching    = 1;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported compression level.",
+			 function );
+
+			return( -1 );
 	}
-	if( compression_chunk_size > ( compressed_data_size - safe_compressed_data_offset ) )
+	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: compressed data too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data == NULL )
+	if( compressed_data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
+		 "%s: invalid compressed data size.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size == NULL )
+	/* A compressed chunk is only useful if it is smaller than the uncompressed data
+	 */
+	safe_compressed_data_size = *compressed_data_size;
+
+	if( safe_compressed_data_size >= uncompressed_data_size )
+	{
+		safe_compressed_data_size = uncompressed_data_size - 1;
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( uint16_t ) * ( 1 << LIBFWNT_LZNT1_HASH_BITS ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
 		 function );
 
 		return( -1 );
 	}
-	safe_uncompressed_data_size = *uncompressed_data_size;
-
 	compression_tuple_threshold    = 16;
 	compression_tuple_offset_shift = 12;
 	compression_tuple_size_mask    = 0x0fff;
 
-	while( compression_chunk_size > 0 )
+	while( uncompressed_data_offset < uncompressed_data_size )
 	{
-		if( safe_compressed_data_offset >= compressed_data_size )
+		/* The compression tuple size mask and offset shift
+		 * are dependent on the current buffer offset in the uncompressed data
+		 */
+		while( uncompressed_data_offset > compression_tuple_threshold )
 		{
-			break;
+			compression_tuple_offset_shift -= 1;
+			compression_tuple_size_mask   >>= 1;
+			compression_tuple_threshold   <<= 1;
 		}
-		compression_flag_byte = compressed_data[ safe_compressed_data_offset ];
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( compression_flag_bit_index == 0 )
 		{
-			libcnotify_printf(
-			 "%s: compressed data offset\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
-			 function,
-			 safe_compressed_data_offset,
-			 safe_compressed_data_offset );
-
-			libcnotify_printf(
-			 "%s: compression flag byte\t\t\t: 0x%02" PRIx8 "\n",
-			 function,
-			 compression_flag_byte );
+			if( compressed_data_offset >= safe_compressed_data_size )
+			{
+				return( 0 );
+			}
+			compression_flag_byte_offset = compressed_data_offset;
 
-			libcnotify_printf(
-			 "\n" );
+			compressed_data[ compressed_data_offset++ ] = 0;
 		}
-#endif /* #if defined( HAVE_DEBUG_OUTPUT ) */
-
-		safe_compressed_data_offset += 1;
-		compression_chunk_size      -= 1;
+		maximum_match_size = (size_t) compression_tuple_size_mask + 3;
 
-		for( compression_flag_bit_index = 0;
-		     compression_flag_bit_index < 8;
-		     compression_flag_bit_index++ )
+		if( maximum_match_size > ( uncompressed_data_size - uncompressed_data_offset ) )
 		{
-			/* Check if the data is compressed (tag bit is set)
-			 */
-			if( ( compression_flag_byte & 0x01 ) != 0 )
-			{
-				if( safe_compressed_data_offset >= ( compressed_data_size - 1 ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: compressed data offset value out of bounds.",
-					 function );
+			maximum_match_size = uncompressed_data_size - uncompressed_data_offset;
+		}
+		if( has_next_match != 0 )
+		{
+			match_distance = next_match_distance;
+			match_size     = next_match_size;
+			has_next_match = 0;
+		}
+		else if( libfwnt_lznt1_compress_find_match(
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          uncompressed_data_offset,
+		          hash_table,
+		          hash_chain,
+		          maximum_chain_length,
+		          maximum_match_size,
+		          &match_distance,
+		          &match_size,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to find match at offset: %" PRIzd ".",
+			 function,
+			 uncompressed_data_offset );
 
-					return( -1 );
-				}
-				/* Read the compression ( size, offset ) tuple
-				 */
-				byte_stream_copy_to_uint16_little_endian(
-				 &( compressed_data[ safe_compressed_data_offset ] ),
-				 compression_tuple );
+			return( -1 );
+		}
+		libfwnt_lznt1_hash_chain_insert(
+		 uncompressed_data,
+		 uncompressed_data_size,
+		 uncompressed_data_offset,
+		 hash_table,
+		 hash_chain );
 
-				compression_tuple_offset = ( compression_tuple >> compression_tuple_offset_shift ) + 1;
-				compression_tuple_size   = ( compression_tuple & compression_tuple_size_mask ) + 3;
+		is_inserted = 1;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: compressed data offset\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
-					 function,
-					 safe_compressed_data_offset,
-					 safe_compressed_data_offset );
+		/* With lazy matching a match is deferred if the next offset has a longer match
+		 */
+		if( ( use_lazy_matching != 0 )
+		 && ( match_size > 0 )
+		 && ( match_size < maximum_match_size ) )
+		{
+			next_compression_tuple_size_mask = compression_tuple_size_mask;
 
-					libcnotify_printf(
-					 "%s: compression tuple\t\t\t: 0x%04" PRIx16 " (shift: %" PRIu16 ", mask: 0x%04" PRIx16 ")\n",
-					 function,
-					 compression_tuple,
-					 compression_tuple_offset_shift,
-					 compression_tuple_size_mask );
+			if( ( uncompressed_data_offset + 1 ) > compression_tuple_threshold )
+			{
+				next_compression_tuple_size_mask >>= 1;
+			}
+			maximum_match_size = (size_t) next_compression_tuple_size_mask + 3;
 
-					libcnotify_printf(
-					 "%s: compression tuple offset\t\t: %" PRIi16 "\n",
-					 function,
-					 compression_tuple_offset );
+			if( maximum_match_size > ( uncompressed_data_size - uncompressed_data_offset - 1 ) )
+			{
+				maximum_match_size = uncompressed_data_size - uncompressed_data_offset - 1;
+			}
+			if( libfwnt_lznt1_compress_find_match(
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     uncompressed_data_offset + 1,
+			     hash_table,
+			     hash_chain,
+			     maximum_chain_length,
+			     maximum_match_size,
+			     &next_match_distance,
+			     &next_match_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to find match at offset: %" PRIzd ".",
+				 function,
+				 uncompressed_data_offset + 1 );
 
-					libcnotify_printf(
-					 "%s: compression tuple size\t\t\t: %" PRIu16 "\n",
-					 function,
-					 compression_tuple_size );
+				return( -1 );
+			}
+			if( next_match_size > match_size )
+			{
+				match_size     = 0;
+				has_next_match = 1;
+			}
+		}
+		if( match_size > 0 )
+		{
+			if( ( safe_compressed_data_size < 2 )
+			 || ( compressed_data_offset > ( safe_compressed_data_size - 2 ) ) )
+			{
+				return( 0 );
+			}
+			compression_tuple = (uint16_t) ( ( ( match_distance - 1 ) << compression_tuple_offset_shift )
+			                  | ( match_size - 3 ) );
 
-					libcnotify_printf(
-					 "%s: uncompressed data offset\t\t: %" PRIzd "\n",
-					 function,
-					 uncompressed_data_offset );
+			byte_stream_copy_from_uint16_little_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 compression_tuple );
 
-					libcnotify_printf(
-					 "\n" );
-				}
-#endif /* #if defined( HAVE_DEBUG_OUTPUT ) */
+			compressed_data_offset += 2;
 
-				safe_compressed_data_offset += 2;
-				compression_chunk_size      -= 2;
+			compressed_data[ compression_flag_byte_offset ] |= (uint8_t) ( 1 << compression_flag_bit_index );
 
-				/* The compression tuple offset refers to an offset in the uncompressed data
-				 */
-				if( (size_t) compression_tuple_offset > uncompressed_data_offset )
+			while( match_size > 0 )
+			{
+				if( is_inserted == 0 )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: compression tuple offset value out of bounds.",
-					 function );
-
-					return( -1 );
+					libfwnt_lznt1_hash_chain_insert(
+					 uncompressed_data,
+					 uncompressed_data_size,
+					 uncompressed_data_offset,
+					 hash_table,
+					 hash_chain );
 				}
-				compression_tuple_index = uncompressed_data_offset - compression_tuple_offset;
+				is_inserted = 0;
 
-				while( compression_tuple_size > 0 )
+				uncompressed_data_offset++;
+				match_size--;
+			}
+		}
+		else
+		{
+			if( compressed_data_offset >= safe_compressed_data_size )
+			{
+				return( 0 );
+			}
+			compressed_data[ compressed_data_offset++ ] = uncompressed_data[ uncompressed_data_offset++ ];
+		}
+		compression_flag_bit_index = ( compression_flag_bit_index + 1 ) & 0x07;
+	}
+	*compressed_data_size = compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Compresses data using LZNT1 compression
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_lznt1_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_lznt1_compress";
+
+	if( libfwnt_lznt1_compress_with_level(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     compressed_data,
+	     compressed_data_size,
+	     LIBFWNT_COMPRESSION_LEVEL_DEFAULT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compresses data using LZNT1 compression with a specific compression level
+ * The compression level controls how thorough the match finder searches for matches
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_lznt1_compress_with_level(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int compression_level,
+     libcerror_error_t **error )
+{
+	static char *function             = "libfwnt_lznt1_compress_with_level";
+	size_t compressed_chunk_size      = 0;
+	size_t compressed_data_offset     = 0;
+	size_t safe_compressed_data_size  = 0;
+	size_t uncompressed_chunk_size    = 0;
+	size_t uncompressed_data_offset   = 0;
+	uint16_t compression_chunk_header = 0;
+	int result                        = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compression_level < LIBFWNT_COMPRESSION_LEVEL_DEFAULT )
+	 || ( compression_level > LIBFWNT_COMPRESSION_LEVEL_BEST ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported compression level.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_size = *compressed_data_size;
+
+	while( uncompressed_data_offset < uncompressed_data_size )
+	{
+		uncompressed_chunk_size = uncompressed_data_size - uncompressed_data_offset;
+
+		if( uncompressed_chunk_size > (size_t) LIBFWNT_LZNT1_COMPRESSION_CHUNK_SIZE )
+		{
+			uncompressed_chunk_size = (size_t) LIBFWNT_LZNT1_COMPRESSION_CHUNK_SIZE;
+		}
+		if( ( safe_compressed_data_size < 2 )
+		 || ( compressed_data_offset > ( safe_compressed_data_size - 2 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data too small.",
+			 function );
+
+			return( -1 );
+		}
+		compressed_chunk_size = safe_compressed_data_size - ( compressed_data_offset + 2 );
+
+		result = libfwnt_lznt1_compress_chunk(
+		          &( uncompressed_data[ uncompressed_data_offset ] ),
+		          uncompressed_chunk_size,
+		          compression_level,
+		          &( compressed_data[ compressed_data_offset + 2 ] ),
+		          &compressed_chunk_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress chunk.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			/* The first 2 bytes contain the compressed chunk header
+			 * 0  - 11	compressed chunk size
+			 * 12 - 14	signature value
+			 * 15		is compressed flag
+			 */
+			compression_chunk_header = 0xb000 | (uint16_t) ( compressed_chunk_size - 1 );
+		}
+		else
+		{
+			/* Store the chunk uncompressed if it does not compress
+			 */
+			if( uncompressed_chunk_size > ( safe_compressed_data_size - ( compressed_data_offset + 2 ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( compressed_data[ compressed_data_offset + 2 ] ),
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     uncompressed_chunk_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy uncompressed data to compressed data.",
+				 function );
+
+				return( -1 );
+			}
+			compressed_chunk_size    = uncompressed_chunk_size;
+			compression_chunk_header = 0x3000 | (uint16_t) ( compressed_chunk_size - 1 );
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 compression_chunk_header );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: compressed data offset\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
+			 function,
+			 compressed_data_offset,
+			 compressed_data_offset );
+
+			libcnotify_printf(
+			 "%s: compression chunk header\t\t\t: 0x%04" PRIx16 "\n",
+			 function,
+			 compression_chunk_header );
+
+			libcnotify_printf(
+			 "%s: uncompressed chunk size\t\t\t: %" PRIzd "\n",
+			 function,
+			 uncompressed_chunk_size );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		compressed_data_offset   += 2 + compressed_chunk_size;
+		uncompressed_data_offset += uncompressed_chunk_size;
+	}
+	*compressed_data_size = compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Decompresses a LZNT1 compressed chunk
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_lznt1_decompress_chunk(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     size_t compression_chunk_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                   = "libfwnt_lznt1_decompress_chunk";
+	size_t compression_tuple_threshold      = 0;
+	size_t safe_compressed_data_offset      = 0;
+	size_t safe_uncompressed_data_size      = 0;
+	size_t uncompressed_data_offset         = 0;
+	uint16_t compression_tuple              = 0;
+	uint16_t compression_tuple_offset_shift = 0;
+	uint16_t compression_tuple_size         = 0;
+	uint16_t compression_tuple_size_mask    = 0;
+	int16_t compression_tuple_offset        = 0;
+	uint8_t compression_flag_bit_index      = 0;
+	uint8_t compression_flag_byte           = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	if( safe_compressed_data_offset >= compressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_chunk_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compression chunk size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compression_chunk_size > ( compressed_data_size - safe_compressed_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	compression_tuple_threshold    = 16;
+	compression_tuple_offset_shift = 12;
+	compression_tuple_size_mask    = 0x0fff;
+
+	while( compression_chunk_size > 0 )
+	{
+		if( safe_compressed_data_offset >= compressed_data_size )
+		{
+			break;
+		}
+		compression_flag_byte = compressed_data[ safe_compressed_data_offset ];
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: compressed data offset\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
+			 function,
+			 safe_compressed_data_offset,
+			 safe_compressed_data_offset );
+
+			libcnotify_printf(
+			 "%s: compression flag byte\t\t\t: 0x%02" PRIx8 "\n",
+			 function,
+			 compression_flag_byte );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif /* #if defined( HAVE_DEBUG_OUTPUT ) */
+
+		safe_compressed_data_offset += 1;
+		compression_chunk_size      -= 1;
+
+		for( compression_flag_bit_index = 0;
+		     compression_flag_bit_index < 8;
+		     compression_flag_bit_index++ )
+		{
+			/* Check if the data is compressed (tag bit is set)
+			 */
+			if( ( compression_flag_byte & 0x01 ) != 0 )
+			{
+				if( safe_compressed_data_offset >= ( compressed_data_size - 1 ) )
 				{
-					if( compression_tuple_index > uncompressed_data_offset )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: compression tuple index value out of bounds.",
-						 function );
-
-						return( -1 );
-					}
-					if( uncompressed_data_offset >= safe_uncompressed_data_size )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-						 "%s: uncompressed data too small.",
-						 function );
-
-						return( -1 );
-					}
-					uncompressed_data[ uncompressed_data_offset++ ] = uncompressed_data[ compression_tuple_index++ ];
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: compressed data offset value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				/* Read the compression ( size, offset ) tuple
+				 */
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ safe_compressed_data_offset ] ),
+				 compression_tuple );
+
+				compression_tuple_offset = ( compression_tuple >> compression_tuple_offset_shift ) + 1;
+				compression_tuple_size   = ( compression_tuple & compression_tuple_size_mask ) + 3;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: compressed data offset\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
+					 function,
+					 safe_compressed_data_offset,
+					 safe_compressed_data_offset );
+
+					libcnotify_printf(
+					 "%s: compression tuple\t\t\t: 0x%04" PRIx16 " (shift: %" PRIu16 ", mask: 0x%04" PRIx16 ")\n",
+					 function,
+					 compression_tuple,
+					 compression_tuple_offset_shift,
+					 compression_tuple_size_mask );
+
+					libcnotify_printf(
+					 "%s: compression tuple offset\t\t: %" PRIi16 "\n",
+					 function,
+					 compression_tuple_offset );
+
+					libcnotify_printf(
+					 "%s: compression tuple size\t\t\t: %" PRIu16 "\n",
+					 function,
+					 compression_tuple_size );
+
+					libcnotify_printf(
+					 "%s: uncompressed data offset\t\t: %" PRIzd "\n",
+					 function,
+					 uncompressed_data_offset );
+
+					libcnotify_printf(
+					 "\n" );
+				}
+#endif /* #if defined( HAVE_DEBUG_OUTPUT ) */
+
+				safe_compressed_data_offset += 2;
+				compression_chunk_size      -= 2;
+
+				/* The compression tuple offset refers to an offset in the uncompressed data
+				 */
+				if( (size_t) compression_tuple_offset > uncompressed_data_offset )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: compression tuple offset value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				if( (size_t) compression_tuple_size > ( safe_uncompressed_data_size - uncompressed_data_offset ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: uncompressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+				libfwnt_match_copy(
+				 uncompressed_data,
+				 uncompressed_data_offset,
+				 (size_t) compression_tuple_offset,
+				 (size_t) compression_tuple_size );
+
+				uncompressed_data_offset += compression_tuple_size;
+			}
+			else
+			{
+				if( uncompressed_data_offset >= safe_uncompressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: uncompressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+				if( safe_compressed_data_offset >= compressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: compressed data offset value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				uncompressed_data[ uncompressed_data_offset++ ] = compressed_data[ safe_compressed_data_offset++ ];
+
+				compression_chunk_size -= 1;
+			}
+			compression_flag_byte >>= 1;
+
+			if( compression_chunk_size == 0 )
+			{
+				break;
+			}
+			/* The compression tuple size mask and offset shift
+			 * are dependent on the current buffer offset in the uncompressed data
+			 */
+			while( uncompressed_data_offset > compression_tuple_threshold )
+			{
+				compression_tuple_offset_shift -= 1;
+				compression_tuple_size_mask   >>= 1;
+				compression_tuple_threshold   <<= 1;
+			}
+		}
+	}
+	*compressed_data_offset = safe_compressed_data_offset;
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Decompresses data using LZNT1 compression
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_lznt1_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function              = "libfwnt_lznt1_decompress";
+	size_t compressed_data_offset      = 0;
+	size_t safe_uncompressed_data_size = 0;
+	size_t uncompressed_chunk_size     = 0;
+	size_t uncompressed_data_offset    = 0;
+	uint16_t compression_chunk_header  = 0;
+	uint16_t compression_chunk_size    = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	while( compressed_data_offset < compressed_data_size )
+	{
+		if( uncompressed_data_offset >= safe_uncompressed_data_size )
+		{
+			break;
+		}
+		if( ( compressed_data_offset + 1 ) >= compressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		/* The first 2 bytes contain the compressed chunk header
+		 * 0  - 11	compressed chunk size
+		 * 12 - 14	signature value
+		 * 15		is compressed flag
+		 */
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 compression_chunk_header );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: compressed data offset\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
+			 function,
+			 compressed_data_offset,
+			 compressed_data_offset );
+
+			libcnotify_printf(
+			 "%s: compression chunk header\t\t\t: 0x%04" PRIx16 "\n",
+			 function,
+			 compression_chunk_header );
+
+			libcnotify_printf(
+			 "%s: compressed chunk size\t\t\t\t: %" PRIu16 "\n",
+			 function,
+			 ( compression_chunk_header & 0x0fff ) + 1 );
+
+			libcnotify_printf(
+			 "%s: signature value\t\t\t\t: %" PRIu16 "\n",
+			 function,
+			 ( compression_chunk_header >> 12 ) & 0x0007 );
+
+			libcnotify_printf(
+			 "%s: is compressed flag\t\t\t\t: %" PRIu16 "\n",
+			 function,
+			 compression_chunk_header >> 15 );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		compressed_data_offset += 2;
+
+		if( compression_chunk_header == 0 )
+		{
+			break;
+		}
+		compression_chunk_size = ( compression_chunk_header & 0x0fff ) + 1;
+
+		if( ( compression_chunk_header & 0x8000 ) != 0 )
+		{
+			/* Adjust the compression chunk size for the iteration
+			 */
+			uncompressed_chunk_size = safe_uncompressed_data_size - uncompressed_data_offset;
+
+			if( libfwnt_lznt1_decompress_chunk(
+			     compressed_data,
+			     compressed_data_size,
+			     &compressed_data_offset,
+			     compression_chunk_size,
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     &uncompressed_chunk_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress chunk.",
+				 function );
+
+				return( -1 );
+			}
+			uncompressed_data_offset += uncompressed_chunk_size;
+		}
+		else
+		{
+			if( compression_chunk_size > ( compressed_data_size - compressed_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( compression_chunk_size > ( safe_uncompressed_data_size - uncompressed_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: uncompressed data too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     &( compressed_data[ compressed_data_offset ] ),
+			     compression_chunk_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy copy compressed data to uncompressed data.",
+				 function );
+
+				return( -1 );
+			}
+			compressed_data_offset   += (size_t) compression_chunk_size;
+			uncompressed_data_offset += (size_t) compression_chunk_size;
+		}
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+}
+
+
+/* Scans the LZNT1 compression chunk headers to determine the offsets of the chunks
+ * The uncompressed data offsets are determined on the assumption that every compressed
+ * chunk, except the last, decompresses to the compression chunk size (4096)
+ * If chunks is NULL only the number of chunks is determined, otherwise number of chunks
+ * must contain the number of entries in chunks
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_lznt1_scan_chunks(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t uncompressed_data_size,
+     libfwnt_lznt1_chunk_t *chunks,
+     int *number_of_chunks,
+     libcerror_error_t **error )
+{
+	static char *function             = "libfwnt_lznt1_scan_chunks";
+	size_t compressed_data_offset     = 0;
+	size_t uncompressed_chunk_size    = 0;
+	size_t uncompressed_data_offset   = 0;
+	uint16_t compression_chunk_header = 0;
+	uint16_t compression_chunk_size   = 0;
+	int chunk_index                   = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of chunks.",
+		 function );
+
+		return( -1 );
+	}
+	while( compressed_data_offset < compressed_data_size )
+	{
+		if( uncompressed_data_offset >= uncompressed_data_size )
+		{
+			break;
+		}
+		if( ( compressed_data_offset + 1 ) >= compressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 compression_chunk_header );
+
+		compressed_data_offset += 2;
+
+		if( compression_chunk_header == 0 )
+		{
+			break;
+		}
+		compression_chunk_size = ( compression_chunk_header & 0x0fff ) + 1;
+
+		if( compression_chunk_size > ( compressed_data_size - compressed_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( compression_chunk_header & 0x8000 ) != 0 )
+		{
+			uncompressed_chunk_size = LIBFWNT_LZNT1_COMPRESSION_CHUNK_SIZE;
+		}
+		else
+		{
+			uncompressed_chunk_size = (size_t) compression_chunk_size;
+		}
+		if( chunk_index == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid chunk index value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( chunks != NULL )
+		{
+			if( chunk_index >= *number_of_chunks )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid chunk index value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			chunks[ chunk_index ].compressed_data_offset   = compressed_data_offset;
+			chunks[ chunk_index ].compression_chunk_size   = compression_chunk_size;
+			chunks[ chunk_index ].is_compressed            = (uint8_t) ( compression_chunk_header >> 15 );
+			chunks[ chunk_index ].uncompressed_data_offset = uncompressed_data_offset;
+			chunks[ chunk_index ].uncompressed_data_size   = uncompressed_data_size - uncompressed_data_offset;
+			chunks[ chunk_index ].uncompressed_chunk_size  = 0;
+
+			/* Only the last chunk can use the remainder of the uncompressed data
+			 */
+			if( chunks[ chunk_index ].uncompressed_data_size > uncompressed_chunk_size )
+			{
+				chunks[ chunk_index ].uncompressed_data_size = uncompressed_chunk_size;
+			}
+		}
+		compressed_data_offset   += compression_chunk_size;
+		uncompressed_data_offset += uncompressed_chunk_size;
+
+		chunk_index++;
+	}
+	if( ( chunks != NULL )
+	 && ( chunk_index > 0 ) )
+	{
+		chunks[ chunk_index - 1 ].uncompressed_data_size = uncompressed_data_size - chunks[ chunk_index - 1 ].uncompressed_data_offset;
+	}
+	*number_of_chunks = chunk_index;
+
+	return( 1 );
+}
+
+/* Decompresses the chunks of a decompress job
+ * This function is called from multiple threads and therefore does not set an error,
+ * the result is stored in the job
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_lznt1_decompress_job_run(
+     libfwnt_lznt1_decompress_job_t *job )
+{
+	libfwnt_lznt1_chunk_t *chunk  = NULL;
+	size_t compressed_data_offset = 0;
+	int chunk_index               = 0;
+
+	if( job == NULL )
+	{
+		return( -1 );
+	}
+	job->result = 1;
 
-					compression_tuple_size -= 1;
-				}
-			}
-			else
-			{
-				if( uncompressed_data_offset >= safe_uncompressed_data_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: uncompressed data too small.",
-					 function );
+	for( chunk_index = 0;
+	     chunk_index < job->number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk = &( job->chunks[ chunk_index ] );
 
-					return( -1 );
-				}
-				if( safe_compressed_data_offset >= compressed_data_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: compressed data offset value out of bounds.",
-					 function );
+		if( chunk->is_compressed != 0 )
+		{
+			compressed_data_offset         = chunk->compressed_data_offset;
+			chunk->uncompressed_chunk_size = chunk->uncompressed_data_size;
 
-					return( -1 );
-				}
-				uncompressed_data[ uncompressed_data_offset++ ] = compressed_data[ safe_compressed_data_offset++ ];
+			if( libfwnt_lznt1_decompress_chunk(
+			     job->compressed_data,
+			     job->compressed_data_size,
+			     &compressed_data_offset,
+			     (size_t) chunk->compression_chunk_size,
+			     &( job->uncompressed_data[ chunk->uncompressed_data_offset ] ),
+			     &( chunk->uncompressed_chunk_size ),
+			     NULL ) != 1 )
+			{
+				job->result = -1;
 
-				compression_chunk_size -= 1;
+				break;
 			}
-			compression_flag_byte >>= 1;
-
-			if( compression_chunk_size == 0 )
+		}
+		else
+		{
+			if( (size_t) chunk->compression_chunk_size > chunk->uncompressed_data_size )
 			{
+				job->result = -1;
+
 				break;
 			}
-			/* The compression tuple size mask and offset shift
-			 * are dependent on the current buffer offset in the uncompressed data
-			 */
-			while( uncompressed_data_offset > compression_tuple_threshold )
+			if( memory_copy(
+			     &( job->uncompressed_data[ chunk->uncompressed_data_offset ] ),
+			     &( job->compressed_data[ chunk->compressed_data_offset ] ),
+			     (size_t) chunk->compression_chunk_size ) == NULL )
 			{
-				compression_tuple_offset_shift -= 1;
-				compression_tuple_size_mask   >>= 1;
-				compression_tuple_threshold   <<= 1;
+				job->result = -1;
+
+				break;
 			}
+			chunk->uncompressed_chunk_size = (size_t) chunk->compression_chunk_size;
 		}
 	}
-	*compressed_data_offset = safe_compressed_data_offset;
-	*uncompressed_data_size = uncompressed_data_offset;
+	return( job->result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function to decompress the chunks of a decompress job from a thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_lznt1_decompress_job_callback(
+     intptr_t *job,
+     void *arguments LIBFWNT_ATTRIBUTE_UNUSED )
+{
+	LIBFWNT_UNREFERENCED_PARAMETER( arguments )
+
+	if( job == NULL )
+	{
+		return( -1 );
+	}
+	/* The result is checked when the thread pool has been joined
+	 */
+	libfwnt_lznt1_decompress_job_run(
+	 (libfwnt_lznt1_decompress_job_t *) job );
 
 	return( 1 );
 }
 
-/* Decompresses data using LZNT1 compression
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decompresses data using LZNT1 compression using multiple threads
+ * The chunks are decompressed in parallel when every compressed chunk, except the last,
+ * decompresses to the compression chunk size (4096), which is the case for data compressed
+ * by Windows, otherwise the data is decompressed sequentially
+ * If the number of threads is 0 or 1 or multi-threading is not supported the data is
+ * decompressed sequentially
  * Returns 1 on success or -1 on error
  */
-int libfwnt_lznt1_decompress(
+int libfwnt_lznt1_decompress_parallel(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
      uint8_t *uncompressed_data,
      size_t *uncompressed_data_size,
+     int number_of_threads,
      libcerror_error_t **error )
 {
-	static char *function              = "libfwnt_lznt1_decompress";
-	size_t compressed_data_offset      = 0;
-	size_t safe_uncompressed_data_size = 0;
-	size_t uncompressed_chunk_size     = 0;
-	size_t uncompressed_data_offset    = 0;
-	uint16_t compression_chunk_header  = 0;
-	uint16_t compression_chunk_size    = 0;
+	static char *function                  = "libfwnt_lznt1_decompress_parallel";
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	libfwnt_lznt1_chunk_t *chunks          = NULL;
+	libfwnt_lznt1_decompress_job_t *jobs   = NULL;
+	size_t compressed_data_offset          = 0;
+	size_t safe_uncompressed_data_size     = 0;
+	size_t uncompressed_data_offset        = 0;
+	uint16_t compression_chunk_header      = 0;
+	int chunk_index                        = 0;
+	int job_index                          = 0;
+	int number_of_chunks                   = 0;
+	int number_of_jobs                     = 0;
+	int result                             = 0;
+#endif
 
 	if( compressed_data == NULL )
 	{
@@ -464,146 +1544,286 @@ int libfwnt_lznt1_decompress(
 
 		return( -1 );
 	}
-	safe_uncompressed_data_size = *uncompressed_data_size;
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
 
-	while( compressed_data_offset < compressed_data_size )
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
 	{
-		if( uncompressed_data_offset >= safe_uncompressed_data_size )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		safe_uncompressed_data_size = *uncompressed_data_size;
+
+		/* If the chunks cannot be scanned, for example because the last chunk is
+		 * truncated, the data is decompressed sequentially which determines the error
+		 */
+		if( libfwnt_lznt1_scan_chunks(
+		     compressed_data,
+		     compressed_data_size,
+		     safe_uncompressed_data_size,
+		     NULL,
+		     &number_of_chunks,
+		     NULL ) != 1 )
 		{
-			break;
+			number_of_chunks = 0;
 		}
-		if( ( compressed_data_offset + 1 ) >= compressed_data_size )
+	}
+	if( number_of_chunks > 1 )
+	{
+		chunks = (libfwnt_lznt1_chunk_t *) memory_allocate(
+		                                    sizeof( libfwnt_lznt1_chunk_t ) * number_of_chunks );
+
+		if( chunks == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: compressed data size value too small.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunks.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		/* The first 2 bytes contain the compressed chunk header
-		 * 0  - 11	compressed chunk size
-		 * 12 - 14	signature value
-		 * 15		is compressed flag
-		 */
-		byte_stream_copy_to_uint16_little_endian(
-		 &( compressed_data[ compressed_data_offset ] ),
-		 compression_chunk_header );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libfwnt_lznt1_scan_chunks(
+		     compressed_data,
+		     compressed_data_size,
+		     safe_uncompressed_data_size,
+		     chunks,
+		     &number_of_chunks,
+		     error ) != 1 )
 		{
-			libcnotify_printf(
-			 "%s: compressed data offset\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
-			 function,
-			 compressed_data_offset,
-			 compressed_data_offset );
-
-			libcnotify_printf(
-			 "%s: compression chunk header\t\t\t: 0x%04" PRIx16 "\n",
-			 function,
-			 compression_chunk_header );
-
-			libcnotify_printf(
-			 "%s: compressed chunk size\t\t\t\t: %" PRIu16 "\n",
-			 function,
-			 ( compression_chunk_header & 0x0fff ) + 1 );
-
-			libcnotify_printf(
-			 "%s: signature value\t\t\t\t: %" PRIu16 "\n",
-			 function,
-			 ( compression_chunk_header >> 12 ) & 0x0007 );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan chunks.",
+			 function );
 
-			libcnotify_printf(
-			 "%s: is compressed flag\t\t\t\t: %" PRIu16 "\n",
-			 function,
-			 compression_chunk_header >> 15 );
+			goto on_error;
+		}
+		number_of_jobs = number_of_chunks;
 
-			libcnotify_printf(
-			 "\n" );
+		if( number_of_threads <= ( number_of_chunks / LIBFWNT_LZNT1_NUMBER_OF_JOBS_PER_THREAD ) )
+		{
+			number_of_jobs = number_of_threads * LIBFWNT_LZNT1_NUMBER_OF_JOBS_PER_THREAD;
 		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		jobs = (libfwnt_lznt1_decompress_job_t *) memory_allocate(
+		                                           sizeof( libfwnt_lznt1_decompress_job_t ) * number_of_jobs );
 
-		compressed_data_offset += 2;
+		if( jobs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create jobs.",
+			 function );
 
-		if( compression_chunk_header == 0 )
+			goto on_error;
+		}
+		/* Distribute the chunks over the jobs in contiguous ranges
+		 */
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
 		{
-			break;
+			jobs[ job_index ].compressed_data      = compressed_data;
+			jobs[ job_index ].compressed_data_size = compressed_data_size;
+			jobs[ job_index ].uncompressed_data    = uncompressed_data;
+			jobs[ job_index ].chunks               = &( chunks[ chunk_index ] );
+			jobs[ job_index ].number_of_chunks     = ( number_of_chunks - chunk_index ) / ( number_of_jobs - job_index );
+			jobs[ job_index ].result               = 0;
+
+			chunk_index += jobs[ job_index ].number_of_chunks;
 		}
-		compression_chunk_size = ( compression_chunk_header & 0x0fff ) + 1;
-
-		if( ( compression_chunk_header & 0x8000 ) != 0 )
+		if( number_of_threads > number_of_jobs )
 		{
-			/* Adjust the compression chunk size for the iteration
-			 */
-			uncompressed_chunk_size = safe_uncompressed_data_size - uncompressed_data_offset;
+			number_of_threads = number_of_jobs;
+		}
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     number_of_jobs,
+		     (int (*)(intptr_t *, void *)) &libfwnt_lznt1_decompress_job_callback,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
 
-			if( libfwnt_lznt1_decompress_chunk(
-			     compressed_data,
-			     compressed_data_size,
-			     &compressed_data_offset,
-			     compression_chunk_size,
-			     &( uncompressed_data[ uncompressed_data_offset ] ),
-			     &uncompressed_chunk_size,
+			goto on_error;
+		}
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( jobs[ job_index ] ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-				 "%s: unable to decompress chunk.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push job: %d onto thread pool.",
+				 function,
+				 job_index );
 
-				return( -1 );
+				goto on_error;
 			}
-			uncompressed_data_offset += uncompressed_chunk_size;
 		}
-		else
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
 		{
-			if( compression_chunk_size > ( compressed_data_size - compressed_data_offset ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: compressed data too small.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
 
-				return( -1 );
+			goto on_error;
+		}
+		result = 1;
+
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			if( jobs[ job_index ].result != 1 )
+			{
+				result = 0;
 			}
-			if( compression_chunk_size > ( safe_uncompressed_data_size - uncompressed_data_offset ) )
+		}
+		/* The chunk offsets are only valid if every chunk, except the last,
+		 * decompressed to its expected size
+		 */
+		for( chunk_index = 0;
+		     chunk_index < ( number_of_chunks - 1 );
+		     chunk_index++ )
+		{
+			if( chunks[ chunk_index ].uncompressed_chunk_size != ( chunks[ chunk_index + 1 ].uncompressed_data_offset - chunks[ chunk_index ].uncompressed_data_offset ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: uncompressed data too small.",
-				 function );
-
-				return( -1 );
+				result = 0;
 			}
-			if( memory_copy(
-			     &( uncompressed_data[ uncompressed_data_offset ] ),
-			     &( compressed_data[ compressed_data_offset ] ),
-			     compression_chunk_size ) == NULL )
+		}
+		if( result == 1 )
+		{
+			uncompressed_data_offset = chunks[ number_of_chunks - 1 ].uncompressed_data_offset
+			                         + chunks[ number_of_chunks - 1 ].uncompressed_chunk_size;
+
+			compressed_data_offset = chunks[ number_of_chunks - 1 ].compressed_data_offset
+			                       + chunks[ number_of_chunks - 1 ].compression_chunk_size;
+
+			/* The scan stops when the chunks are expected to fill the uncompressed data,
+			 * if the last chunk is shorter the data that follows it would be decompressed
+			 * as well, unless it starts with an empty chunk header
+			 */
+			if( ( uncompressed_data_offset < safe_uncompressed_data_size )
+			 && ( compressed_data_offset < compressed_data_size ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy copy compressed data to uncompressed data.",
-				 function );
+				if( ( compressed_data_offset + 1 ) >= compressed_data_size )
+				{
+					result = 0;
+				}
+				else
+				{
+					byte_stream_copy_to_uint16_little_endian(
+					 &( compressed_data[ compressed_data_offset ] ),
+					 compression_chunk_header );
 
-				return( -1 );
+					if( compression_chunk_header != 0 )
+					{
+						result = 0;
+					}
+				}
 			}
-			compressed_data_offset   += (size_t) compression_chunk_size;
-			uncompressed_data_offset += (size_t) compression_chunk_size;
+		}
+		if( result == 1 )
+		{
+			*uncompressed_data_size = uncompressed_data_offset;
+		}
+		memory_free(
+		 jobs );
+
+		jobs = NULL;
+
+		memory_free(
+		 chunks );
+
+		chunks = NULL;
+
+		if( result == 1 )
+		{
+			return( 1 );
 		}
 	}
-	*uncompressed_data_size = uncompressed_data_offset;
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Fall back to sequential decompression, which also determines
+	 * the error if the compressed data is corrupt
+	 */
+	if( libfwnt_lznt1_decompress(
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
 
+		return( -1 );
+	}
 	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( jobs != NULL )
+	{
+		memory_free(
+		 jobs );
+	}
+	if( chunks != NULL )
+	{
+		memory_free(
+		 chunks );
+	}
+	return( -1 );
+#endif
 }
 
@@ -32,6 +32,97 @@
 extern "C" {
 #endif
 
+/* The (uncompressed) size of a LZNT1 compression chunk
+ */
+#define LIBFWNT_LZNT1_COMPRESSION_CHUNK_SIZE		4096
+
+/* The number of bits of the match finder hash
+ */
+#define LIBFWNT_LZNT1_HASH_BITS				12
+
+/* The number of decompress jobs per thread, more jobs than threads
+ * balances the load when chunks take a different time to decompress
+ */
+#define LIBFWNT_LZNT1_NUMBER_OF_JOBS_PER_THREAD		4
+
+typedef struct libfwnt_lznt1_chunk libfwnt_lznt1_chunk_t;
+
+struct libfwnt_lznt1_chunk
+{
+	/* The offset of the chunk data in the compressed data
+	 */
+	size_t compressed_data_offset;
+
+	/* The compression chunk size
+	 */
+	uint16_t compression_chunk_size;
+
+	/* Value to indicate the chunk is compressed
+	 */
+	uint8_t is_compressed;
+
+	/* The offset of the chunk in the uncompressed data
+	 */
+	size_t uncompressed_data_offset;
+
+	/* The size of the uncompressed data available to the chunk
+	 */
+	size_t uncompressed_data_size;
+
+	/* The size of the uncompressed chunk
+	 */
+	size_t uncompressed_chunk_size;
+};
+
+typedef struct libfwnt_lznt1_decompress_job libfwnt_lznt1_decompress_job_t;
+
+struct libfwnt_lznt1_decompress_job
+{
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The chunks to decompress
+	 */
+	libfwnt_lznt1_chunk_t *chunks;
+
+	/* The number of chunks to decompress
+	 */
+	int number_of_chunks;
+
+	/* The result of decompressing the chunks
+	 */
+	int result;
+};
+
+int libfwnt_lznt1_compress_find_match(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     const uint16_t *hash_table,
+     const uint16_t *hash_chain,
+     int maximum_chain_length,
+     size_t maximum_match_size,
+     size_t *match_distance,
+     size_t *match_size,
+     libcerror_error_t **error );
+
+int libfwnt_lznt1_compress_chunk(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     int compression_level,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_lznt1_compress(
      const uint8_t *uncompressed_data,
@@ -40,6 +131,15 @@ int libfwnt_lznt1_compress(
      size_t *compressed_data_size,
      libcerror_error_t **error );
 
+LIBFWNT_EXTERN \
+int libfwnt_lznt1_compress_with_level(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int compression_level,
+     libcerror_error_t **error );
+
 int libfwnt_lznt1_decompress_chunk(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
@@ -57,6 +157,34 @@ int libfwnt_lznt1_decompress(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int libfwnt_lznt1_scan_chunks(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t uncompressed_data_size,
+     libfwnt_lznt1_chunk_t *chunks,
+     int *number_of_chunks,
+     libcerror_error_t **error );
+
+int libfwnt_lznt1_decompress_job_run(
+     libfwnt_lznt1_decompress_job_t *job );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libfwnt_lznt1_decompress_job_callback(
+     intptr_t *job,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+LIBFWNT_EXTERN \
+int libfwnt_lznt1_decompress_parallel(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,614 @@
+/*
+ * LZNT1 stream decoder functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_libcnotify.h"
+#include "libfwnt_lznt1.h"
+#include "libfwnt_lznt1_stream_decoder.h"
+#include "libfwnt_types.h"
+
+/* Creates a LZNT1 stream decoder
+ * Make sure the value stream_decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_lznt1_stream_decoder_initialize(
+     libfwnt_lznt1_stream_decoder_t **stream_decoder,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_lznt1_stream_decoder_t *internal_stream_decoder = NULL;
+	static char *function                                            = "libfwnt_lznt1_stream_decoder_initialize";
+
+	if( stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_decoder = memory_allocate_structure(
+	                           libfwnt_internal_lznt1_stream_decoder_t );
+
+	if( internal_stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_stream_decoder,
+	     0,
+	     sizeof( libfwnt_internal_lznt1_stream_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream decoder.",
+		 function );
+
+		memory_free(
+		 internal_stream_decoder );
+
+		return( -1 );
+	}
+	*stream_decoder = (libfwnt_lznt1_stream_decoder_t *) internal_stream_decoder;
+
+	return( 1 );
+}
+
+/* Frees a LZNT1 stream decoder
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_lznt1_stream_decoder_free(
+     libfwnt_lznt1_stream_decoder_t **stream_decoder,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_lznt1_stream_decoder_t *internal_stream_decoder = NULL;
+	static char *function                                            = "libfwnt_lznt1_stream_decoder_free";
+
+	if( stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_decoder != NULL )
+	{
+		internal_stream_decoder = (libfwnt_internal_lznt1_stream_decoder_t *) *stream_decoder;
+		*stream_decoder         = NULL;
+
+		memory_free(
+		 internal_stream_decoder );
+	}
+	return( 1 );
+}
+
+/* Resets a LZNT1 stream decoder to decode a new stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_lznt1_stream_decoder_reset(
+     libfwnt_lznt1_stream_decoder_t *stream_decoder,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_lznt1_stream_decoder_t *internal_stream_decoder = NULL;
+	static char *function                                            = "libfwnt_lznt1_stream_decoder_reset";
+
+	if( stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_decoder = (libfwnt_internal_lznt1_stream_decoder_t *) stream_decoder;
+
+	internal_stream_decoder->chunk_header_data_size         = 0;
+	internal_stream_decoder->compression_chunk_size         = 0;
+	internal_stream_decoder->chunk_is_compressed            = 0;
+	internal_stream_decoder->compressed_chunk_data_size     = 0;
+	internal_stream_decoder->uncompressed_chunk_data_size   = 0;
+	internal_stream_decoder->uncompressed_chunk_data_offset = 0;
+	internal_stream_decoder->end_of_stream                  = 0;
+
+	return( 1 );
+}
+
+/* Decodes the current compression chunk
+ * The chunk data must contain the compression chunk size number of bytes and
+ * the uncompressed data must be at least the compression chunk size (4096) bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_lznt1_stream_decoder_decode_chunk(
+     libfwnt_internal_lznt1_stream_decoder_t *internal_stream_decoder,
+     const uint8_t *chunk_data,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfwnt_internal_lznt1_stream_decoder_decode_chunk";
+	size_t compressed_data_offset = 0;
+
+	if( internal_stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size < LIBFWNT_LZNT1_COMPRESSION_CHUNK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: uncompressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_stream_decoder->chunk_is_compressed != 0 )
+	{
+		/* A compression chunk cannot decompress to more than the compression chunk size
+		 */
+		*uncompressed_data_size = LIBFWNT_LZNT1_COMPRESSION_CHUNK_SIZE;
+
+		if( libfwnt_lznt1_decompress_chunk(
+		     chunk_data,
+		     (size_t) internal_stream_decoder->compression_chunk_size,
+		     &compressed_data_offset,
+		     (size_t) internal_stream_decoder->compression_chunk_size,
+		     uncompressed_data,
+		     uncompressed_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress chunk.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( memory_copy(
+		     uncompressed_data,
+		     chunk_data,
+		     (size_t) internal_stream_decoder->compression_chunk_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy copy compressed data to uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		*uncompressed_data_size = (size_t) internal_stream_decoder->compression_chunk_size;
+	}
+	return( 1 );
+}
+
+/* Decompresses LZNT1 compressed data in a stream
+ * The compressed data is consumed and the uncompressed data is written in slices of any size.
+ * On return the compressed data size contains the number of bytes consumed and the uncompressed
+ * data size the number of bytes written. Use LIBFWNT_STREAM_FLAG_END_OF_INPUT to indicate
+ * that the compressed data contains the remainder of the stream.
+ * Compression chunks that are completely contained in the compressed data are decoded in place
+ * and, if the remaining uncompressed data size allows it, directly into the uncompressed data.
+ * Returns 1 if the end of the stream was reached, 0 if more compressed data or output space is needed or -1 on error
+ */
+int libfwnt_lznt1_stream_decoder_decompress(
+     libfwnt_lznt1_stream_decoder_t *stream_decoder,
+     const uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_lznt1_stream_decoder_t *internal_stream_decoder = NULL;
+	const uint8_t *chunk_data                                        = NULL;
+	uint8_t *uncompressed_chunk_data                                 = NULL;
+	static char *function                                            = "libfwnt_lznt1_stream_decoder_decompress";
+	size_t compressed_data_offset                                    = 0;
+	size_t read_size                                                 = 0;
+	size_t safe_compressed_data_size                                 = 0;
+	size_t safe_uncompressed_data_size                               = 0;
+	size_t uncompressed_chunk_size                                   = 0;
+	size_t uncompressed_data_offset                                  = 0;
+	uint16_t compression_chunk_header                                = 0;
+	uint8_t end_of_input                                             = 0;
+
+	if( stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_decoder = (libfwnt_internal_lznt1_stream_decoder_t *) stream_decoder;
+
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data == NULL )
+	 && ( *compressed_data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBFWNT_STREAM_FLAG_END_OF_INPUT ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	safe_compressed_data_size   = *compressed_data_size;
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	if( ( flags & LIBFWNT_STREAM_FLAG_END_OF_INPUT ) != 0 )
+	{
+		end_of_input = 1;
+	}
+	while( internal_stream_decoder->end_of_stream == 0 )
+	{
+		/* Output the remainder of the previous compression chunk first
+		 */
+		if( internal_stream_decoder->uncompressed_chunk_data_offset < internal_stream_decoder->uncompressed_chunk_data_size )
+		{
+			read_size = internal_stream_decoder->uncompressed_chunk_data_size - internal_stream_decoder->uncompressed_chunk_data_offset;
+
+			if( read_size > ( safe_uncompressed_data_size - uncompressed_data_offset ) )
+			{
+				read_size = safe_uncompressed_data_size - uncompressed_data_offset;
+			}
+			if( read_size == 0 )
+			{
+				break;
+			}
+			if( memory_copy(
+			     &( uncompressed_data[ uncompressed_data_offset ] ),
+			     &( internal_stream_decoder->uncompressed_chunk_data[ internal_stream_decoder->uncompressed_chunk_data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy uncompressed chunk data.",
+				 function );
+
+				return( -1 );
+			}
+			internal_stream_decoder->uncompressed_chunk_data_offset += read_size;
+			uncompressed_data_offset                                += read_size;
+
+			continue;
+		}
+		if( internal_stream_decoder->chunk_header_data_size < 2 )
+		{
+			while( ( internal_stream_decoder->chunk_header_data_size < 2 )
+			    && ( compressed_data_offset < safe_compressed_data_size ) )
+			{
+				internal_stream_decoder->chunk_header_data[ internal_stream_decoder->chunk_header_data_size++ ] = compressed_data[ compressed_data_offset++ ];
+			}
+			if( internal_stream_decoder->chunk_header_data_size < 2 )
+			{
+				if( end_of_input == 0 )
+				{
+					break;
+				}
+				if( internal_stream_decoder->chunk_header_data_size != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: compressed data size value too small.",
+					 function );
+
+					return( -1 );
+				}
+				internal_stream_decoder->end_of_stream = 1;
+
+				break;
+			}
+			/* The first 2 bytes contain the compressed chunk header
+			 * 0  - 11	compressed chunk size
+			 * 12 - 14	signature value
+			 * 15		is compressed flag
+			 */
+			byte_stream_copy_to_uint16_little_endian(
+			 internal_stream_decoder->chunk_header_data,
+			 compression_chunk_header );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: compression chunk header\t\t\t: 0x%04" PRIx16 "\n",
+				 function,
+				 compression_chunk_header );
+
+				libcnotify_printf(
+				 "\n" );
+			}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+			if( compression_chunk_header == 0 )
+			{
+				internal_stream_decoder->end_of_stream = 1;
+
+				break;
+			}
+			internal_stream_decoder->compression_chunk_size     = ( compression_chunk_header & 0x0fff ) + 1;
+			internal_stream_decoder->chunk_is_compressed        = (uint8_t) ( compression_chunk_header >> 15 );
+			internal_stream_decoder->compressed_chunk_data_size = 0;
+		}
+		/* Decode the compression chunk in place when it is completely contained in the compressed data
+		 * otherwise collect it in the compressed chunk data
+		 */
+		read_size = (size_t) internal_stream_decoder->compression_chunk_size - internal_stream_decoder->compressed_chunk_data_size;
+
+		if( ( internal_stream_decoder->compressed_chunk_data_size == 0 )
+		 && ( read_size <= ( safe_compressed_data_size - compressed_data_offset ) ) )
+		{
+			chunk_data = &( compressed_data[ compressed_data_offset ] );
+
+			compressed_data_offset += read_size;
+		}
+		else
+		{
+			if( read_size > ( safe_compressed_data_size - compressed_data_offset ) )
+			{
+				read_size = safe_compressed_data_size - compressed_data_offset;
+			}
+			if( read_size > 0 )
+			{
+				if( memory_copy(
+				     &( internal_stream_decoder->compressed_chunk_data[ internal_stream_decoder->compressed_chunk_data_size ] ),
+				     &( compressed_data[ compressed_data_offset ] ),
+				     read_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy compressed chunk data.",
+					 function );
+
+					return( -1 );
+				}
+				internal_stream_decoder->compressed_chunk_data_size += read_size;
+				compressed_data_offset                              += read_size;
+			}
+			if( internal_stream_decoder->compressed_chunk_data_size < (size_t) internal_stream_decoder->compression_chunk_size )
+			{
+				if( end_of_input == 0 )
+				{
+					break;
+				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data too small.",
+				 function );
+
+				return( -1 );
+			}
+			chunk_data = internal_stream_decoder->compressed_chunk_data;
+		}
+		/* Decode the compression chunk directly into the uncompressed data when it fits
+		 * otherwise decode it into the uncompressed chunk data
+		 */
+		if( ( safe_uncompressed_data_size - uncompressed_data_offset ) >= LIBFWNT_LZNT1_COMPRESSION_CHUNK_SIZE )
+		{
+			uncompressed_chunk_data = &( uncompressed_data[ uncompressed_data_offset ] );
+		}
+		else
+		{
+			uncompressed_chunk_data = internal_stream_decoder->uncompressed_chunk_data;
+		}
+		uncompressed_chunk_size = LIBFWNT_LZNT1_COMPRESSION_CHUNK_SIZE;
+
+		if( libfwnt_internal_lznt1_stream_decoder_decode_chunk(
+		     internal_stream_decoder,
+		     chunk_data,
+		     uncompressed_chunk_data,
+		     &uncompressed_chunk_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decode chunk.",
+			 function );
+
+			return( -1 );
+		}
+		if( uncompressed_chunk_data == internal_stream_decoder->uncompressed_chunk_data )
+		{
+			internal_stream_decoder->uncompressed_chunk_data_size   = uncompressed_chunk_size;
+			internal_stream_decoder->uncompressed_chunk_data_offset = 0;
+		}
+		else
+		{
+			uncompressed_data_offset += uncompressed_chunk_size;
+		}
+		internal_stream_decoder->chunk_header_data_size     = 0;
+		internal_stream_decoder->compressed_chunk_data_size = 0;
+	}
+	*compressed_data_size   = compressed_data_offset;
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	if( internal_stream_decoder->end_of_stream != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
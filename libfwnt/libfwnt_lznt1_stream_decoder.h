@@ -0,0 +1,121 @@
+/*
+ * LZNT1 stream decoder functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_INTERNAL_LZNT1_STREAM_DECODER_H )
+#define _LIBFWNT_INTERNAL_LZNT1_STREAM_DECODER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_lznt1.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwnt_internal_lznt1_stream_decoder libfwnt_internal_lznt1_stream_decoder_t;
+
+struct libfwnt_internal_lznt1_stream_decoder
+{
+	/* The compression chunk header data
+	 */
+	uint8_t chunk_header_data[ 2 ];
+
+	/* The size of the compression chunk header data that has been read
+	 */
+	uint8_t chunk_header_data_size;
+
+	/* The compression chunk size
+	 */
+	uint16_t compression_chunk_size;
+
+	/* Value to indicate the compression chunk is compressed
+	 */
+	uint8_t chunk_is_compressed;
+
+	/* The compressed chunk data
+	 * that contains a compression chunk that was provided in multiple slices
+	 */
+	uint8_t compressed_chunk_data[ LIBFWNT_LZNT1_COMPRESSION_CHUNK_SIZE ];
+
+	/* The size of the compressed chunk data
+	 */
+	size_t compressed_chunk_data_size;
+
+	/* The uncompressed chunk data
+	 * that contains the part of a compression chunk that did not fit in the output
+	 */
+	uint8_t uncompressed_chunk_data[ LIBFWNT_LZNT1_COMPRESSION_CHUNK_SIZE ];
+
+	/* The size of the uncompressed chunk data
+	 */
+	size_t uncompressed_chunk_data_size;
+
+	/* The offset in the uncompressed chunk data of the next byte to output
+	 */
+	size_t uncompressed_chunk_data_offset;
+
+	/* Value to indicate the end of the stream was reached
+	 */
+	uint8_t end_of_stream;
+};
+
+LIBFWNT_EXTERN \
+int libfwnt_lznt1_stream_decoder_initialize(
+     libfwnt_lznt1_stream_decoder_t **stream_decoder,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_lznt1_stream_decoder_free(
+     libfwnt_lznt1_stream_decoder_t **stream_decoder,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_lznt1_stream_decoder_reset(
+     libfwnt_lznt1_stream_decoder_t *stream_decoder,
+     libcerror_error_t **error );
+
+int libfwnt_internal_lznt1_stream_decoder_decode_chunk(
+     libfwnt_internal_lznt1_stream_decoder_t *internal_stream_decoder,
+     const uint8_t *chunk_data,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_lznt1_stream_decoder_decompress(
+     libfwnt_lznt1_stream_decoder_t *stream_decoder,
+     const uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_INTERNAL_LZNT1_STREAM_DECODER_H ) */
+
@@ -20,23 +20,17 @@
  */
 
 #include <common.h>
-#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
 #include "libfwnt_bit_stream.h"
+#include "libfwnt_call_instruction.h"
 #include "libfwnt_huffman_tree.h"
 #include "libfwnt_libcerror.h"
 #include "libfwnt_libcnotify.h"
 #include "libfwnt_lzx.h"
-
-#if !defined( LIBFWNT_LZX_ATTRIBUTE_FALLTHROUGH )
-#if defined( __GNUC__ ) && __GNUC__ >= 7
-#define LIBFWNT_LZX_ATTRIBUTE_FALLTHROUGH      __attribute__ ((fallthrough))
-#else
-#define LIBFWNT_LZX_ATTRIBUTE_FALLTHROUGH
-#endif
-#endif
+#include "libfwnt_lzx_decoder.h"
+#include "libfwnt_match_copy.h"
 
 /* Base position - 2
  */
@@ -57,20 +51,20 @@ const uint8_t libfwnt_lzx_number_of_footer_bits[ 50 ] = {
  */
 int libfwnt_lzx_read_huffman_code_sizes(
      libfwnt_bit_stream_t *bit_stream,
+     libfwnt_huffman_tree_t *pre_codes_huffman_tree,
      uint8_t *code_size_array,
      int number_of_code_sizes,
      libcerror_error_t **error )
 {
 	uint8_t pre_code_size_array[ 20 ];
 
-	libfwnt_huffman_tree_t *pre_codes_huffman_tree = NULL;
-	static char *function                          = "libfwnt_lzx_read_huffman_code_sizes";
-	uint32_t symbol                                = 0;
-	uint32_t times_to_repeat                       = 0;
-	uint32_t value_32bit                           = 0;
-	int32_t code_size                              = 0;
-	uint8_t pre_code_index                         = 0;
-	int code_size_index                            = 0;
+	static char *function    = "libfwnt_lzx_read_huffman_code_sizes";
+	uint32_t symbol          = 0;
+	uint32_t times_to_repeat = 0;
+	uint32_t value_32bit     = 0;
+	int32_t code_size        = 0;
+	uint8_t pre_code_index   = 0;
+	int code_size_index      = 0;
 
 	if( bit_stream == NULL )
 	{
@@ -83,6 +77,17 @@ int libfwnt_lzx_read_huffman_code_sizes(
 
 		return( -1 );
 	}
+	if( pre_codes_huffman_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pre-codes Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
 	for( pre_code_index = 0;
 	     pre_code_index < 20;
 	     pre_code_index++ )
@@ -101,7 +106,7 @@ int libfwnt_lzx_read_huffman_code_sizes(
 			 function,
 			 pre_code_index );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( libcnotify_verbose != 0 )
 		{
@@ -118,21 +123,6 @@ int libfwnt_lzx_read_huffman_code_sizes(
 		libcnotify_printf(
 		 "\n" );
 	}
-	if( libfwnt_huffman_tree_initialize(
-	     &pre_codes_huffman_tree,
-	     20,
-	     15,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pre-codes Huffman tree.",
-		 function );
-
-		goto on_error;
-	}
 	if( libfwnt_huffman_tree_build(
 	     pre_codes_huffman_tree,
 	     pre_code_size_array,
@@ -146,7 +136,7 @@ int libfwnt_lzx_read_huffman_code_sizes(
 		 "%s: unable to build pre-codes Huffman tree.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	code_size_index = 0;
 
@@ -165,7 +155,7 @@ int libfwnt_lzx_read_huffman_code_sizes(
 			 "%s: unable to retrieve symbol from pre-codes Huffman tree.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( libcnotify_verbose != 0 )
 		{
@@ -212,7 +202,7 @@ int libfwnt_lzx_read_huffman_code_sizes(
 				 "%s: unable to retrieve times to repeat from bit stream.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			times_to_repeat += 4;
 		}
@@ -231,7 +221,7 @@ int libfwnt_lzx_read_huffman_code_sizes(
 				 "%s: unable to retrieve times to repeat from bit stream.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			times_to_repeat += 20;
 		}
@@ -250,7 +240,7 @@ int libfwnt_lzx_read_huffman_code_sizes(
 				 "%s: unable to retrieve times to repeat from bit stream.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			times_to_repeat += 4;
 
@@ -267,7 +257,7 @@ int libfwnt_lzx_read_huffman_code_sizes(
 				 "%s: unable to retrieve symbol from pre-codes Huffman tree.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			if( symbol > 17 )
 			{
@@ -278,7 +268,7 @@ int libfwnt_lzx_read_huffman_code_sizes(
 				 "%s: invalid code size symbol value out of bounds.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			code_size = code_size_array[ code_size_index ] - symbol;
 
@@ -296,7 +286,7 @@ int libfwnt_lzx_read_huffman_code_sizes(
 			 "%s: invalid code size symbol value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( libcnotify_verbose != 0 )
 		{
@@ -330,34 +320,12 @@ int libfwnt_lzx_read_huffman_code_sizes(
 			times_to_repeat--;
 		}
 	}
-	if( libfwnt_huffman_tree_free(
-	     &pre_codes_huffman_tree,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free pre-codes Huffman tree.",
-		 function );
-
-		goto on_error;
-	}
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
 		 "\n" );
 	}
 	return( 1 );
-
-on_error:
-	if( pre_codes_huffman_tree != NULL )
-	{
-		libfwnt_huffman_tree_free(
-		 &pre_codes_huffman_tree,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Reads and builds the literals and match headers Huffman tree
@@ -365,6 +333,7 @@ on_error:
  */
 int libfwnt_lzx_build_main_huffman_tree(
      libfwnt_bit_stream_t *bit_stream,
+     libfwnt_huffman_tree_t *pre_codes_huffman_tree,
      uint8_t *code_size_array,
      libfwnt_huffman_tree_t *huffman_tree,
      libcerror_error_t **error )
@@ -373,6 +342,7 @@ int libfwnt_lzx_build_main_huffman_tree(
 
 	if( libfwnt_lzx_read_huffman_code_sizes(
 	     bit_stream,
+	     pre_codes_huffman_tree,
 	     code_size_array,
 	     256,
 	     error ) != 1 )
@@ -388,6 +358,7 @@ int libfwnt_lzx_build_main_huffman_tree(
 	}
 	if( libfwnt_lzx_read_huffman_code_sizes(
 	     bit_stream,
+	     pre_codes_huffman_tree,
 	     &( code_size_array[ 256 ] ),
 	     240,
 	     error ) != 1 )
@@ -424,6 +395,7 @@ int libfwnt_lzx_build_main_huffman_tree(
  */
 int libfwnt_lzx_build_lengths_huffman_tree(
      libfwnt_bit_stream_t *bit_stream,
+     libfwnt_huffman_tree_t *pre_codes_huffman_tree,
      uint8_t *code_size_array,
      libfwnt_huffman_tree_t *huffman_tree,
      libcerror_error_t **error )
@@ -432,6 +404,7 @@ int libfwnt_lzx_build_lengths_huffman_tree(
 
 	if( libfwnt_lzx_read_huffman_code_sizes(
 	     bit_stream,
+	     pre_codes_huffman_tree,
 	     code_size_array,
 	     249,
 	     error ) != 1 )
@@ -597,6 +570,25 @@ int libfwnt_lzx_decode_huffman(
 
 	while( data_offset < data_end_offset )
 	{
+		/* A literal or match requires at most 16 + 16 + 17 bits, refill the bit buffer
+		 * in advance so that the Huffman trees and footer bits can use it directly
+		 */
+		if( bit_stream->bit_buffer_size < 32 )
+		{
+			if( libfwnt_bit_stream_refill(
+			     bit_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to refill bit stream.",
+				 function );
+
+				return( -1 );
+			}
+		}
 		if( libfwnt_huffman_tree_get_symbol_from_bit_stream(
 		     main_huffman_tree,
 		     bit_stream,
@@ -771,13 +763,13 @@ int libfwnt_lzx_decode_huffman(
 
 				return( -1 );
 			}
-			while( compression_size > 0 )
-			{
-				uncompressed_data[ data_offset ] = uncompressed_data[ data_offset - compression_offset ];
+			libfwnt_match_copy(
+			 uncompressed_data,
+			 data_offset,
+			 (size_t) compression_offset,
+			 (size_t) compression_size );
 
-				data_offset++;
-				compression_size--;
-			}
+			data_offset += compression_size;
 		}
 	}
 	*uncompressed_data_offset = data_offset;
@@ -786,6 +778,8 @@ int libfwnt_lzx_decode_huffman(
 }
 
 /* Adjusts the 32-bit Intel 80x86 CALL (0xe8) instructions after decompression
+ * The decoder uses the uncompressed data as its sliding window, hence the instructions
+ * can only be adjusted after all the data that matches can refer to has been decoded
  * Returns 1 on success or -1 on error
  */
 int libfwnt_lzx_decompress_adjust_call_instructions(
@@ -793,9 +787,7 @@ int libfwnt_lzx_decompress_adjust_call_instructions(
      size_t uncompressed_data_size,
      libcerror_error_t **error )
 {
-	static char *function           = "libfwnt_lzx_decompress_adjust_call_instructions";
-	size_t uncompressed_data_offset = 0;
-	uint32_t address                = 0;
+	static char *function = "libfwnt_lzx_decompress_adjust_call_instructions";
 
 	if( uncompressed_data == NULL )
 	{
@@ -808,54 +800,30 @@ int libfwnt_lzx_decompress_adjust_call_instructions(
 
 		return( -1 );
 	}
-	if( ( uncompressed_data_size < 6 )
-	 || ( uncompressed_data_size > (size_t) SSIZE_MAX ) )
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid uncompressed data size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	for( uncompressed_data_offset = 0;
-	     uncompressed_data_offset < ( uncompressed_data_size - 6 );
-	     uncompressed_data_offset++ )
+	/* Call instructions in data of less than 10 bytes are not adjusted
+	 */
+	if( uncompressed_data_size < LIBFWNT_CALL_INSTRUCTION_MINIMUM_DATA_SIZE )
 	{
-		if( uncompressed_data[ uncompressed_data_offset ] != 0xe8 )
-		{
-			continue;
-		}
-		byte_stream_copy_to_uint32_little_endian(
-		 &( uncompressed_data[ uncompressed_data_offset + 1 ] ),
-		 address );
-
-		if( address > (uint32_t) INT32_MAX )
-		{
-			if( (int32_t) address > ( -1 * (int32_t) uncompressed_data_offset ) )
-			{
-				address = (uint32_t) ( (int32_t) address + 12000000 );
-
-				byte_stream_copy_from_uint32_little_endian(
-				 &( uncompressed_data[ uncompressed_data_offset + 1 ] ),
-				 address );
-			}
-		}
-		else
-		{
-			if( address < 12000000 )
-			{
-				address = (uint32_t) ( (int32_t) address - uncompressed_data_offset );
-
-				byte_stream_copy_from_uint32_little_endian(
-				 &( uncompressed_data[ uncompressed_data_offset + 1 ] ),
-				 address );
-			}
-		}
-		uncompressed_data_offset += 4;
+		return( 1 );
 	}
+	/* Call instructions in the last 6 bytes are not adjusted
+	 */
+	libfwnt_call_instruction_translate(
+	 uncompressed_data,
+	 0,
+	 uncompressed_data_size - 6 );
+
 	return( 1 );
 }
 
@@ -869,23 +837,15 @@ int libfwnt_lzx_decompress(
      size_t *uncompressed_data_size,
      libcerror_error_t **error )
 {
-	uint8_t aligned_offsets_code_size_array[ 8 ];
-	uint8_t lengths_code_size_array[ 249 ];
-	uint8_t main_code_size_array[ 256 + 240 ];
-
-	uint32_t recent_compression_offsets[ 3 ]             = { 1, 1, 1 };
-
 	libfwnt_bit_stream_t *bit_stream                     = NULL;
 	libfwnt_huffman_tree_t *aligned_offsets_huffman_tree = NULL;
-	libfwnt_huffman_tree_t *lengths_huffman_tree         = NULL;
-	libfwnt_huffman_tree_t *main_huffman_tree            = NULL;
+	libfwnt_internal_lzx_decoder_t *internal_decoder     = NULL;
+	libfwnt_lzx_decoder_t *decoder                       = NULL;
 	static char *function                                = "libfwnt_lzx_decompress";
 	size_t safe_uncompressed_data_size                   = 0;
 	size_t uncompressed_data_offset                      = 0;
 	uint32_t block_size                                  = 0;
 	uint32_t block_type                                  = 0;
-	int initialized_aligned_offsets_code_size_array      = 0;
-	int initialized_main_and_length_code_size_arrays     = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -942,10 +902,23 @@ int libfwnt_lzx_decompress(
 
 		return( -1 );
 	}
-	safe_uncompressed_data_size = *uncompressed_data_size;
+	if( libfwnt_lzx_decoder_initialize(
+	     &decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	internal_decoder = (libfwnt_internal_lzx_decoder_t *) decoder;
 
-	if( libfwnt_bit_stream_initialize(
-	     &bit_stream,
+	if( libfwnt_internal_lzx_decoder_reset(
+	     internal_decoder,
 	     compressed_data,
 	     compressed_data_size,
 	     error ) != 1 )
@@ -953,37 +926,24 @@ int libfwnt_lzx_decompress(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create bit-stream.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset decoder.",
 		 function );
 
 		goto on_error;
 	}
-/* TODO find optimized solution to read bit stream from bytes */
+	bit_stream                  = &( internal_decoder->bit_stream );
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
 	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
 	{
 		if( uncompressed_data_offset >= safe_uncompressed_data_size )
 		{
 			break;
 		}
-		if( libfwnt_bit_stream_get_value(
-		     bit_stream,
-		     3,
+		if( libfwnt_internal_lzx_decoder_read_block_header(
+		     internal_decoder,
 		     &block_type,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from bit stream.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfwnt_bit_stream_get_value(
-		     bit_stream,
-		     1,
 		     &block_size,
 		     error ) != 1 )
 		{
@@ -991,227 +951,28 @@ int libfwnt_lzx_decompress(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from bit stream.",
+			 "%s: unable to read block header.",
 			 function );
 
 			goto on_error;
 		}
-		if( block_size != 0 )
-		{
-			block_size = 32768;
-		}
-		else
-		{
-			if( libfwnt_bit_stream_get_value(
-			     bit_stream,
-			     16,
-			     &block_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value from bit stream.",
-				 function );
-
-				goto on_error;
-			}
-/* TODO add extended block size support ? */
-		}
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: block header block type\t\t\t\t: %" PRIu32 " (",
-			 function,
-			 block_type );
-
-			switch( block_type )
-			{
-				case LIBFWNT_LZX_BLOCK_TYPE_ALIGNED:
-					libcnotify_printf(
-					 "Aligned" );
-					break;
-
-				case LIBFWNT_LZX_BLOCK_TYPE_VERBATIM:
-					libcnotify_printf(
-					 "Verbatim" );
-					break;
-
-				case LIBFWNT_LZX_BLOCK_TYPE_UNCOMPRESSED:
-					libcnotify_printf(
-					 "Uncompressed" );
-					break;
-
-				default:
-					libcnotify_printf(
-					 "Invalid" );
-					break;
-			}
-			libcnotify_printf(
-			 ")\n" );
-
-			libcnotify_printf(
-			 "%s: block header block size\t\t\t\t: %" PRIu32 "\n",
-			 function,
-			 block_size );
-
-			libcnotify_printf(
-			 "\n" );
-		}
 		switch( block_type )
 		{
 			case LIBFWNT_LZX_BLOCK_TYPE_ALIGNED:
-				if( initialized_aligned_offsets_code_size_array == 0 )
-				{
-					if( memory_set(
-					     aligned_offsets_code_size_array,
-					     0,
-					     sizeof( uint8_t ) * 8 ) == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_MEMORY,
-						 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-						 "%s: unable to clear aligned offsets code size array.",
-						 function );
-
-						goto on_error;
-					}
-					initialized_aligned_offsets_code_size_array = 1;
-				}
-				if( libfwnt_huffman_tree_initialize(
-				     &aligned_offsets_huffman_tree,
-				     256,
-				     16,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create aligned offsets Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libfwnt_lzx_build_aligned_offsets_huffman_tree(
-				     bit_stream,
-				     aligned_offsets_code_size_array,
-				     aligned_offsets_huffman_tree,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build aligned offsets Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-
-			LIBFWNT_LZX_ATTRIBUTE_FALLTHROUGH;
 			case LIBFWNT_LZX_BLOCK_TYPE_VERBATIM:
-				if( initialized_main_and_length_code_size_arrays == 0 )
-				{
-					if( memory_set(
-					     main_code_size_array,
-					     0,
-					     sizeof( uint8_t ) * ( 256 + 240 ) ) == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_MEMORY,
-						 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-						 "%s: unable to clear main code size array.",
-						 function );
+				aligned_offsets_huffman_tree = NULL;
 
-						goto on_error;
-					}
-					if( memory_set(
-					     lengths_code_size_array,
-					     0,
-					     sizeof( uint8_t ) * 249 ) == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_MEMORY,
-						 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-						 "%s: unable to clear lengths code size array.",
-						 function );
-
-						goto on_error;
-					}
-					initialized_main_and_length_code_size_arrays = 1;
-				}
-				if( libfwnt_huffman_tree_initialize(
-				     &main_huffman_tree,
-				     256 + 240,
-				     16,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create literals and match headers Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libfwnt_lzx_build_main_huffman_tree(
-				     bit_stream,
-				     main_code_size_array,
-				     main_huffman_tree,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build literals and match headers Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libfwnt_huffman_tree_initialize(
-				     &lengths_huffman_tree,
-				     249,
-				     16,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create lengths Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libfwnt_lzx_build_lengths_huffman_tree(
-				     bit_stream,
-				     lengths_code_size_array,
-				     lengths_huffman_tree,
-				     error ) != 1 )
+				if( block_type == LIBFWNT_LZX_BLOCK_TYPE_ALIGNED )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to build lengths Huffman tree.",
-					 function );
-
-					goto on_error;
+					aligned_offsets_huffman_tree = internal_decoder->aligned_offsets_huffman_tree;
 				}
 				if( libfwnt_lzx_decode_huffman(
 				     bit_stream,
 				     block_size,
-				     main_huffman_tree,
-				     lengths_huffman_tree,
+				     internal_decoder->main_huffman_tree,
+				     internal_decoder->lengths_huffman_tree,
 				     aligned_offsets_huffman_tree,
-				     recent_compression_offsets,
+				     internal_decoder->recent_compression_offsets,
 				     uncompressed_data,
 				     safe_uncompressed_data_size,
 				     &uncompressed_data_offset,
@@ -1226,238 +987,65 @@ int libfwnt_lzx_decompress(
 
 					goto on_error;
 				}
-				if( aligned_offsets_huffman_tree != NULL )
-				{
-					if( libfwnt_huffman_tree_free(
-					     &aligned_offsets_huffman_tree,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-						 "%s: unable to free aligned offsets Huffman tree.",
-						 function );
-
-						goto on_error;
-					}
-				}
-				if( libfwnt_huffman_tree_free(
-				     &lengths_huffman_tree,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free lengths Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
-				if( libfwnt_huffman_tree_free(
-				     &main_huffman_tree,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free literals and match headers Huffman tree.",
-					 function );
-
-					goto on_error;
-				}
 				break;
 
 			case LIBFWNT_LZX_BLOCK_TYPE_UNCOMPRESSED:
-/* TODO align byte stream */
-				if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) < 12 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: invalid compressed data value too small.",
-					 function );
-
-					goto on_error;
-				}
-				byte_stream_copy_to_uint32_little_endian(
-				 &( compressed_data[ bit_stream->byte_stream_offset ] ),
-				 recent_compression_offsets[ 0 ] );
-
-				bit_stream->byte_stream_offset += 4;
-
-				byte_stream_copy_to_uint32_little_endian(
-				 &( compressed_data[ bit_stream->byte_stream_offset ] ),
-				 recent_compression_offsets[ 1 ] );
-
-				bit_stream->byte_stream_offset += 4;
-
-				byte_stream_copy_to_uint32_little_endian(
-				 &( compressed_data[ bit_stream->byte_stream_offset ] ),
-				 recent_compression_offsets[ 2 ] );
-
-				bit_stream->byte_stream_offset += 4;
-
-				if( recent_compression_offsets[ 0 ] == 0 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-					 "%s: unsupported R0 value.",
-					 function );
-
-					goto on_error;
-				}
-				if( recent_compression_offsets[ 1 ] == 0 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-					 "%s: unsupported R1 value.",
-					 function );
-
-					goto on_error;
-				}
-				if( recent_compression_offsets[ 2 ] == 0 )
+				if( libfwnt_internal_lzx_decoder_read_uncompressed_block(
+				     internal_decoder,
+				     block_size,
+				     uncompressed_data,
+				     safe_uncompressed_data_size,
+				     &uncompressed_data_offset,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-					 "%s: unsupported R2 value.",
-					 function );
-
-					goto on_error;
-				}
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: R0 value\t\t\t\t\t: 0x%08" PRIx32 "\n",
-					 function,
-					 recent_compression_offsets[ 0 ] );
-
-					libcnotify_printf(
-					 "%s: R1 value\t\t\t\t\t: 0x%08" PRIx32 "\n",
-					 function,
-					 recent_compression_offsets[ 1 ] );
-
-					libcnotify_printf(
-					 "%s: R2 value\t\t\t\t\t: 0x%08" PRIx32 "\n",
-					 function,
-					 recent_compression_offsets[ 2 ] );
-
-					libcnotify_printf(
-					 "\n" );
-				}
-				if( (size_t) block_size > ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) )
-				{
-					block_size = (uint32_t) ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset );
-				}
-				if( (size_t) block_size > ( safe_uncompressed_data_size - uncompressed_data_offset ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: invalid uncompressed data value too small.",
-					 function );
-
-					goto on_error;
-				}
-				if( memory_copy(
-				     &( uncompressed_data[ uncompressed_data_offset ] ),
-				     &( compressed_data[ bit_stream->byte_stream_offset ] ),
-				     (size_t) block_size ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-					 "%s: unable to initialize lz buffer.",
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to read uncompressed block.",
 					 function );
 
 					goto on_error;
 				}
-				bit_stream->byte_stream_offset += block_size;
-				uncompressed_data_offset       += block_size;
-
-				/* Flush the bit-stream buffer
-				 */
-				bit_stream->bit_buffer      = 0;
-				bit_stream->bit_buffer_size = 0;
-
 				break;
-
-			default:
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported block type.",
-				 function );
-
-				goto on_error;
 		}
 	}
-	if( libfwnt_bit_stream_free(
-	     &bit_stream,
+	if( libfwnt_lzx_decompress_adjust_call_instructions(
+	     uncompressed_data,
+	     uncompressed_data_offset,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free bit-stream.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to adjust call instructions.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfwnt_lzx_decompress_adjust_call_instructions(
-	     uncompressed_data,
-	     uncompressed_data_offset,
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	if( libfwnt_lzx_decoder_free(
+	     &decoder,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to adjust call instructions.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decoder.",
 		 function );
 
 		goto on_error;
 	}
-	*uncompressed_data_size = uncompressed_data_offset;
-
 	return( 1 );
 
 on_error:
-	if( lengths_huffman_tree != NULL )
-	{
-		libfwnt_huffman_tree_free(
-		 &lengths_huffman_tree,
-		 NULL );
-	}
-	if( main_huffman_tree != NULL )
-	{
-		libfwnt_huffman_tree_free(
-		 &main_huffman_tree,
-		 NULL );
-	}
-	if( aligned_offsets_huffman_tree != NULL )
-	{
-		libfwnt_huffman_tree_free(
-		 &aligned_offsets_huffman_tree,
-		 NULL );
-	}
-	if( bit_stream != NULL )
+	if( decoder != NULL )
 	{
-		libfwnt_bit_stream_free(
-		 &bit_stream,
+		libfwnt_lzx_decoder_free(
+		 &decoder,
 		 NULL );
 	}
 	return( -1 );
@@ -45,18 +45,21 @@ enum LIBFWNT_LZX_BLOCK_TYPES
 
 int libfwnt_lzx_read_huffman_code_sizes(
      libfwnt_bit_stream_t *bit_stream,
+     libfwnt_huffman_tree_t *pre_codes_huffman_tree,
      uint8_t *code_size_array,
      int number_of_code_sizes,
      libcerror_error_t **error );
 
 int libfwnt_lzx_build_main_huffman_tree(
      libfwnt_bit_stream_t *bit_stream,
+     libfwnt_huffman_tree_t *pre_codes_huffman_tree,
      uint8_t *code_size_array,
      libfwnt_huffman_tree_t *main_huffman_tre,
      libcerror_error_t **error );
 
 int libfwnt_lzx_build_lengths_huffman_tree(
      libfwnt_bit_stream_t *bit_stream,
+     libfwnt_huffman_tree_t *pre_codes_huffman_tree,
      uint8_t *code_size_array,
      libfwnt_huffman_tree_t *lengths_huffman_tre,
      libcerror_error_t **error );
@@ -79,6 +82,11 @@ int libfwnt_lzx_decode_huffman(
      size_t *uncompressed_data_offset,
      libcerror_error_t **error );
 
+int libfwnt_lzx_decompress_adjust_call_instructions(
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_lzx_decompress(
      const uint8_t *compressed_data,
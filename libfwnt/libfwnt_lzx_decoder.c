@@ -0,0 +1,987 @@
+/*
+ * LZX decoder functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_bit_stream.h"
+#include "libfwnt_huffman_tree.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_libcnotify.h"
+#include "libfwnt_lzx.h"
+#include "libfwnt_lzx_decoder.h"
+#include "libfwnt_types.h"
+
+#if !defined( LIBFWNT_LZX_ATTRIBUTE_FALLTHROUGH )
+#if defined( __GNUC__ ) && __GNUC__ >= 7
+#define LIBFWNT_LZX_ATTRIBUTE_FALLTHROUGH      __attribute__ ((fallthrough))
+#else
+#define LIBFWNT_LZX_ATTRIBUTE_FALLTHROUGH
+#endif
+#endif
+
+/* Creates a LZX decoder
+ * Make sure the value decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_lzx_decoder_initialize(
+     libfwnt_lzx_decoder_t **decoder,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_lzx_decoder_t *internal_decoder = NULL;
+	static char *function                            = "libfwnt_lzx_decoder_initialize";
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_decoder = memory_allocate_structure(
+	                    libfwnt_internal_lzx_decoder_t );
+
+	if( internal_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_decoder,
+	     0,
+	     sizeof( libfwnt_internal_lzx_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decoder.",
+		 function );
+
+		memory_free(
+		 internal_decoder );
+
+		return( -1 );
+	}
+	if( libfwnt_huffman_tree_initialize(
+	     &( internal_decoder->pre_codes_huffman_tree ),
+	     20,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pre-codes Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwnt_huffman_tree_initialize(
+	     &( internal_decoder->main_huffman_tree ),
+	     256 + 240,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create literals and match headers Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwnt_huffman_tree_initialize(
+	     &( internal_decoder->lengths_huffman_tree ),
+	     249,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create lengths Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwnt_huffman_tree_initialize(
+	     &( internal_decoder->aligned_offsets_huffman_tree ),
+	     8,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create aligned offsets Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	*decoder = (libfwnt_lzx_decoder_t *) internal_decoder;
+
+	return( 1 );
+
+on_error:
+	if( internal_decoder != NULL )
+	{
+		if( internal_decoder->lengths_huffman_tree != NULL )
+		{
+			libfwnt_huffman_tree_free(
+			 &( internal_decoder->lengths_huffman_tree ),
+			 NULL );
+		}
+		if( internal_decoder->main_huffman_tree != NULL )
+		{
+			libfwnt_huffman_tree_free(
+			 &( internal_decoder->main_huffman_tree ),
+			 NULL );
+		}
+		if( internal_decoder->pre_codes_huffman_tree != NULL )
+		{
+			libfwnt_huffman_tree_free(
+			 &( internal_decoder->pre_codes_huffman_tree ),
+			 NULL );
+		}
+		memory_free(
+		 internal_decoder );
+	}
+	return( -1 );
+}
+
+/* Frees a LZX decoder
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_lzx_decoder_free(
+     libfwnt_lzx_decoder_t **decoder,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_lzx_decoder_t *internal_decoder = NULL;
+	static char *function                            = "libfwnt_lzx_decoder_free";
+	int result                                       = 1;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder != NULL )
+	{
+		internal_decoder = (libfwnt_internal_lzx_decoder_t *) *decoder;
+		*decoder         = NULL;
+
+		if( libfwnt_huffman_tree_free(
+		     &( internal_decoder->aligned_offsets_huffman_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free aligned offsets Huffman tree.",
+			 function );
+
+			result = -1;
+		}
+		if( libfwnt_huffman_tree_free(
+		     &( internal_decoder->lengths_huffman_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free lengths Huffman tree.",
+			 function );
+
+			result = -1;
+		}
+		if( libfwnt_huffman_tree_free(
+		     &( internal_decoder->main_huffman_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free literals and match headers Huffman tree.",
+			 function );
+
+			result = -1;
+		}
+		if( libfwnt_huffman_tree_free(
+		     &( internal_decoder->pre_codes_huffman_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pre-codes Huffman tree.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_decoder );
+	}
+	return( result );
+}
+
+/* Resets a LZX decoder to decode a new frame
+ * This sets the bit stream to the compressed data, the recent compression offsets
+ * to their initial values and clears the code sizes arrays, no memory is allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_lzx_decoder_reset(
+     libfwnt_internal_lzx_decoder_t *internal_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_internal_lzx_decoder_reset";
+
+	if( internal_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_decoder->bit_stream.byte_stream        = compressed_data;
+	internal_decoder->bit_stream.byte_stream_size   = compressed_data_size;
+	internal_decoder->bit_stream.byte_stream_offset = 0;
+	internal_decoder->bit_stream.bit_buffer         = 0;
+	internal_decoder->bit_stream.bit_buffer_size    = 0;
+
+	internal_decoder->recent_compression_offsets[ 0 ] = 1;
+	internal_decoder->recent_compression_offsets[ 1 ] = 1;
+	internal_decoder->recent_compression_offsets[ 2 ] = 1;
+
+	if( memory_set(
+	     internal_decoder->main_code_size_array,
+	     0,
+	     sizeof( uint8_t ) * ( 256 + 240 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear main code size array.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_decoder->lengths_code_size_array,
+	     0,
+	     sizeof( uint8_t ) * 249 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lengths code size array.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_decoder->aligned_offsets_code_size_array,
+	     0,
+	     sizeof( uint8_t ) * 8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear aligned offsets code size array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a LZX block header
+ * The Huffman trees of verbatim and aligned offsets blocks are built and
+ * the recent compression offsets of uncompressed blocks are read
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_internal_lzx_decoder_read_block_header(
+     libfwnt_internal_lzx_decoder_t *internal_decoder,
+     uint32_t *block_type,
+     uint32_t *block_size,
+     libcerror_error_t **error )
+{
+	libfwnt_bit_stream_t *bit_stream = NULL;
+	static char *function            = "libfwnt_internal_lzx_decoder_read_block_header";
+	uint32_t safe_block_size         = 0;
+	uint32_t safe_block_type         = 0;
+	uint8_t number_of_padding_bits   = 0;
+
+	if( internal_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block type.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block size.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = &( internal_decoder->bit_stream );
+
+	if( libfwnt_bit_stream_get_value(
+	     bit_stream,
+	     3,
+	     &safe_block_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_bit_stream_get_value(
+	     bit_stream,
+	     1,
+	     &safe_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_block_size != 0 )
+	{
+		safe_block_size = 32768;
+	}
+	else
+	{
+		if( libfwnt_bit_stream_get_value(
+		     bit_stream,
+		     16,
+		     &safe_block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from bit stream.",
+			 function );
+
+			return( -1 );
+		}
+/* TODO add extended block size support ? */
+	}
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: block header block type\t\t\t\t: %" PRIu32 " (",
+		 function,
+		 safe_block_type );
+
+		switch( safe_block_type )
+		{
+			case LIBFWNT_LZX_BLOCK_TYPE_ALIGNED:
+				libcnotify_printf(
+				 "Aligned" );
+				break;
+
+			case LIBFWNT_LZX_BLOCK_TYPE_VERBATIM:
+				libcnotify_printf(
+				 "Verbatim" );
+				break;
+
+			case LIBFWNT_LZX_BLOCK_TYPE_UNCOMPRESSED:
+				libcnotify_printf(
+				 "Uncompressed" );
+				break;
+
+			default:
+				libcnotify_printf(
+				 "Invalid" );
+				break;
+		}
+		libcnotify_printf(
+		 ")\n" );
+
+		libcnotify_printf(
+		 "%s: block header block size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 safe_block_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+	switch( safe_block_type )
+	{
+		case LIBFWNT_LZX_BLOCK_TYPE_ALIGNED:
+			if( libfwnt_lzx_build_aligned_offsets_huffman_tree(
+			     bit_stream,
+			     internal_decoder->aligned_offsets_code_size_array,
+			     internal_decoder->aligned_offsets_huffman_tree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to build aligned offsets Huffman tree.",
+				 function );
+
+				return( -1 );
+			}
+
+		LIBFWNT_LZX_ATTRIBUTE_FALLTHROUGH;
+		case LIBFWNT_LZX_BLOCK_TYPE_VERBATIM:
+			if( libfwnt_lzx_build_main_huffman_tree(
+			     bit_stream,
+			     internal_decoder->pre_codes_huffman_tree,
+			     internal_decoder->main_code_size_array,
+			     internal_decoder->main_huffman_tree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to build literals and match headers Huffman tree.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfwnt_lzx_build_lengths_huffman_tree(
+			     bit_stream,
+			     internal_decoder->pre_codes_huffman_tree,
+			     internal_decoder->lengths_code_size_array,
+			     internal_decoder->lengths_huffman_tree,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to build lengths Huffman tree.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBFWNT_LZX_BLOCK_TYPE_UNCOMPRESSED:
+			/* The uncompressed block header is preceded by 1 to 16 bits of padding
+			 * to align the bit stream to a 16-bit boundary. The bit buffer can contain
+			 * 16-bit values that were read ahead, return these to the byte stream.
+			 */
+			number_of_padding_bits = bit_stream->bit_buffer_size % 16;
+
+			if( number_of_padding_bits == 0 )
+			{
+				number_of_padding_bits = 16;
+			}
+			if( bit_stream->bit_buffer_size >= number_of_padding_bits )
+			{
+				bit_stream->byte_stream_offset -= ( bit_stream->bit_buffer_size - number_of_padding_bits ) / 8;
+			}
+			else if( bit_stream->byte_stream_offset <= ( bit_stream->byte_stream_size - 2 ) )
+			{
+				bit_stream->byte_stream_offset += 2;
+			}
+			bit_stream->bit_buffer      = 0;
+			bit_stream->bit_buffer_size = 0;
+
+			if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) < 12 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid compressed data value too small.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+			 internal_decoder->recent_compression_offsets[ 0 ] );
+
+			bit_stream->byte_stream_offset += 4;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+			 internal_decoder->recent_compression_offsets[ 1 ] );
+
+			bit_stream->byte_stream_offset += 4;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+			 internal_decoder->recent_compression_offsets[ 2 ] );
+
+			bit_stream->byte_stream_offset += 4;
+
+			if( internal_decoder->recent_compression_offsets[ 0 ] == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported R0 value.",
+				 function );
+
+				return( -1 );
+			}
+			if( internal_decoder->recent_compression_offsets[ 1 ] == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported R1 value.",
+				 function );
+
+				return( -1 );
+			}
+			if( internal_decoder->recent_compression_offsets[ 2 ] == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported R2 value.",
+				 function );
+
+				return( -1 );
+			}
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: R0 value\t\t\t\t\t: 0x%08" PRIx32 "\n",
+				 function,
+				 internal_decoder->recent_compression_offsets[ 0 ] );
+
+				libcnotify_printf(
+				 "%s: R1 value\t\t\t\t\t: 0x%08" PRIx32 "\n",
+				 function,
+				 internal_decoder->recent_compression_offsets[ 1 ] );
+
+				libcnotify_printf(
+				 "%s: R2 value\t\t\t\t\t: 0x%08" PRIx32 "\n",
+				 function,
+				 internal_decoder->recent_compression_offsets[ 2 ] );
+
+				libcnotify_printf(
+				 "\n" );
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported block type.",
+			 function );
+
+			return( -1 );
+	}
+	*block_type = safe_block_type;
+	*block_size = safe_block_size;
+
+	return( 1 );
+}
+
+/* Reads an uncompressed block
+ * The block data is copied from the byte stream of the bit stream
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_internal_lzx_decoder_read_uncompressed_block(
+     libfwnt_internal_lzx_decoder_t *internal_decoder,
+     uint32_t block_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	libfwnt_bit_stream_t *bit_stream     = NULL;
+	static char *function                = "libfwnt_internal_lzx_decoder_read_uncompressed_block";
+	size_t safe_uncompressed_data_offset = 0;
+
+	if( internal_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+	if( safe_uncompressed_data_offset > uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream = &( internal_decoder->bit_stream );
+
+	if( (size_t) block_size > ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) )
+	{
+		block_size = (uint32_t) ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset );
+	}
+	if( (size_t) block_size > ( uncompressed_data_size - safe_uncompressed_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid uncompressed data value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( uncompressed_data[ safe_uncompressed_data_offset ] ),
+	     &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+	     (size_t) block_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to initialize lz buffer.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream->byte_stream_offset += block_size;
+
+	*uncompressed_data_offset = safe_uncompressed_data_offset + block_size;
+
+	return( 1 );
+}
+
+/* Decompresses a LZX compressed frame
+ * The decoder is reset before the frame is decoded and reuses its Huffman trees,
+ * hence decompressing successive frames does not allocate memory
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_lzx_decoder_decompress(
+     libfwnt_lzx_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_bit_stream_t *bit_stream                     = NULL;
+	libfwnt_huffman_tree_t *aligned_offsets_huffman_tree = NULL;
+	libfwnt_internal_lzx_decoder_t *internal_decoder     = NULL;
+	static char *function                                = "libfwnt_lzx_decoder_decompress";
+	size_t safe_uncompressed_data_size                   = 0;
+	size_t uncompressed_data_offset                      = 0;
+	uint32_t block_size                                  = 0;
+	uint32_t block_type                                  = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_decoder = (libfwnt_internal_lzx_decoder_t *) decoder;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_lzx_decoder_reset(
+	     internal_decoder,
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset decoder.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream                  = &( internal_decoder->bit_stream );
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	{
+		if( uncompressed_data_offset >= safe_uncompressed_data_size )
+		{
+			break;
+		}
+		if( libfwnt_internal_lzx_decoder_read_block_header(
+		     internal_decoder,
+		     &block_type,
+		     &block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read block header.",
+			 function );
+
+			return( -1 );
+		}
+		switch( block_type )
+		{
+			case LIBFWNT_LZX_BLOCK_TYPE_ALIGNED:
+			case LIBFWNT_LZX_BLOCK_TYPE_VERBATIM:
+				/* The aligned offsets Huffman tree only applies to aligned offsets blocks
+				 */
+				aligned_offsets_huffman_tree = NULL;
+
+				if( block_type == LIBFWNT_LZX_BLOCK_TYPE_ALIGNED )
+				{
+					aligned_offsets_huffman_tree = internal_decoder->aligned_offsets_huffman_tree;
+				}
+				if( libfwnt_lzx_decode_huffman(
+				     bit_stream,
+				     block_size,
+				     internal_decoder->main_huffman_tree,
+				     internal_decoder->lengths_huffman_tree,
+				     aligned_offsets_huffman_tree,
+				     internal_decoder->recent_compression_offsets,
+				     uncompressed_data,
+				     safe_uncompressed_data_size,
+				     &uncompressed_data_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to decode fixed Huffman encoded bit stream.",
+					 function );
+
+					return( -1 );
+				}
+				break;
+
+			case LIBFWNT_LZX_BLOCK_TYPE_UNCOMPRESSED:
+				if( libfwnt_internal_lzx_decoder_read_uncompressed_block(
+				     internal_decoder,
+				     block_size,
+				     uncompressed_data,
+				     safe_uncompressed_data_size,
+				     &uncompressed_data_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to read uncompressed block.",
+					 function );
+
+					return( -1 );
+				}
+				break;
+		}
+	}
+	if( libfwnt_lzx_decompress_adjust_call_instructions(
+	     uncompressed_data,
+	     uncompressed_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to adjust call instructions.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+}
+
@@ -0,0 +1,125 @@
+/*
+ * LZX decoder functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_INTERNAL_LZX_DECODER_H )
+#define _LIBFWNT_INTERNAL_LZX_DECODER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_bit_stream.h"
+#include "libfwnt_extern.h"
+#include "libfwnt_huffman_tree.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwnt_internal_lzx_decoder libfwnt_internal_lzx_decoder_t;
+
+struct libfwnt_internal_lzx_decoder
+{
+	/* The bit stream
+	 * that is set to the compressed data of every frame
+	 */
+	libfwnt_bit_stream_t bit_stream;
+
+	/* The pre-codes Huffman tree
+	 * that is used to read the code sizes of the other trees
+	 */
+	libfwnt_huffman_tree_t *pre_codes_huffman_tree;
+
+	/* The literals and match headers Huffman tree
+	 */
+	libfwnt_huffman_tree_t *main_huffman_tree;
+
+	/* The lengths Huffman tree
+	 */
+	libfwnt_huffman_tree_t *lengths_huffman_tree;
+
+	/* The aligned offsets Huffman tree
+	 */
+	libfwnt_huffman_tree_t *aligned_offsets_huffman_tree;
+
+	/* The literals and match headers code sizes array
+	 */
+	uint8_t main_code_size_array[ 256 + 240 ];
+
+	/* The lengths code sizes array
+	 */
+	uint8_t lengths_code_size_array[ 249 ];
+
+	/* The aligned offsets code sizes array
+	 */
+	uint8_t aligned_offsets_code_size_array[ 8 ];
+
+	/* The recent compression offsets (R0, R1 and R2)
+	 */
+	uint32_t recent_compression_offsets[ 3 ];
+};
+
+LIBFWNT_EXTERN \
+int libfwnt_lzx_decoder_initialize(
+     libfwnt_lzx_decoder_t **decoder,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_lzx_decoder_free(
+     libfwnt_lzx_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int libfwnt_internal_lzx_decoder_reset(
+     libfwnt_internal_lzx_decoder_t *internal_decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     libcerror_error_t **error );
+
+int libfwnt_internal_lzx_decoder_read_block_header(
+     libfwnt_internal_lzx_decoder_t *internal_decoder,
+     uint32_t *block_type,
+     uint32_t *block_size,
+     libcerror_error_t **error );
+
+int libfwnt_internal_lzx_decoder_read_uncompressed_block(
+     libfwnt_internal_lzx_decoder_t *internal_decoder,
+     uint32_t block_size,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_lzx_decoder_decompress(
+     libfwnt_lzx_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_INTERNAL_LZX_DECODER_H ) */
+
@@ -0,0 +1,921 @@
+/*
+ * LZX stream decoder functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_bit_stream.h"
+#include "libfwnt_call_instruction.h"
+#include "libfwnt_definitions.h"
+#include "libfwnt_huffman_tree.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_lzx.h"
+#include "libfwnt_lzx_decoder.h"
+#include "libfwnt_lzx_stream_decoder.h"
+#include "libfwnt_types.h"
+
+/* Creates a LZX stream decoder
+ * Make sure the value stream_decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_lzx_stream_decoder_initialize(
+     libfwnt_lzx_stream_decoder_t **stream_decoder,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_lzx_stream_decoder_t *internal_stream_decoder = NULL;
+	static char *function                                          = "libfwnt_lzx_stream_decoder_initialize";
+
+	if( stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_decoder = memory_allocate_structure(
+	                           libfwnt_internal_lzx_stream_decoder_t );
+
+	if( internal_stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_stream_decoder,
+	     0,
+	     sizeof( libfwnt_internal_lzx_stream_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream decoder.",
+		 function );
+
+		memory_free(
+		 internal_stream_decoder );
+
+		return( -1 );
+	}
+	if( libfwnt_lzx_decoder_initialize(
+	     &( internal_stream_decoder->decoder ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwnt_lzx_stream_decoder_reset(
+	     (libfwnt_lzx_stream_decoder_t *) internal_stream_decoder,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset stream decoder.",
+		 function );
+
+		goto on_error;
+	}
+	*stream_decoder = (libfwnt_lzx_stream_decoder_t *) internal_stream_decoder;
+
+	return( 1 );
+
+on_error:
+	if( internal_stream_decoder != NULL )
+	{
+		if( internal_stream_decoder->decoder != NULL )
+		{
+			libfwnt_lzx_decoder_free(
+			 &( internal_stream_decoder->decoder ),
+			 NULL );
+		}
+		memory_free(
+		 internal_stream_decoder );
+	}
+	return( -1 );
+}
+
+/* Frees a LZX stream decoder
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_lzx_stream_decoder_free(
+     libfwnt_lzx_stream_decoder_t **stream_decoder,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_lzx_stream_decoder_t *internal_stream_decoder = NULL;
+	static char *function                                          = "libfwnt_lzx_stream_decoder_free";
+	int result                                                     = 1;
+
+	if( stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_decoder != NULL )
+	{
+		internal_stream_decoder = (libfwnt_internal_lzx_stream_decoder_t *) *stream_decoder;
+		*stream_decoder         = NULL;
+
+		if( libfwnt_lzx_decoder_free(
+		     &( internal_stream_decoder->decoder ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decoder.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_stream_decoder );
+	}
+	return( result );
+}
+
+/* Resets a LZX stream decoder to decode a new stream
+ * The uncompressed data size is needed since LZX compressed data has no end of stream marker
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_lzx_stream_decoder_reset(
+     libfwnt_lzx_stream_decoder_t *stream_decoder,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_lzx_stream_decoder_t *internal_stream_decoder = NULL;
+	static char *function                                          = "libfwnt_lzx_stream_decoder_reset";
+
+	if( stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_decoder = (libfwnt_internal_lzx_stream_decoder_t *) stream_decoder;
+
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_lzx_decoder_reset(
+	     (libfwnt_internal_lzx_decoder_t *) internal_stream_decoder->decoder,
+	     internal_stream_decoder->input_buffer,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset decoder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_decoder->window_offset                = 0;
+	internal_stream_decoder->window_output_offset         = 0;
+	internal_stream_decoder->uncompressed_data_size       = uncompressed_data_size;
+	internal_stream_decoder->uncompressed_data_offset     = 0;
+	internal_stream_decoder->output_data_offset           = 0;
+	internal_stream_decoder->call_instruction_data_offset = 0;
+	internal_stream_decoder->call_instruction_data_size   = 0;
+	internal_stream_decoder->block_type                   = 0;
+	internal_stream_decoder->block_size                   = 0;
+	internal_stream_decoder->end_of_stream                = 0;
+
+	return( 1 );
+}
+
+/* Decodes as much of the input buffer as possible into the window buffer
+ * Unless the end of the input was reached, blocks and literals or matches are
+ * only decoded when they cannot extend beyond the data in the input buffer
+ * Returns 1 if data was decoded, 0 if more input or output space is needed or -1 on error
+ */
+int libfwnt_internal_lzx_stream_decoder_decode(
+     libfwnt_internal_lzx_stream_decoder_t *internal_stream_decoder,
+     uint8_t end_of_input,
+     libcerror_error_t **error )
+{
+	libfwnt_bit_stream_t *bit_stream                     = NULL;
+	libfwnt_huffman_tree_t *aligned_offsets_huffman_tree = NULL;
+	libfwnt_internal_lzx_decoder_t *internal_decoder     = NULL;
+	static char *function                                = "libfwnt_internal_lzx_stream_decoder_decode";
+	size_t input_size                                    = 0;
+	size_t remaining_uncompressed_data_size              = 0;
+	size_t window_data_size                              = 0;
+	size_t window_offset                                 = 0;
+	size_t window_shift_size                             = 0;
+	size_t window_space                                  = 0;
+	uint32_t decode_size                                 = 0;
+	int result                                           = 0;
+
+	if( internal_stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_decoder = (libfwnt_internal_lzx_decoder_t *) internal_stream_decoder->decoder;
+	bit_stream       = &( internal_decoder->bit_stream );
+
+	while( internal_stream_decoder->end_of_stream == 0 )
+	{
+		if( internal_stream_decoder->uncompressed_data_offset >= internal_stream_decoder->uncompressed_data_size )
+		{
+			internal_stream_decoder->end_of_stream = 1;
+
+			result = 1;
+
+			break;
+		}
+		/* Move the sliding window to the start of the window buffer once the data
+		 * before it has been output, the sliding window and the data it is moved
+		 * over do not overlap
+		 */
+		if( internal_stream_decoder->window_offset >= ( 2 * LIBFWNT_LZX_STREAM_DECODER_WINDOW_SIZE ) )
+		{
+			window_shift_size = internal_stream_decoder->window_offset - LIBFWNT_LZX_STREAM_DECODER_WINDOW_SIZE;
+
+			if( internal_stream_decoder->window_output_offset >= window_shift_size )
+			{
+				if( memory_copy(
+				     internal_stream_decoder->window,
+				     &( internal_stream_decoder->window[ window_shift_size ] ),
+				     LIBFWNT_LZX_STREAM_DECODER_WINDOW_SIZE ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to move sliding window.",
+					 function );
+
+					return( -1 );
+				}
+				internal_stream_decoder->window_offset        -= window_shift_size;
+				internal_stream_decoder->window_output_offset -= window_shift_size;
+			}
+		}
+		window_space = LIBFWNT_LZX_STREAM_DECODER_WINDOW_BUFFER_SIZE - internal_stream_decoder->window_offset;
+
+		if( window_space <= LIBFWNT_LZX_STREAM_DECODER_MAXIMUM_COMPRESSION_SIZE )
+		{
+			break;
+		}
+		input_size = ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset )
+		           + ( bit_stream->bit_buffer_size / 8 );
+
+		if( internal_stream_decoder->block_size == 0 )
+		{
+			if( end_of_input != 0 )
+			{
+				if( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
+				{
+					internal_stream_decoder->end_of_stream = 1;
+
+					result = 1;
+
+					break;
+				}
+			}
+			else if( input_size < ( LIBFWNT_LZX_STREAM_DECODER_BLOCK_HEADER_SIZE + LIBFWNT_LZX_STREAM_DECODER_INPUT_SLACK_SIZE ) )
+			{
+				break;
+			}
+			if( libfwnt_internal_lzx_decoder_read_block_header(
+			     internal_decoder,
+			     &( internal_stream_decoder->block_type ),
+			     &( internal_stream_decoder->block_size ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to read block header.",
+				 function );
+
+				return( -1 );
+			}
+			result = 1;
+
+			continue;
+		}
+		remaining_uncompressed_data_size = internal_stream_decoder->uncompressed_data_size
+		                                 - internal_stream_decoder->uncompressed_data_offset;
+
+		/* A block that does not fit in the remaining uncompressed data is corrupt
+		 */
+		if( (size_t) internal_stream_decoder->block_size > remaining_uncompressed_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid block size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		window_offset = internal_stream_decoder->window_offset;
+
+		if( internal_stream_decoder->block_type == LIBFWNT_LZX_BLOCK_TYPE_UNCOMPRESSED )
+		{
+			window_data_size = bit_stream->byte_stream_size - bit_stream->byte_stream_offset;
+
+			if( window_data_size > (size_t) internal_stream_decoder->block_size )
+			{
+				window_data_size = (size_t) internal_stream_decoder->block_size;
+			}
+			if( window_data_size > window_space )
+			{
+				window_data_size = window_space;
+			}
+			if( window_data_size == 0 )
+			{
+				/* The block is truncated at the end of the input
+				 */
+				if( end_of_input == 0 )
+				{
+					break;
+				}
+				internal_stream_decoder->block_size = 0;
+
+				continue;
+			}
+			if( memory_copy(
+			     &( internal_stream_decoder->window[ window_offset ] ),
+			     &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
+			     window_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy uncompressed block data.",
+				 function );
+
+				return( -1 );
+			}
+			bit_stream->byte_stream_offset        += window_data_size;
+			internal_stream_decoder->window_offset += window_data_size;
+		}
+		else
+		{
+			/* A literal requires at most 16 bits per byte and a match at most 49 bits
+			 * for 2 or more bytes, hence 3 input bytes per output byte suffice
+			 */
+			decode_size = internal_stream_decoder->block_size;
+
+			if( end_of_input == 0 )
+			{
+				if( input_size < ( LIBFWNT_LZX_STREAM_DECODER_INPUT_SLACK_SIZE + 3 ) )
+				{
+					break;
+				}
+				input_size = ( input_size - LIBFWNT_LZX_STREAM_DECODER_INPUT_SLACK_SIZE ) / 3;
+
+				if( (size_t) decode_size > input_size )
+				{
+					decode_size = (uint32_t) input_size;
+				}
+			}
+			/* The last match can extend beyond the decode size
+			 */
+			if( (size_t) decode_size > ( window_space - LIBFWNT_LZX_STREAM_DECODER_MAXIMUM_COMPRESSION_SIZE ) )
+			{
+				decode_size = (uint32_t) ( window_space - LIBFWNT_LZX_STREAM_DECODER_MAXIMUM_COMPRESSION_SIZE );
+			}
+			window_data_size = LIBFWNT_LZX_STREAM_DECODER_WINDOW_BUFFER_SIZE;
+
+			if( window_data_size > ( window_offset + remaining_uncompressed_data_size ) )
+			{
+				window_data_size = window_offset + remaining_uncompressed_data_size;
+			}
+			/* The aligned offsets Huffman tree only applies to aligned offsets blocks
+			 */
+			aligned_offsets_huffman_tree = NULL;
+
+			if( internal_stream_decoder->block_type == LIBFWNT_LZX_BLOCK_TYPE_ALIGNED )
+			{
+				aligned_offsets_huffman_tree = internal_decoder->aligned_offsets_huffman_tree;
+			}
+			if( libfwnt_lzx_decode_huffman(
+			     bit_stream,
+			     decode_size,
+			     internal_decoder->main_huffman_tree,
+			     internal_decoder->lengths_huffman_tree,
+			     aligned_offsets_huffman_tree,
+			     internal_decoder->recent_compression_offsets,
+			     internal_stream_decoder->window,
+			     window_data_size,
+			     &( internal_stream_decoder->window_offset ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to decode fixed Huffman encoded bit stream.",
+				 function );
+
+				return( -1 );
+			}
+			window_data_size = internal_stream_decoder->window_offset - window_offset;
+		}
+		if( window_data_size > (size_t) internal_stream_decoder->block_size )
+		{
+			internal_stream_decoder->block_size = 0;
+		}
+		else
+		{
+			internal_stream_decoder->block_size -= (uint32_t) window_data_size;
+		}
+		internal_stream_decoder->uncompressed_data_offset += window_data_size;
+
+		result = 1;
+	}
+	return( result );
+}
+
+/* Writes the decoded data in the window buffer to the uncompressed data
+ * The addresses of call (0xe8) instructions are translated while they are written,
+ * which requires the 6 bytes that follow or the end of the stream to have been decoded.
+ * The window is scanned for call instructions using the active kernel variant
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_lzx_stream_decoder_write_output(
+     libfwnt_internal_lzx_stream_decoder_t *internal_stream_decoder,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfwnt_internal_lzx_stream_decoder_write_output";
+	size_t data_offset              = 0;
+	size_t output_data_end_offset   = 0;
+	size_t read_size                = 0;
+	size_t scan_offset              = 0;
+	size_t scan_size                = 0;
+	size_t translation_end_offset   = 0;
+	uint32_t address                = 0;
+
+	if( internal_stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = *uncompressed_data_offset;
+
+	/* Call instructions in the last 6 bytes of the stream are not translated
+	 * and neither are call instructions in a stream of less than 10 bytes,
+	 * hence no data is written until 10 bytes or the end of the stream have
+	 * been decoded
+	 */
+	if( internal_stream_decoder->uncompressed_data_offset >= LIBFWNT_CALL_INSTRUCTION_MINIMUM_DATA_SIZE )
+	{
+		translation_end_offset = internal_stream_decoder->uncompressed_data_offset - 6;
+	}
+	if( internal_stream_decoder->end_of_stream != 0 )
+	{
+		output_data_end_offset = internal_stream_decoder->uncompressed_data_offset;
+	}
+	else
+	{
+		output_data_end_offset = translation_end_offset;
+	}
+	while( data_offset < uncompressed_data_size )
+	{
+		if( internal_stream_decoder->call_instruction_data_offset < internal_stream_decoder->call_instruction_data_size )
+		{
+			uncompressed_data[ data_offset++ ] = internal_stream_decoder->call_instruction_data[ internal_stream_decoder->call_instruction_data_offset++ ];
+
+			continue;
+		}
+		if( internal_stream_decoder->output_data_offset >= output_data_end_offset )
+		{
+			break;
+		}
+		read_size = output_data_end_offset - internal_stream_decoder->output_data_offset;
+
+		if( read_size > ( uncompressed_data_size - data_offset ) )
+		{
+			read_size = uncompressed_data_size - data_offset;
+		}
+		/* Only the call instructions before the translation end offset are translated
+		 */
+		scan_size = 0;
+
+		if( internal_stream_decoder->output_data_offset < translation_end_offset )
+		{
+			scan_size = translation_end_offset - internal_stream_decoder->output_data_offset;
+
+			if( scan_size > read_size )
+			{
+				scan_size = read_size;
+			}
+		}
+		scan_offset = libfwnt_call_instruction_scan(
+		               &( internal_stream_decoder->window[ internal_stream_decoder->window_output_offset ] ),
+		               scan_size );
+
+		if( scan_offset >= scan_size )
+		{
+			scan_offset = read_size;
+		}
+		if( scan_offset > 0 )
+		{
+			if( memory_copy(
+			     &( uncompressed_data[ data_offset ] ),
+			     &( internal_stream_decoder->window[ internal_stream_decoder->window_output_offset ] ),
+			     scan_offset ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy decoded data.",
+				 function );
+
+				return( -1 );
+			}
+			data_offset                                   += scan_offset;
+			internal_stream_decoder->window_output_offset += scan_offset;
+			internal_stream_decoder->output_data_offset   += scan_offset;
+		}
+		if( scan_offset >= read_size )
+		{
+			continue;
+		}
+		/* Translate the absolute address of the call instruction into a relative address
+		 */
+		byte_stream_copy_to_uint32_little_endian(
+		 &( internal_stream_decoder->window[ internal_stream_decoder->window_output_offset + 1 ] ),
+		 address );
+
+		address = libfwnt_call_instruction_translate_address(
+		           address,
+		           internal_stream_decoder->output_data_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 internal_stream_decoder->call_instruction_data,
+		 address );
+
+		internal_stream_decoder->call_instruction_data_offset = 0;
+		internal_stream_decoder->call_instruction_data_size   = 4;
+
+		uncompressed_data[ data_offset++ ] = 0xe8;
+
+		internal_stream_decoder->window_output_offset += 5;
+		internal_stream_decoder->output_data_offset   += 5;
+	}
+	*uncompressed_data_offset = data_offset;
+
+	return( 1 );
+}
+
+/* Decompresses LZX compressed data in a stream
+ * The compressed data is consumed and the uncompressed data is written in slices of any size.
+ * On return the compressed data size contains the number of bytes consumed and the uncompressed
+ * data size the number of bytes written. Use LIBFWNT_STREAM_FLAG_END_OF_INPUT to indicate
+ * that the compressed data contains the remainder of the stream.
+ * Returns 1 if the end of the stream was reached, 0 if more compressed data or output space is needed or -1 on error
+ */
+int libfwnt_lzx_stream_decoder_decompress(
+     libfwnt_lzx_stream_decoder_t *stream_decoder,
+     const uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfwnt_bit_stream_t *bit_stream                               = NULL;
+	libfwnt_internal_lzx_stream_decoder_t *internal_stream_decoder = NULL;
+	static char *function                                          = "libfwnt_lzx_stream_decoder_decompress";
+	size_t compressed_data_offset                                  = 0;
+	size_t input_shift_size                                        = 0;
+	size_t input_size                                              = 0;
+	size_t output_size                                             = 0;
+	size_t safe_compressed_data_size                               = 0;
+	size_t safe_uncompressed_data_size                             = 0;
+	size_t uncompressed_data_offset                                = 0;
+	uint8_t end_of_input                                           = 0;
+	int result                                                     = 0;
+
+	if( stream_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream decoder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream_decoder = (libfwnt_internal_lzx_stream_decoder_t *) stream_decoder;
+
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data == NULL )
+	 && ( *compressed_data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBFWNT_STREAM_FLAG_END_OF_INPUT ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	bit_stream                  = &( ( (libfwnt_internal_lzx_decoder_t *) internal_stream_decoder->decoder )->bit_stream );
+	safe_compressed_data_size   = *compressed_data_size;
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	do
+	{
+		output_size = uncompressed_data_offset;
+
+		if( libfwnt_internal_lzx_stream_decoder_write_output(
+		     internal_stream_decoder,
+		     uncompressed_data,
+		     safe_uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write uncompressed data.",
+			 function );
+
+			return( -1 );
+		}
+		output_size = uncompressed_data_offset - output_size;
+
+		if( ( internal_stream_decoder->end_of_stream != 0 )
+		 && ( internal_stream_decoder->output_data_offset >= internal_stream_decoder->uncompressed_data_offset )
+		 && ( internal_stream_decoder->call_instruction_data_offset >= internal_stream_decoder->call_instruction_data_size ) )
+		{
+			result = 1;
+
+			break;
+		}
+		/* Move the unconsumed input to the start of the input buffer when it does not
+		 * overlap with the consumed input. The bytes that were read into the bit buffer
+		 * are kept since an uncompressed block header returns these to the byte stream.
+		 */
+		if( bit_stream->byte_stream_offset > sizeof( uint64_t ) )
+		{
+			input_shift_size = bit_stream->byte_stream_offset - sizeof( uint64_t );
+
+			if( input_shift_size >= ( bit_stream->byte_stream_size - input_shift_size ) )
+			{
+				if( memory_copy(
+				     internal_stream_decoder->input_buffer,
+				     &( internal_stream_decoder->input_buffer[ input_shift_size ] ),
+				     bit_stream->byte_stream_size - input_shift_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to move input data.",
+					 function );
+
+					return( -1 );
+				}
+				bit_stream->byte_stream_size   -= input_shift_size;
+				bit_stream->byte_stream_offset -= input_shift_size;
+			}
+		}
+		input_size = LIBFWNT_LZX_STREAM_DECODER_INPUT_BUFFER_SIZE - bit_stream->byte_stream_size;
+
+		if( input_size > ( safe_compressed_data_size - compressed_data_offset ) )
+		{
+			input_size = safe_compressed_data_size - compressed_data_offset;
+		}
+		if( input_size > 0 )
+		{
+			if( memory_copy(
+			     &( internal_stream_decoder->input_buffer[ bit_stream->byte_stream_size ] ),
+			     &( compressed_data[ compressed_data_offset ] ),
+			     input_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy compressed data.",
+				 function );
+
+				return( -1 );
+			}
+			bit_stream->byte_stream_size += input_size;
+			compressed_data_offset       += input_size;
+		}
+		end_of_input = 0;
+
+		if( ( ( flags & LIBFWNT_STREAM_FLAG_END_OF_INPUT ) != 0 )
+		 && ( compressed_data_offset >= safe_compressed_data_size ) )
+		{
+			end_of_input = 1;
+		}
+		result = libfwnt_internal_lzx_stream_decoder_decode(
+		          internal_stream_decoder,
+		          end_of_input,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode compressed data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	while( ( result != 0 )
+	    || ( input_size > 0 )
+	    || ( output_size > 0 ) );
+
+	*compressed_data_size   = compressed_data_offset;
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( result );
+}
+
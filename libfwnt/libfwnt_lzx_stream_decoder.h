@@ -0,0 +1,171 @@
+/*
+ * LZX stream decoder functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_INTERNAL_LZX_STREAM_DECODER_H )
+#define _LIBFWNT_INTERNAL_LZX_STREAM_DECODER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the LZX sliding window
+ */
+#define LIBFWNT_LZX_STREAM_DECODER_WINDOW_SIZE			32768
+
+/* The size of the window buffer, which contains the sliding window
+ * followed by the data that is being decoded
+ */
+#define LIBFWNT_LZX_STREAM_DECODER_WINDOW_BUFFER_SIZE		( 3 * LIBFWNT_LZX_STREAM_DECODER_WINDOW_SIZE )
+
+/* The size of the input buffer
+ */
+#define LIBFWNT_LZX_STREAM_DECODER_INPUT_BUFFER_SIZE		16384
+
+/* The number of input bytes a block header can consist of, which covers
+ * the largest possible pre-codes and code sizes of all the Huffman trees
+ */
+#define LIBFWNT_LZX_STREAM_DECODER_BLOCK_HEADER_SIZE		2048
+
+/* The number of input bytes that must remain available after a literal
+ * or match has been decoded, so that the bit buffer is never refilled
+ * beyond the input that has been provided
+ */
+#define LIBFWNT_LZX_STREAM_DECODER_INPUT_SLACK_SIZE		32
+
+/* The maximum size of a match
+ */
+#define LIBFWNT_LZX_STREAM_DECODER_MAXIMUM_COMPRESSION_SIZE	257
+
+typedef struct libfwnt_internal_lzx_stream_decoder libfwnt_internal_lzx_stream_decoder_t;
+
+struct libfwnt_internal_lzx_stream_decoder
+{
+	/* The decoder
+	 * that contains the bit stream, Huffman trees and recent compression offsets
+	 */
+	libfwnt_lzx_decoder_t *decoder;
+
+	/* The input buffer
+	 * that contains the compressed data that has not been consumed by the bit stream
+	 */
+	uint8_t input_buffer[ LIBFWNT_LZX_STREAM_DECODER_INPUT_BUFFER_SIZE ];
+
+	/* The window buffer
+	 */
+	uint8_t window[ LIBFWNT_LZX_STREAM_DECODER_WINDOW_BUFFER_SIZE ];
+
+	/* The offset in the window buffer the next literal or match is decoded to
+	 */
+	size_t window_offset;
+
+	/* The offset in the window buffer of the next byte to output
+	 */
+	size_t window_output_offset;
+
+	/* The uncompressed data size of the stream
+	 */
+	size_t uncompressed_data_size;
+
+	/* The number of bytes that have been decoded
+	 */
+	size_t uncompressed_data_offset;
+
+	/* The offset in the uncompressed data of the next byte to output
+	 */
+	size_t output_data_offset;
+
+	/* The translated address of a call (0xe8) instruction that remains to be output
+	 */
+	uint8_t call_instruction_data[ 4 ];
+
+	/* The offset in the call instruction data
+	 */
+	uint8_t call_instruction_data_offset;
+
+	/* The size of the call instruction data
+	 */
+	uint8_t call_instruction_data_size;
+
+	/* The block type of the current block
+	 */
+	uint32_t block_type;
+
+	/* The remaining size of the current block
+	 */
+	uint32_t block_size;
+
+	/* Value to indicate the end of the stream was reached
+	 */
+	uint8_t end_of_stream;
+};
+
+LIBFWNT_EXTERN \
+int libfwnt_lzx_stream_decoder_initialize(
+     libfwnt_lzx_stream_decoder_t **stream_decoder,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_lzx_stream_decoder_free(
+     libfwnt_lzx_stream_decoder_t **stream_decoder,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_lzx_stream_decoder_reset(
+     libfwnt_lzx_stream_decoder_t *stream_decoder,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
+int libfwnt_internal_lzx_stream_decoder_decode(
+     libfwnt_internal_lzx_stream_decoder_t *internal_stream_decoder,
+     uint8_t end_of_input,
+     libcerror_error_t **error );
+
+int libfwnt_internal_lzx_stream_decoder_write_output(
+     libfwnt_internal_lzx_stream_decoder_t *internal_stream_decoder,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_lzx_stream_decoder_decompress(
+     libfwnt_lzx_stream_decoder_t *stream_decoder,
+     const uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_INTERNAL_LZX_STREAM_DECODER_H ) */
+
@@ -25,22 +25,58 @@
 #include <types.h>
 
 #include "libfwnt_bit_stream.h"
+#include "libfwnt_definitions.h"
 #include "libfwnt_huffman_tree.h"
 #include "libfwnt_libcerror.h"
 #include "libfwnt_libcnotify.h"
+#include "libfwnt_libcthreads.h"
 #include "libfwnt_lzxpress.h"
+#include "libfwnt_lzxpress_huffman_decoder.h"
+#include "libfwnt_match_copy.h"
+#include "libfwnt_unused.h"
 
-/* Compresses data using LZXPRESS (LZ77 + DIRECT2) compression
- * Returns 1 on success or -1 on error
+/* Calculates the match finder hash of the 3 bytes at the start of data
  */
-int libfwnt_lzxpress_compress(
+#define libfwnt_lzxpress_get_hash( data ) \
+	( (uint32_t) ( ( ( (uint32_t) ( data )[ 0 ] << 16 ) | ( (uint32_t) ( data )[ 1 ] << 8 ) | (uint32_t) ( data )[ 2 ] ) * 0x9e3779b1UL ) >> ( 32 - LIBFWNT_LZXPRESS_HASH_BITS ) )
+
+/* Adds the position in the uncompressed data to the match finder hash chain
+ * The hash chain is a circular buffer of window size entries
+ */
+#define libfwnt_lzxpress_hash_chain_insert( uncompressed_data, uncompressed_data_size, uncompressed_data_offset, hash_table, hash_chain, window_size ) \
+	if( ( uncompressed_data_offset + 3 ) <= uncompressed_data_size ) \
+	{ \
+		uint32_t hash_value = libfwnt_lzxpress_get_hash( &( ( uncompressed_data )[ uncompressed_data_offset ] ) ); \
+\
+		( hash_chain )[ ( uncompressed_data_offset ) & ( ( window_size ) - 1 ) ] = ( hash_table )[ hash_value ]; \
+		( hash_table )[ hash_value ]                                             = ( uncompressed_data_offset ) + 1; \
+	}
+
+/* Finds the longest match for the uncompressed data offset in the match finder hash chain
+ * The hash table and chain contain the uncompressed data offsets + 1, where 0 marks the end of the chain
+ * The window size must be a power of 2 and matches are less than window size bytes back
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_lzxpress_compress_find_match(
      const uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
-     uint8_t *compressed_data,
-     size_t *compressed_data_size,
+     size_t uncompressed_data_offset,
+     const size_t *hash_table,
+     const size_t *hash_chain,
+     size_t window_size,
+     int maximum_chain_length,
+     size_t maximum_match_size,
+     size_t *match_distance,
+     size_t *match_size,
      libcerror_error_t **error )
 {
-	static char *function = "libfwnt_lzxpress_compress";
+	static char *function      = "libfwnt_lzxpress_compress_find_match";
+	size_t candidate_distance  = 0;
+	size_t candidate_offset    = 0;
+	size_t candidate_size      = 0;
+	size_t hash_chain_entry    = 0;
+	size_t safe_match_distance = 0;
+	size_t safe_match_size     = 0;
 
 	if( uncompressed_data == NULL )
 	{
@@ -53,243 +89,445 @@ int libfwnt_lzxpress_compress(
 
 		return( -1 );
 	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	if( ( uncompressed_data_offset > uncompressed_data_size )
+	 || ( maximum_match_size > ( uncompressed_data_size - uncompressed_data_offset ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data == NULL )
+	if( ( hash_table == NULL )
+	 || ( hash_chain == NULL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid hash table or chain.",
 		 function );
 
 		return( -1 );
 	}
-	if( compressed_data_size == NULL )
+	if( ( window_size == 0 )
+	 || ( ( window_size & ( window_size - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported window size.",
+		 function );
+
+		return( -1 );
+	}
+	if( match_distance == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data size.",
+		 "%s: invalid match distance.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO implement */
-	return( -1 );
+	if( match_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid match size.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_match_size >= 3 )
+	{
+		hash_chain_entry = hash_table[ libfwnt_lzxpress_get_hash( &( uncompressed_data[ uncompressed_data_offset ] ) ) ];
+
+		while( ( hash_chain_entry != 0 )
+		    && ( maximum_chain_length > 0 ) )
+		{
+			candidate_offset   = hash_chain_entry - 1;
+			candidate_distance = uncompressed_data_offset - candidate_offset;
+
+			/* The hash chain entries of offsets outside the window have been overwritten
+			 */
+			if( candidate_distance >= window_size )
+			{
+				break;
+			}
+			/* Only compare the candidate when it could improve the current match
+			 */
+			if( uncompressed_data[ candidate_offset + safe_match_size ] == uncompressed_data[ uncompressed_data_offset + safe_match_size ] )
+			{
+				for( candidate_size = 0;
+				     candidate_size < maximum_match_size;
+				     candidate_size++ )
+				{
+					if( uncompressed_data[ candidate_offset + candidate_size ] != uncompressed_data[ uncompressed_data_offset + candidate_size ] )
+					{
+						break;
+					}
+				}
+				if( candidate_size > safe_match_size )
+				{
+					safe_match_distance = candidate_distance;
+					safe_match_size     = candidate_size;
+
+					if( safe_match_size >= maximum_match_size )
+					{
+						break;
+					}
+				}
+			}
+			hash_chain_entry = hash_chain[ candidate_offset & ( window_size - 1 ) ];
+
+			maximum_chain_length--;
+		}
+	}
+	if( safe_match_size < 3 )
+	{
+		safe_match_distance = 0;
+		safe_match_size     = 0;
+	}
+	*match_distance = safe_match_distance;
+	*match_size     = safe_match_size;
+
+	return( 1 );
 }
 
-/* Decompresses data using LZXPRESS (LZ77 + DIRECT2) compression
- * Return 1 on success or -1 on error
+/* Compresses data using LZXPRESS (LZ77 + DIRECT2) compression
+ * Returns 1 on success or -1 on error
  */
-int libfwnt_lzxpress_decompress(
-     const uint8_t *compressed_data,
-     size_t compressed_data_size,
-     uint8_t *uncompressed_data,
-     size_t *uncompressed_data_size,
+int libfwnt_lzxpress_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
      libcerror_error_t **error )
 {
-	static char *function                  = "libfwnt_lzxpress_decompress";
-	size_t compressed_data_offset          = 0;
-	size_t compression_index               = 0;
-	size_t compression_shared_byte_index   = 0;
-	size_t safe_uncompressed_data_size     = 0;
-	size_t uncompressed_data_offset        = 0;
-	uint32_t compression_indicator         = 0;
-	uint32_t compression_indicator_bitmask = 0;
-	uint16_t compression_tuple             = 0;
-	uint16_t compression_tuple_size        = 0;
-	int16_t compression_tuple_offset       = 0;
+	static char *function = "libfwnt_lzxpress_compress";
 
-	if( compressed_data == NULL )
+	if( libfwnt_lzxpress_compress_with_level(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     compressed_data,
+	     compressed_data_size,
+	     LIBFWNT_COMPRESSION_LEVEL_DEFAULT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compresses data using LZXPRESS (LZ77 + DIRECT2) compression with a specific compression level
+ * The default and fast compression levels use a single hash probe per offset,
+ * the normal level searches a hash chain and the best level adds lazy matching
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_lzxpress_compress_with_level(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int compression_level,
+     libcerror_error_t **error )
+{
+	size_t *hash_chain                      = NULL;
+	size_t *hash_table                      = NULL;
+	static char *function                   = "libfwnt_lzxpress_compress_with_level";
+	size_t compressed_data_offset           = 0;
+	size_t compression_indicator_offset     = 0;
+	size_t compression_shared_byte_index    = 0;
+	size_t compression_tuple_size           = 0;
+	size_t match_distance                   = 0;
+	size_t match_size                       = 0;
+	size_t maximum_match_size               = 0;
+	size_t next_match_distance              = 0;
+	size_t next_match_size                  = 0;
+	size_t safe_compressed_data_size        = 0;
+	size_t uncompressed_data_offset         = 0;
+	uint32_t compression_indicator          = 0;
+	uint16_t compression_tuple              = 0;
+	uint8_t compression_indicator_bit_count = 0;
+	int has_next_match                      = 0;
+	int maximum_chain_length                = 0;
+	int use_lazy_matching                   = 0;
+
+	if( uncompressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid compressed data.",
+		 "%s: invalid uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( compressed_data_size < 2 )
-	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid compressed data size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data == NULL )
+	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data.",
+		 "%s: invalid compressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_size == NULL )
+	if( compressed_data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data size.",
+		 "%s: invalid compressed data size.",
 		 function );
 
 		return( -1 );
 	}
-	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	switch( compression_level )
+	{
+		case LIBFWNT_COMPRESSION_LEVEL_DEFAULT:
+		case LIBFWNT_COMPRESSION_LEVEL_FAST:
+			maximum_chain_length = 1;
+			use_lazy_matching    = 0;
+			break;
+
+		case LIBFWNT_COMPRESSION_LEVEL_NORMAL:
+			maximum_chain_length = 16;
+			use_lazy_matching    = 0;
+			break;
+
+		case LIBFWNT_COMPRESSION_LEVEL_BEST:
+			maximum_chain_length = 256;
+			use_lazy_matching    = 1;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported compression level.",
+			 function );
+
+			return( -1 );
+	}
+	safe_compressed_data_size = *compressed_data_size;
+
+	hash_table = (size_t *) memory_allocate(
+	                         sizeof( size_t ) * ( 1 << LIBFWNT_LZXPRESS_HASH_BITS ) );
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( size_t ) * ( 1 << LIBFWNT_LZXPRESS_HASH_BITS ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		goto on_error;
+	}
+	hash_chain = (size_t *) memory_allocate(
+	                         sizeof( size_t ) * LIBFWNT_LZXPRESS_MAXIMUM_COMPRESSION_OFFSET );
+
+	if( hash_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash chain.",
+		 function );
+
+		goto on_error;
+	}
+	/* The compressed data starts with a compression indicator
+	 */
+	if( safe_compressed_data_size < 4 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data too small.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	safe_uncompressed_data_size = *uncompressed_data_size;
+	compression_indicator_offset = 0;
+	compressed_data_offset       = 4;
 
-	while( compressed_data_offset < compressed_data_size )
+	while( uncompressed_data_offset < uncompressed_data_size )
 	{
-		if( uncompressed_data_offset >= safe_uncompressed_data_size )
+		maximum_match_size = uncompressed_data_size - uncompressed_data_offset;
+
+		if( maximum_match_size > LIBFWNT_LZXPRESS_MAXIMUM_COMPRESSION_SIZE )
 		{
-			break;
+			maximum_match_size = LIBFWNT_LZXPRESS_MAXIMUM_COMPRESSION_SIZE;
 		}
-		if( ( compressed_data_size < 4 )
-		 || ( compressed_data_offset > ( compressed_data_size - 4 ) ) )
+		if( has_next_match != 0 )
+		{
+			match_distance = next_match_distance;
+			match_size     = next_match_size;
+			has_next_match = 0;
+		}
+		else if( libfwnt_lzxpress_compress_find_match(
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          uncompressed_data_offset,
+		          hash_table,
+		          hash_chain,
+		          LIBFWNT_LZXPRESS_MAXIMUM_COMPRESSION_OFFSET,
+		          maximum_chain_length,
+		          maximum_match_size,
+		          &match_distance,
+		          &match_size,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: compressed data too small.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to find match at offset: %" PRIzd ".",
+			 function,
+			 uncompressed_data_offset );
 
-			return( -1 );
+			goto on_error;
 		}
-		byte_stream_copy_to_uint32_little_endian(
-		 &( compressed_data[ compressed_data_offset ] ),
-		 compression_indicator );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		libfwnt_lzxpress_hash_chain_insert(
+		 uncompressed_data,
+		 uncompressed_data_size,
+		 uncompressed_data_offset,
+		 hash_table,
+		 hash_chain,
+		 LIBFWNT_LZXPRESS_MAXIMUM_COMPRESSION_OFFSET );
+
+		/* With lazy matching a match is deferred if the next offset has a longer match
+		 */
+		if( ( use_lazy_matching != 0 )
+		 && ( match_size > 0 )
+		 && ( match_size < maximum_match_size ) )
 		{
-			libcnotify_printf(
-			 "%s: compressed data offset\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
-			 function,
-			 compressed_data_offset,
-			 compressed_data_offset );
+			maximum_match_size = uncompressed_data_size - ( uncompressed_data_offset + 1 );
 
-			libcnotify_printf(
-			 "%s: compression indicator\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 compression_indicator );
+			if( maximum_match_size > LIBFWNT_LZXPRESS_MAXIMUM_COMPRESSION_SIZE )
+			{
+				maximum_match_size = LIBFWNT_LZXPRESS_MAXIMUM_COMPRESSION_SIZE;
+			}
+			if( libfwnt_lzxpress_compress_find_match(
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     uncompressed_data_offset + 1,
+			     hash_table,
+			     hash_chain,
+			     LIBFWNT_LZXPRESS_MAXIMUM_COMPRESSION_OFFSET,
+			     maximum_chain_length,
+			     maximum_match_size,
+			     &next_match_distance,
+			     &next_match_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to find match at offset: %" PRIzd ".",
+				 function,
+				 uncompressed_data_offset + 1 );
 
-			libcnotify_printf(
-			 "\n" );
+				goto on_error;
+			}
+			if( next_match_size > match_size )
+			{
+				match_size     = 0;
+				has_next_match = 1;
+			}
 		}
-#endif
-		compressed_data_offset += 4;
+		compression_indicator <<= 1;
 
-		for( compression_indicator_bitmask = 0x80000000UL;
-		     compression_indicator_bitmask > 0;
-		     compression_indicator_bitmask >>= 1 )
+		if( match_size > 0 )
 		{
-			if( uncompressed_data_offset >= safe_uncompressed_data_size )
+			/* The compression tuple contains:
+			 * 0 - 2	the size
+			 * 3 - 15	the offset - 1
+			 * larger sizes are stored in a shared 4-bit value, an 8-bit value and a 16-bit value
+			 */
+			compression_tuple_size = match_size - 3;
+
+			if( compression_tuple_size < 0x07 )
 			{
-				break;
+				compression_tuple = (uint16_t) ( ( ( match_distance - 1 ) << 3 ) | compression_tuple_size );
 			}
-			if( compressed_data_offset >= compressed_data_size )
+			else
 			{
-				break;
+				compression_tuple = (uint16_t) ( ( ( match_distance - 1 ) << 3 ) | 0x07 );
 			}
-			/* If the indicator bit is 0 the data is uncompressed
-			 * or 1 if the data is compressed
-			 */
-			if( ( compression_indicator & compression_indicator_bitmask ) != 0 )
+			if( compressed_data_offset > ( safe_compressed_data_size - 2 ) )
 			{
-				if( compressed_data_offset > ( compressed_data_size - 2 ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: compressed data too small.",
-					 function );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data too small.",
+				 function );
 
-					return( -1 );
-				}
-		                byte_stream_copy_to_uint16_little_endian(
-		                 &( compressed_data[ compressed_data_offset ] ),
-		                 compression_tuple );
+				goto on_error;
+			}
+			byte_stream_copy_from_uint16_little_endian(
+			 &( compressed_data[ compressed_data_offset ] ),
+			 compression_tuple );
 
-				compressed_data_offset += 2;
-
-				/* The compression tuple contains:
-				 * 0 - 2	the size
-				 * 3 - 15	the offset - 1
-				 */
-				compression_tuple_size   = ( compression_tuple & 0x0007 );
-				compression_tuple_offset = ( compression_tuple >> 3 ) + 1;
-
-				/* Check for a first level extended size
-				 * stored in the 4-bits of a shared extended compression tuple size byte
-				 * the size is added to the previous size
-				 */
-				if( compression_tuple_size == 0x07 )
-				{
-					if( compression_shared_byte_index == 0 )
-					{
-						if( compressed_data_offset >= compressed_data_size )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-							 "%s: compressed data too small.",
-							 function );
-
-							return( -1 );
-						}
-						compression_tuple_size += compressed_data[ compressed_data_offset ] & 0x0f;
-
-						compression_shared_byte_index = compressed_data_offset++;
-					}
-					else
-					{
-						compression_tuple_size += compressed_data[ compression_shared_byte_index ] >> 4;
+			compressed_data_offset += 2;
 
-						compression_shared_byte_index = 0;
-					}
-				}
-				/* Check for a second level extended size
-				 * stored in the 8-bits of the next byte
-				 * the size is added to the previous size
-				 */
-				if( compression_tuple_size == ( 0x07 + 0x0f ) )
+			if( compression_tuple_size >= 0x07 )
+			{
+				if( compression_shared_byte_index == 0 )
 				{
-					if( compressed_data_offset >= compressed_data_size )
+					if( compressed_data_offset >= safe_compressed_data_size )
 					{
 						libcerror_error_set(
 						 error,
@@ -298,116 +536,34 @@ int libfwnt_lzxpress_decompress(
 						 "%s: compressed data too small.",
 						 function );
 
-						return( -1 );
+						goto on_error;
 					}
-					compression_tuple_size += compressed_data[ compressed_data_offset++ ];
-				}
-				/* Check for a third level extended size
-				 * stored in the 16-bits of the next two bytes
-				 * the previous size is ignored
-				 */
-				if( compression_tuple_size == ( 0x07 + 0x0f + 0xff ) )
-				{
-					if( compressed_data_offset > ( compressed_data_size - 2 ) )
+					if( compression_tuple_size < ( 0x07 + 0x0f ) )
 					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-						 "%s: compressed data too small.",
-						 function );
-
-						return( -1 );
+						compressed_data[ compressed_data_offset ] = (uint8_t) ( compression_tuple_size - 0x07 );
 					}
-			                byte_stream_copy_to_uint16_little_endian(
-			                 &( compressed_data[ compressed_data_offset ] ),
-			                 compression_tuple_size );
-		
-					compressed_data_offset += 2;
-
-				}
-				/* The size value is stored as
-				 * size - 3
-				 */
-				compression_tuple_size += 3;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: compressed data offset\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
-					 function,
-					 compressed_data_offset,
-					 compressed_data_offset );
-
-					libcnotify_printf(
-					 "%s: compression tuple offset\t\t\t: %" PRIi16 "\n",
-					 function,
-					 compression_tuple_offset );
-
-					libcnotify_printf(
-					 "%s: compression tuple size\t\t\t: %" PRIu16 "\n",
-					 function,
-					 compression_tuple_size );
-
-					libcnotify_printf(
-					 "%s: uncompressed data offset\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
-					 function,
-					 uncompressed_data_offset,
-					 uncompressed_data_offset );
-
-					libcnotify_printf(
-					 "\n" );
-				}
-#endif
-				if( compression_tuple_size > 32771 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: compression tuple size value out of bounds.",
-					 function );
-
-					return( -1 );
+					else
+					{
+						compressed_data[ compressed_data_offset ] = 0x0f;
+					}
+					compression_shared_byte_index = compressed_data_offset++;
 				}
-				compression_index = uncompressed_data_offset - compression_tuple_offset;
-
-				while( compression_tuple_size > 0 )
+				else
 				{
-					if( compression_index >= uncompressed_data_offset )
+					if( compression_tuple_size < ( 0x07 + 0x0f ) )
 					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-						 "%s: invalid compressed data at offset: %" PRIzd " - compression index: %" PRIzd " out of range: %" PRIzd ".",
-						 function,
-						 compressed_data_offset,
-						 compression_index,
-						 uncompressed_data_offset );
-
-						return( -1 );
+						compressed_data[ compression_shared_byte_index ] |= (uint8_t) ( ( compression_tuple_size - 0x07 ) << 4 );
 					}
-					if( uncompressed_data_offset >= safe_uncompressed_data_size )
+					else
 					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-						 "%s: uncompressed data too small.",
-						 function );
-
-						return( -1 );
+						compressed_data[ compression_shared_byte_index ] |= 0xf0;
 					}
-					uncompressed_data[ uncompressed_data_offset++ ] = uncompressed_data[ compression_index++ ];
-
-					compression_tuple_size--;
+					compression_shared_byte_index = 0;
 				}
 			}
-			else
+			if( compression_tuple_size >= ( 0x07 + 0x0f ) )
 			{
-				if( compressed_data_offset >= compressed_data_size )
+				if( compressed_data_offset >= safe_compressed_data_size )
 				{
 					libcerror_error_set(
 					 error,
@@ -416,67 +572,178 @@ int libfwnt_lzxpress_decompress(
 					 "%s: compressed data too small.",
 					 function );
 
-					return( -1 );
+					goto on_error;
 				}
-				if( uncompressed_data_offset > safe_uncompressed_data_size )
+				if( compression_tuple_size < ( 0x07 + 0x0f + 0xff ) )
+				{
+					compressed_data[ compressed_data_offset++ ] = (uint8_t) ( compression_tuple_size - ( 0x07 + 0x0f ) );
+				}
+				else
+				{
+					compressed_data[ compressed_data_offset++ ] = 0xff;
+				}
+			}
+			if( compression_tuple_size >= ( 0x07 + 0x0f + 0xff ) )
+			{
+				if( compressed_data_offset > ( safe_compressed_data_size - 2 ) )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: uncompressed data too small.",
+					 "%s: compressed data too small.",
 					 function );
 
-					return( -1 );
+					goto on_error;
 				}
-				uncompressed_data[ uncompressed_data_offset++ ] = compressed_data[ compressed_data_offset++ ];
+				byte_stream_copy_from_uint16_little_endian(
+				 &( compressed_data[ compressed_data_offset ] ),
+				 compression_tuple_size );
+
+				compressed_data_offset += 2;
+			}
+			compression_indicator |= 1;
+
+			/* The first offset of the match was already added to the hash chain
+			 */
+			uncompressed_data_offset++;
+			match_size--;
+
+			while( match_size > 0 )
+			{
+				libfwnt_lzxpress_hash_chain_insert(
+				 uncompressed_data,
+				 uncompressed_data_size,
+				 uncompressed_data_offset,
+				 hash_table,
+				 hash_chain,
+				 LIBFWNT_LZXPRESS_MAXIMUM_COMPRESSION_OFFSET );
+
+				uncompressed_data_offset++;
+				match_size--;
+			}
+		}
+		else
+		{
+			if( compressed_data_offset >= safe_compressed_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data too small.",
+				 function );
+
+				goto on_error;
+			}
+			compressed_data[ compressed_data_offset++ ] = uncompressed_data[ uncompressed_data_offset++ ];
+		}
+		compression_indicator_bit_count++;
+
+		if( compression_indicator_bit_count == 32 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( compressed_data[ compression_indicator_offset ] ),
+			 compression_indicator );
+
+			if( compressed_data_offset > ( safe_compressed_data_size - 4 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: compressed data too small.",
+				 function );
+
+				goto on_error;
 			}
+			compression_indicator_offset = compressed_data_offset;
+			compressed_data_offset      += 4;
+
+			compression_indicator           = 0;
+			compression_indicator_bit_count = 0;
 		}
 	}
-	*uncompressed_data_size = uncompressed_data_offset;
+	/* The unused bits of the last compression indicator are set
+	 */
+	if( compression_indicator_bit_count == 0 )
+	{
+		compression_indicator = 0xffffffffUL;
+	}
+	else
+	{
+		compression_indicator <<= 32 - compression_indicator_bit_count;
+		compression_indicator  |= ( (uint32_t) 1 << ( 32 - compression_indicator_bit_count ) ) - 1;
+	}
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( compressed_data[ compression_indicator_offset ] ),
+	 compression_indicator );
+
+	memory_free(
+	 hash_chain );
+
+	memory_free(
+	 hash_table );
+
+	*compressed_data_size = compressed_data_offset;
 
 	return( 1 );
+
+on_error:
+	if( hash_chain != NULL )
+	{
+		memory_free(
+		 hash_chain );
+	}
+	if( hash_table != NULL )
+	{
+		memory_free(
+		 hash_table );
+	}
+	return( -1 );
 }
 
-/* Decompresses a LZXPRESS Huffman compressed chunk
+/* Decompresses data using LZXPRESS (LZ77 + DIRECT2) compression
  * Return 1 on success or -1 on error
  */
-int libfwnt_lzxpress_huffman_decompress_chunk(
-     libfwnt_bit_stream_t *bit_stream,
+int libfwnt_lzxpress_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
      uint8_t *uncompressed_data,
-     size_t uncompressed_data_size,
-     size_t *uncompressed_data_offset,
+     size_t *uncompressed_data_size,
      libcerror_error_t **error )
 {
-	uint8_t code_size_array[ 512 ];
-
-	libfwnt_huffman_tree_t *huffman_tree       = NULL;
-	static char *function                      = "libfwnt_lzxpress_huffman_decompress_chunk";
-	size_t next_chunk_uncompressed_data_offset = 0;
-	size_t safe_uncompressed_data_offset       = 0;
-	uint32_t compression_offset                = 0;
-	uint32_t compression_size                  = 0;
-	uint32_t symbol                            = 0;
-	uint8_t byte_value                         = 0;
+	static char *function                  = "libfwnt_lzxpress_decompress";
+	size_t compressed_data_offset          = 0;
+	size_t compression_shared_byte_index   = 0;
+	size_t safe_uncompressed_data_size     = 0;
+	size_t uncompressed_data_offset        = 0;
+	uint32_t compression_indicator         = 0;
+	uint32_t compression_indicator_bitmask = 0;
+	uint16_t compression_tuple             = 0;
+	uint16_t compression_tuple_size        = 0;
+	int16_t compression_tuple_offset       = 0;
 
-	if( bit_stream == NULL )
+	if( compressed_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid bit stream.",
+		 "%s: invalid compressed data.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) < 260 )
+	if( ( compressed_data_size < 2 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid bit stream - byte stream value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
 		 function );
 
 		return( -1 );
@@ -492,84 +759,1149 @@ int libfwnt_lzxpress_huffman_decompress_chunk(
 
 		return( -1 );
 	}
-	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	if( uncompressed_data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
 		 function );
 
 		return( -1 );
 	}
-	if( uncompressed_data_offset == NULL )
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid uncompressed data offset.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	safe_uncompressed_data_offset = *uncompressed_data_offset;
+	safe_uncompressed_data_size = *uncompressed_data_size;
 
-	if( safe_uncompressed_data_offset >= uncompressed_data_size )
+	while( compressed_data_offset < compressed_data_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: uncompressed data offset value out of bounds.",
+		if( uncompressed_data_offset >= safe_uncompressed_data_size )
+		{
+			break;
+		}
+		if( ( compressed_data_size < 4 )
+		 || ( compressed_data_offset > ( compressed_data_size - 4 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: compressed data too small.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 compression_indicator );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: compressed data offset\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
+			 function,
+			 compressed_data_offset,
+			 compressed_data_offset );
+
+			libcnotify_printf(
+			 "%s: compression indicator\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 compression_indicator );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		compressed_data_offset += 4;
+
+		for( compression_indicator_bitmask = 0x80000000UL;
+		     compression_indicator_bitmask > 0;
+		     compression_indicator_bitmask >>= 1 )
+		{
+			if( uncompressed_data_offset >= safe_uncompressed_data_size )
+			{
+				break;
+			}
+			if( compressed_data_offset >= compressed_data_size )
+			{
+				break;
+			}
+			/* If the indicator bit is 0 the data is uncompressed
+			 * or 1 if the data is compressed
+			 */
+			if( ( compression_indicator & compression_indicator_bitmask ) != 0 )
+			{
+				if( compressed_data_offset > ( compressed_data_size - 2 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: compressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+		                byte_stream_copy_to_uint16_little_endian(
+		                 &( compressed_data[ compressed_data_offset ] ),
+		                 compression_tuple );
+
+				compressed_data_offset += 2;
+
+				/* The compression tuple contains:
+				 * 0 - 2	the size
+				 * 3 - 15	the offset - 1
+				 */
+				compression_tuple_size   = ( compression_tuple & 0x0007 );
+				compression_tuple_offset = ( compression_tuple >> 3 ) + 1;
+
+				/* Check for a first level extended size
+				 * stored in the 4-bits of a shared extended compression tuple size byte
+				 * the size is added to the previous size
+				 */
+				if( compression_tuple_size == 0x07 )
+				{
+					if( compression_shared_byte_index == 0 )
+					{
+						if( compressed_data_offset >= compressed_data_size )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+							 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+							 "%s: compressed data too small.",
+							 function );
+
+							return( -1 );
+						}
+						compression_tuple_size += compressed_data[ compressed_data_offset ] & 0x0f;
+
+						compression_shared_byte_index = compressed_data_offset++;
+					}
+					else
+					{
+						compression_tuple_size += compressed_data[ compression_shared_byte_index ] >> 4;
+
+						compression_shared_byte_index = 0;
+					}
+				}
+				/* Check for a second level extended size
+				 * stored in the 8-bits of the next byte
+				 * the size is added to the previous size
+				 */
+				if( compression_tuple_size == ( 0x07 + 0x0f ) )
+				{
+					if( compressed_data_offset >= compressed_data_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: compressed data too small.",
+						 function );
+
+						return( -1 );
+					}
+					compression_tuple_size += compressed_data[ compressed_data_offset++ ];
+				}
+				/* Check for a third level extended size
+				 * stored in the 16-bits of the next two bytes
+				 * the previous size is ignored
+				 */
+				if( compression_tuple_size == ( 0x07 + 0x0f + 0xff ) )
+				{
+					if( compressed_data_offset > ( compressed_data_size - 2 ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: compressed data too small.",
+						 function );
+
+						return( -1 );
+					}
+			                byte_stream_copy_to_uint16_little_endian(
+			                 &( compressed_data[ compressed_data_offset ] ),
+			                 compression_tuple_size );
+		
+					compressed_data_offset += 2;
+
+				}
+				/* The size value is stored as
+				 * size - 3
+				 */
+				compression_tuple_size += 3;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: compressed data offset\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
+					 function,
+					 compressed_data_offset,
+					 compressed_data_offset );
+
+					libcnotify_printf(
+					 "%s: compression tuple offset\t\t\t: %" PRIi16 "\n",
+					 function,
+					 compression_tuple_offset );
+
+					libcnotify_printf(
+					 "%s: compression tuple size\t\t\t: %" PRIu16 "\n",
+					 function,
+					 compression_tuple_size );
+
+					libcnotify_printf(
+					 "%s: uncompressed data offset\t\t\t: %" PRIzd " (0x%08" PRIzx ")\n",
+					 function,
+					 uncompressed_data_offset,
+					 uncompressed_data_offset );
+
+					libcnotify_printf(
+					 "\n" );
+				}
+#endif
+				if( compression_tuple_size > 32771 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: compression tuple size value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				/* The compression tuple offset refers to an offset in the uncompressed data
+				 */
+				if( (size_t) compression_tuple_offset > uncompressed_data_offset )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: invalid compressed data at offset: %" PRIzd " - compression tuple offset: %" PRIi16 " out of range: %" PRIzd ".",
+					 function,
+					 compressed_data_offset,
+					 compression_tuple_offset,
+					 uncompressed_data_offset );
+
+					return( -1 );
+				}
+				if( (size_t) compression_tuple_size > ( safe_uncompressed_data_size - uncompressed_data_offset ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: uncompressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+				libfwnt_match_copy(
+				 uncompressed_data,
+				 uncompressed_data_offset,
+				 (size_t) compression_tuple_offset,
+				 (size_t) compression_tuple_size );
+
+				uncompressed_data_offset += compression_tuple_size;
+			}
+			else
+			{
+				if( compressed_data_offset >= compressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: compressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+				if( uncompressed_data_offset > safe_uncompressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: uncompressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+				uncompressed_data[ uncompressed_data_offset++ ] = compressed_data[ compressed_data_offset++ ];
+			}
+		}
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Compresses a LZXPRESS Huffman compressed chunk
+ * The tokens contain a literal byte value (0 - 255) or a match, which is stored as 2 tokens:
+ * the match size with the 0x80000000 flag set followed by the match distance
+ * The end-of-stream symbol (256) corresponds with a match of size 3 and distance 1
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_lzxpress_huffman_compress_chunk(
+     const uint32_t *tokens,
+     size_t number_of_tokens,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error )
+{
+	uint32_t codes_array[ 512 ];
+	uint32_t symbol_frequencies[ 512 ];
+	uint8_t code_size_array[ 512 ];
+
+	static char *function              = "libfwnt_lzxpress_huffman_compress_chunk";
+	size_t first_value_offset          = 0;
+	size_t safe_compressed_data_offset = 0;
+	size_t second_value_offset         = 0;
+	size_t token_index                 = 0;
+	uint32_t bit_buffer                = 0;
+	uint32_t compression_offset        = 0;
+	uint32_t compression_size          = 0;
+	uint32_t symbol                    = 0;
+	uint32_t value                     = 0;
+	uint8_t compression_offset_bits    = 0;
+	uint8_t number_of_bits             = 0;
+	uint8_t number_of_free_bits        = 0;
+	int value_index                    = 0;
+
+	if( tokens == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tokens.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_compressed_data_offset = *compressed_data_offset;
+
+	/* The chunk consists of the table with the 4-bit code size per symbol
+	 * followed by at least 2 16-bit values with the Huffman encoded data
+	 */
+	if( ( safe_compressed_data_offset > compressed_data_size )
+	 || ( ( compressed_data_size - safe_compressed_data_offset ) < 260 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     symbol_frequencies,
+	     0,
+	     sizeof( uint32_t ) * 512 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear symbol frequencies.",
+		 function );
+
+		return( -1 );
+	}
+	for( token_index = 0;
+	     token_index < number_of_tokens;
+	     token_index++ )
+	{
+		symbol = tokens[ token_index ];
+
+		if( ( symbol & 0x80000000UL ) != 0 )
+		{
+			if( ( token_index + 1 ) >= number_of_tokens )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid tokens - missing match distance.",
+				 function );
+
+				return( -1 );
+			}
+			compression_size   = ( symbol & 0x7fffffffUL ) - 3;
+			compression_offset = tokens[ ++token_index ];
+
+			if( ( compression_size > 0xffffUL )
+			 || ( compression_offset == 0 )
+			 || ( compression_offset > 0xffffUL ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid tokens - match value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			for( compression_offset_bits = 0;
+			     ( compression_offset >> ( compression_offset_bits + 1 ) ) != 0;
+			     compression_offset_bits++ )
+			{
+			}
+			if( compression_size > 15 )
+			{
+				compression_size = 15;
+			}
+			symbol = 256 + ( (uint32_t) compression_offset_bits << 4 ) + compression_size;
+		}
+		else if( symbol > 255 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid tokens - literal value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		symbol_frequencies[ symbol ] += 1;
+	}
+	if( libfwnt_huffman_tree_get_code_sizes_from_frequencies(
+	     symbol_frequencies,
+	     512,
+	     15,
+	     code_size_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine code sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_huffman_tree_get_codes_from_code_sizes(
+	     code_size_array,
+	     512,
+	     15,
+	     codes_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine codes.",
+		 function );
+
+		return( -1 );
+	}
+	/* The table contains 4-bits code size per symbol
+	 */
+	for( symbol = 0;
+	     symbol < 512;
+	     symbol += 2 )
+	{
+		compressed_data[ safe_compressed_data_offset++ ] = code_size_array[ symbol ] | ( code_size_array[ symbol + 1 ] << 4 );
+	}
+	/* The decompressor reads 2 16-bit values ahead and the extended compression sizes are
+	 * read from the compressed data directly after them, hence the bits are stored in 2 reserved
+	 * 16-bit values and a new value is reserved when the first one is filled
+	 */
+	first_value_offset           = safe_compressed_data_offset;
+	second_value_offset          = safe_compressed_data_offset + 2;
+	safe_compressed_data_offset += 4;
+	number_of_free_bits          = 16;
+
+	for( token_index = 0;
+	     token_index < number_of_tokens;
+	     token_index++ )
+	{
+		symbol = tokens[ token_index ];
+
+		if( ( symbol & 0x80000000UL ) != 0 )
+		{
+			compression_size   = ( symbol & 0x7fffffffUL ) - 3;
+			compression_offset = tokens[ ++token_index ];
+
+			for( compression_offset_bits = 0;
+			     ( compression_offset >> ( compression_offset_bits + 1 ) ) != 0;
+			     compression_offset_bits++ )
+			{
+			}
+			if( compression_size < 15 )
+			{
+				symbol = 256 + ( (uint32_t) compression_offset_bits << 4 ) + compression_size;
+			}
+			else
+			{
+				symbol = 256 + ( (uint32_t) compression_offset_bits << 4 ) + 15;
+			}
+		}
+		for( value_index = 0;
+		     value_index < 2;
+		     value_index++ )
+		{
+			if( value_index == 0 )
+			{
+				value          = codes_array[ symbol ];
+				number_of_bits = code_size_array[ symbol ];
+			}
+			else
+			{
+				if( symbol < 256 )
+				{
+					break;
+				}
+				/* The extended compression size is stored in the compressed data
+				 * before the compression offset bits
+				 */
+				if( compression_size >= 15 )
+				{
+					if( safe_compressed_data_offset >= compressed_data_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: compressed data too small.",
+						 function );
+
+						return( -1 );
+					}
+					if( compression_size < ( 15 + 255 ) )
+					{
+						compressed_data[ safe_compressed_data_offset++ ] = (uint8_t) ( compression_size - 15 );
+					}
+					else
+					{
+						compressed_data[ safe_compressed_data_offset++ ] = 0xff;
+
+						if( ( compressed_data_size - safe_compressed_data_offset ) < 2 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+							 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+							 "%s: compressed data too small.",
+							 function );
+
+							return( -1 );
+						}
+						byte_stream_copy_from_uint16_little_endian(
+						 &( compressed_data[ safe_compressed_data_offset ] ),
+						 compression_size );
+
+						safe_compressed_data_offset += 2;
+					}
+				}
+				value          = compression_offset & ( ( (uint32_t) 1 << compression_offset_bits ) - 1 );
+				number_of_bits = compression_offset_bits;
+			}
+			if( number_of_bits <= number_of_free_bits )
+			{
+				bit_buffer           = ( bit_buffer << number_of_bits ) | value;
+				number_of_free_bits -= number_of_bits;
+			}
+			else
+			{
+				number_of_bits -= number_of_free_bits;
+
+				bit_buffer = ( bit_buffer << number_of_free_bits ) | ( value >> number_of_bits );
+
+				byte_stream_copy_from_uint16_little_endian(
+				 &( compressed_data[ first_value_offset ] ),
+				 bit_buffer );
+
+				if( ( compressed_data_size - safe_compressed_data_offset ) < 2 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: compressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+				first_value_offset           = second_value_offset;
+				second_value_offset          = safe_compressed_data_offset;
+				safe_compressed_data_offset += 2;
+
+				bit_buffer          = value & ( ( (uint32_t) 1 << number_of_bits ) - 1 );
+				number_of_free_bits = 16 - number_of_bits;
+			}
+		}
+	}
+	bit_buffer <<= number_of_free_bits;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( compressed_data[ first_value_offset ] ),
+	 bit_buffer );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( compressed_data[ second_value_offset ] ),
+	 0 );
+
+	*compressed_data_offset = safe_compressed_data_offset;
+
+	return( 1 );
+}
+
+/* Compresses data using LZXPRESS Huffman compression
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_lzxpress_huffman_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_lzxpress_huffman_compress";
+
+	if( libfwnt_lzxpress_huffman_compress_with_level(
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     compressed_data,
+	     compressed_data_size,
+	     LIBFWNT_COMPRESSION_LEVEL_DEFAULT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+		 "%s: unable to compress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compresses data using LZXPRESS Huffman compression with a specific compression level
+ * The fast compression level uses a single hash probe per offset, the default and
+ * normal levels search a hash chain and the best level adds lazy matching
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_lzxpress_huffman_compress_with_level(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int compression_level,
+     libcerror_error_t **error )
+{
+	size_t *hash_chain              = NULL;
+	size_t *hash_table              = NULL;
+	uint32_t *tokens                = NULL;
+	static char *function           = "libfwnt_lzxpress_huffman_compress_with_level";
+	size_t compressed_data_offset   = 0;
+	size_t match_distance           = 0;
+	size_t match_size               = 0;
+	size_t maximum_match_size       = 0;
+	size_t next_match_distance      = 0;
+	size_t next_match_size          = 0;
+	size_t number_of_tokens         = 0;
+	size_t uncompressed_chunk_end   = 0;
+	size_t uncompressed_data_offset = 0;
+	int has_end_of_stream           = 0;
+	int has_next_match              = 0;
+	int maximum_chain_length        = 0;
+	int use_lazy_matching           = 0;
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
 		 function );
 
 		return( -1 );
 	}
-	/* The table contains 4-bits code size per symbol
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	switch( compression_level )
+	{
+		case LIBFWNT_COMPRESSION_LEVEL_FAST:
+			maximum_chain_length = 1;
+			use_lazy_matching    = 0;
+			break;
+
+		case LIBFWNT_COMPRESSION_LEVEL_DEFAULT:
+		case LIBFWNT_COMPRESSION_LEVEL_NORMAL:
+			maximum_chain_length = 16;
+			use_lazy_matching    = 0;
+			break;
+
+		case LIBFWNT_COMPRESSION_LEVEL_BEST:
+			maximum_chain_length = 256;
+			use_lazy_matching    = 1;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported compression level.",
+			 function );
+
+			return( -1 );
+	}
+	hash_table = (size_t *) memory_allocate(
+	                         sizeof( size_t ) * ( 1 << LIBFWNT_LZXPRESS_HASH_BITS ) );
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     hash_table,
+	     0,
+	     sizeof( size_t ) * ( 1 << LIBFWNT_LZXPRESS_HASH_BITS ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		goto on_error;
+	}
+	hash_chain = (size_t *) memory_allocate(
+	                         sizeof( size_t ) * LIBFWNT_LZXPRESS_HUFFMAN_CHUNK_SIZE );
+
+	if( hash_chain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash chain.",
+		 function );
+
+		goto on_error;
+	}
+	/* A match takes 2 tokens and at least 3 bytes, so a chunk requires at most
+	 * 1 token per byte and 2 tokens for the end-of-stream symbol
 	 */
-	while( symbol < 512 )
+	tokens = (uint32_t *) memory_allocate(
+	                       sizeof( uint32_t ) * ( LIBFWNT_LZXPRESS_HUFFMAN_CHUNK_SIZE + 2 ) );
+
+	if( tokens == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tokens.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		uncompressed_chunk_end = uncompressed_data_size - uncompressed_data_offset;
+
+		if( uncompressed_chunk_end > LIBFWNT_LZXPRESS_HUFFMAN_CHUNK_SIZE )
+		{
+			uncompressed_chunk_end = LIBFWNT_LZXPRESS_HUFFMAN_CHUNK_SIZE;
+		}
+		uncompressed_chunk_end += uncompressed_data_offset;
+		number_of_tokens        = 0;
+
+		/* Matches can refer to data of previous chunks but do not extend beyond the end of the chunk
+		 */
+		while( uncompressed_data_offset < uncompressed_chunk_end )
+		{
+			maximum_match_size = uncompressed_chunk_end - uncompressed_data_offset;
+
+			if( has_next_match != 0 )
+			{
+				match_distance = next_match_distance;
+				match_size     = next_match_size;
+				has_next_match = 0;
+			}
+			else if( libfwnt_lzxpress_compress_find_match(
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          uncompressed_data_offset,
+			          hash_table,
+			          hash_chain,
+			          LIBFWNT_LZXPRESS_HUFFMAN_CHUNK_SIZE,
+			          maximum_chain_length,
+			          maximum_match_size,
+			          &match_distance,
+			          &match_size,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to find match at offset: %" PRIzd ".",
+				 function,
+				 uncompressed_data_offset );
+
+				goto on_error;
+			}
+			libfwnt_lzxpress_hash_chain_insert(
+			 uncompressed_data,
+			 uncompressed_data_size,
+			 uncompressed_data_offset,
+			 hash_table,
+			 hash_chain,
+			 LIBFWNT_LZXPRESS_HUFFMAN_CHUNK_SIZE );
+
+			/* With lazy matching a match is deferred if the next offset has a longer match
+			 */
+			if( ( use_lazy_matching != 0 )
+			 && ( match_size > 0 )
+			 && ( match_size < maximum_match_size ) )
+			{
+				if( libfwnt_lzxpress_compress_find_match(
+				     uncompressed_data,
+				     uncompressed_data_size,
+				     uncompressed_data_offset + 1,
+				     hash_table,
+				     hash_chain,
+				     LIBFWNT_LZXPRESS_HUFFMAN_CHUNK_SIZE,
+				     maximum_chain_length,
+				     maximum_match_size - 1,
+				     &next_match_distance,
+				     &next_match_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to find match at offset: %" PRIzd ".",
+					 function,
+					 uncompressed_data_offset + 1 );
+
+					goto on_error;
+				}
+				if( next_match_size > match_size )
+				{
+					match_size     = 0;
+					has_next_match = 1;
+				}
+			}
+			if( match_size > 0 )
+			{
+				tokens[ number_of_tokens++ ] = 0x80000000UL | (uint32_t) match_size;
+				tokens[ number_of_tokens++ ] = (uint32_t) match_distance;
+
+				/* The first offset of the match was already added to the hash chain
+				 */
+				uncompressed_data_offset++;
+				match_size--;
+
+				while( match_size > 0 )
+				{
+					libfwnt_lzxpress_hash_chain_insert(
+					 uncompressed_data,
+					 uncompressed_data_size,
+					 uncompressed_data_offset,
+					 hash_table,
+					 hash_chain,
+					 LIBFWNT_LZXPRESS_HUFFMAN_CHUNK_SIZE );
+
+					uncompressed_data_offset++;
+					match_size--;
+				}
+			}
+			else
+			{
+				tokens[ number_of_tokens++ ] = uncompressed_data[ uncompressed_data_offset++ ];
+			}
+		}
+		/* The last chunk is terminated by the end-of-stream symbol. The decoder does not read
+		 * beyond the uncompressed size of a chunk, hence if the data ends on a chunk boundary
+		 * the end-of-stream symbol is stored in an additional chunk
+		 */
+		if( ( uncompressed_data_offset >= uncompressed_data_size )
+		 && ( ( number_of_tokens == 0 )
+		  || ( ( uncompressed_data_size % LIBFWNT_LZXPRESS_HUFFMAN_CHUNK_SIZE ) != 0 ) ) )
+		{
+			tokens[ number_of_tokens++ ] = 0x80000000UL | 3;
+			tokens[ number_of_tokens++ ] = 1;
+
+			has_end_of_stream = 1;
+		}
+		if( libfwnt_lzxpress_huffman_compress_chunk(
+		     tokens,
+		     number_of_tokens,
+		     compressed_data,
+		     *compressed_data_size,
+		     &compressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_COMPRESS_FAILED,
+			 "%s: unable to compress chunk.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( has_end_of_stream == 0 );
+
+	memory_free(
+	 tokens );
+
+	memory_free(
+	 hash_chain );
+
+	memory_free(
+	 hash_table );
+
+	*compressed_data_size = compressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( tokens != NULL )
+	{
+		memory_free(
+		 tokens );
+	}
+	if( hash_chain != NULL )
+	{
+		memory_free(
+		 hash_chain );
+	}
+	if( hash_table != NULL )
+	{
+		memory_free(
+		 hash_table );
+	}
+	return( -1 );
+}
+
+/* Decompresses a LZXPRESS Huffman compressed chunk
+ * The Huffman tree of the decoder is rebuilt in place from the chunk code sizes table
+ * Return 1 on success or -1 on error
+ */
+int libfwnt_lzxpress_huffman_decompress_chunk(
+     libfwnt_lzxpress_huffman_decoder_t *decoder,
+     libfwnt_bit_stream_t *bit_stream,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t *uncompressed_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function                      = "libfwnt_lzxpress_huffman_decompress_chunk";
+	size_t next_chunk_uncompressed_data_offset = 0;
+	size_t safe_uncompressed_data_offset       = 0;
+	uint32_t compression_offset                = 0;
+	uint32_t compression_size                  = 0;
+	uint32_t symbol                            = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) < 260 )
 	{
-		byte_value = bit_stream->byte_stream[ bit_stream->byte_stream_offset ];
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid bit stream - byte stream value too small.",
+		 function );
 
-		code_size_array[ symbol++ ] = byte_value & 0x0f;
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
 
-		byte_value >>= 4;
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
 
-		code_size_array[ symbol++ ] = byte_value & 0x0f;
+		return( -1 );
+	}
+	if( uncompressed_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data offset.",
+		 function );
 
-		bit_stream->byte_stream_offset += 1;
+		return( -1 );
 	}
-	if( libfwnt_huffman_tree_initialize(
-	     &huffman_tree,
-	     512,
-	     15,
-	     error ) != 1 )
+	safe_uncompressed_data_offset = *uncompressed_data_offset;
+
+	if( safe_uncompressed_data_offset >= uncompressed_data_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create Huffman tree.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: uncompressed data offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfwnt_huffman_tree_build(
-	     huffman_tree,
-	     code_size_array,
-	     512,
+	if( libfwnt_lzxpress_huffman_decoder_read_table(
+	     decoder,
+	     bit_stream,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to build Huffman tree.",
+		 "%s: unable to read code sizes table.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( libfwnt_bit_stream_read(
 	     bit_stream,
@@ -583,7 +1915,7 @@ int libfwnt_lzxpress_huffman_decompress_chunk(
 		 "%s: unable to read 32-bit from bit stream.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	next_chunk_uncompressed_data_offset = safe_uncompressed_data_offset + 65536;
 
@@ -626,7 +1958,7 @@ int libfwnt_lzxpress_huffman_decompress_chunk(
 		}
 #endif
 		if( libfwnt_huffman_tree_get_symbol_from_bit_stream(
-		     huffman_tree,
+		     decoder->huffman_tree,
 		     bit_stream,
 		     &symbol,
 		     error ) != 1 )
@@ -638,7 +1970,7 @@ int libfwnt_lzxpress_huffman_decompress_chunk(
 			 "%s: unable to read symbol.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -669,7 +2001,7 @@ int libfwnt_lzxpress_huffman_decompress_chunk(
 				 "%s: unable to read 16-bit from bit stream.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -681,9 +2013,17 @@ int libfwnt_lzxpress_huffman_decompress_chunk(
 			 bit_stream->bit_buffer_size );
 		}
 #endif
-		/* Check if we have an end-of-block marker (symbol 256) and the number of remaining bits are 0
+		/* Check if we have an end-of-stream marker (symbol 256) at the end of the compressed data
+		 * and the number of remaining bits are 0
+		 */
+		if( ( symbol == 256 )
+		 && ( bit_stream->byte_stream_offset >= bit_stream->byte_stream_size )
+		 && ( bit_stream->bit_buffer == 0 ) )
+		{
+			break;
+		}
+		/* Check if the uncompressed data is full and the number of remaining bits are 0
 		 */
-/* TODO add ( symbol == 256 ) */
 		if( ( bit_stream->bit_buffer == 0 )
 		 && ( safe_uncompressed_data_offset >= uncompressed_data_size ) )
 		{
@@ -711,7 +2051,7 @@ int libfwnt_lzxpress_huffman_decompress_chunk(
 					 "%s: unable to retrieve compression offset from bit stream.",
 					 function );
 
-					goto on_error;
+					return( -1 );
 				}
 #if defined( HAVE_DEBUG_OUTPUT )
 				if( libcnotify_verbose != 0 )
@@ -747,7 +2087,7 @@ int libfwnt_lzxpress_huffman_decompress_chunk(
 					 "%s: compressed data size value too small.",
 					 function );
 
-					goto on_error;
+					return( -1 );
 				}
 				compression_size = bit_stream->byte_stream[ bit_stream->byte_stream_offset ] + 15;
 
@@ -779,7 +2119,7 @@ int libfwnt_lzxpress_huffman_decompress_chunk(
 						 "%s: compressed data size value too small.",
 						 function );
 
-						goto on_error;
+						return( -1 );
 					}
 					byte_stream_copy_to_uint16_little_endian(
 					 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
@@ -813,7 +2153,7 @@ int libfwnt_lzxpress_huffman_decompress_chunk(
 							 "%s: compressed data size value too small.",
 							 function );
 
-							goto on_error;
+							return( -1 );
 						}
 						byte_stream_copy_to_uint32_little_endian(
 						 &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] ),
@@ -870,7 +2210,7 @@ int libfwnt_lzxpress_huffman_decompress_chunk(
 				 "%s: compression offset value out of bounds.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			if( compression_size > ( uncompressed_data_size - safe_uncompressed_data_offset ) )
 			{
@@ -881,16 +2221,16 @@ int libfwnt_lzxpress_huffman_decompress_chunk(
 				 "%s: compression size value out of bounds.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-			compression_offset = safe_uncompressed_data_offset - compression_offset;
+			libfwnt_match_copy(
+			 uncompressed_data,
+			 safe_uncompressed_data_offset,
+			 (size_t) compression_offset,
+			 (size_t) compression_size );
 
-			while( compression_size > 0 )
-			{
-				uncompressed_data[ safe_uncompressed_data_offset++ ] = uncompressed_data[ compression_offset++ ];
+			safe_uncompressed_data_offset += compression_size;
 
-				compression_size--;
-			}
 			/* Make sure the bit buffer contains at least 16-bit to ensure successive chunks in a stream are read correctly
 			 */
 			if( bit_stream->bit_buffer_size < 16 )
@@ -907,7 +2247,7 @@ int libfwnt_lzxpress_huffman_decompress_chunk(
 					 "%s: unable to read 16-bit from bit stream.",
 					 function );
 
-					goto on_error;
+					return( -1 );
 				}
 			}
 		}
@@ -917,50 +2257,443 @@ int libfwnt_lzxpress_huffman_decompress_chunk(
 			libcnotify_printf(
 			 "\n" );
 		}
-#endif
+#endif
+	}
+	*uncompressed_data_offset = safe_uncompressed_data_offset;
+
+	return( 1 );
+}
+
+/* Decompresses data using LZXPRESS Huffman compression
+ * Return 1 on success or -1 on error
+ */
+int libfwnt_lzxpress_huffman_decompress(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_bit_stream_t *bit_stream            = NULL;
+	libfwnt_lzxpress_huffman_decoder_t *decoder = NULL;
+	static char *function                       = "libfwnt_lzxpress_huffman_decompress";
+	size_t safe_uncompressed_data_size          = 0;
+	size_t uncompressed_data_offset             = 0;
+
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_bit_stream_initialize(
+	     &bit_stream,
+	     compressed_data,
+	     compressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	/* The decoder is reused for all chunks in the stream
+	 */
+	if( libfwnt_lzxpress_huffman_decoder_initialize(
+	     &decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	safe_uncompressed_data_size = *uncompressed_data_size;
+
+	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	{
+		if( uncompressed_data_offset >= safe_uncompressed_data_size )
+		{
+			break;
+		}
+		if( libfwnt_lzxpress_huffman_decompress_chunk(
+		     decoder,
+		     bit_stream,
+		     uncompressed_data,
+		     safe_uncompressed_data_size,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress chunk.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfwnt_lzxpress_huffman_decoder_free(
+	     &decoder,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwnt_bit_stream_free(
+	     &bit_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free bit stream.",
+		 function );
+
+		goto on_error;
+	}
+	*uncompressed_data_size = uncompressed_data_offset;
+
+	return( 1 );
+
+on_error:
+	if( decoder != NULL )
+	{
+		libfwnt_lzxpress_huffman_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	if( bit_stream != NULL )
+	{
+		libfwnt_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decompresses a LZXPRESS Huffman compressed chunk of which the boundaries are known
+ * If is independent is set the chunk is decompressed without access to the preceding
+ * uncompressed data and a compression offset that refers to it is considered an error
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_lzxpress_huffman_decompress_framed_chunk(
+     libfwnt_lzxpress_huffman_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     uint8_t *uncompressed_data,
+     libfwnt_lzxpress_huffman_chunk_t *chunk,
+     uint8_t is_independent,
+     libcerror_error_t **error )
+{
+	libfwnt_bit_stream_t bit_stream;
+
+	static char *function           = "libfwnt_lzxpress_huffman_decompress_framed_chunk";
+	uint8_t *chunk_uncompressed_data = NULL;
+	size_t uncompressed_data_end     = 0;
+	size_t uncompressed_data_offset  = 0;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &bit_stream,
+	     0,
+	     sizeof( libfwnt_bit_stream_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	bit_stream.byte_stream      = &( compressed_data[ chunk->compressed_data_offset ] );
+	bit_stream.byte_stream_size = chunk->compressed_data_size;
+
+	/* An independent chunk is decompressed into its own slice of the uncompressed data
+	 * so that a compression offset cannot refer to data of the preceding chunks
+	 */
+	if( is_independent != 0 )
+	{
+		chunk_uncompressed_data  = &( uncompressed_data[ chunk->uncompressed_data_offset ] );
+		uncompressed_data_offset = 0;
+		uncompressed_data_end    = chunk->uncompressed_data_size;
+	}
+	else
+	{
+		chunk_uncompressed_data  = uncompressed_data;
+		uncompressed_data_offset = chunk->uncompressed_data_offset;
+		uncompressed_data_end    = chunk->uncompressed_data_offset + chunk->uncompressed_data_size;
+	}
+	while( bit_stream.byte_stream_offset < bit_stream.byte_stream_size )
+	{
+		if( uncompressed_data_offset >= uncompressed_data_end )
+		{
+			break;
+		}
+		if( libfwnt_lzxpress_huffman_decompress_chunk(
+		     decoder,
+		     &bit_stream,
+		     chunk_uncompressed_data,
+		     uncompressed_data_end,
+		     &uncompressed_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress chunk.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( uncompressed_data_offset != uncompressed_data_end )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: mismatch in chunk uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decompresses the chunks of a decompress job
+ * Every chunk is decompressed independent of the preceding chunks
+ * and the result is stored in the chunk
+ * Returns 1 if every chunk was decompressed or -1 otherwise
+ */
+int libfwnt_lzxpress_huffman_decompress_job_run(
+     libfwnt_lzxpress_huffman_decompress_job_t *job )
+{
+	libfwnt_lzxpress_huffman_decoder_t *decoder = NULL;
+	int chunk_index                             = 0;
+	int result                                  = 1;
+
+	if( job == NULL )
+	{
+		return( -1 );
+	}
+	if( libfwnt_lzxpress_huffman_decoder_initialize(
+	     &decoder,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	for( chunk_index = 0;
+	     chunk_index < job->number_of_chunks;
+	     chunk_index++ )
+	{
+		job->chunks[ chunk_index ].result = libfwnt_lzxpress_huffman_decompress_framed_chunk(
+		                                     decoder,
+		                                     job->compressed_data,
+		                                     job->uncompressed_data,
+		                                     &( job->chunks[ chunk_index ] ),
+		                                     1,
+		                                     NULL );
+
+		if( job->chunks[ chunk_index ].result != 1 )
+		{
+			result = -1;
+		}
 	}
-	if( libfwnt_huffman_tree_free(
-	     &huffman_tree,
-	     error ) != 1 )
+	if( libfwnt_lzxpress_huffman_decoder_free(
+	     &decoder,
+	     NULL ) != 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free Huffman tree.",
-		 function );
-
-		goto on_error;
+		result = -1;
 	}
-	*uncompressed_data_offset = safe_uncompressed_data_offset;
+	return( result );
+}
 
-	return( 1 );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
 
-on_error:
-	if( huffman_tree != NULL )
+/* Callback function to decompress the chunks of a decompress job from a thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_lzxpress_huffman_decompress_job_callback(
+     intptr_t *job,
+     void *arguments LIBFWNT_ATTRIBUTE_UNUSED )
+{
+	LIBFWNT_UNREFERENCED_PARAMETER( arguments )
+
+	if( job == NULL )
 	{
-		libfwnt_huffman_tree_free(
-		 &huffman_tree,
-		 NULL );
+		return( -1 );
 	}
-	return( -1 );
+	/* The result of every chunk is checked when the thread pool has been joined
+	 */
+	libfwnt_lzxpress_huffman_decompress_job_run(
+	 (libfwnt_lzxpress_huffman_decompress_job_t *) job );
+
+	return( 1 );
 }
 
-/* Decompresses data using LZXPRESS Huffman compression
- * Return 1 on success or -1 on error
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Decompresses data using LZXPRESS Huffman compression using multiple threads
+ * The chunk offsets contain the offset of every chunk in the compressed data,
+ * such as the chunk offset table of a WOF compressed file, where every chunk,
+ * except the last, decompresses to chunk size bytes
+ * The chunks are decompressed in parallel into their own part of the uncompressed data,
+ * a chunk that refers to data of the preceding chunks is decompressed sequentially afterwards
+ * A single chunk is decompressed the same way as libfwnt_lzxpress_huffman_decompress
+ * If the number of threads is 0 or 1 or multi-threading is not supported the data is
+ * decompressed sequentially
+ * Returns 1 on success or -1 on error
  */
-int libfwnt_lzxpress_huffman_decompress(
+int libfwnt_lzxpress_huffman_decompress_parallel(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
+     const size_t *chunk_offsets,
+     int number_of_chunks,
+     size_t chunk_size,
      uint8_t *uncompressed_data,
      size_t *uncompressed_data_size,
+     int number_of_threads,
      libcerror_error_t **error )
 {
-	libfwnt_bit_stream_t *bit_stream   = NULL;
-	static char *function              = "libfwnt_lzxpress_huffman_decompress";
-	size_t safe_uncompressed_data_size = 0;
-	size_t uncompressed_data_offset    = 0;
+	libfwnt_lzxpress_huffman_chunk_t *chunks        = NULL;
+	libfwnt_lzxpress_huffman_decoder_t *decoder     = NULL;
+	static char *function                           = "libfwnt_lzxpress_huffman_decompress_parallel";
+	size_t compressed_data_end                      = 0;
+	size_t safe_uncompressed_data_size              = 0;
+	size_t uncompressed_data_offset                 = 0;
+	int chunk_index                                 = 0;
+	int number_of_used_chunks                       = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool          = NULL;
+	libfwnt_lzxpress_huffman_decompress_job_t *jobs = NULL;
+	int job_index                                   = 0;
+	int number_of_jobs                              = 0;
+#endif
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_chunks < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of chunks value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
 
+		return( -1 );
+	}
 	if( uncompressed_data_size == NULL )
 	{
 		libcerror_error_set(
@@ -972,33 +2705,117 @@ int libfwnt_lzxpress_huffman_decompress(
 
 		return( -1 );
 	}
-	if( libfwnt_bit_stream_initialize(
-	     &bit_stream,
-	     compressed_data,
-	     compressed_data_size,
-	     error ) != 1 )
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create bit stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
 	}
 	safe_uncompressed_data_size = *uncompressed_data_size;
 
-	while( bit_stream->byte_stream_offset < bit_stream->byte_stream_size )
+	/* Chunks that start beyond the end of the uncompressed data are ignored
+	 */
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
 	{
 		if( uncompressed_data_offset >= safe_uncompressed_data_size )
 		{
 			break;
 		}
-		if( libfwnt_lzxpress_huffman_decompress_chunk(
-		     bit_stream,
+		uncompressed_data_offset += chunk_size;
+
+		if( uncompressed_data_offset > safe_uncompressed_data_size )
+		{
+			uncompressed_data_offset = safe_uncompressed_data_size;
+		}
+	}
+	number_of_used_chunks = chunk_index;
+
+	if( number_of_used_chunks == 0 )
+	{
+		*uncompressed_data_size = 0;
+
+		return( 1 );
+	}
+	chunks = (libfwnt_lzxpress_huffman_chunk_t *) memory_allocate(
+	                                               sizeof( libfwnt_lzxpress_huffman_chunk_t ) * number_of_used_chunks );
+
+	if( chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunks.",
+		 function );
+
+		goto on_error;
+	}
+	uncompressed_data_offset = 0;
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_used_chunks;
+	     chunk_index++ )
+	{
+		if( ( chunk_index + 1 ) < number_of_chunks )
+		{
+			compressed_data_end = chunk_offsets[ chunk_index + 1 ];
+		}
+		else
+		{
+			compressed_data_end = compressed_data_size;
+		}
+		if( ( chunk_offsets[ chunk_index ] >= compressed_data_end )
+		 || ( compressed_data_end > compressed_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid chunk: %d offset value out of bounds.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		chunks[ chunk_index ].compressed_data_offset   = chunk_offsets[ chunk_index ];
+		chunks[ chunk_index ].compressed_data_size     = compressed_data_end - chunk_offsets[ chunk_index ];
+		chunks[ chunk_index ].uncompressed_data_offset = uncompressed_data_offset;
+		chunks[ chunk_index ].uncompressed_data_size   = chunk_size;
+		chunks[ chunk_index ].result                   = 0;
+
+		if( chunk_size > ( safe_uncompressed_data_size - uncompressed_data_offset ) )
+		{
+			chunks[ chunk_index ].uncompressed_data_size = safe_uncompressed_data_size - uncompressed_data_offset;
+		}
+		uncompressed_data_offset += chunks[ chunk_index ].uncompressed_data_size;
+	}
+	/* A single chunk is decompressed as a stream so that the result is the same
+	 * as that of libfwnt_lzxpress_huffman_decompress
+	 */
+	if( number_of_used_chunks == 1 )
+	{
+		if( libfwnt_lzxpress_huffman_decompress(
+		     &( compressed_data[ chunks[ 0 ].compressed_data_offset ] ),
+		     chunks[ 0 ].compressed_data_size,
 		     uncompressed_data,
-		     safe_uncompressed_data_size,
 		     &uncompressed_data_offset,
 		     error ) != 1 )
 		{
@@ -1006,36 +2823,213 @@ int libfwnt_lzxpress_huffman_decompress(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
 			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-			 "%s: unable to decompress chunk.",
+			 "%s: unable to decompress chunk: 0.",
 			 function );
 
 			goto on_error;
 		}
+		memory_free(
+		 chunks );
+
+		*uncompressed_data_size = uncompressed_data_offset;
+
+		return( 1 );
 	}
-	if( libfwnt_bit_stream_free(
-	     &bit_stream,
-	     error ) != 1 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_used_chunks > 1 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free bit stream.",
-		 function );
+		number_of_jobs = number_of_used_chunks;
 
-		goto on_error;
+		if( number_of_threads <= ( number_of_used_chunks / LIBFWNT_LZXPRESS_HUFFMAN_NUMBER_OF_JOBS_PER_THREAD ) )
+		{
+			number_of_jobs = number_of_threads * LIBFWNT_LZXPRESS_HUFFMAN_NUMBER_OF_JOBS_PER_THREAD;
+		}
+		jobs = (libfwnt_lzxpress_huffman_decompress_job_t *) memory_allocate(
+		                                                      sizeof( libfwnt_lzxpress_huffman_decompress_job_t ) * number_of_jobs );
+
+		if( jobs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create jobs.",
+			 function );
+
+			goto on_error;
+		}
+		/* Distribute the chunks over the jobs in contiguous ranges
+		 */
+		chunk_index = 0;
+
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			jobs[ job_index ].compressed_data   = compressed_data;
+			jobs[ job_index ].uncompressed_data = uncompressed_data;
+			jobs[ job_index ].chunks            = &( chunks[ chunk_index ] );
+			jobs[ job_index ].number_of_chunks  = ( number_of_used_chunks - chunk_index ) / ( number_of_jobs - job_index );
+
+			chunk_index += jobs[ job_index ].number_of_chunks;
+		}
+		if( number_of_threads > number_of_jobs )
+		{
+			number_of_threads = number_of_jobs;
+		}
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     number_of_jobs,
+		     (int (*)(intptr_t *, void *)) &libfwnt_lzxpress_huffman_decompress_job_callback,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( jobs[ job_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push job: %d onto thread pool.",
+				 function,
+				 job_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 jobs );
+
+		jobs = NULL;
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	/* Decompress the chunks that were not decompressed in parallel, in order,
+	 * which also determines the error if the compressed data is corrupt
+	 */
+	for( chunk_index = 0;
+	     chunk_index < number_of_used_chunks;
+	     chunk_index++ )
+	{
+		if( chunks[ chunk_index ].result == 1 )
+		{
+			continue;
+		}
+		if( decoder == NULL )
+		{
+			if( libfwnt_lzxpress_huffman_decoder_initialize(
+			     &decoder,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create decoder.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libfwnt_lzxpress_huffman_decompress_framed_chunk(
+		     decoder,
+		     compressed_data,
+		     uncompressed_data,
+		     &( chunks[ chunk_index ] ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	if( decoder != NULL )
+	{
+		if( libfwnt_lzxpress_huffman_decoder_free(
+		     &decoder,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decoder.",
+			 function );
+
+			goto on_error;
+		}
 	}
+	memory_free(
+	 chunks );
+
 	*uncompressed_data_size = uncompressed_data_offset;
 
 	return( 1 );
 
 on_error:
-	if( bit_stream != NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
 	{
-		libfwnt_bit_stream_free(
-		 &bit_stream,
+		libcthreads_thread_pool_join(
+		 &thread_pool,
 		 NULL );
 	}
+	if( jobs != NULL )
+	{
+		memory_free(
+		 jobs );
+	}
+#endif
+	if( decoder != NULL )
+	{
+		libfwnt_lzxpress_huffman_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	if( chunks != NULL )
+	{
+		memory_free(
+		 chunks );
+	}
 	return( -1 );
 }
 
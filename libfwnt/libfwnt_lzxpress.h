@@ -29,11 +29,28 @@
 #include "libfwnt_extern.h"
 #include "libfwnt_huffman_tree.h"
 #include "libfwnt_libcerror.h"
+#include "libfwnt_lzxpress_huffman_decoder.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The maximum LZXPRESS (LZ77 + DIRECT2) compression offset
+ */
+#define LIBFWNT_LZXPRESS_MAXIMUM_COMPRESSION_OFFSET	8192
+
+/* The maximum LZXPRESS (LZ77 + DIRECT2) compression size
+ */
+#define LIBFWNT_LZXPRESS_MAXIMUM_COMPRESSION_SIZE	32771
+
+/* The number of bits of the match finder hash
+ */
+#define LIBFWNT_LZXPRESS_HASH_BITS			14
+
+/* The (uncompressed) size of a LZXPRESS Huffman chunk
+ */
+#define LIBFWNT_LZXPRESS_HUFFMAN_CHUNK_SIZE		65536
+
 typedef struct libfwnt_lzxpress_huffman_code_symbol libfwnt_lzxpress_huffman_code_symbol_t;
 
 struct libfwnt_lzxpress_huffman_code_symbol
@@ -47,6 +64,69 @@ struct libfwnt_lzxpress_huffman_code_symbol
 	uint16_t code_size;
 };
 
+/* The number of decompress jobs per thread
+ */
+#define LIBFWNT_LZXPRESS_HUFFMAN_NUMBER_OF_JOBS_PER_THREAD	4
+
+typedef struct libfwnt_lzxpress_huffman_chunk libfwnt_lzxpress_huffman_chunk_t;
+
+struct libfwnt_lzxpress_huffman_chunk
+{
+	/* The offset of the chunk in the compressed data
+	 */
+	size_t compressed_data_offset;
+
+	/* The size of the chunk in the compressed data
+	 */
+	size_t compressed_data_size;
+
+	/* The offset of the chunk in the uncompressed data
+	 */
+	size_t uncompressed_data_offset;
+
+	/* The size of the chunk in the uncompressed data
+	 */
+	size_t uncompressed_data_size;
+
+	/* The result of decompressing the chunk independent of the preceding chunks
+	 */
+	int result;
+};
+
+typedef struct libfwnt_lzxpress_huffman_decompress_job libfwnt_lzxpress_huffman_decompress_job_t;
+
+struct libfwnt_lzxpress_huffman_decompress_job
+{
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The chunks to decompress
+	 */
+	libfwnt_lzxpress_huffman_chunk_t *chunks;
+
+	/* The number of chunks to decompress
+	 */
+	int number_of_chunks;
+};
+
+int libfwnt_lzxpress_compress_find_match(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t uncompressed_data_offset,
+     const size_t *hash_table,
+     const size_t *hash_chain,
+     size_t window_size,
+     int maximum_chain_length,
+     size_t maximum_match_size,
+     size_t *match_distance,
+     size_t *match_size,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_lzxpress_compress(
      const uint8_t *uncompressed_data,
@@ -55,6 +135,15 @@ int libfwnt_lzxpress_compress(
      size_t *compressed_data_size,
      libcerror_error_t **error );
 
+LIBFWNT_EXTERN \
+int libfwnt_lzxpress_compress_with_level(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int compression_level,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_lzxpress_decompress(
      const uint8_t *compressed_data,
@@ -63,7 +152,33 @@ int libfwnt_lzxpress_decompress(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int libfwnt_lzxpress_huffman_compress_chunk(
+     const uint32_t *tokens,
+     size_t number_of_tokens,
+     uint8_t *compressed_data,
+     size_t compressed_data_size,
+     size_t *compressed_data_offset,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_lzxpress_huffman_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_lzxpress_huffman_compress_with_level(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size,
+     int compression_level,
+     libcerror_error_t **error );
+
 int libfwnt_lzxpress_huffman_decompress_chunk(
+     libfwnt_lzxpress_huffman_decoder_t *decoder,
      libfwnt_bit_stream_t *bit_stream,
      uint8_t *uncompressed_data,
      size_t uncompressed_data_size,
@@ -78,6 +193,37 @@ int libfwnt_lzxpress_huffman_decompress(
      size_t *uncompressed_data_size,
      libcerror_error_t **error );
 
+int libfwnt_lzxpress_huffman_decompress_framed_chunk(
+     libfwnt_lzxpress_huffman_decoder_t *decoder,
+     const uint8_t *compressed_data,
+     uint8_t *uncompressed_data,
+     libfwnt_lzxpress_huffman_chunk_t *chunk,
+     uint8_t is_independent,
+     libcerror_error_t **error );
+
+int libfwnt_lzxpress_huffman_decompress_job_run(
+     libfwnt_lzxpress_huffman_decompress_job_t *job );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libfwnt_lzxpress_huffman_decompress_job_callback(
+     intptr_t *job,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+LIBFWNT_EXTERN \
+int libfwnt_lzxpress_huffman_decompress_parallel(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const size_t *chunk_offsets,
+     int number_of_chunks,
+     size_t chunk_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
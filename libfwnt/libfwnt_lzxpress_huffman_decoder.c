@@ -0,0 +1,244 @@
+/*
+ * LZXPRESS Huffman decoder functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_bit_stream.h"
+#include "libfwnt_huffman_tree.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_lzxpress_huffman_decoder.h"
+
+/* Creates a LZXPRESS Huffman decoder
+ * Make sure the value decoder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_lzxpress_huffman_decoder_initialize(
+     libfwnt_lzxpress_huffman_decoder_t **decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_lzxpress_huffman_decoder_initialize";
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*decoder = memory_allocate_structure(
+	            libfwnt_lzxpress_huffman_decoder_t );
+
+	if( *decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *decoder,
+	     0,
+	     sizeof( libfwnt_lzxpress_huffman_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decoder.",
+		 function );
+
+		memory_free(
+		 *decoder );
+
+		*decoder = NULL;
+
+		return( -1 );
+	}
+	if( libfwnt_huffman_tree_initialize(
+	     &( ( *decoder )->huffman_tree ),
+	     LIBFWNT_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS,
+	     15,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create Huffman tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *decoder != NULL )
+	{
+		memory_free(
+		 *decoder );
+
+		*decoder = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a LZXPRESS Huffman decoder
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_lzxpress_huffman_decoder_free(
+     libfwnt_lzxpress_huffman_decoder_t **decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_lzxpress_huffman_decoder_free";
+	int result            = 1;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decoder != NULL )
+	{
+		if( libfwnt_huffman_tree_free(
+		     &( ( *decoder )->huffman_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free Huffman tree.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *decoder );
+
+		*decoder = NULL;
+	}
+	return( result );
+}
+
+/* Reads the code sizes table of a chunk from the bit stream and rebuilds the Huffman tree
+ * The table contains a 4-bit code size per symbol
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_lzxpress_huffman_decoder_read_table(
+     libfwnt_lzxpress_huffman_decoder_t *decoder,
+     libfwnt_bit_stream_t *bit_stream,
+     libcerror_error_t **error )
+{
+	const uint8_t *table_data = NULL;
+	static char *function     = "libfwnt_lzxpress_huffman_decoder_read_table";
+	int symbol                = 0;
+	int table_index           = 0;
+
+	if( decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( bit_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bit stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bit_stream->byte_stream_offset > bit_stream->byte_stream_size )
+	 || ( ( bit_stream->byte_stream_size - bit_stream->byte_stream_offset ) < LIBFWNT_LZXPRESS_HUFFMAN_TABLE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid bit stream - byte stream value too small.",
+		 function );
+
+		return( -1 );
+	}
+	table_data = &( bit_stream->byte_stream[ bit_stream->byte_stream_offset ] );
+
+	for( table_index = 0;
+	     table_index < LIBFWNT_LZXPRESS_HUFFMAN_TABLE_SIZE;
+	     table_index++ )
+	{
+		decoder->code_sizes_array[ symbol++ ] = table_data[ table_index ] & 0x0f;
+		decoder->code_sizes_array[ symbol++ ] = table_data[ table_index ] >> 4;
+	}
+	bit_stream->byte_stream_offset += LIBFWNT_LZXPRESS_HUFFMAN_TABLE_SIZE;
+
+	if( libfwnt_huffman_tree_build(
+	     decoder->huffman_tree,
+	     decoder->code_sizes_array,
+	     LIBFWNT_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to build Huffman tree.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
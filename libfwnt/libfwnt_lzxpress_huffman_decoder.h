@@ -0,0 +1,76 @@
+/*
+ * LZXPRESS Huffman decoder functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_LZXPRESS_HUFFMAN_DECODER_H )
+#define _LIBFWNT_LZXPRESS_HUFFMAN_DECODER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_bit_stream.h"
+#include "libfwnt_huffman_tree.h"
+#include "libfwnt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of LZXPRESS Huffman symbols
+ */
+#define LIBFWNT_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS	512
+
+/* The size of the LZXPRESS Huffman code sizes table
+ */
+#define LIBFWNT_LZXPRESS_HUFFMAN_TABLE_SIZE		256
+
+typedef struct libfwnt_lzxpress_huffman_decoder libfwnt_lzxpress_huffman_decoder_t;
+
+struct libfwnt_lzxpress_huffman_decoder
+{
+	/* The Huffman tree
+	 * that is rebuilt in place for every chunk
+	 */
+	libfwnt_huffman_tree_t *huffman_tree;
+
+	/* The code sizes array
+	 */
+	uint8_t code_sizes_array[ LIBFWNT_LZXPRESS_HUFFMAN_NUMBER_OF_SYMBOLS ];
+};
+
+int libfwnt_lzxpress_huffman_decoder_initialize(
+     libfwnt_lzxpress_huffman_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int libfwnt_lzxpress_huffman_decoder_free(
+     libfwnt_lzxpress_huffman_decoder_t **decoder,
+     libcerror_error_t **error );
+
+int libfwnt_lzxpress_huffman_decoder_read_table(
+     libfwnt_lzxpress_huffman_decoder_t *decoder,
+     libfwnt_bit_stream_t *bit_stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_LZXPRESS_HUFFMAN_DECODER_H ) */
+
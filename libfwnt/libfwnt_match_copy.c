@@ -0,0 +1,391 @@
+/*
+ * Match copy functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_cpu.h"
+#include "libfwnt_match_copy.h"
+
+#if defined( LIBFWNT_CPU_HAVE_SSE2 ) || defined( LIBFWNT_CPU_HAVE_AVX2 )
+#include <immintrin.h>
+#endif
+
+#if defined( LIBFWNT_CPU_HAVE_NEON )
+#include <arm_neon.h>
+#endif
+
+/* The match copy function of the active kernel variant
+ */
+void (*libfwnt_match_copy)(
+      uint8_t *data,
+      size_t data_offset,
+      size_t match_offset,
+      size_t match_size ) = &libfwnt_match_copy_resolve;
+
+/* Selects the match copy function of the active kernel variant and copies a match
+ * This function is only used if the match copy is used before the CPU features were detected
+ */
+void libfwnt_match_copy_resolve(
+      uint8_t *data,
+      size_t data_offset,
+      size_t match_offset,
+      size_t match_size )
+{
+	libfwnt_cpu_initialize();
+
+	libfwnt_match_copy(
+	 data,
+	 data_offset,
+	 match_offset,
+	 match_size );
+}
+
+/* Copies a match from preceding data to the data offset
+ * The match offset is the distance between the data offset and the start of the match,
+ * the match can overlap with the data it produces, e.g. a match offset of 1 repeats
+ * the preceding byte match size times
+ * The caller must ensure that the match offset is not larger than the data offset and
+ * that the data contains at least match size bytes after the data offset, so that the
+ * bounds are checked once per match instead of once per byte
+ */
+void libfwnt_match_copy_scalar(
+      uint8_t *data,
+      size_t data_offset,
+      size_t match_offset,
+      size_t match_size )
+{
+	const uint8_t *match_data = NULL;
+	uint8_t *output_data      = NULL;
+
+	if( ( data == NULL )
+	 || ( match_offset == 0 )
+	 || ( match_offset > data_offset ) )
+	{
+		return;
+	}
+	output_data = &( data[ data_offset ] );
+	match_data  = &( data[ data_offset - match_offset ] );
+
+	/* A short match is copied using 2 possibly overlapping stores, where the second store
+	 * only reads data written by the first, since the match offset is at least the store size
+	 */
+	if( ( match_size >= 8 )
+	 && ( match_size <= 16 )
+	 && ( match_offset >= 8 ) )
+	{
+		memory_copy(
+		 output_data,
+		 match_data,
+		 8 );
+
+		memory_copy(
+		 &( output_data[ match_size - 8 ] ),
+		 &( match_data[ match_size - 8 ] ),
+		 8 );
+
+		return;
+	}
+	if( ( match_size >= 4 )
+	 && ( match_size < 8 )
+	 && ( match_offset >= 4 ) )
+	{
+		memory_copy(
+		 output_data,
+		 match_data,
+		 4 );
+
+		memory_copy(
+		 &( output_data[ match_size - 4 ] ),
+		 &( match_data[ match_size - 4 ] ),
+		 4 );
+
+		return;
+	}
+	/* A long match that does not overlap with the data it produces is a plain copy
+	 */
+	if( ( match_offset >= match_size )
+	 && ( match_size >= 64 ) )
+	{
+		memory_copy(
+		 output_data,
+		 match_data,
+		 match_size );
+
+		return;
+	}
+	if( match_offset >= 8 )
+	{
+		while( match_size >= 8 )
+		{
+			memory_copy(
+			 output_data,
+			 match_data,
+			 8 );
+
+			output_data += 8;
+			match_data  += 8;
+			match_size  -= 8;
+		}
+	}
+	while( match_size > 0 )
+	{
+		*output_data = *match_data;
+
+		output_data++;
+		match_data++;
+		match_size--;
+	}
+}
+
+#if defined( LIBFWNT_CPU_HAVE_SSE2 )
+
+/* Copies a match from preceding data to the data offset using SSE2 instructions
+ * Matches of at least 16 bytes are copied 16 bytes per step, where a match offset
+ * of less than 16 is copied by repeating a 16 byte pattern
+ * The caller must ensure the same bounds as for libfwnt_match_copy_scalar
+ */
+LIBFWNT_CPU_TARGET( "sse2" ) \
+void libfwnt_match_copy_sse2(
+      uint8_t *data,
+      size_t data_offset,
+      size_t match_offset,
+      size_t match_size )
+{
+	uint8_t pattern_data[ 16 ];
+
+	__m128i pattern_vector    = _mm_setzero_si128();
+	const uint8_t *match_data = NULL;
+	uint8_t *output_data      = NULL;
+	size_t copy_size          = 0;
+	size_t pattern_index      = 0;
+	size_t pattern_step       = 0;
+
+	if( ( data == NULL )
+	 || ( match_offset == 0 )
+	 || ( match_offset > data_offset ) )
+	{
+		return;
+	}
+	if( ( match_size < 16 )
+	 || ( ( match_offset >= match_size )
+	  &&  ( match_size >= 64 ) ) )
+	{
+		libfwnt_match_copy_scalar(
+		 data,
+		 data_offset,
+		 match_offset,
+		 match_size );
+
+		return;
+	}
+	output_data = &( data[ data_offset ] );
+	match_data  = &( data[ data_offset - match_offset ] );
+
+	if( match_offset >= 16 )
+	{
+		while( ( match_size - copy_size ) >= 16 )
+		{
+			_mm_storeu_si128(
+			 (__m128i *) &( output_data[ copy_size ] ),
+			 _mm_loadu_si128(
+			  (const __m128i *) &( match_data[ copy_size ] ) ) );
+
+			copy_size += 16;
+		}
+	}
+	else
+	{
+		/* Broadcast the repeating pattern of a short match offset over 16 bytes
+		 * and advance by the largest multiple of the match offset that fits in 16 bytes,
+		 * so that every store starts at the same position in the pattern
+		 */
+		for( pattern_index = 0;
+		     pattern_index < 16;
+		     pattern_index++ )
+		{
+			pattern_data[ pattern_index ] = match_data[ pattern_index % match_offset ];
+		}
+		pattern_vector = _mm_loadu_si128(
+		                  (const __m128i *) pattern_data );
+
+		pattern_step = 16 - ( 16 % match_offset );
+
+		while( ( match_size - copy_size ) >= 16 )
+		{
+			_mm_storeu_si128(
+			 (__m128i *) &( output_data[ copy_size ] ),
+			 pattern_vector );
+
+			copy_size += pattern_step;
+		}
+	}
+	libfwnt_match_copy_scalar(
+	 data,
+	 data_offset + copy_size,
+	 match_offset,
+	 match_size - copy_size );
+}
+
+#endif /* defined( LIBFWNT_CPU_HAVE_SSE2 ) */
+
+#if defined( LIBFWNT_CPU_HAVE_AVX2 )
+
+/* Copies a match from preceding data to the data offset using AVX2 instructions
+ * Matches with a match offset of at least 32 are copied 32 bytes per step,
+ * other matches are copied using SSE2 instructions
+ * The caller must ensure the same bounds as for libfwnt_match_copy_scalar
+ */
+LIBFWNT_CPU_TARGET( "avx2" ) \
+void libfwnt_match_copy_avx2(
+      uint8_t *data,
+      size_t data_offset,
+      size_t match_offset,
+      size_t match_size )
+{
+	const uint8_t *match_data = NULL;
+	uint8_t *output_data      = NULL;
+	size_t copy_size          = 0;
+
+	if( ( data == NULL )
+	 || ( match_offset == 0 )
+	 || ( match_offset > data_offset ) )
+	{
+		return;
+	}
+	if( ( match_offset >= 32 )
+	 && ( match_size >= 32 )
+	 && ( ( match_offset < match_size )
+	  ||  ( match_size < 64 ) ) )
+	{
+		output_data = &( data[ data_offset ] );
+		match_data  = &( data[ data_offset - match_offset ] );
+
+		while( ( match_size - copy_size ) >= 32 )
+		{
+			_mm256_storeu_si256(
+			 (__m256i *) &( output_data[ copy_size ] ),
+			 _mm256_loadu_si256(
+			  (const __m256i *) &( match_data[ copy_size ] ) ) );
+
+			copy_size += 32;
+		}
+	}
+	libfwnt_match_copy_sse2(
+	 data,
+	 data_offset + copy_size,
+	 match_offset,
+	 match_size - copy_size );
+}
+
+#endif /* defined( LIBFWNT_CPU_HAVE_AVX2 ) */
+
+#if defined( LIBFWNT_CPU_HAVE_NEON )
+
+/* Copies a match from preceding data to the data offset using NEON instructions
+ * Matches of at least 16 bytes are copied 16 bytes per step, where a match offset
+ * of less than 16 is copied by repeating a 16 byte pattern
+ * The caller must ensure the same bounds as for libfwnt_match_copy_scalar
+ */
+void libfwnt_match_copy_neon(
+      uint8_t *data,
+      size_t data_offset,
+      size_t match_offset,
+      size_t match_size )
+{
+	uint8_t pattern_data[ 16 ];
+
+	uint8x16_t pattern_vector;
+
+	const uint8_t *match_data = NULL;
+	uint8_t *output_data      = NULL;
+	size_t copy_size          = 0;
+	size_t pattern_index      = 0;
+	size_t pattern_step       = 0;
+
+	if( ( data == NULL )
+	 || ( match_offset == 0 )
+	 || ( match_offset > data_offset ) )
+	{
+		return;
+	}
+	if( ( match_size < 16 )
+	 || ( ( match_offset >= match_size )
+	  &&  ( match_size >= 64 ) ) )
+	{
+		libfwnt_match_copy_scalar(
+		 data,
+		 data_offset,
+		 match_offset,
+		 match_size );
+
+		return;
+	}
+	output_data = &( data[ data_offset ] );
+	match_data  = &( data[ data_offset - match_offset ] );
+
+	if( match_offset >= 16 )
+	{
+		while( ( match_size - copy_size ) >= 16 )
+		{
+			vst1q_u8(
+			 &( output_data[ copy_size ] ),
+			 vld1q_u8(
+			  &( match_data[ copy_size ] ) ) );
+
+			copy_size += 16;
+		}
+	}
+	else
+	{
+		/* Broadcast the repeating pattern of a short match offset over 16 bytes
+		 * and advance by the largest multiple of the match offset that fits in 16 bytes
+		 */
+		for( pattern_index = 0;
+		     pattern_index < 16;
+		     pattern_index++ )
+		{
+			pattern_data[ pattern_index ] = match_data[ pattern_index % match_offset ];
+		}
+		pattern_vector = vld1q_u8(
+		                  pattern_data );
+
+		pattern_step = 16 - ( 16 % match_offset );
+
+		while( ( match_size - copy_size ) >= 16 )
+		{
+			vst1q_u8(
+			 &( output_data[ copy_size ] ),
+			 pattern_vector );
+
+			copy_size += pattern_step;
+		}
+	}
+	libfwnt_match_copy_scalar(
+	 data,
+	 data_offset + copy_size,
+	 match_offset,
+	 match_size - copy_size );
+}
+
+#endif /* defined( LIBFWNT_CPU_HAVE_NEON ) */
+
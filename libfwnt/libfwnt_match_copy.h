@@ -0,0 +1,89 @@
+/*
+ * Match copy functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_MATCH_COPY_H )
+#define _LIBFWNT_MATCH_COPY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_cpu.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The match copy function of the active kernel variant
+ */
+extern void (*libfwnt_match_copy)(
+             uint8_t *data,
+             size_t data_offset,
+             size_t match_offset,
+             size_t match_size );
+
+void libfwnt_match_copy_resolve(
+      uint8_t *data,
+      size_t data_offset,
+      size_t match_offset,
+      size_t match_size );
+
+void libfwnt_match_copy_scalar(
+      uint8_t *data,
+      size_t data_offset,
+      size_t match_offset,
+      size_t match_size );
+
+#if defined( LIBFWNT_CPU_HAVE_SSE2 )
+
+void libfwnt_match_copy_sse2(
+      uint8_t *data,
+      size_t data_offset,
+      size_t match_offset,
+      size_t match_size );
+
+#endif /* defined( LIBFWNT_CPU_HAVE_SSE2 ) */
+
+#if defined( LIBFWNT_CPU_HAVE_AVX2 )
+
+void libfwnt_match_copy_avx2(
+      uint8_t *data,
+      size_t data_offset,
+      size_t match_offset,
+      size_t match_size );
+
+#endif /* defined( LIBFWNT_CPU_HAVE_AVX2 ) */
+
+#if defined( LIBFWNT_CPU_HAVE_NEON )
+
+void libfwnt_match_copy_neon(
+      uint8_t *data,
+      size_t data_offset,
+      size_t match_offset,
+      size_t match_size );
+
+#endif /* defined( LIBFWNT_CPU_HAVE_NEON ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_MATCH_COPY_H ) */
+
@@ -28,11 +28,13 @@
 #include <wide_string.h>
 
 #include "libfwnt_access_control_list.h"
+#include "libfwnt_arena.h"
 #include "libfwnt_debug.h"
 #include "libfwnt_definitions.h"
 #include "libfwnt_libcerror.h"
 #include "libfwnt_libcnotify.h"
 #include "libfwnt_security_descriptor.h"
+#include "libfwnt_security_descriptor_cache.h"
 #include "libfwnt_security_identifier.h"
 #include "libfwnt_types.h"
 
@@ -43,9 +45,25 @@
 int libfwnt_security_descriptor_initialize(
      libfwnt_security_descriptor_t **security_descriptor,
      libcerror_error_t **error )
+{
+	return( libfwnt_security_descriptor_initialize_with_arena(
+	         security_descriptor,
+	         NULL,
+	         error ) );
+}
+
+/* Creates a security descriptor that is allocated from an arena
+ * Make sure the value security_descriptor is referencing, is set to NULL
+ * If arena is NULL the security descriptor is allocated on the heap
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_initialize_with_arena(
+     libfwnt_security_descriptor_t **security_descriptor,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error )
 {
 	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
-	static char *function                                                = "libfwnt_security_descriptor_initialize";
+	static char *function                                                = "libfwnt_security_descriptor_initialize_with_arena";
 
 	if( security_descriptor == NULL )
 	{
@@ -69,40 +87,64 @@ int libfwnt_security_descriptor_initialize(
 
 		return( -1 );
 	}
-	internal_security_descriptor = memory_allocate_structure(
-	                                libfwnt_internal_security_descriptor_t );
-
-	if( internal_security_descriptor == NULL )
+	if( arena != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create security descriptor.",
-		 function );
+		if( libfwnt_arena_allocate(
+		     arena,
+		     sizeof( libfwnt_internal_security_descriptor_t ),
+		     (void **) &internal_security_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create security descriptor.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	if( memory_set(
-	     internal_security_descriptor,
-	     0,
-	     sizeof( libfwnt_internal_security_descriptor_t ) ) == NULL )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear security descriptor.",
-		 function );
+		internal_security_descriptor = memory_allocate_structure(
+		                                libfwnt_internal_security_descriptor_t );
+
+		if( internal_security_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create security descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_security_descriptor,
+		     0,
+		     sizeof( libfwnt_internal_security_descriptor_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear security descriptor.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
+	internal_security_descriptor->arena = arena;
+
 	*security_descriptor = (libfwnt_security_descriptor_t *) internal_security_descriptor;
 
 	return( 1 );
 
 on_error:
-	if( internal_security_descriptor != NULL )
+	if( ( internal_security_descriptor != NULL )
+	 && ( arena == NULL ) )
 	{
 		memory_free(
 		 internal_security_descriptor );
@@ -137,6 +179,25 @@ int libfwnt_security_descriptor_free(
 		internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) *security_descriptor;
 		*security_descriptor         = NULL;
 
+		/* A security descriptor managed by a cache is shared, freeing it releases a reference
+		 */
+		if( internal_security_descriptor->cache_entry != NULL )
+		{
+			if( libfwnt_security_descriptor_cache_entry_release(
+			     (libfwnt_security_descriptor_cache_entry_t *) internal_security_descriptor->cache_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release cache entry.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
 		if( internal_security_descriptor->owner_sid != NULL )
 		{
 			if( libfwnt_internal_security_identifier_free(
@@ -201,8 +262,11 @@ int libfwnt_security_descriptor_free(
 				result = -1;
 			}
 		}
-		memory_free(
-		 internal_security_descriptor );
+		if( internal_security_descriptor->arena == NULL )
+		{
+			memory_free(
+			 internal_security_descriptor );
+		}
 	}
 	return( result );
 }
@@ -223,7 +287,6 @@ int libfwnt_security_descriptor_copy_from_byte_stream(
 	uint32_t group_sid_offset                                            = 0;
 	uint32_t owner_sid_offset                                            = 0;
 	uint32_t system_acl_offset                                           = 0;
-	uint16_t control_flags                                               = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	system_character_t *sid_string                                       = NULL;
@@ -348,7 +411,7 @@ int libfwnt_security_descriptor_copy_from_byte_stream(
 
 	byte_stream_copy_to_uint16_little_endian(
 	 &( byte_stream[ 2 ] ),
-	 control_flags );
+	 internal_security_descriptor->control_flags );
 
 	byte_stream_copy_to_uint32_little_endian(
 	 &( byte_stream[ 4 ] ),
@@ -382,9 +445,9 @@ int libfwnt_security_descriptor_copy_from_byte_stream(
 		libcnotify_printf(
 		 "%s: control flags\t\t: 0x%04" PRIx16 "\n",
 		 function,
-		 control_flags );
+		 internal_security_descriptor->control_flags );
 		libfwnt_debug_print_security_descriptor_control_flags(
-		 control_flags );
+		 internal_security_descriptor->control_flags );
 		libcnotify_printf(
 		 "\n" );
 
@@ -427,8 +490,9 @@ int libfwnt_security_descriptor_copy_from_byte_stream(
 
 			goto on_error;
 		}
-		if( libfwnt_security_identifier_initialize(
+		if( libfwnt_security_identifier_initialize_with_arena(
 		     &( internal_security_descriptor->owner_sid ),
+		     internal_security_descriptor->arena,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -561,8 +625,9 @@ int libfwnt_security_descriptor_copy_from_byte_stream(
 
 			goto on_error;
 		}
-		if( libfwnt_security_identifier_initialize(
+		if( libfwnt_security_identifier_initialize_with_arena(
 		     &( internal_security_descriptor->group_sid ),
+		     internal_security_descriptor->arena,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -695,8 +760,9 @@ int libfwnt_security_descriptor_copy_from_byte_stream(
 
 			goto on_error;
 		}
-		if( libfwnt_access_control_list_initialize(
+		if( libfwnt_access_control_list_initialize_with_arena(
 		     &( internal_security_descriptor->system_acl ),
+		     internal_security_descriptor->arena,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -739,8 +805,9 @@ int libfwnt_security_descriptor_copy_from_byte_stream(
 
 			goto on_error;
 		}
-		if( libfwnt_access_control_list_initialize(
+		if( libfwnt_access_control_list_initialize_with_arena(
 		     &( internal_security_descriptor->discretionary_acl ),
+		     internal_security_descriptor->arena,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -806,6 +873,389 @@ on_error:
 	return( -1 );
 }
 
+/* Determines the size of the security descriptor as a self-relative byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_get_byte_stream_size(
+     libfwnt_security_descriptor_t *security_descriptor,
+     size_t *byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_get_byte_stream_size";
+	size_t component_size                                                = 0;
+	size_t security_descriptor_size                                      = 0;
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( byte_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	security_descriptor_size = 20;
+
+	if( internal_security_descriptor->system_acl != NULL )
+	{
+		if( libfwnt_access_control_list_get_byte_stream_size(
+		     internal_security_descriptor->system_acl,
+		     &component_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve system ACL byte stream size.",
+			 function );
+
+			return( -1 );
+		}
+		security_descriptor_size += component_size;
+	}
+	if( internal_security_descriptor->discretionary_acl != NULL )
+	{
+		if( libfwnt_access_control_list_get_byte_stream_size(
+		     internal_security_descriptor->discretionary_acl,
+		     &component_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve discretionary ACL byte stream size.",
+			 function );
+
+			return( -1 );
+		}
+		security_descriptor_size += component_size;
+	}
+	if( internal_security_descriptor->owner_sid != NULL )
+	{
+		if( libfwnt_security_identifier_get_byte_stream_size(
+		     internal_security_descriptor->owner_sid,
+		     &component_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve owner SID byte stream size.",
+			 function );
+
+			return( -1 );
+		}
+		security_descriptor_size += component_size;
+	}
+	if( internal_security_descriptor->group_sid != NULL )
+	{
+		if( libfwnt_security_identifier_get_byte_stream_size(
+		     internal_security_descriptor->group_sid,
+		     &component_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve group SID byte stream size.",
+			 function );
+
+			return( -1 );
+		}
+		security_descriptor_size += component_size;
+	}
+	*byte_stream_size = security_descriptor_size;
+
+	return( 1 );
+}
+
+/* Converts a security descriptor into a self-relative byte stream
+ * The components are stored in the order: system ACL, discretionary ACL, owner SID
+ * and group SID, which is the order used by Windows, and the control flags are
+ * stored with the self-relative flag set
+ * Use libfwnt_security_descriptor_get_byte_stream_size to determine the size of
+ * the byte stream, no memory is allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_copy_to_byte_stream(
+     libfwnt_security_descriptor_t *security_descriptor,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_copy_to_byte_stream";
+	size_t byte_stream_offset                                            = 0;
+	size_t component_size                                                = 0;
+	size_t security_descriptor_size                                      = 0;
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_descriptor_get_byte_stream_size(
+	     security_descriptor,
+	     &security_descriptor_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve security descriptor byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < security_descriptor_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     byte_stream,
+	     0,
+	     20 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream[ 0 ] = internal_security_descriptor->revision_number;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( byte_stream[ 2 ] ),
+	 internal_security_descriptor->control_flags | LIBFWNT_CONTROL_FLAG_SELF_RELATIVE );
+
+	byte_stream_offset = 20;
+
+	if( internal_security_descriptor->system_acl != NULL )
+	{
+		if( libfwnt_access_control_list_get_byte_stream_size(
+		     internal_security_descriptor->system_acl,
+		     &component_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve system ACL byte stream size.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwnt_access_control_list_copy_to_byte_stream(
+		     internal_security_descriptor->system_acl,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     component_size,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy system ACL to byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( byte_stream[ 12 ] ),
+		 (uint32_t) byte_stream_offset );
+
+		byte_stream_offset += component_size;
+	}
+	if( internal_security_descriptor->discretionary_acl != NULL )
+	{
+		if( libfwnt_access_control_list_get_byte_stream_size(
+		     internal_security_descriptor->discretionary_acl,
+		     &component_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve discretionary ACL byte stream size.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwnt_access_control_list_copy_to_byte_stream(
+		     internal_security_descriptor->discretionary_acl,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     component_size,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy discretionary ACL to byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( byte_stream[ 16 ] ),
+		 (uint32_t) byte_stream_offset );
+
+		byte_stream_offset += component_size;
+	}
+	if( internal_security_descriptor->owner_sid != NULL )
+	{
+		if( libfwnt_security_identifier_get_byte_stream_size(
+		     internal_security_descriptor->owner_sid,
+		     &component_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve owner SID byte stream size.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwnt_security_identifier_copy_to_byte_stream(
+		     internal_security_descriptor->owner_sid,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     component_size,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy owner SID to byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( byte_stream[ 4 ] ),
+		 (uint32_t) byte_stream_offset );
+
+		byte_stream_offset += component_size;
+	}
+	if( internal_security_descriptor->group_sid != NULL )
+	{
+		if( libfwnt_security_identifier_get_byte_stream_size(
+		     internal_security_descriptor->group_sid,
+		     &component_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve group SID byte stream size.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwnt_security_identifier_copy_to_byte_stream(
+		     internal_security_descriptor->group_sid,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     component_size,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy group SID to byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( byte_stream[ 8 ] ),
+		 (uint32_t) byte_stream_offset );
+	}
+	return( 1 );
+}
+
 /* Retrieves the owner security identifier (SID)
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -49,6 +49,10 @@ struct libfwnt_internal_security_descriptor
 	 */
 	uint8_t revision_number;
 
+	/* The control flags
+	 */
+	uint16_t control_flags;
+
 	/* The owner SID
 	 */
 	libfwnt_security_identifier_t *owner_sid;
@@ -64,6 +68,14 @@ struct libfwnt_internal_security_descriptor
 	/* The discretionary ACL
 	 */
 	libfwnt_access_control_list_t *discretionary_acl;
+
+	/* The arena the security descriptor is allocated from
+	 */
+	libfwnt_arena_t *arena;
+
+	/* The security descriptor cache entry that manages the security descriptor
+	 */
+	intptr_t *cache_entry;
 };
 
 LIBFWNT_EXTERN \
@@ -71,6 +83,12 @@ int libfwnt_security_descriptor_initialize(
      libfwnt_security_descriptor_t **security_descriptor,
      libcerror_error_t **error );
 
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_initialize_with_arena(
+     libfwnt_security_descriptor_t **security_descriptor,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_security_descriptor_free(
      libfwnt_security_descriptor_t **security_descriptor,
@@ -84,6 +102,20 @@ int libfwnt_security_descriptor_copy_from_byte_stream(
      int byte_order,
      libcerror_error_t **error );
 
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_get_byte_stream_size(
+     libfwnt_security_descriptor_t *security_descriptor,
+     size_t *byte_stream_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_copy_to_byte_stream(
+     libfwnt_security_descriptor_t *security_descriptor,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_security_descriptor_get_owner(
      libfwnt_security_descriptor_t *security_descriptor,
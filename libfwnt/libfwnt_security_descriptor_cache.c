@@ -0,0 +1,857 @@
+/*
+ * Windows NT Security Descriptor cache functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_security_descriptor.h"
+#include "libfwnt_security_descriptor_cache.h"
+#include "libfwnt_types.h"
+
+/* Creates a security descriptor cache
+ * Make sure the value security_descriptor_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_initialize(
+     libfwnt_security_descriptor_cache_t **security_descriptor_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_cache_t *internal_cache = NULL;
+	static char *function                                        = "libfwnt_security_descriptor_cache_initialize";
+	uint32_t number_of_buckets                                   = 1;
+
+	if( security_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_descriptor_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security descriptor cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries <= 0 )
+	 || ( maximum_number_of_entries > ( 1 << 24 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use at least as many buckets as entries to keep the bucket chains short
+	 */
+	while( number_of_buckets < (uint32_t) maximum_number_of_entries )
+	{
+		number_of_buckets <<= 1;
+	}
+	internal_cache = memory_allocate_structure(
+	                  libfwnt_internal_security_descriptor_cache_t );
+
+	if( internal_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create security descriptor cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_cache,
+	     0,
+	     sizeof( libfwnt_internal_security_descriptor_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear security descriptor cache.",
+		 function );
+
+		memory_free(
+		 internal_cache );
+
+		return( -1 );
+	}
+	internal_cache->buckets = (libfwnt_security_descriptor_cache_entry_t **) memory_allocate(
+	                                                                          sizeof( libfwnt_security_descriptor_cache_entry_t * ) * number_of_buckets );
+
+	if( internal_cache->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_cache->buckets,
+	     0,
+	     sizeof( libfwnt_security_descriptor_cache_entry_t * ) * number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	internal_cache->maximum_number_of_entries = maximum_number_of_entries;
+	internal_cache->number_of_buckets         = number_of_buckets;
+
+	*security_descriptor_cache = (libfwnt_security_descriptor_cache_t *) internal_cache;
+
+	return( 1 );
+
+on_error:
+	if( internal_cache != NULL )
+	{
+		if( internal_cache->buckets != NULL )
+		{
+			memory_free(
+			 internal_cache->buckets );
+		}
+		memory_free(
+		 internal_cache );
+	}
+	return( -1 );
+}
+
+/* Frees a security descriptor cache
+ * Security descriptors that are still referenced remain valid and are freed
+ * when their last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_free(
+     libfwnt_security_descriptor_cache_t **security_descriptor_cache,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_cache_t *internal_cache = NULL;
+	libfwnt_security_descriptor_cache_entry_t *cache_entry       = NULL;
+	libfwnt_security_descriptor_cache_entry_t *next_cache_entry  = NULL;
+	static char *function                                        = "libfwnt_security_descriptor_cache_free";
+	int result                                                   = 1;
+
+	if( security_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_descriptor_cache != NULL )
+	{
+		internal_cache             = (libfwnt_internal_security_descriptor_cache_t *) *security_descriptor_cache;
+		*security_descriptor_cache = NULL;
+
+		cache_entry = internal_cache->first_entry;
+
+		while( cache_entry != NULL )
+		{
+			next_cache_entry = cache_entry->next_entry;
+
+			/* Detach referenced entries, these are freed on their last release
+			 */
+			cache_entry->internal_cache    = NULL;
+			cache_entry->next_bucket_entry = NULL;
+			cache_entry->previous_entry    = NULL;
+			cache_entry->next_entry        = NULL;
+
+			if( cache_entry->reference_count == 0 )
+			{
+				if( libfwnt_security_descriptor_cache_entry_free(
+				     &cache_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free cache entry.",
+					 function );
+
+					result = -1;
+				}
+			}
+			cache_entry = next_cache_entry;
+		}
+		memory_free(
+		 internal_cache->buckets );
+
+		memory_free(
+		 internal_cache );
+	}
+	return( result );
+}
+
+/* Calculates the hash of security descriptor data
+ * This is the 32-bit Fowler-Noll-Vo (FNV-1a) hash of the data
+ * Returns the hash
+ */
+uint32_t libfwnt_security_descriptor_cache_calculate_hash(
+          const uint8_t *data,
+          size_t data_size )
+{
+	size_t data_offset = 0;
+	uint32_t hash      = 0x811c9dc5UL;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		hash ^= data[ data_offset ];
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Frees a security descriptor cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_entry_free(
+     libfwnt_security_descriptor_cache_entry_t **cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_descriptor_cache_entry_free";
+	int result            = 1;
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_entry != NULL )
+	{
+		if( ( *cache_entry )->security_descriptor != NULL )
+		{
+			/* Unlink the security descriptor from the entry so that it is actually freed
+			 */
+			( (libfwnt_internal_security_descriptor_t *) ( *cache_entry )->security_descriptor )->cache_entry = NULL;
+
+			if( libfwnt_security_descriptor_free(
+			     &( ( *cache_entry )->security_descriptor ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free security descriptor.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *cache_entry )->data != NULL )
+		{
+			memory_free(
+			 ( *cache_entry )->data );
+		}
+		memory_free(
+		 *cache_entry );
+
+		*cache_entry = NULL;
+	}
+	return( result );
+}
+
+/* Releases a reference to a security descriptor cache entry
+ * The entry is freed when the last reference is released and the entry is not stored in a cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_entry_release(
+     libfwnt_security_descriptor_cache_entry_t *cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_descriptor_cache_entry_release";
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_entry->reference_count <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache entry - reference count value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	cache_entry->reference_count -= 1;
+
+	if( ( cache_entry->reference_count == 0 )
+	 && ( cache_entry->internal_cache == NULL ) )
+	{
+		if( libfwnt_security_descriptor_cache_entry_free(
+		     &cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cache entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the security descriptor of security descriptor data
+ * The data is parsed on a cache miss, on a cache hit the previously parsed
+ * security descriptor is shared
+ * The security descriptor holds a reference to the cache entry that must be
+ * released by freeing it with libfwnt_security_descriptor_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_get_security_descriptor(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libfwnt_security_descriptor_t **security_descriptor,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_cache_t *internal_cache = NULL;
+	libfwnt_security_descriptor_cache_entry_t *cache_entry       = NULL;
+	libfwnt_security_descriptor_cache_entry_t *evicted_entry     = NULL;
+	libfwnt_security_descriptor_cache_entry_t **bucket_entry     = NULL;
+	static char *function                                        = "libfwnt_security_descriptor_cache_get_security_descriptor";
+	uint32_t bucket_index                                        = 0;
+	uint32_t hash                                                = 0;
+
+	if( security_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfwnt_internal_security_descriptor_cache_t *) security_descriptor_cache;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size == 0 )
+	 || ( byte_stream_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_descriptor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libfwnt_security_descriptor_cache_calculate_hash(
+	        byte_stream,
+	        byte_stream_size );
+
+	bucket_index = hash & ( internal_cache->number_of_buckets - 1 );
+
+	for( cache_entry = internal_cache->buckets[ bucket_index ];
+	     cache_entry != NULL;
+	     cache_entry = cache_entry->next_bucket_entry )
+	{
+		if( ( cache_entry->hash == hash )
+		 && ( cache_entry->data_size == byte_stream_size )
+		 && ( memory_compare(
+		       cache_entry->data,
+		       byte_stream,
+		       byte_stream_size ) == 0 ) )
+		{
+			break;
+		}
+	}
+	if( cache_entry != NULL )
+	{
+		internal_cache->number_of_hits += 1;
+
+		/* Move the entry to the front of the most recently used list
+		 */
+		if( cache_entry->previous_entry != NULL )
+		{
+			cache_entry->previous_entry->next_entry = cache_entry->next_entry;
+
+			if( cache_entry->next_entry != NULL )
+			{
+				cache_entry->next_entry->previous_entry = cache_entry->previous_entry;
+			}
+			else
+			{
+				internal_cache->last_entry = cache_entry->previous_entry;
+			}
+			cache_entry->previous_entry                 = NULL;
+			cache_entry->next_entry                     = internal_cache->first_entry;
+			internal_cache->first_entry->previous_entry = cache_entry;
+			internal_cache->first_entry                 = cache_entry;
+		}
+		cache_entry->reference_count += 1;
+
+		*security_descriptor = cache_entry->security_descriptor;
+
+		return( 1 );
+	}
+	internal_cache->number_of_misses += 1;
+
+	cache_entry = memory_allocate_structure(
+	               libfwnt_security_descriptor_cache_entry_t );
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     cache_entry,
+	     0,
+	     sizeof( libfwnt_security_descriptor_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache entry.",
+		 function );
+
+		memory_free(
+		 cache_entry );
+
+		return( -1 );
+	}
+	cache_entry->data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * byte_stream_size );
+
+	if( cache_entry->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     cache_entry->data,
+	     byte_stream,
+	     byte_stream_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy cache entry data.",
+		 function );
+
+		goto on_error;
+	}
+	cache_entry->data_size = byte_stream_size;
+	cache_entry->hash      = hash;
+
+	if( libfwnt_security_descriptor_initialize(
+	     &( cache_entry->security_descriptor ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create security descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwnt_security_descriptor_copy_from_byte_stream(
+	     cache_entry->security_descriptor,
+	     byte_stream,
+	     byte_stream_size,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security descriptor from byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	( (libfwnt_internal_security_descriptor_t *) cache_entry->security_descriptor )->cache_entry = (intptr_t *) cache_entry;
+
+	if( internal_cache->number_of_entries >= internal_cache->maximum_number_of_entries )
+	{
+		/* Evict the least recently used entry that is no longer referenced
+		 */
+		for( evicted_entry = internal_cache->last_entry;
+		     evicted_entry != NULL;
+		     evicted_entry = evicted_entry->previous_entry )
+		{
+			if( evicted_entry->reference_count == 0 )
+			{
+				break;
+			}
+		}
+		if( evicted_entry != NULL )
+		{
+			bucket_entry = &( internal_cache->buckets[ evicted_entry->hash & ( internal_cache->number_of_buckets - 1 ) ] );
+
+			while( *bucket_entry != evicted_entry )
+			{
+				bucket_entry = &( ( *bucket_entry )->next_bucket_entry );
+			}
+			*bucket_entry = evicted_entry->next_bucket_entry;
+
+			if( evicted_entry->previous_entry != NULL )
+			{
+				evicted_entry->previous_entry->next_entry = evicted_entry->next_entry;
+			}
+			else
+			{
+				internal_cache->first_entry = evicted_entry->next_entry;
+			}
+			if( evicted_entry->next_entry != NULL )
+			{
+				evicted_entry->next_entry->previous_entry = evicted_entry->previous_entry;
+			}
+			else
+			{
+				internal_cache->last_entry = evicted_entry->previous_entry;
+			}
+			internal_cache->number_of_entries   -= 1;
+			internal_cache->number_of_evictions += 1;
+
+			if( libfwnt_security_descriptor_cache_entry_free(
+			     &evicted_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free evicted cache entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	/* If all entries are referenced the security descriptor is not stored
+	 * in the cache and it is freed when its reference is released
+	 */
+	if( internal_cache->number_of_entries < internal_cache->maximum_number_of_entries )
+	{
+		cache_entry->internal_cache    = internal_cache;
+		cache_entry->next_bucket_entry = internal_cache->buckets[ bucket_index ];
+		cache_entry->next_entry        = internal_cache->first_entry;
+
+		if( internal_cache->first_entry != NULL )
+		{
+			internal_cache->first_entry->previous_entry = cache_entry;
+		}
+		else
+		{
+			internal_cache->last_entry = cache_entry;
+		}
+		internal_cache->first_entry             = cache_entry;
+		internal_cache->buckets[ bucket_index ] = cache_entry;
+
+		internal_cache->number_of_entries += 1;
+	}
+	cache_entry->reference_count = 1;
+
+	*security_descriptor = cache_entry->security_descriptor;
+
+	return( 1 );
+
+on_error:
+	if( cache_entry != NULL )
+	{
+		libfwnt_security_descriptor_cache_entry_free(
+		 &cache_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of entries in the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_get_number_of_entries(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_cache_t *internal_cache = NULL;
+	static char *function                                        = "libfwnt_security_descriptor_cache_get_number_of_entries";
+
+	if( security_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfwnt_internal_security_descriptor_cache_t *) security_descriptor_cache;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = internal_cache->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the number of cache hits
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_get_number_of_hits(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     uint64_t *number_of_hits,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_cache_t *internal_cache = NULL;
+	static char *function                                        = "libfwnt_security_descriptor_cache_get_number_of_hits";
+
+	if( security_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfwnt_internal_security_descriptor_cache_t *) security_descriptor_cache;
+
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_hits = internal_cache->number_of_hits;
+
+	return( 1 );
+}
+
+/* Retrieves the number of cache misses
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_get_number_of_misses(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_cache_t *internal_cache = NULL;
+	static char *function                                        = "libfwnt_security_descriptor_cache_get_number_of_misses";
+
+	if( security_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfwnt_internal_security_descriptor_cache_t *) security_descriptor_cache;
+
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_misses = internal_cache->number_of_misses;
+
+	return( 1 );
+}
+
+/* Retrieves the number of evictions
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_get_number_of_evictions(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_cache_t *internal_cache = NULL;
+	static char *function                                        = "libfwnt_security_descriptor_cache_get_number_of_evictions";
+
+	if( security_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cache = (libfwnt_internal_security_descriptor_cache_t *) security_descriptor_cache;
+
+	if( number_of_evictions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of evictions.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_evictions = internal_cache->number_of_evictions;
+
+	return( 1 );
+}
+
@@ -0,0 +1,188 @@
+/*
+ * Windows NT Security Descriptor cache functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_SECURITY_DESCRIPTOR_CACHE_H )
+#define _LIBFWNT_SECURITY_DESCRIPTOR_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The security descriptor cache maps the raw bytes of a security descriptor
+ * onto a single parsed security descriptor that is shared by all callers
+ * that look up the same bytes.
+ *
+ * Every security descriptor handed out by the cache holds a reference that
+ * is released by libfwnt_security_descriptor_free. When the cache is full
+ * the least recently used entry that is no longer referenced is evicted.
+ */
+
+typedef struct libfwnt_internal_security_descriptor_cache libfwnt_internal_security_descriptor_cache_t;
+
+typedef struct libfwnt_security_descriptor_cache_entry libfwnt_security_descriptor_cache_entry_t;
+
+struct libfwnt_security_descriptor_cache_entry
+{
+	/* The cache the entry is stored in or NULL if the entry is not stored in a cache
+	 */
+	libfwnt_internal_security_descriptor_cache_t *internal_cache;
+
+	/* The hash of the data
+	 */
+	uint32_t hash;
+
+	/* The security descriptor data
+	 */
+	uint8_t *data;
+
+	/* The security descriptor data size
+	 */
+	size_t data_size;
+
+	/* The (parsed) security descriptor
+	 */
+	libfwnt_security_descriptor_t *security_descriptor;
+
+	/* The reference count
+	 */
+	int reference_count;
+
+	/* The next entry in the hash bucket
+	 */
+	libfwnt_security_descriptor_cache_entry_t *next_bucket_entry;
+
+	/* The previous (more recently used) entry
+	 */
+	libfwnt_security_descriptor_cache_entry_t *previous_entry;
+
+	/* The next (less recently used) entry
+	 */
+	libfwnt_security_descriptor_cache_entry_t *next_entry;
+};
+
+struct libfwnt_internal_security_descriptor_cache
+{
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The hash buckets
+	 */
+	libfwnt_security_descriptor_cache_entry_t **buckets;
+
+	/* The number of hash buckets, which is a power of 2
+	 */
+	uint32_t number_of_buckets;
+
+	/* The most recently used entry
+	 */
+	libfwnt_security_descriptor_cache_entry_t *first_entry;
+
+	/* The least recently used entry
+	 */
+	libfwnt_security_descriptor_cache_entry_t *last_entry;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+
+	/* The number of evictions
+	 */
+	uint64_t number_of_evictions;
+};
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_cache_initialize(
+     libfwnt_security_descriptor_cache_t **security_descriptor_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_cache_free(
+     libfwnt_security_descriptor_cache_t **security_descriptor_cache,
+     libcerror_error_t **error );
+
+uint32_t libfwnt_security_descriptor_cache_calculate_hash(
+          const uint8_t *data,
+          size_t data_size );
+
+int libfwnt_security_descriptor_cache_entry_free(
+     libfwnt_security_descriptor_cache_entry_t **cache_entry,
+     libcerror_error_t **error );
+
+int libfwnt_security_descriptor_cache_entry_release(
+     libfwnt_security_descriptor_cache_entry_t *cache_entry,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_cache_get_security_descriptor(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libfwnt_security_descriptor_t **security_descriptor,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_cache_get_number_of_entries(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_cache_get_number_of_hits(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     uint64_t *number_of_hits,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_cache_get_number_of_misses(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_cache_get_number_of_evictions(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_SECURITY_DESCRIPTOR_CACHE_H ) */
+
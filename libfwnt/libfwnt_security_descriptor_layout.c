@@ -0,0 +1,521 @@
+/*
+ * Windows NT Security Descriptor layout functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_security_descriptor_layout.h"
+
+/* Scans a security identifier in data
+ * The data can contain trailing data
+ * Returns the size of the security identifier or 0 if the data does not contain a valid security identifier
+ */
+size_t libfwnt_security_descriptor_layout_scan_security_identifier(
+        const uint8_t *data,
+        size_t data_size )
+{
+	size_t security_identifier_size = 0;
+
+	if( data_size < 8 )
+	{
+		return( 0 );
+	}
+	if( data[ 1 ] > 15 )
+	{
+		return( 0 );
+	}
+	security_identifier_size = 8 + ( (size_t) data[ 1 ] * 4 );
+
+	if( security_identifier_size > data_size )
+	{
+		return( 0 );
+	}
+	return( security_identifier_size );
+}
+
+/* Scans an access control list, including all its entries and their security identifiers, in data
+ * The data can contain trailing data
+ * Returns the size of the access control list or 0 if the data does not contain a valid access control list
+ */
+size_t libfwnt_security_descriptor_layout_scan_access_control_list(
+        const uint8_t *data,
+        size_t data_size )
+{
+	size_t data_offset                 = 0;
+	size_t security_identifier_offset  = 0;
+	uint32_t object_flags              = 0;
+	uint16_t access_control_entry_size = 0;
+	uint16_t access_control_list_size  = 0;
+	uint16_t entry_index               = 0;
+	uint16_t number_of_entries         = 0;
+
+	if( data_size < 8 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 2 ] ),
+	 access_control_list_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 4 ] ),
+	 number_of_entries );
+
+	if( ( access_control_list_size < 8 )
+	 || ( (size_t) access_control_list_size > data_size ) )
+	{
+		return( 0 );
+	}
+	data_offset = 8;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( ( data_offset + 4 ) > (size_t) access_control_list_size )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ data_offset + 2 ] ),
+		 access_control_entry_size );
+
+		if( ( access_control_entry_size < 4 )
+		 || ( (size_t) access_control_entry_size > ( (size_t) access_control_list_size - data_offset ) ) )
+		{
+			return( 0 );
+		}
+		switch( data[ data_offset ] )
+		{
+			/* Basic types */
+			case LIBFWNT_ACCESS_ALLOWED:
+			case LIBFWNT_ACCESS_DENIED:
+			case LIBFWNT_SYSTEM_AUDIT:
+			case LIBFWNT_SYSTEM_ALARM:
+			case LIBFWNT_ACCESS_ALLOWED_CALLBACK:
+			case LIBFWNT_ACCESS_DENIED_CALLBACK:
+			case LIBFWNT_SYSTEM_AUDIT_CALLBACK:
+			case LIBFWNT_SYSTEM_ALARM_CALLBACK:
+			case LIBFWNT_SYSTEM_MANDATORY_LABEL:
+				security_identifier_offset = 8;
+
+				break;
+
+			/* Object types */
+			case LIBFWNT_ACCESS_ALLOWED_OBJECT:
+			case LIBFWNT_ACCESS_DENIED_OBJECT:
+			case LIBFWNT_SYSTEM_AUDIT_OBJECT:
+			case LIBFWNT_SYSTEM_ALARM_OBJECT:
+			case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
+			case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
+			case LIBFWNT_SYSTEM_AUDIT_CALLBACK_OBJECT:
+			case LIBFWNT_SYSTEM_ALARM_CALLBACK_OBJECT:
+				if( access_control_entry_size < 12 )
+				{
+					return( 0 );
+				}
+				byte_stream_copy_to_uint32_little_endian(
+				 &( data[ data_offset + 8 ] ),
+				 object_flags );
+
+				security_identifier_offset = 12;
+
+				/* ACE_OBJECT_TYPE_PRESENT */
+				if( ( object_flags & 0x00000001UL ) != 0 )
+				{
+					security_identifier_offset += 16;
+				}
+				/* ACE_INHERITED_OBJECT_TYPE_PRESENT */
+				if( ( object_flags & 0x00000002UL ) != 0 )
+				{
+					security_identifier_offset += 16;
+				}
+				break;
+
+			/* Unknown types */
+			case LIBFWNT_ACCESS_ALLOWED_COMPOUND:
+			default:
+				security_identifier_offset = 0;
+
+				break;
+		}
+		if( security_identifier_offset > 0 )
+		{
+			if( security_identifier_offset > (size_t) access_control_entry_size )
+			{
+				return( 0 );
+			}
+			if( libfwnt_security_descriptor_layout_scan_security_identifier(
+			     &( data[ data_offset + security_identifier_offset ] ),
+			     (size_t) access_control_entry_size - security_identifier_offset ) == 0 )
+			{
+				return( 0 );
+			}
+		}
+		data_offset += access_control_entry_size;
+	}
+	return( (size_t) access_control_list_size );
+}
+
+/* Sets a security descriptor layout from a byte stream
+ * The header offsets, the access control list and entry sizes and the security identifier
+ * sub authority counts are validated in a single pass, the same as by
+ * libfwnt_security_descriptor_view_set_from_byte_stream, nothing is copied and no memory
+ * is allocated, also not when the byte stream is malformed
+ * The byte stream can contain trailing data
+ * Returns 1 if successful, 0 if the byte stream does not contain a valid security descriptor or -1 on error
+ */
+int libfwnt_security_descriptor_layout_set_from_byte_stream(
+     libfwnt_security_descriptor_layout_t *security_descriptor_layout,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	static char *function             = "libfwnt_security_descriptor_layout_set_from_byte_stream";
+	size_t component_size             = 0;
+	size_t data_size                  = 20;
+	uint32_t discretionary_acl_offset = 0;
+	uint32_t group_sid_offset         = 0;
+	uint32_t owner_sid_offset         = 0;
+	uint32_t system_acl_offset        = 0;
+
+	if( security_descriptor_layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     security_descriptor_layout,
+	     0,
+	     sizeof( libfwnt_security_descriptor_layout_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear security descriptor layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 20 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 4 ] ),
+	 owner_sid_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 8 ] ),
+	 group_sid_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 12 ] ),
+	 system_acl_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 16 ] ),
+	 discretionary_acl_offset );
+
+	if( owner_sid_offset != 0 )
+	{
+		if( ( owner_sid_offset < 20 )
+		 || ( (size_t) owner_sid_offset >= byte_stream_size ) )
+		{
+			return( 0 );
+		}
+		component_size = libfwnt_security_descriptor_layout_scan_security_identifier(
+		                  &( byte_stream[ owner_sid_offset ] ),
+		                  byte_stream_size - owner_sid_offset );
+
+		if( component_size == 0 )
+		{
+			return( 0 );
+		}
+		security_descriptor_layout->owner_sid_offset = owner_sid_offset;
+		security_descriptor_layout->owner_sid_size   = (uint32_t) component_size;
+
+		if( ( owner_sid_offset + component_size ) > data_size )
+		{
+			data_size = owner_sid_offset + component_size;
+		}
+	}
+	if( group_sid_offset != 0 )
+	{
+		if( ( group_sid_offset < 20 )
+		 || ( (size_t) group_sid_offset >= byte_stream_size ) )
+		{
+			return( 0 );
+		}
+		component_size = libfwnt_security_descriptor_layout_scan_security_identifier(
+		                  &( byte_stream[ group_sid_offset ] ),
+		                  byte_stream_size - group_sid_offset );
+
+		if( component_size == 0 )
+		{
+			return( 0 );
+		}
+		security_descriptor_layout->group_sid_offset = group_sid_offset;
+		security_descriptor_layout->group_sid_size   = (uint32_t) component_size;
+
+		if( ( group_sid_offset + component_size ) > data_size )
+		{
+			data_size = group_sid_offset + component_size;
+		}
+	}
+	if( system_acl_offset != 0 )
+	{
+		if( ( system_acl_offset < 20 )
+		 || ( (size_t) system_acl_offset >= byte_stream_size ) )
+		{
+			return( 0 );
+		}
+		component_size = libfwnt_security_descriptor_layout_scan_access_control_list(
+		                  &( byte_stream[ system_acl_offset ] ),
+		                  byte_stream_size - system_acl_offset );
+
+		if( component_size == 0 )
+		{
+			return( 0 );
+		}
+		security_descriptor_layout->system_acl_offset = system_acl_offset;
+		security_descriptor_layout->system_acl_size   = (uint32_t) component_size;
+
+		if( ( system_acl_offset + component_size ) > data_size )
+		{
+			data_size = system_acl_offset + component_size;
+		}
+	}
+	if( discretionary_acl_offset != 0 )
+	{
+		if( ( discretionary_acl_offset < 20 )
+		 || ( (size_t) discretionary_acl_offset >= byte_stream_size ) )
+		{
+			return( 0 );
+		}
+		component_size = libfwnt_security_descriptor_layout_scan_access_control_list(
+		                  &( byte_stream[ discretionary_acl_offset ] ),
+		                  byte_stream_size - discretionary_acl_offset );
+
+		if( component_size == 0 )
+		{
+			return( 0 );
+		}
+		security_descriptor_layout->discretionary_acl_offset = discretionary_acl_offset;
+		security_descriptor_layout->discretionary_acl_size   = (uint32_t) component_size;
+
+		if( ( discretionary_acl_offset + component_size ) > data_size )
+		{
+			data_size = discretionary_acl_offset + component_size;
+		}
+	}
+	security_descriptor_layout->revision_number = byte_stream[ 0 ];
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( byte_stream[ 2 ] ),
+	 security_descriptor_layout->control_flags );
+
+	security_descriptor_layout->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Scans multiple security descriptors and filters them with a predicate
+ * Every byte stream is scanned as by libfwnt_security_descriptor_layout_set_from_byte_stream
+ * and the predicate function is called with the layout of every valid security descriptor,
+ * it should return 1 if the security descriptor matches, 0 if not or -1 on error
+ * Without a predicate function every valid security descriptor matches
+ * If matches is not NULL it receives 1 for every byte stream that matches and 0 otherwise,
+ * a malformed byte stream never matches
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_layout_scan_byte_streams(
+     const uint8_t **byte_streams,
+     const size_t *byte_stream_sizes,
+     int number_of_byte_streams,
+     int byte_order,
+     int (*predicate_function)(
+            const uint8_t *byte_stream,
+            size_t byte_stream_size,
+            libfwnt_security_descriptor_layout_t *security_descriptor_layout,
+            void *predicate_arguments,
+            libcerror_error_t **error ),
+     void *predicate_arguments,
+     uint8_t *matches,
+     int *number_of_matches,
+     libcerror_error_t **error )
+{
+	libfwnt_security_descriptor_layout_t security_descriptor_layout;
+
+	static char *function = "libfwnt_security_descriptor_layout_scan_byte_streams";
+	int byte_stream_index = 0;
+	int match_count       = 0;
+	int result            = 0;
+
+	if( byte_streams == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte streams.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_byte_streams < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of byte streams value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of matches.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_stream_index = 0;
+	     byte_stream_index < number_of_byte_streams;
+	     byte_stream_index++ )
+	{
+		result = libfwnt_security_descriptor_layout_set_from_byte_stream(
+		          &security_descriptor_layout,
+		          byte_streams[ byte_stream_index ],
+		          byte_stream_sizes[ byte_stream_index ],
+		          byte_order,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set security descriptor layout: %d from byte stream.",
+			 function,
+			 byte_stream_index );
+
+			return( -1 );
+		}
+		else if( ( result != 0 )
+		      && ( predicate_function != NULL ) )
+		{
+			result = predicate_function(
+			          byte_streams[ byte_stream_index ],
+			          byte_stream_sizes[ byte_stream_index ],
+			          &security_descriptor_layout,
+			          predicate_arguments,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to apply predicate to security descriptor: %d.",
+				 function,
+				 byte_stream_index );
+
+				return( -1 );
+			}
+		}
+		if( matches != NULL )
+		{
+			matches[ byte_stream_index ] = (uint8_t) ( result != 0 );
+		}
+		if( result != 0 )
+		{
+			match_count++;
+		}
+	}
+	*number_of_matches = match_count;
+
+	return( 1 );
+}
+
@@ -0,0 +1,80 @@
+/*
+ * Windows NT Security Descriptor layout functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_SECURITY_DESCRIPTOR_LAYOUT_H )
+#define _LIBFWNT_SECURITY_DESCRIPTOR_LAYOUT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The security descriptor layout is determined by a single scan of the self-relative
+ * security descriptor data, that applies the same validation as a security descriptor
+ * view but reports malformed data by return value instead of by error, so that scanning
+ * malformed data does not allocate memory either
+ */
+
+size_t libfwnt_security_descriptor_layout_scan_security_identifier(
+        const uint8_t *data,
+        size_t data_size );
+
+size_t libfwnt_security_descriptor_layout_scan_access_control_list(
+        const uint8_t *data,
+        size_t data_size );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_layout_set_from_byte_stream(
+     libfwnt_security_descriptor_layout_t *security_descriptor_layout,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_layout_scan_byte_streams(
+     const uint8_t **byte_streams,
+     const size_t *byte_stream_sizes,
+     int number_of_byte_streams,
+     int byte_order,
+     int (*predicate_function)(
+            const uint8_t *byte_stream,
+            size_t byte_stream_size,
+            libfwnt_security_descriptor_layout_t *security_descriptor_layout,
+            void *predicate_arguments,
+            libcerror_error_t **error ),
+     void *predicate_arguments,
+     uint8_t *matches,
+     int *number_of_matches,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_SECURITY_DESCRIPTOR_LAYOUT_H ) */
+
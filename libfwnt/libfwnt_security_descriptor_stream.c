@@ -0,0 +1,906 @@
+/*
+ * Windows NT Security Descriptor stream ($SDS) functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_arena.h"
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_libcthreads.h"
+#include "libfwnt_security_descriptor.h"
+#include "libfwnt_security_descriptor_stream.h"
+#include "libfwnt_types.h"
+#include "libfwnt_unused.h"
+
+/* Creates a security descriptor stream
+ * Make sure the value security_descriptor_stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_stream_initialize(
+     libfwnt_security_descriptor_stream_t **security_descriptor_stream,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_stream_t *internal_security_descriptor_stream = NULL;
+	static char *function                                                              = "libfwnt_security_descriptor_stream_initialize";
+
+	if( security_descriptor_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_descriptor_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security descriptor stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_stream = memory_allocate_structure(
+	                                       libfwnt_internal_security_descriptor_stream_t );
+
+	if( internal_security_descriptor_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create security descriptor stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_security_descriptor_stream,
+	     0,
+	     sizeof( libfwnt_internal_security_descriptor_stream_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear security descriptor stream.",
+		 function );
+
+		memory_free(
+		 internal_security_descriptor_stream );
+
+		return( -1 );
+	}
+	*security_descriptor_stream = (libfwnt_security_descriptor_stream_t *) internal_security_descriptor_stream;
+
+	return( 1 );
+}
+
+/* Frees a security descriptor stream
+ * The security descriptors of the entries are freed as well
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_stream_free(
+     libfwnt_security_descriptor_stream_t **security_descriptor_stream,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_stream_t *internal_security_descriptor_stream = NULL;
+	static char *function                                                              = "libfwnt_security_descriptor_stream_free";
+	int result                                                                         = 1;
+
+	if( security_descriptor_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_descriptor_stream != NULL )
+	{
+		internal_security_descriptor_stream = (libfwnt_internal_security_descriptor_stream_t *) *security_descriptor_stream;
+		*security_descriptor_stream         = NULL;
+
+		if( libfwnt_internal_security_descriptor_stream_clear(
+		     internal_security_descriptor_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear security descriptor stream.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_security_descriptor_stream );
+	}
+	return( result );
+}
+
+/* Clears a security descriptor stream
+ * The entries and the arenas their security descriptors were allocated from are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_security_descriptor_stream_clear(
+     libfwnt_internal_security_descriptor_stream_t *internal_security_descriptor_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_internal_security_descriptor_stream_clear";
+	int arena_index       = 0;
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( internal_security_descriptor_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor_stream->entries != NULL )
+	{
+		for( entry_index = 0;
+		     entry_index < internal_security_descriptor_stream->number_of_entries;
+		     entry_index++ )
+		{
+			if( internal_security_descriptor_stream->entries[ entry_index ].security_descriptor != NULL )
+			{
+				if( libfwnt_security_descriptor_free(
+				     &( internal_security_descriptor_stream->entries[ entry_index ].security_descriptor ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free security descriptor of entry: %d.",
+					 function,
+					 entry_index );
+
+					result = -1;
+				}
+			}
+		}
+		memory_free(
+		 internal_security_descriptor_stream->entries );
+
+		internal_security_descriptor_stream->entries = NULL;
+	}
+	internal_security_descriptor_stream->number_of_entries = 0;
+
+	if( internal_security_descriptor_stream->arenas != NULL )
+	{
+		for( arena_index = 0;
+		     arena_index < internal_security_descriptor_stream->number_of_arenas;
+		     arena_index++ )
+		{
+			if( internal_security_descriptor_stream->arenas[ arena_index ] != NULL )
+			{
+				if( libfwnt_arena_free(
+				     &( internal_security_descriptor_stream->arenas[ arena_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free arena: %d.",
+					 function,
+					 arena_index );
+
+					result = -1;
+				}
+			}
+		}
+		memory_free(
+		 internal_security_descriptor_stream->arenas );
+
+		internal_security_descriptor_stream->arenas = NULL;
+	}
+	internal_security_descriptor_stream->number_of_arenas = 0;
+
+	return( result );
+}
+
+/* Scans the entry headers of the security descriptor stream data
+ * The mirror blocks are skipped. An entry header that does not contain its own offset
+ * in the stream marks the end of the entries in a block
+ * If entries is NULL only the number of entries is determined, otherwise number of entries
+ * must contain the number of entries in entries
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_security_descriptor_stream_scan_entries(
+     const uint8_t *data,
+     size_t data_size,
+     libfwnt_security_descriptor_stream_entry_t *entries,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function                   = "libfwnt_security_descriptor_stream_scan_entries";
+	size_t block_end_offset                 = 0;
+	size_t block_offset                     = 0;
+	size_t data_offset                      = 0;
+	uint64_t entry_offset                   = 0;
+	uint32_t entry_size                     = 0;
+	uint32_t security_descriptor_identifier = 0;
+	int entry_index                         = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		block_offset     = data_offset - ( data_offset % LIBFWNT_SECURITY_DESCRIPTOR_STREAM_BLOCK_SIZE );
+		block_end_offset = block_offset + LIBFWNT_SECURITY_DESCRIPTOR_STREAM_BLOCK_SIZE;
+
+		if( block_end_offset > data_size )
+		{
+			block_end_offset = data_size;
+		}
+		/* Every odd block is a mirror of the preceding block
+		 */
+		if( ( ( data_offset / LIBFWNT_SECURITY_DESCRIPTOR_STREAM_BLOCK_SIZE ) % 2 ) != 0 )
+		{
+			data_offset = block_offset + LIBFWNT_SECURITY_DESCRIPTOR_STREAM_BLOCK_SIZE;
+
+			continue;
+		}
+		if( ( data_offset + LIBFWNT_SECURITY_DESCRIPTOR_STREAM_ENTRY_HEADER_SIZE ) > block_end_offset )
+		{
+			data_offset = block_offset + ( 2 * LIBFWNT_SECURITY_DESCRIPTOR_STREAM_BLOCK_SIZE );
+
+			continue;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset + 4 ] ),
+		 security_descriptor_identifier );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset + 8 ] ),
+		 entry_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset + 16 ] ),
+		 entry_size );
+
+		if( ( entry_size == 0 )
+		 || ( entry_offset != (uint64_t) data_offset ) )
+		{
+			data_offset = block_offset + ( 2 * LIBFWNT_SECURITY_DESCRIPTOR_STREAM_BLOCK_SIZE );
+
+			continue;
+		}
+		if( ( entry_size < LIBFWNT_SECURITY_DESCRIPTOR_STREAM_ENTRY_HEADER_SIZE )
+		 || ( (size_t) entry_size > ( block_end_offset - data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry: %d size value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( entry_index == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entry index value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( entries != NULL )
+		{
+			if( entry_index >= *number_of_entries )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid entry index value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			entries[ entry_index ].security_descriptor_identifier = security_descriptor_identifier;
+			entries[ entry_index ].data_offset                    = data_offset + LIBFWNT_SECURITY_DESCRIPTOR_STREAM_ENTRY_HEADER_SIZE;
+			entries[ entry_index ].data_size                      = (size_t) entry_size - LIBFWNT_SECURITY_DESCRIPTOR_STREAM_ENTRY_HEADER_SIZE;
+			entries[ entry_index ].security_descriptor            = NULL;
+		}
+		/* The entries are 16-byte aligned
+		 */
+		data_offset += ( (size_t) entry_size + 15 ) & ~( (size_t) 15 );
+
+		entry_index++;
+	}
+	*number_of_entries = entry_index;
+
+	return( 1 );
+}
+
+/* Reads the security descriptors of the entries of a read job
+ * This function is called from multiple threads and therefore does not set an error,
+ * the result is stored in the job
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_security_descriptor_stream_read_job_run(
+     libfwnt_security_descriptor_stream_read_job_t *job )
+{
+	libfwnt_security_descriptor_stream_entry_t *entry = NULL;
+	int entry_index                                   = 0;
+
+	if( job == NULL )
+	{
+		return( -1 );
+	}
+	job->result = 1;
+
+	for( entry_index = 0;
+	     entry_index < job->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( job->entries[ entry_index ] );
+
+		if( libfwnt_security_descriptor_initialize_with_arena(
+		     &( entry->security_descriptor ),
+		     job->arena,
+		     NULL ) != 1 )
+		{
+			job->result = -1;
+
+			break;
+		}
+		if( libfwnt_security_descriptor_copy_from_byte_stream(
+		     entry->security_descriptor,
+		     &( job->data[ entry->data_offset ] ),
+		     entry->data_size,
+		     LIBFWNT_ENDIAN_LITTLE,
+		     NULL ) != 1 )
+		{
+			libfwnt_security_descriptor_free(
+			 &( entry->security_descriptor ),
+			 NULL );
+
+			job->result = -1;
+
+			break;
+		}
+	}
+	return( job->result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function to read the entries of a read job from a thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_stream_read_job_callback(
+     intptr_t *job,
+     void *arguments LIBFWNT_ATTRIBUTE_UNUSED )
+{
+	LIBFWNT_UNREFERENCED_PARAMETER( arguments )
+
+	if( job == NULL )
+	{
+		return( -1 );
+	}
+	/* The result is checked when the thread pool has been joined
+	 */
+	libfwnt_security_descriptor_stream_read_job_run(
+	 (libfwnt_security_descriptor_stream_read_job_t *) job );
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Reads the security descriptor stream ($SDS) data, for example a memory-mapped buffer
+ * The entries are read in parallel using multiple threads, every thread reads a contiguous
+ * range of entries and allocates their security descriptors from its own arena
+ * If the number of threads is 0 or 1 or multi-threading is not supported the entries
+ * are read sequentially
+ * The security descriptors are copied, the data is no longer needed after reading
+ * Entries that were read before are freed
+ * Returns 1 on success or -1 on error
+ */
+int libfwnt_security_descriptor_stream_read_data(
+     libfwnt_security_descriptor_stream_t *security_descriptor_stream,
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_stream_t *internal_security_descriptor_stream = NULL;
+	libfwnt_security_descriptor_stream_read_job_t *jobs                                = NULL;
+	static char *function                                                              = "libfwnt_security_descriptor_stream_read_data";
+	int entry_index                                                                    = 0;
+	int job_index                                                                      = 0;
+	int number_of_entries                                                              = 0;
+	int number_of_jobs                                                                 = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool                                             = NULL;
+#endif
+
+	if( security_descriptor_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_stream = (libfwnt_internal_security_descriptor_stream_t *) security_descriptor_stream;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_security_descriptor_stream_clear(
+	     internal_security_descriptor_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear security descriptor stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_descriptor_stream_scan_entries(
+	     data,
+	     data_size,
+	     NULL,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	internal_security_descriptor_stream->entries = (libfwnt_security_descriptor_stream_entry_t *) memory_allocate(
+	                                                                                               sizeof( libfwnt_security_descriptor_stream_entry_t ) * number_of_entries );
+
+	if( internal_security_descriptor_stream->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwnt_security_descriptor_stream_scan_entries(
+	     data,
+	     data_size,
+	     internal_security_descriptor_stream->entries,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to scan entries.",
+		 function );
+
+		goto on_error;
+	}
+	internal_security_descriptor_stream->number_of_entries = number_of_entries;
+
+	number_of_jobs = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		number_of_jobs = number_of_threads;
+
+		if( number_of_jobs > number_of_entries )
+		{
+			number_of_jobs = number_of_entries;
+		}
+	}
+#endif
+	jobs = (libfwnt_security_descriptor_stream_read_job_t *) memory_allocate(
+	                                                          sizeof( libfwnt_security_descriptor_stream_read_job_t ) * number_of_jobs );
+
+	if( jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create jobs.",
+		 function );
+
+		goto on_error;
+	}
+	internal_security_descriptor_stream->arenas = (libfwnt_arena_t **) memory_allocate(
+	                                                                    sizeof( libfwnt_arena_t * ) * number_of_jobs );
+
+	if( internal_security_descriptor_stream->arenas == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arenas.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_security_descriptor_stream->arenas,
+	     0,
+	     sizeof( libfwnt_arena_t * ) * number_of_jobs ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arenas.",
+		 function );
+
+		goto on_error;
+	}
+	internal_security_descriptor_stream->number_of_arenas = number_of_jobs;
+
+	/* Distribute the entries over the jobs in contiguous ranges, so that the
+	 * security descriptors of every job are allocated from its own arena
+	 */
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		if( libfwnt_arena_initialize(
+		     &( internal_security_descriptor_stream->arenas[ job_index ] ),
+		     LIBFWNT_ARENA_DEFAULT_BLOCK_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create arena: %d.",
+			 function,
+			 job_index );
+
+			goto on_error;
+		}
+		jobs[ job_index ].data              = data;
+		jobs[ job_index ].entries           = &( internal_security_descriptor_stream->entries[ entry_index ] );
+		jobs[ job_index ].number_of_entries = ( number_of_entries - entry_index ) / ( number_of_jobs - job_index );
+		jobs[ job_index ].arena             = internal_security_descriptor_stream->arenas[ job_index ];
+		jobs[ job_index ].result            = 0;
+
+		entry_index += jobs[ job_index ].number_of_entries;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_jobs > 1 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_jobs,
+		     number_of_jobs,
+		     (int (*)(intptr_t *, void *)) &libfwnt_security_descriptor_stream_read_job_callback,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( job_index = 0;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) &( jobs[ job_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push job: %d onto thread pool.",
+				 function,
+				 job_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		libfwnt_security_descriptor_stream_read_job_run(
+		 &( jobs[ 0 ] ) );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( internal_security_descriptor_stream->entries[ entry_index ].security_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy security descriptor of entry: %d from byte stream.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 jobs );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( jobs != NULL )
+	{
+		memory_free(
+		 jobs );
+	}
+	libfwnt_internal_security_descriptor_stream_clear(
+	 internal_security_descriptor_stream,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_stream_get_number_of_entries(
+     libfwnt_security_descriptor_stream_t *security_descriptor_stream,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_stream_t *internal_security_descriptor_stream = NULL;
+	static char *function                                                              = "libfwnt_security_descriptor_stream_get_number_of_entries";
+
+	if( security_descriptor_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_stream = (libfwnt_internal_security_descriptor_stream_t *) security_descriptor_stream;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = internal_security_descriptor_stream->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * The entries are in the order they are stored in the stream
+ * The security descriptor is managed by the security descriptor stream and must not
+ * be freed, it remains valid until the stream is freed or other data is read
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_stream_get_entry_by_index(
+     libfwnt_security_descriptor_stream_t *security_descriptor_stream,
+     int entry_index,
+     uint32_t *security_descriptor_identifier,
+     libfwnt_security_descriptor_t **security_descriptor,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_stream_t *internal_security_descriptor_stream = NULL;
+	static char *function                                                              = "libfwnt_security_descriptor_stream_get_entry_by_index";
+
+	if( security_descriptor_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_stream = (libfwnt_internal_security_descriptor_stream_t *) security_descriptor_stream;
+
+	if( ( entry_index < 0 )
+	 || ( entry_index >= internal_security_descriptor_stream->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_descriptor_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	*security_descriptor_identifier = internal_security_descriptor_stream->entries[ entry_index ].security_descriptor_identifier;
+	*security_descriptor            = internal_security_descriptor_stream->entries[ entry_index ].security_descriptor;
+
+	return( 1 );
+}
+
@@ -0,0 +1,176 @@
+/*
+ * Windows NT Security Descriptor stream ($SDS) functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_SECURITY_DESCRIPTOR_STREAM_H )
+#define _LIBFWNT_SECURITY_DESCRIPTOR_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The security descriptor stream is the $SDS data stream of the NTFS $Secure
+ * metadata file. The stream consists of 256 KiB blocks of which every odd block
+ * is a mirror of the preceding block. A block contains 16-byte aligned entries,
+ * that consist of a 20-byte header followed by a self-relative security descriptor.
+ */
+
+/* The size of a security descriptor stream block
+ */
+#define LIBFWNT_SECURITY_DESCRIPTOR_STREAM_BLOCK_SIZE		0x00040000UL
+
+/* The size of a security descriptor stream entry header
+ */
+#define LIBFWNT_SECURITY_DESCRIPTOR_STREAM_ENTRY_HEADER_SIZE	20
+
+typedef struct libfwnt_security_descriptor_stream_entry libfwnt_security_descriptor_stream_entry_t;
+
+struct libfwnt_security_descriptor_stream_entry
+{
+	/* The security descriptor identifier
+	 */
+	uint32_t security_descriptor_identifier;
+
+	/* The offset of the security descriptor data in the stream
+	 */
+	size_t data_offset;
+
+	/* The security descriptor data size
+	 */
+	size_t data_size;
+
+	/* The security descriptor
+	 */
+	libfwnt_security_descriptor_t *security_descriptor;
+};
+
+typedef struct libfwnt_security_descriptor_stream_read_job libfwnt_security_descriptor_stream_read_job_t;
+
+struct libfwnt_security_descriptor_stream_read_job
+{
+	/* The stream data
+	 */
+	const uint8_t *data;
+
+	/* The entries to read
+	 */
+	libfwnt_security_descriptor_stream_entry_t *entries;
+
+	/* The number of entries to read
+	 */
+	int number_of_entries;
+
+	/* The arena the security descriptors are allocated from
+	 */
+	libfwnt_arena_t *arena;
+
+	/* The result of reading the entries
+	 */
+	int result;
+};
+
+typedef struct libfwnt_internal_security_descriptor_stream libfwnt_internal_security_descriptor_stream_t;
+
+struct libfwnt_internal_security_descriptor_stream
+{
+	/* The entries
+	 */
+	libfwnt_security_descriptor_stream_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The arenas, one per read job
+	 */
+	libfwnt_arena_t **arenas;
+
+	/* The number of arenas
+	 */
+	int number_of_arenas;
+};
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_stream_initialize(
+     libfwnt_security_descriptor_stream_t **security_descriptor_stream,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_stream_free(
+     libfwnt_security_descriptor_stream_t **security_descriptor_stream,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_descriptor_stream_clear(
+     libfwnt_internal_security_descriptor_stream_t *internal_security_descriptor_stream,
+     libcerror_error_t **error );
+
+int libfwnt_security_descriptor_stream_scan_entries(
+     const uint8_t *data,
+     size_t data_size,
+     libfwnt_security_descriptor_stream_entry_t *entries,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libfwnt_security_descriptor_stream_read_job_run(
+     libfwnt_security_descriptor_stream_read_job_t *job );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libfwnt_security_descriptor_stream_read_job_callback(
+     intptr_t *job,
+     void *arguments );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_stream_read_data(
+     libfwnt_security_descriptor_stream_t *security_descriptor_stream,
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_stream_get_number_of_entries(
+     libfwnt_security_descriptor_stream_t *security_descriptor_stream,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_stream_get_entry_by_index(
+     libfwnt_security_descriptor_stream_t *security_descriptor_stream,
+     int entry_index,
+     uint32_t *security_descriptor_identifier,
+     libfwnt_security_descriptor_t **security_descriptor,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_SECURITY_DESCRIPTOR_STREAM_H ) */
+
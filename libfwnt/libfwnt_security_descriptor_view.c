@@ -0,0 +1,678 @@
+/*
+ * Windows NT Security Descriptor view functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libfwnt_access_control_list_view.h"
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_security_descriptor_view.h"
+#include "libfwnt_security_identifier_view.h"
+#include "libfwnt_types.h"
+
+/* Sets a security descriptor view from a byte stream
+ * The header, the owner and group security identifiers and the access control lists,
+ * including all their entries, are validated once but not copied, the view references
+ * the byte stream and no memory is allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_view_set_from_byte_stream(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfwnt_access_control_list_view_t access_control_list_view;
+	libfwnt_security_identifier_view_t security_identifier_view;
+
+	static char *function             = "libfwnt_security_descriptor_view_set_from_byte_stream";
+	uint32_t discretionary_acl_offset = 0;
+	uint32_t group_sid_offset         = 0;
+	uint32_t owner_sid_offset         = 0;
+	uint32_t system_acl_offset        = 0;
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 20 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 4 ] ),
+	 owner_sid_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 8 ] ),
+	 group_sid_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 12 ] ),
+	 system_acl_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 16 ] ),
+	 discretionary_acl_offset );
+
+	if( owner_sid_offset != 0 )
+	{
+		if( ( owner_sid_offset < 20 )
+		 || ( (size_t) owner_sid_offset >= byte_stream_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: owner SID offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwnt_security_identifier_view_set_from_byte_stream(
+		     &security_identifier_view,
+		     &( byte_stream[ owner_sid_offset ] ),
+		     byte_stream_size - owner_sid_offset,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set owner SID view.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( group_sid_offset != 0 )
+	{
+		if( ( group_sid_offset < 20 )
+		 || ( (size_t) group_sid_offset >= byte_stream_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: group SID offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwnt_security_identifier_view_set_from_byte_stream(
+		     &security_identifier_view,
+		     &( byte_stream[ group_sid_offset ] ),
+		     byte_stream_size - group_sid_offset,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set group SID view.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( system_acl_offset != 0 )
+	{
+		if( ( system_acl_offset < 20 )
+		 || ( (size_t) system_acl_offset >= byte_stream_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: system ACL offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwnt_access_control_list_view_set_from_byte_stream(
+		     &access_control_list_view,
+		     &( byte_stream[ system_acl_offset ] ),
+		     byte_stream_size - system_acl_offset,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set system ACL view.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( discretionary_acl_offset != 0 )
+	{
+		if( ( discretionary_acl_offset < 20 )
+		 || ( (size_t) discretionary_acl_offset >= byte_stream_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: discretionary ACL offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwnt_access_control_list_view_set_from_byte_stream(
+		     &access_control_list_view,
+		     &( byte_stream[ discretionary_acl_offset ] ),
+		     byte_stream_size - discretionary_acl_offset,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set discretionary ACL view.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	security_descriptor_view->data      = byte_stream;
+	security_descriptor_view->data_size = byte_stream_size;
+
+	return( 1 );
+}
+
+/* Retrieves the revision number
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_revision_number(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     uint8_t *revision_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_descriptor_view_get_revision_number";
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( security_descriptor_view->data == NULL )
+	 || ( security_descriptor_view->data_size < 20 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( revision_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid revision number.",
+		 function );
+
+		return( -1 );
+	}
+	*revision_number = security_descriptor_view->data[ 0 ];
+
+	return( 1 );
+}
+
+/* Retrieves the control flags
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_control_flags(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     uint16_t *control_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_descriptor_view_get_control_flags";
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( security_descriptor_view->data == NULL )
+	 || ( security_descriptor_view->data_size < 20 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( control_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid control flags.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( security_descriptor_view->data[ 2 ] ),
+	 *control_flags );
+
+	return( 1 );
+}
+
+/* Retrieves a security identifier using the offset stored at a specific offset in the header
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_security_identifier_by_header_offset(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     size_t header_offset,
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfwnt_security_descriptor_view_get_security_identifier_by_header_offset";
+	size_t security_identifier_size = 0;
+	uint32_t data_offset            = 0;
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( security_descriptor_view->data == NULL )
+	 || ( security_descriptor_view->data_size < 20 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( header_offset < 4 )
+	 || ( header_offset > 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid header offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_identifier_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier view.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( security_descriptor_view->data[ header_offset ] ),
+	 data_offset );
+
+	if( data_offset == 0 )
+	{
+		return( 0 );
+	}
+	if( ( data_offset < 20 )
+	 || ( (size_t) data_offset > ( security_descriptor_view->data_size - 8 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: security identifier offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	security_identifier_size = 8 + ( (size_t) security_descriptor_view->data[ data_offset + 1 ] * 4 );
+
+	if( security_identifier_size > ( security_descriptor_view->data_size - data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: security identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	security_identifier_view->data      = &( security_descriptor_view->data[ data_offset ] );
+	security_identifier_view->data_size = security_identifier_size;
+
+	return( 1 );
+}
+
+/* Retrieves an access control list using the offset stored at a specific offset in the header
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_access_control_list_by_header_offset(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     size_t header_offset,
+     libfwnt_access_control_list_view_t *access_control_list_view,
+     libcerror_error_t **error )
+{
+	static char *function             = "libfwnt_security_descriptor_view_get_access_control_list_by_header_offset";
+	uint32_t data_offset              = 0;
+	uint16_t access_control_list_size = 0;
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( security_descriptor_view->data == NULL )
+	 || ( security_descriptor_view->data_size < 20 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( header_offset < 4 )
+	 || ( header_offset > 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid header offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_control_list_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list view.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( security_descriptor_view->data[ header_offset ] ),
+	 data_offset );
+
+	if( data_offset == 0 )
+	{
+		return( 0 );
+	}
+	if( ( data_offset < 20 )
+	 || ( (size_t) data_offset > ( security_descriptor_view->data_size - 8 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: access control list offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( security_descriptor_view->data[ data_offset + 2 ] ),
+	 access_control_list_size );
+
+	if( ( access_control_list_size < 8 )
+	 || ( (size_t) access_control_list_size > ( security_descriptor_view->data_size - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: access control list size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	access_control_list_view->data      = &( security_descriptor_view->data[ data_offset ] );
+	access_control_list_view->data_size = (size_t) access_control_list_size;
+
+	return( 1 );
+}
+
+/* Retrieves the owner security identifier (SID)
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_owner(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_descriptor_view_get_owner";
+	int result            = 0;
+
+	result = libfwnt_security_descriptor_view_get_security_identifier_by_header_offset(
+	          security_descriptor_view,
+	          4,
+	          security_identifier_view,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve owner security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the group security identifier (SID)
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_group(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_descriptor_view_get_group";
+	int result            = 0;
+
+	result = libfwnt_security_descriptor_view_get_security_identifier_by_header_offset(
+	          security_descriptor_view,
+	          8,
+	          security_identifier_view,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve group security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the discretionary access control list (ACL)
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_discretionary_acl(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     libfwnt_access_control_list_view_t *access_control_list_view,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_descriptor_view_get_discretionary_acl";
+	int result            = 0;
+
+	result = libfwnt_security_descriptor_view_get_access_control_list_by_header_offset(
+	          security_descriptor_view,
+	          16,
+	          access_control_list_view,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve discretionary access control list.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the system access control list (ACL)
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_system_acl(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     libfwnt_access_control_list_view_t *access_control_list_view,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_descriptor_view_get_system_acl";
+	int result            = 0;
+
+	result = libfwnt_security_descriptor_view_get_access_control_list_by_header_offset(
+	          security_descriptor_view,
+	          12,
+	          access_control_list_view,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve system access control list.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -0,0 +1,97 @@
+/*
+ * Windows NT Security Descriptor view functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_SECURITY_DESCRIPTOR_VIEW_H )
+#define _LIBFWNT_SECURITY_DESCRIPTOR_VIEW_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_set_from_byte_stream(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_revision_number(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     uint8_t *revision_number,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_control_flags(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     uint16_t *control_flags,
+     libcerror_error_t **error );
+
+int libfwnt_security_descriptor_view_get_security_identifier_by_header_offset(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     size_t header_offset,
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     libcerror_error_t **error );
+
+int libfwnt_security_descriptor_view_get_access_control_list_by_header_offset(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     size_t header_offset,
+     libfwnt_access_control_list_view_t *access_control_list_view,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_owner(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_group(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_discretionary_acl(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     libfwnt_access_control_list_view_t *access_control_list_view,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_system_acl(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     libfwnt_access_control_list_view_t *access_control_list_view,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_SECURITY_DESCRIPTOR_VIEW_H ) */
+
@@ -24,11 +24,33 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwnt_arena.h"
 #include "libfwnt_definitions.h"
 #include "libfwnt_libcerror.h"
 #include "libfwnt_security_identifier.h"
 #include "libfwnt_types.h"
 
+/* The decimal digit pairs 00 to 99, used to format 2 digits at a time
+ */
+static const uint8_t libfwnt_security_identifier_decimal_digit_pairs[ 200 ] = {
+	'0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6', '0', '7', '0', '8', '0', '9',
+	'1', '0', '1', '1', '1', '2', '1', '3', '1', '4', '1', '5', '1', '6', '1', '7', '1', '8', '1', '9',
+	'2', '0', '2', '1', '2', '2', '2', '3', '2', '4', '2', '5', '2', '6', '2', '7', '2', '8', '2', '9',
+	'3', '0', '3', '1', '3', '2', '3', '3', '3', '4', '3', '5', '3', '6', '3', '7', '3', '8', '3', '9',
+	'4', '0', '4', '1', '4', '2', '4', '3', '4', '4', '4', '5', '4', '6', '4', '7', '4', '8', '4', '9',
+	'5', '0', '5', '1', '5', '2', '5', '3', '5', '4', '5', '5', '5', '6', '5', '7', '5', '8', '5', '9',
+	'6', '0', '6', '1', '6', '2', '6', '3', '6', '4', '6', '5', '6', '6', '6', '7', '6', '8', '6', '9',
+	'7', '0', '7', '1', '7', '2', '7', '3', '7', '4', '7', '5', '7', '6', '7', '7', '7', '8', '7', '9',
+	'8', '0', '8', '1', '8', '2', '8', '3', '8', '4', '8', '5', '8', '6', '8', '7', '8', '8', '8', '9',
+	'9', '0', '9', '1', '9', '2', '9', '3', '9', '4', '9', '5', '9', '6', '9', '7', '9', '8', '9', '9' };
+
+/* The powers of 10 used to determine the number of decimal digits of a 48-bit value
+ */
+static const uint64_t libfwnt_security_identifier_powers_of_10[ 15 ] = {
+	10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+	1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+	100000000000000ULL, 1000000000000000ULL };
+
 /* Creates a security identifier
  * Make sure the value security_identifier is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -36,9 +58,25 @@
 int libfwnt_security_identifier_initialize(
      libfwnt_security_identifier_t **security_identifier,
      libcerror_error_t **error )
+{
+	return( libfwnt_security_identifier_initialize_with_arena(
+	         security_identifier,
+	         NULL,
+	         error ) );
+}
+
+/* Creates a security identifier that is allocated from an arena
+ * Make sure the value security_identifier is referencing, is set to NULL
+ * If arena is NULL the security identifier is allocated on the heap
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_initialize_with_arena(
+     libfwnt_security_identifier_t **security_identifier,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error )
 {
 	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
-	static char *function                                                = "libfwnt_security_identifier_initialize";
+	static char *function                                                = "libfwnt_security_identifier_initialize_with_arena";
 
 	if( security_identifier == NULL )
 	{
@@ -62,40 +100,64 @@ int libfwnt_security_identifier_initialize(
 
 		return( -1 );
 	}
-	internal_security_identifier = memory_allocate_structure(
-	                                libfwnt_internal_security_identifier_t );
-
-	if( internal_security_identifier == NULL )
+	if( arena != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create security identifier.",
-		 function );
+		if( libfwnt_arena_allocate(
+		     arena,
+		     sizeof( libfwnt_internal_security_identifier_t ),
+		     (void **) &internal_security_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create security identifier.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	if( memory_set(
-	     internal_security_identifier,
-	     0,
-	     sizeof( libfwnt_internal_security_identifier_t ) ) == NULL )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear security identifier.",
-		 function );
+		internal_security_identifier = memory_allocate_structure(
+		                                libfwnt_internal_security_identifier_t );
+
+		if( internal_security_identifier == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create security identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_security_identifier,
+		     0,
+		     sizeof( libfwnt_internal_security_identifier_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear security identifier.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
+	internal_security_identifier->arena = arena;
+
 	*security_identifier = (libfwnt_security_identifier_t *) internal_security_identifier;
 
 	return( 1 );
 
 on_error:
-	if( internal_security_identifier != NULL )
+	if( ( internal_security_identifier != NULL )
+	 && ( arena == NULL ) )
 	{
 		memory_free(
 		 internal_security_identifier );
@@ -172,9 +234,11 @@ int libfwnt_internal_security_identifier_free(
 	}
 	if( *internal_security_identifier != NULL )
 	{
-		memory_free(
-		 *internal_security_identifier );
-
+		if( ( *internal_security_identifier )->arena == NULL )
+		{
+			memory_free(
+			 *internal_security_identifier );
+		}
 		*internal_security_identifier = NULL;
 	}
 	return( 1 );
@@ -302,6 +366,200 @@ int libfwnt_security_identifier_copy_from_byte_stream(
 	return( 1 );
 }
 
+/* Retrieves the size of the security identifier stored in a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_get_byte_stream_size(
+     libfwnt_security_identifier_t *security_identifier,
+     size_t *byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
+	static char *function                                                = "libfwnt_security_identifier_get_byte_stream_size";
+
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier = (libfwnt_internal_security_identifier_t *) security_identifier;
+
+	if( byte_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_identifier->number_of_sub_authorities > 15 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported security identifier contains more than 15 sub authoritites.",
+		 function );
+
+		return( -1 );
+	}
+	*byte_stream_size = 8 + ( (size_t) internal_security_identifier->number_of_sub_authorities * 4 );
+
+	return( 1 );
+}
+
+/* Converts a security identifier into a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_copy_to_byte_stream(
+     libfwnt_security_identifier_t *security_identifier,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
+	static char *function                                                = "libfwnt_security_identifier_copy_to_byte_stream";
+	size_t security_identifier_size                                      = 0;
+	uint8_t sub_authority_index                                          = 0;
+
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier = (libfwnt_internal_security_identifier_t *) security_identifier;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_identifier->number_of_sub_authorities > 15 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported security identifier contains more than 15 sub authoritites.",
+		 function );
+
+		return( -1 );
+	}
+	security_identifier_size = 8 + ( (size_t) internal_security_identifier->number_of_sub_authorities * 4 );
+
+	if( byte_stream_size < security_identifier_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream[ 0 ] = internal_security_identifier->revision_number;
+	byte_stream[ 1 ] = internal_security_identifier->number_of_sub_authorities;
+
+	byte_stream += 2;
+
+	/* The authority is stored as a 48-bit value
+	 */
+	byte_stream_copy_from_uint48_big_endian(
+	 byte_stream,
+	 internal_security_identifier->authority );
+
+	byte_stream += 6;
+
+	for( sub_authority_index = 0;
+	     sub_authority_index < internal_security_identifier->number_of_sub_authorities;
+	     sub_authority_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 byte_stream,
+		 internal_security_identifier->sub_authority[ sub_authority_index ] );
+
+		byte_stream += 4;
+	}
+	return( 1 );
+}
+
+/* Calculates the hash of a security identifier stored in a byte stream
+ * The size of a security identifier byte stream is a multiple of 4, so the data is
+ * hashed in 32-bit values
+ * Returns the hash
+ */
+uint32_t libfwnt_security_identifier_calculate_hash(
+          const uint8_t *byte_stream,
+          size_t byte_stream_size )
+{
+	size_t byte_stream_offset = 0;
+	uint32_t hash             = 0x811c9dc5UL;
+	uint32_t value_32bit      = 0;
+
+	while( ( byte_stream_offset + 4 ) <= byte_stream_size )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 value_32bit );
+
+		hash ^= value_32bit;
+		hash *= 0x9e3779b1UL;
+		hash ^= hash >> 15;
+
+		byte_stream_offset += 4;
+	}
+	hash ^= (uint32_t) byte_stream_size;
+	hash *= 0x85ebca6bUL;
+	hash ^= hash >> 13;
+
+	return( hash );
+}
+
 /* Deterimes the size of the string for the security identifier
  * The string size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -1174,3 +1432,1023 @@ int libfwnt_security_identifier_copy_to_utf32_string_with_index(
 	return( 1 );
 }
 
+/* Determines the number of decimal digits of a value of at most 48 bits
+ * Returns the number of decimal digits
+ */
+size_t libfwnt_security_identifier_get_number_of_decimal_digits(
+        uint64_t value )
+{
+	size_t number_of_digits = 11;
+
+	if( value < 100000 )
+	{
+		if( value < 10 )
+		{
+			return( 1 );
+		}
+		if( value < 100 )
+		{
+			return( 2 );
+		}
+		if( value < 1000 )
+		{
+			return( 3 );
+		}
+		if( value < 10000 )
+		{
+			return( 4 );
+		}
+		return( 5 );
+	}
+	if( value < 10000000000ULL )
+	{
+		if( value < 1000000 )
+		{
+			return( 6 );
+		}
+		if( value < 10000000 )
+		{
+			return( 7 );
+		}
+		if( value < 100000000 )
+		{
+			return( 8 );
+		}
+		if( value < 1000000000 )
+		{
+			return( 9 );
+		}
+		return( 10 );
+	}
+	while( ( number_of_digits < 16 )
+	    && ( value >= libfwnt_security_identifier_powers_of_10[ number_of_digits - 1 ] ) )
+	{
+		number_of_digits++;
+	}
+	return( number_of_digits );
+}
+
+/* Formats a value as decimal digits, 2 digits at a time
+ * The digits are stored in front of the string index, working backwards
+ * Returns the string index of the first digit
+ */
+size_t libfwnt_security_identifier_format_decimal(
+        uint64_t value,
+        uint8_t *string,
+        size_t string_index )
+{
+	size_t digit_pair_index = 0;
+	uint32_t value_32bit    = 0;
+
+	/* Only the authority can exceed 32 bits
+	 */
+	while( value > (uint64_t) UINT32_MAX )
+	{
+		digit_pair_index = (size_t) ( value % 100 ) * 2;
+		value           /= 100;
+
+		string[ --string_index ] = libfwnt_security_identifier_decimal_digit_pairs[ digit_pair_index + 1 ];
+		string[ --string_index ] = libfwnt_security_identifier_decimal_digit_pairs[ digit_pair_index ];
+	}
+	value_32bit = (uint32_t) value;
+
+	while( value_32bit >= 100 )
+	{
+		digit_pair_index = (size_t) ( value_32bit % 100 ) * 2;
+		value_32bit     /= 100;
+
+		string[ --string_index ] = libfwnt_security_identifier_decimal_digit_pairs[ digit_pair_index + 1 ];
+		string[ --string_index ] = libfwnt_security_identifier_decimal_digit_pairs[ digit_pair_index ];
+	}
+	if( value_32bit >= 10 )
+	{
+		digit_pair_index = (size_t) value_32bit * 2;
+
+		string[ --string_index ] = libfwnt_security_identifier_decimal_digit_pairs[ digit_pair_index + 1 ];
+		string[ --string_index ] = libfwnt_security_identifier_decimal_digit_pairs[ digit_pair_index ];
+	}
+	else
+	{
+		string[ --string_index ] = (uint8_t) '0' + (uint8_t) value_32bit;
+	}
+	return( string_index );
+}
+
+/* Determines the size of the UTF-8 string of an internal security identifier
+ * The string size includes the end of string character
+ * Returns the string size
+ */
+size_t libfwnt_internal_security_identifier_get_utf8_string_size(
+        libfwnt_internal_security_identifier_t *internal_security_identifier )
+{
+	size_t string_size          = 0;
+	uint8_t sub_authority_index = 0;
+
+	/* "S-" revision "-" authority and the end of string character
+	 */
+	string_size = 4
+	            + libfwnt_security_identifier_get_number_of_decimal_digits(
+	               (uint64_t) internal_security_identifier->revision_number )
+	            + libfwnt_security_identifier_get_number_of_decimal_digits(
+	               internal_security_identifier->authority );
+
+	for( sub_authority_index = 0;
+	     sub_authority_index < internal_security_identifier->number_of_sub_authorities;
+	     sub_authority_index++ )
+	{
+		string_size += 1
+		             + libfwnt_security_identifier_get_number_of_decimal_digits(
+		                (uint64_t) internal_security_identifier->sub_authority[ sub_authority_index ] );
+	}
+	return( string_size );
+}
+
+/* Determines the size of the UTF-8 strings of multiple security identifiers
+ * The strings size includes the end of string character of every string
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_get_utf8_strings_size(
+     libfwnt_security_identifier_t **security_identifiers,
+     int number_of_security_identifiers,
+     size_t *utf8_strings_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
+	static char *function                                                = "libfwnt_security_identifier_get_utf8_strings_size";
+	size_t strings_size                                                  = 0;
+	int security_identifier_index                                        = 0;
+
+	if( security_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_security_identifiers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of security identifiers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_format_flags != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format flags.",
+		 function );
+
+		return( -1 );
+	}
+	for( security_identifier_index = 0;
+	     security_identifier_index < number_of_security_identifiers;
+	     security_identifier_index++ )
+	{
+		internal_security_identifier = (libfwnt_internal_security_identifier_t *) security_identifiers[ security_identifier_index ];
+
+		if( internal_security_identifier == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid security identifier: %d.",
+			 function,
+			 security_identifier_index );
+
+			return( -1 );
+		}
+		strings_size += libfwnt_internal_security_identifier_get_utf8_string_size(
+		                 internal_security_identifier );
+	}
+	*utf8_strings_size = strings_size;
+
+	return( 1 );
+}
+
+/* Converts multiple security identifiers into UTF-8 strings
+ * The strings are stored consecutively in a single buffer, each string is
+ * terminated by an end of string character
+ * The offset of the start of every string in the buffer is stored in the
+ * string offsets, which must contain number of security identifiers elements
+ * The strings size can be determined with libfwnt_security_identifier_get_utf8_strings_size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_copy_to_utf8_strings(
+     libfwnt_security_identifier_t **security_identifiers,
+     int number_of_security_identifiers,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     size_t *utf8_string_offsets,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_string[ LIBFWNT_SECURITY_IDENTIFIER_MAXIMUM_UTF8_STRING_SIZE ];
+
+	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
+	static char *function                                                = "libfwnt_security_identifier_copy_to_utf8_strings";
+	size_t string_index                                                  = 0;
+	size_t string_size                                                   = 0;
+	size_t utf8_strings_index                                            = 0;
+	int security_identifier_index                                        = 0;
+	uint8_t sub_authority_index                                          = 0;
+
+	if( security_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_security_identifiers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of security identifiers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: UTF-8 strings size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_format_flags != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format flags.",
+		 function );
+
+		return( -1 );
+	}
+	for( security_identifier_index = 0;
+	     security_identifier_index < number_of_security_identifiers;
+	     security_identifier_index++ )
+	{
+		internal_security_identifier = (libfwnt_internal_security_identifier_t *) security_identifiers[ security_identifier_index ];
+
+		if( internal_security_identifier == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid security identifier: %d.",
+			 function,
+			 security_identifier_index );
+
+			return( -1 );
+		}
+		/* Format the string backwards so that every value is formatted only once
+		 */
+		string_index = LIBFWNT_SECURITY_IDENTIFIER_MAXIMUM_UTF8_STRING_SIZE;
+
+		utf8_string[ --string_index ] = 0;
+
+		for( sub_authority_index = internal_security_identifier->number_of_sub_authorities;
+		     sub_authority_index > 0;
+		     sub_authority_index-- )
+		{
+			string_index = libfwnt_security_identifier_format_decimal(
+			                (uint64_t) internal_security_identifier->sub_authority[ sub_authority_index - 1 ],
+			                utf8_string,
+			                string_index );
+
+			utf8_string[ --string_index ] = (uint8_t) '-';
+		}
+		string_index = libfwnt_security_identifier_format_decimal(
+		                internal_security_identifier->authority,
+		                utf8_string,
+		                string_index );
+
+		utf8_string[ --string_index ] = (uint8_t) '-';
+
+		string_index = libfwnt_security_identifier_format_decimal(
+		                (uint64_t) internal_security_identifier->revision_number,
+		                utf8_string,
+		                string_index );
+
+		utf8_string[ --string_index ] = (uint8_t) '-';
+		utf8_string[ --string_index ] = (uint8_t) 'S';
+
+		string_size = LIBFWNT_SECURITY_IDENTIFIER_MAXIMUM_UTF8_STRING_SIZE - string_index;
+
+		if( string_size > ( utf8_strings_size - utf8_strings_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 strings is too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( utf8_strings[ utf8_strings_index ] ),
+		     &( utf8_string[ string_index ] ),
+		     string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string: %d.",
+			 function,
+			 security_identifier_index );
+
+			return( -1 );
+		}
+		utf8_string_offsets[ security_identifier_index ] = utf8_strings_index;
+
+		utf8_strings_index += string_size;
+	}
+	return( 1 );
+}
+
+/* Parses a decimal value from an UTF-8 string
+ * Up to 8 digits are converted at once if the string contains enough characters
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_parse_utf8_decimal(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint64_t maximum_value,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfwnt_security_identifier_parse_utf8_decimal";
+	size_t number_of_digits = 0;
+	size_t string_index     = 0;
+	uint64_t digits_64bit   = 0;
+	uint64_t value_64bit    = 0;
+	uint8_t digit           = 0;
+
+	string_index = *utf8_string_index;
+
+	if( ( utf8_string_size - string_index ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( utf8_string[ string_index ] ),
+		 digits_64bit );
+
+		/* Check if all 8 characters are in the range '0' to '9'
+		 */
+		if( ( ( digits_64bit & 0xf0f0f0f0f0f0f0f0ULL )
+		    | ( ( ( digits_64bit + 0x0606060606060606ULL ) & 0xf0f0f0f0f0f0f0f0ULL ) >> 4 ) ) == 0x3333333333333333ULL )
+		{
+			/* Combine the digits into pairs, the pairs into quads and the quads into a single value
+			 */
+			digits_64bit -= 0x3030303030303030ULL;
+			digits_64bit  = ( digits_64bit * 10 ) + ( digits_64bit >> 8 );
+			digits_64bit  = ( ( ( digits_64bit & 0x000000ff000000ffULL ) * ( 100 + ( 1000000ULL << 32 ) ) )
+			              + ( ( ( digits_64bit >> 16 ) & 0x000000ff000000ffULL ) * ( 1 + ( 10000ULL << 32 ) ) ) ) >> 32;
+
+			value_64bit       = digits_64bit & 0xffffffffUL;
+			number_of_digits  = 8;
+			string_index     += 8;
+		}
+	}
+	while( string_index < utf8_string_size )
+	{
+		digit = (uint8_t) ( utf8_string[ string_index ] - (uint8_t) '0' );
+
+		if( digit > 9 )
+		{
+			break;
+		}
+		/* A 48-bit value has at most 15 digits
+		 */
+		if( number_of_digits >= 15 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid decimal value too many digits.",
+			 function );
+
+			return( -1 );
+		}
+		value_64bit = ( value_64bit * 10 ) + digit;
+
+		number_of_digits++;
+		string_index++;
+	}
+	if( number_of_digits == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: missing decimal value at index: %" PRIzd ".",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( value_64bit > maximum_value )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid decimal value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string_index = string_index;
+	*value             = value_64bit;
+
+	return( 1 );
+}
+
+/* Parses a 48-bit hexadecimal value from an UTF-8 string
+ * The string index should point to the first hexadecimal digit after "0x"
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_parse_utf8_hexadecimal(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfwnt_security_identifier_parse_utf8_hexadecimal";
+	size_t number_of_digits = 0;
+	size_t string_index     = 0;
+	uint64_t value_64bit    = 0;
+	uint8_t character       = 0;
+
+	string_index = *utf8_string_index;
+
+	while( string_index < utf8_string_size )
+	{
+		character = utf8_string[ string_index ];
+
+		if( ( character >= (uint8_t) '0' )
+		 && ( character <= (uint8_t) '9' ) )
+		{
+			character -= (uint8_t) '0';
+		}
+		else if( ( character >= (uint8_t) 'A' )
+		      && ( character <= (uint8_t) 'F' ) )
+		{
+			character -= (uint8_t) 'A' - 10;
+		}
+		else if( ( character >= (uint8_t) 'a' )
+		      && ( character <= (uint8_t) 'f' ) )
+		{
+			character -= (uint8_t) 'a' - 10;
+		}
+		else
+		{
+			break;
+		}
+		if( number_of_digits >= 12 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid hexadecimal value exceeds 48-bit.",
+			 function );
+
+			return( -1 );
+		}
+		value_64bit = ( value_64bit << 4 ) | character;
+
+		number_of_digits++;
+		string_index++;
+	}
+	if( number_of_digits == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: missing hexadecimal value at index: %" PRIzd ".",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	*utf8_string_index = string_index;
+	*value             = value_64bit;
+
+	return( 1 );
+}
+
+/* Converts an UTF-8 string into the security identifier
+ * The string should be formatted as "S-1-" authority followed by up to 15 "-" sub authority
+ * The authority is either decimal or hexadecimal prefixed by "0x"
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_copy_from_utf8_string(
+     libfwnt_security_identifier_t *security_identifier,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfwnt_security_identifier_copy_from_utf8_string";
+	size_t utf8_string_index = 0;
+
+	if( libfwnt_security_identifier_copy_from_utf8_string_with_index(
+	     security_identifier,
+	     utf8_string,
+	     utf8_string_size,
+	     &utf8_string_index,
+	     string_format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier from UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts an UTF-8 string into the security identifier
+ * The string should be formatted as "S-1-" authority followed by up to 15 "-" sub authority
+ * The authority is either decimal or hexadecimal prefixed by "0x"
+ * The string must end with an end of string character or at the end of the string size
+ * On return the string index points after the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_copy_from_utf8_string_with_index(
+     libfwnt_security_identifier_t *security_identifier,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	uint32_t sub_authority[ 15 ];
+
+	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
+	static char *function                                                = "libfwnt_security_identifier_copy_from_utf8_string_with_index";
+	size_t string_index                                                  = 0;
+	uint64_t authority                                                   = 0;
+	uint64_t value_64bit                                                 = 0;
+	uint8_t number_of_sub_authorities                                    = 0;
+
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier = (libfwnt_internal_security_identifier_t *) security_identifier;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: UTF-8 string size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_format_flags != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format flags.",
+		 function );
+
+		return( -1 );
+	}
+	string_index = *utf8_string_index;
+
+	if( ( string_index >= utf8_string_size )
+	 || ( ( utf8_string_size - string_index ) < 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string is too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( utf8_string[ string_index ] != (uint8_t) 'S' )
+	  &&  ( utf8_string[ string_index ] != (uint8_t) 's' ) )
+	 || ( utf8_string[ string_index + 1 ] != (uint8_t) '-' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported UTF-8 string missing prefix: S-.",
+		 function );
+
+		return( -1 );
+	}
+	string_index += 2;
+
+	if( libfwnt_security_identifier_parse_utf8_decimal(
+	     utf8_string,
+	     utf8_string_size,
+	     &string_index,
+	     255,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse revision number.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported revision number: %" PRIu64 ".",
+		 function,
+		 value_64bit );
+
+		return( -1 );
+	}
+	if( ( string_index >= utf8_string_size )
+	 || ( utf8_string[ string_index ] != (uint8_t) '-' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported UTF-8 string missing authority.",
+		 function );
+
+		return( -1 );
+	}
+	string_index++;
+
+	if( ( ( utf8_string_size - string_index ) >= 2 )
+	 && ( utf8_string[ string_index ] == (uint8_t) '0' )
+	 && ( ( utf8_string[ string_index + 1 ] == (uint8_t) 'x' )
+	  ||  ( utf8_string[ string_index + 1 ] == (uint8_t) 'X' ) ) )
+	{
+		string_index += 2;
+
+		if( libfwnt_security_identifier_parse_utf8_hexadecimal(
+		     utf8_string,
+		     utf8_string_size,
+		     &string_index,
+		     &authority,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to parse authority.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( libfwnt_security_identifier_parse_utf8_decimal(
+	          utf8_string,
+	          utf8_string_size,
+	          &string_index,
+	          0xffffffffffffULL,
+	          &authority,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse authority.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( string_index < utf8_string_size )
+	    && ( utf8_string[ string_index ] == (uint8_t) '-' ) )
+	{
+		if( number_of_sub_authorities >= 15 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported security identifier contains more than 15 sub authoritites.",
+			 function );
+
+			return( -1 );
+		}
+		string_index++;
+
+		if( libfwnt_security_identifier_parse_utf8_decimal(
+		     utf8_string,
+		     utf8_string_size,
+		     &string_index,
+		     (uint64_t) UINT32_MAX,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to parse sub authority: %" PRIu8 ".",
+			 function,
+			 number_of_sub_authorities );
+
+			return( -1 );
+		}
+		sub_authority[ number_of_sub_authorities++ ] = (uint32_t) value_64bit;
+	}
+	if( string_index < utf8_string_size )
+	{
+		if( utf8_string[ string_index ] != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character: 0x%02" PRIx8 " at index: %" PRIzd ".",
+			 function,
+			 utf8_string[ string_index ],
+			 string_index );
+
+			return( -1 );
+		}
+		string_index++;
+	}
+	/* Only change the security identifier after the whole string was parsed successfully
+	 */
+	internal_security_identifier->revision_number           = 1;
+	internal_security_identifier->number_of_sub_authorities = number_of_sub_authorities;
+	internal_security_identifier->authority                 = authority;
+
+	if( number_of_sub_authorities > 0 )
+	{
+		if( memory_copy(
+		     internal_security_identifier->sub_authority,
+		     sub_authority,
+		     sizeof( uint32_t ) * number_of_sub_authorities ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sub authorities.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*utf8_string_index = string_index;
+
+	return( 1 );
+}
+
+/* Converts an UTF-16 string into the security identifier
+ * The string should be formatted as "S-1-" authority followed by up to 15 "-" sub authority
+ * The authority is either decimal or hexadecimal prefixed by "0x"
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_copy_from_utf16_string(
+     libfwnt_security_identifier_t *security_identifier,
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfwnt_security_identifier_copy_from_utf16_string";
+	size_t utf16_string_index = 0;
+
+	if( libfwnt_security_identifier_copy_from_utf16_string_with_index(
+	     security_identifier,
+	     utf16_string,
+	     utf16_string_size,
+	     &utf16_string_index,
+	     string_format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier from UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts an UTF-16 string into the security identifier
+ * The string should be formatted as "S-1-" authority followed by up to 15 "-" sub authority
+ * The authority is either decimal or hexadecimal prefixed by "0x"
+ * The string must end with an end of string character or at the end of the string size
+ * On return the string index points after the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_copy_from_utf16_string_with_index(
+     libfwnt_security_identifier_t *security_identifier,
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_string[ LIBFWNT_SECURITY_IDENTIFIER_MAXIMUM_PARSE_STRING_SIZE ];
+
+	static char *function    = "libfwnt_security_identifier_copy_from_utf16_string_with_index";
+	size_t string_index      = 0;
+	size_t utf8_string_index = 0;
+	size_t utf8_string_size  = 0;
+	uint16_t character       = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: UTF-16 string size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string index.",
+		 function );
+
+		return( -1 );
+	}
+	/* A security identifier string only contains ASCII characters, hence the
+	 * UTF-16 string is narrowed so that it can be parsed as an UTF-8 string
+	 * Characters outside the ASCII range are mapped to 0xff, which is invalid
+	 * A string that does not fit in the buffer is never a valid security identifier
+	 */
+	string_index = *utf16_string_index;
+
+	while( ( string_index < utf16_string_size )
+	    && ( utf8_string_size < LIBFWNT_SECURITY_IDENTIFIER_MAXIMUM_PARSE_STRING_SIZE ) )
+	{
+		character = utf16_string[ string_index++ ];
+
+		if( character < 0x0080 )
+		{
+			utf8_string[ utf8_string_size++ ] = (uint8_t) character;
+		}
+		else
+		{
+			utf8_string[ utf8_string_size++ ] = 0xff;
+		}
+		if( character == 0 )
+		{
+			break;
+		}
+	}
+	if( libfwnt_security_identifier_copy_from_utf8_string_with_index(
+	     security_identifier,
+	     utf8_string,
+	     utf8_string_size,
+	     &utf8_string_index,
+	     string_format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier from narrowed UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	*utf16_string_index += utf8_string_index;
+
+	return( 1 );
+}
+
@@ -53,6 +53,17 @@ extern "C" {
  * The maximum number of sub authorities seems to be 15.
  */
 
+/* The maximum size of an UTF-8 formatted SID including the end of string character
+ * "S-" 255 "-" 48-bit authority and 15 "-" 32-bit sub authorities
+ */
+#define LIBFWNT_SECURITY_IDENTIFIER_MAXIMUM_UTF8_STRING_SIZE	192
+
+/* The maximum size of a SID string that can be parsed including the end of string character
+ * Every value can have up to 15 digits since leading zeros are allowed
+ * "S-" 15 digits "-" 15 digits and 15 "-" 15 digits
+ */
+#define LIBFWNT_SECURITY_IDENTIFIER_MAXIMUM_PARSE_STRING_SIZE	274
+
 typedef struct libfwnt_internal_security_identifier libfwnt_internal_security_identifier_t;
 
 struct libfwnt_internal_security_identifier
@@ -76,6 +87,10 @@ struct libfwnt_internal_security_identifier
 	/* Value to indicate if the identifier is managed by the descriptor
 	 */
 	uint8_t is_managed;
+
+	/* The arena the security identifier is allocated from
+	 */
+	libfwnt_arena_t *arena;
 };
 
 LIBFWNT_EXTERN \
@@ -83,6 +98,11 @@ int libfwnt_security_identifier_initialize(
      libfwnt_security_identifier_t **security_identifier,
      libcerror_error_t **error );
 
+int libfwnt_security_identifier_initialize_with_arena(
+     libfwnt_security_identifier_t **security_identifier,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_security_identifier_free(
      libfwnt_security_identifier_t **security_identifier,
@@ -100,6 +120,24 @@ int libfwnt_security_identifier_copy_from_byte_stream(
      int byte_order,
      libcerror_error_t **error );
 
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_get_byte_stream_size(
+     libfwnt_security_identifier_t *security_identifier,
+     size_t *byte_stream_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_copy_to_byte_stream(
+     libfwnt_security_identifier_t *security_identifier,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
+uint32_t libfwnt_security_identifier_calculate_hash(
+          const uint8_t *byte_stream,
+          size_t byte_stream_size );
+
 LIBFWNT_EXTERN \
 int libfwnt_security_identifier_get_string_size(
      libfwnt_security_identifier_t *security_identifier,
@@ -158,6 +196,84 @@ int libfwnt_security_identifier_copy_to_utf32_string_with_index(
      uint32_t string_format_flags,
      libcerror_error_t **error );
 
+size_t libfwnt_security_identifier_get_number_of_decimal_digits(
+        uint64_t value );
+
+size_t libfwnt_security_identifier_format_decimal(
+        uint64_t value,
+        uint8_t *string,
+        size_t string_index );
+
+size_t libfwnt_internal_security_identifier_get_utf8_string_size(
+        libfwnt_internal_security_identifier_t *internal_security_identifier );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_get_utf8_strings_size(
+     libfwnt_security_identifier_t **security_identifiers,
+     int number_of_security_identifiers,
+     size_t *utf8_strings_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_copy_to_utf8_strings(
+     libfwnt_security_identifier_t **security_identifiers,
+     int number_of_security_identifiers,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     size_t *utf8_string_offsets,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+int libfwnt_security_identifier_parse_utf8_decimal(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint64_t maximum_value,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int libfwnt_security_identifier_parse_utf8_hexadecimal(
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_copy_from_utf8_string(
+     libfwnt_security_identifier_t *security_identifier,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_copy_from_utf8_string_with_index(
+     libfwnt_security_identifier_t *security_identifier,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_copy_from_utf16_string(
+     libfwnt_security_identifier_t *security_identifier,
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_copy_from_utf16_string_with_index(
+     libfwnt_security_identifier_t *security_identifier,
+     const uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1133 @@
+/*
+ * Windows NT Security Identifier (SID) table functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_libcthreads.h"
+#include "libfwnt_security_identifier.h"
+#include "libfwnt_security_identifier_table.h"
+#include "libfwnt_security_identifier_view.h"
+#include "libfwnt_types.h"
+
+/* Creates a security identifier table
+ * Make sure the value security_identifier_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_table_initialize(
+     libfwnt_security_identifier_table_t **security_identifier_table,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_table_t *internal_security_identifier_table = NULL;
+	static char *function                                                            = "libfwnt_security_identifier_table_initialize";
+
+	if( security_identifier_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_identifier_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security identifier table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier_table = memory_allocate_structure(
+	                                     libfwnt_internal_security_identifier_table_t );
+
+	if( internal_security_identifier_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create security identifier table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_security_identifier_table,
+	     0,
+	     sizeof( libfwnt_internal_security_identifier_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear security identifier table.",
+		 function );
+
+		memory_free(
+		 internal_security_identifier_table );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_security_identifier_table->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*security_identifier_table = (libfwnt_security_identifier_table_t *) internal_security_identifier_table;
+
+	return( 1 );
+
+on_error:
+	if( internal_security_identifier_table != NULL )
+	{
+		memory_free(
+		 internal_security_identifier_table );
+	}
+	return( -1 );
+}
+
+/* Frees a security identifier table
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_table_free(
+     libfwnt_security_identifier_table_t **security_identifier_table,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_table_t *internal_security_identifier_table = NULL;
+	static char *function                                                            = "libfwnt_security_identifier_table_free";
+	uint32_t entries_block_index                                                     = 0;
+	int result                                                                       = 1;
+
+	if( security_identifier_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_identifier_table != NULL )
+	{
+		internal_security_identifier_table = (libfwnt_internal_security_identifier_table_t *) *security_identifier_table;
+		*security_identifier_table         = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_security_identifier_table->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( internal_security_identifier_table->entries_blocks != NULL )
+		{
+			for( entries_block_index = 0;
+			     entries_block_index < internal_security_identifier_table->number_of_entries_blocks;
+			     entries_block_index++ )
+			{
+				if( internal_security_identifier_table->entries_blocks[ entries_block_index ] != NULL )
+				{
+					memory_free(
+					 internal_security_identifier_table->entries_blocks[ entries_block_index ] );
+				}
+			}
+			memory_free(
+			 internal_security_identifier_table->entries_blocks );
+		}
+		if( internal_security_identifier_table->slots != NULL )
+		{
+			memory_free(
+			 internal_security_identifier_table->slots );
+		}
+		memory_free(
+		 internal_security_identifier_table );
+	}
+	return( result );
+}
+
+/* Retrieves the identifier of security identifier data
+ * The caller must hold the read/write lock
+ * Returns 1 if successful or 0 if the security identifier is not in the table
+ */
+int libfwnt_internal_security_identifier_table_get_identifier_by_data(
+     libfwnt_internal_security_identifier_table_t *internal_security_identifier_table,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t hash,
+     uint32_t *identifier )
+{
+	libfwnt_security_identifier_table_entry_t *entry = NULL;
+	uint32_t entry_identifier                        = 0;
+	uint32_t slot_index                              = 0;
+
+	if( internal_security_identifier_table->number_of_slots == 0 )
+	{
+		return( 0 );
+	}
+	slot_index = hash & ( internal_security_identifier_table->number_of_slots - 1 );
+
+	/* The hash table is at most half full so an unused slot always ends the probe sequence
+	 */
+	while( internal_security_identifier_table->slots[ slot_index ] != 0 )
+	{
+		entry_identifier = internal_security_identifier_table->slots[ slot_index ] - 1;
+
+		entry = &( internal_security_identifier_table->entries_blocks[ entry_identifier / LIBFWNT_SECURITY_IDENTIFIER_TABLE_ENTRIES_BLOCK_SIZE ][ entry_identifier % LIBFWNT_SECURITY_IDENTIFIER_TABLE_ENTRIES_BLOCK_SIZE ] );
+
+		if( ( entry->hash == hash )
+		 && ( entry->data_size == data_size )
+		 && ( memory_compare(
+		       entry->data,
+		       data,
+		       data_size ) == 0 ) )
+		{
+			*identifier = entry_identifier;
+
+			return( 1 );
+		}
+		slot_index = ( slot_index + 1 ) & ( internal_security_identifier_table->number_of_slots - 1 );
+	}
+	return( 0 );
+}
+
+/* Inserts security identifier data into the table
+ * The caller must hold the read/write lock for writing and have determined
+ * that the security identifier is not in the table
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_security_identifier_table_insert_entry(
+     libfwnt_internal_security_identifier_table_t *internal_security_identifier_table,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t hash,
+     uint32_t *identifier,
+     libcerror_error_t **error )
+{
+	libfwnt_security_identifier_table_entry_t **entries_blocks = NULL;
+	libfwnt_security_identifier_table_entry_t *entries_block   = NULL;
+	libfwnt_security_identifier_table_entry_t *entry           = NULL;
+	static char *function                                      = "libfwnt_internal_security_identifier_table_insert_entry";
+	uint32_t *slots                                            = NULL;
+	uint32_t entries_block_index                               = 0;
+	uint32_t entry_identifier                                  = 0;
+	uint32_t number_of_entries_blocks                          = 0;
+	uint32_t number_of_slots                                   = 0;
+	uint32_t slot_index                                        = 0;
+
+	if( internal_security_identifier_table->number_of_entries >= LIBFWNT_SECURITY_IDENTIFIER_TABLE_MAXIMUM_NUMBER_OF_ENTRIES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid security identifier table - number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	entries_block_index = internal_security_identifier_table->number_of_entries / LIBFWNT_SECURITY_IDENTIFIER_TABLE_ENTRIES_BLOCK_SIZE;
+
+	/* The entries blocks array is grown, the entries blocks themselves are never moved
+	 */
+	if( entries_block_index >= internal_security_identifier_table->number_of_entries_blocks )
+	{
+		number_of_entries_blocks = internal_security_identifier_table->number_of_entries_blocks * 2;
+
+		if( number_of_entries_blocks < 16 )
+		{
+			number_of_entries_blocks = 16;
+		}
+		entries_blocks = (libfwnt_security_identifier_table_entry_t **) memory_reallocate(
+		                  internal_security_identifier_table->entries_blocks,
+		                  sizeof( libfwnt_security_identifier_table_entry_t * ) * number_of_entries_blocks );
+
+		if( entries_blocks == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries blocks.",
+			 function );
+
+			return( -1 );
+		}
+		internal_security_identifier_table->entries_blocks = entries_blocks;
+
+		if( memory_set(
+		     &( entries_blocks[ internal_security_identifier_table->number_of_entries_blocks ] ),
+		     0,
+		     sizeof( libfwnt_security_identifier_table_entry_t * ) * ( number_of_entries_blocks - internal_security_identifier_table->number_of_entries_blocks ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entries blocks.",
+			 function );
+
+			return( -1 );
+		}
+		internal_security_identifier_table->number_of_entries_blocks = number_of_entries_blocks;
+	}
+	if( internal_security_identifier_table->entries_blocks[ entries_block_index ] == NULL )
+	{
+		entries_block = (libfwnt_security_identifier_table_entry_t *) memory_allocate(
+		                 sizeof( libfwnt_security_identifier_table_entry_t ) * LIBFWNT_SECURITY_IDENTIFIER_TABLE_ENTRIES_BLOCK_SIZE );
+
+		if( entries_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries block.",
+			 function );
+
+			return( -1 );
+		}
+		internal_security_identifier_table->entries_blocks[ entries_block_index ] = entries_block;
+	}
+	/* Keep the hash table at most half full so that probe sequences stay short
+	 */
+	if( ( internal_security_identifier_table->number_of_entries + 1 ) * 2 > internal_security_identifier_table->number_of_slots )
+	{
+		number_of_slots = internal_security_identifier_table->number_of_slots * 2;
+
+		if( number_of_slots < 64 )
+		{
+			number_of_slots = 64;
+		}
+		slots = (uint32_t *) memory_allocate(
+		                      sizeof( uint32_t ) * number_of_slots );
+
+		if( slots == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create slots.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     slots,
+		     0,
+		     sizeof( uint32_t ) * number_of_slots ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear slots.",
+			 function );
+
+			memory_free(
+			 slots );
+
+			return( -1 );
+		}
+		for( entry_identifier = 0;
+		     entry_identifier < internal_security_identifier_table->number_of_entries;
+		     entry_identifier++ )
+		{
+			entry = &( internal_security_identifier_table->entries_blocks[ entry_identifier / LIBFWNT_SECURITY_IDENTIFIER_TABLE_ENTRIES_BLOCK_SIZE ][ entry_identifier % LIBFWNT_SECURITY_IDENTIFIER_TABLE_ENTRIES_BLOCK_SIZE ] );
+
+			slot_index = entry->hash & ( number_of_slots - 1 );
+
+			while( slots[ slot_index ] != 0 )
+			{
+				slot_index = ( slot_index + 1 ) & ( number_of_slots - 1 );
+			}
+			slots[ slot_index ] = entry_identifier + 1;
+		}
+		if( internal_security_identifier_table->slots != NULL )
+		{
+			memory_free(
+			 internal_security_identifier_table->slots );
+		}
+		internal_security_identifier_table->slots           = slots;
+		internal_security_identifier_table->number_of_slots = number_of_slots;
+	}
+	entry_identifier = internal_security_identifier_table->number_of_entries;
+
+	entry = &( internal_security_identifier_table->entries_blocks[ entries_block_index ][ entry_identifier % LIBFWNT_SECURITY_IDENTIFIER_TABLE_ENTRIES_BLOCK_SIZE ] );
+
+	if( memory_copy(
+	     entry->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier data.",
+		 function );
+
+		return( -1 );
+	}
+	entry->hash      = hash;
+	entry->data_size = data_size;
+
+	slot_index = hash & ( internal_security_identifier_table->number_of_slots - 1 );
+
+	while( internal_security_identifier_table->slots[ slot_index ] != 0 )
+	{
+		slot_index = ( slot_index + 1 ) & ( internal_security_identifier_table->number_of_slots - 1 );
+	}
+	internal_security_identifier_table->slots[ slot_index ] = entry_identifier + 1;
+
+	internal_security_identifier_table->number_of_entries += 1;
+
+	*identifier = entry_identifier;
+
+	return( 1 );
+}
+
+/* Interns security identifier data
+ * A security identifier that is already in the table is looked up while holding the
+ * read/write lock for reading, so that concurrent lookups of known security identifiers
+ * do not block each other
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_security_identifier_table_intern_data(
+     libfwnt_internal_security_identifier_table_t *internal_security_identifier_table,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_internal_security_identifier_table_intern_data";
+	uint32_t hash         = 0;
+	int result            = 0;
+
+	if( internal_security_identifier_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier table.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 8 )
+	 || ( data_size > LIBFWNT_SECURITY_IDENTIFIER_TABLE_MAXIMUM_DATA_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libfwnt_security_identifier_calculate_hash(
+	        data,
+	        data_size );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_security_identifier_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfwnt_internal_security_identifier_table_get_identifier_by_data(
+	          internal_security_identifier_table,
+	          data,
+	          data_size,
+	          hash,
+	          identifier );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_security_identifier_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_security_identifier_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have inserted the security identifier after the read/write lock was released
+	 */
+	result = libfwnt_internal_security_identifier_table_get_identifier_by_data(
+	          internal_security_identifier_table,
+	          data,
+	          data_size,
+	          hash,
+	          identifier );
+
+	if( result == 0 )
+	{
+		result = libfwnt_internal_security_identifier_table_insert_entry(
+		          internal_security_identifier_table,
+		          data,
+		          data_size,
+		          hash,
+		          identifier,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert security identifier.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_security_identifier_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_security_identifier_table->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Interns a security identifier (SID)
+ * A security identifier that is not yet in the table is assigned the next identifier,
+ * otherwise the identifier it was assigned before is returned
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_table_intern_security_identifier(
+     libfwnt_security_identifier_table_t *security_identifier_table,
+     libfwnt_security_identifier_t *security_identifier,
+     uint32_t *identifier,
+     libcerror_error_t **error )
+{
+	uint8_t data[ LIBFWNT_SECURITY_IDENTIFIER_TABLE_MAXIMUM_DATA_SIZE ];
+
+	libfwnt_internal_security_identifier_table_t *internal_security_identifier_table = NULL;
+	static char *function                                                            = "libfwnt_security_identifier_table_intern_security_identifier";
+	size_t data_size                                                                 = 0;
+
+	if( security_identifier_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier_table = (libfwnt_internal_security_identifier_table_t *) security_identifier_table;
+
+	if( libfwnt_security_identifier_get_byte_stream_size(
+	     security_identifier,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve security identifier data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_copy_to_byte_stream(
+	     security_identifier,
+	     data,
+	     LIBFWNT_SECURITY_IDENTIFIER_TABLE_MAXIMUM_DATA_SIZE,
+	     LIBFWNT_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_security_identifier_table_intern_data(
+	     internal_security_identifier_table,
+	     data,
+	     data_size,
+	     identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to intern security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Interns a security identifier (SID) stored in a byte stream
+ * The byte stream can contain trailing data, for example the byte stream of
+ * an access control entry (ACE) starting at its security identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_table_intern_byte_stream(
+     libfwnt_security_identifier_table_t *security_identifier_table,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     uint32_t *identifier,
+     libcerror_error_t **error )
+{
+	libfwnt_security_identifier_view_t security_identifier_view;
+
+	libfwnt_internal_security_identifier_table_t *internal_security_identifier_table = NULL;
+	static char *function                                                            = "libfwnt_security_identifier_table_intern_byte_stream";
+
+	if( security_identifier_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier_table = (libfwnt_internal_security_identifier_table_t *) security_identifier_table;
+
+	if( libfwnt_security_identifier_view_set_from_byte_stream(
+	     &security_identifier_view,
+	     byte_stream,
+	     byte_stream_size,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set security identifier view.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_security_identifier_table_intern_data(
+	     internal_security_identifier_table,
+	     security_identifier_view.data,
+	     security_identifier_view.data_size,
+	     identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to intern security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the identifier of a security identifier (SID) without interning it
+ * Returns 1 if successful, 0 if the security identifier is not in the table or -1 on error
+ */
+int libfwnt_security_identifier_table_get_identifier(
+     libfwnt_security_identifier_table_t *security_identifier_table,
+     libfwnt_security_identifier_t *security_identifier,
+     uint32_t *identifier,
+     libcerror_error_t **error )
+{
+	uint8_t data[ LIBFWNT_SECURITY_IDENTIFIER_TABLE_MAXIMUM_DATA_SIZE ];
+
+	libfwnt_internal_security_identifier_table_t *internal_security_identifier_table = NULL;
+	static char *function                                                            = "libfwnt_security_identifier_table_get_identifier";
+	size_t data_size                                                                 = 0;
+	uint32_t hash                                                                    = 0;
+	int result                                                                       = 0;
+
+	if( security_identifier_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier_table = (libfwnt_internal_security_identifier_table_t *) security_identifier_table;
+
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_get_byte_stream_size(
+	     security_identifier,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve security identifier data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_copy_to_byte_stream(
+	     security_identifier,
+	     data,
+	     LIBFWNT_SECURITY_IDENTIFIER_TABLE_MAXIMUM_DATA_SIZE,
+	     LIBFWNT_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier data.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libfwnt_security_identifier_calculate_hash(
+	        data,
+	        data_size );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_security_identifier_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfwnt_internal_security_identifier_table_get_identifier_by_data(
+	          internal_security_identifier_table,
+	          data,
+	          data_size,
+	          hash,
+	          identifier );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_security_identifier_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of security identifiers (SIDs) in the table
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_table_get_number_of_security_identifiers(
+     libfwnt_security_identifier_table_t *security_identifier_table,
+     int *number_of_security_identifiers,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_table_t *internal_security_identifier_table = NULL;
+	static char *function                                                            = "libfwnt_security_identifier_table_get_number_of_security_identifiers";
+
+	if( security_identifier_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier_table = (libfwnt_internal_security_identifier_table_t *) security_identifier_table;
+
+	if( number_of_security_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of security identifiers.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_security_identifier_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_security_identifiers = (int) internal_security_identifier_table->number_of_entries;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_security_identifier_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a security identifier (SID) view by identifier
+ * The view references the data of the table and remains valid until the table is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_table_get_security_identifier_view_by_identifier(
+     libfwnt_security_identifier_table_t *security_identifier_table,
+     uint32_t identifier,
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_table_t *internal_security_identifier_table = NULL;
+	libfwnt_security_identifier_table_entry_t *entry                                 = NULL;
+	static char *function                                                            = "libfwnt_security_identifier_table_get_security_identifier_view_by_identifier";
+	int result                                                                       = 1;
+
+	if( security_identifier_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier_table = (libfwnt_internal_security_identifier_table_t *) security_identifier_table;
+
+	if( security_identifier_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier view.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_security_identifier_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( identifier >= internal_security_identifier_table->number_of_entries )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid identifier value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		entry = &( internal_security_identifier_table->entries_blocks[ identifier / LIBFWNT_SECURITY_IDENTIFIER_TABLE_ENTRIES_BLOCK_SIZE ][ identifier % LIBFWNT_SECURITY_IDENTIFIER_TABLE_ENTRIES_BLOCK_SIZE ] );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_security_identifier_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( entry != NULL )
+	{
+		security_identifier_view->data      = entry->data;
+		security_identifier_view->data_size = entry->data_size;
+	}
+	return( result );
+}
+
+/* Retrieves a security identifier (SID) by identifier
+ * The security identifier is created and must be freed by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_table_get_security_identifier_by_identifier(
+     libfwnt_security_identifier_table_t *security_identifier_table,
+     uint32_t identifier,
+     libfwnt_security_identifier_t **security_identifier,
+     libcerror_error_t **error )
+{
+	libfwnt_security_identifier_view_t security_identifier_view;
+
+	libfwnt_security_identifier_t *safe_security_identifier = NULL;
+	static char *function                                   = "libfwnt_security_identifier_table_get_security_identifier_by_identifier";
+
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_identifier != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security identifier value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_table_get_security_identifier_view_by_identifier(
+	     security_identifier_table,
+	     identifier,
+	     &security_identifier_view,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve security identifier: %" PRIu32 " view.",
+		 function,
+		 identifier );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_initialize(
+	     &safe_security_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create security identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwnt_security_identifier_copy_from_byte_stream(
+	     safe_security_identifier,
+	     security_identifier_view.data,
+	     security_identifier_view.data_size,
+	     LIBFWNT_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier from byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	*security_identifier = safe_security_identifier;
+
+	return( 1 );
+
+on_error:
+	if( safe_security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &safe_security_identifier,
+		 NULL );
+	}
+	return( -1 );
+}
+
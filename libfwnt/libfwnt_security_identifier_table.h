@@ -0,0 +1,188 @@
+/*
+ * Windows NT Security Identifier (SID) table functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_SECURITY_IDENTIFIER_TABLE_H )
+#define _LIBFWNT_SECURITY_IDENTIFIER_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_libcthreads.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The security identifier table interns security identifiers (SIDs), every
+ * distinct SID is assigned a dense 32-bit identifier in order of insertion,
+ * starting at 0
+ *
+ * The SIDs are stored in their binary form in blocks that are never moved,
+ * so that a SID view retrieved by identifier remains valid until the table
+ * is freed. The identifiers are looked up by an open addressing hash table
+ * of the binary form.
+ */
+
+/* The maximum size of the binary form of a SID
+ * 8 bytes header and 15 32-bit sub authorities
+ */
+#define LIBFWNT_SECURITY_IDENTIFIER_TABLE_MAXIMUM_DATA_SIZE		68
+
+/* The number of entries in an entries block
+ */
+#define LIBFWNT_SECURITY_IDENTIFIER_TABLE_ENTRIES_BLOCK_SIZE		1024
+
+/* The maximum number of entries, which keeps the number of hash table slots within 32-bit
+ */
+#define LIBFWNT_SECURITY_IDENTIFIER_TABLE_MAXIMUM_NUMBER_OF_ENTRIES	0x40000000UL
+
+typedef struct libfwnt_security_identifier_table_entry libfwnt_security_identifier_table_entry_t;
+
+struct libfwnt_security_identifier_table_entry
+{
+	/* The hash of the security identifier data
+	 */
+	uint32_t hash;
+
+	/* The security identifier data size
+	 */
+	size_t data_size;
+
+	/* The security identifier data
+	 */
+	uint8_t data[ LIBFWNT_SECURITY_IDENTIFIER_TABLE_MAXIMUM_DATA_SIZE ];
+};
+
+typedef struct libfwnt_internal_security_identifier_table libfwnt_internal_security_identifier_table_t;
+
+struct libfwnt_internal_security_identifier_table
+{
+	/* The entries blocks
+	 */
+	libfwnt_security_identifier_table_entry_t **entries_blocks;
+
+	/* The number of allocated entries blocks
+	 */
+	uint32_t number_of_entries_blocks;
+
+	/* The number of entries, which is the next identifier
+	 */
+	uint32_t number_of_entries;
+
+	/* The hash table slots, a slot contains the identifier + 1 or 0 if not used
+	 */
+	uint32_t *slots;
+
+	/* The number of hash table slots, which is a power of 2
+	 */
+	uint32_t number_of_slots;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_table_initialize(
+     libfwnt_security_identifier_table_t **security_identifier_table,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_table_free(
+     libfwnt_security_identifier_table_t **security_identifier_table,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_identifier_table_get_identifier_by_data(
+     libfwnt_internal_security_identifier_table_t *internal_security_identifier_table,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t hash,
+     uint32_t *identifier );
+
+int libfwnt_internal_security_identifier_table_insert_entry(
+     libfwnt_internal_security_identifier_table_t *internal_security_identifier_table,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t hash,
+     uint32_t *identifier,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_identifier_table_intern_data(
+     libfwnt_internal_security_identifier_table_t *internal_security_identifier_table,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_table_intern_security_identifier(
+     libfwnt_security_identifier_table_t *security_identifier_table,
+     libfwnt_security_identifier_t *security_identifier,
+     uint32_t *identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_table_intern_byte_stream(
+     libfwnt_security_identifier_table_t *security_identifier_table,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     uint32_t *identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_table_get_identifier(
+     libfwnt_security_identifier_table_t *security_identifier_table,
+     libfwnt_security_identifier_t *security_identifier,
+     uint32_t *identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_table_get_number_of_security_identifiers(
+     libfwnt_security_identifier_table_t *security_identifier_table,
+     int *number_of_security_identifiers,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_table_get_security_identifier_view_by_identifier(
+     libfwnt_security_identifier_table_t *security_identifier_table,
+     uint32_t identifier,
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_table_get_security_identifier_by_identifier(
+     libfwnt_security_identifier_table_t *security_identifier_table,
+     uint32_t identifier,
+     libfwnt_security_identifier_t **security_identifier,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_SECURITY_IDENTIFIER_TABLE_H ) */
+
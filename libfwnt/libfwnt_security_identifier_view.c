@@ -0,0 +1,347 @@
+/*
+ * Windows NT Security Identifier (SID) view functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_security_identifier_view.h"
+#include "libfwnt_types.h"
+
+/* Sets a security identifier view from a byte stream
+ * The byte stream is validated but not copied, the view references the byte stream
+ * The byte stream can contain trailing data, the view only covers the security identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_view_set_from_byte_stream(
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfwnt_security_identifier_view_set_from_byte_stream";
+	size_t security_identifier_size = 0;
+
+	if( security_identifier_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier view.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream[ 1 ] > 15 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported security identifier contains more than 15 sub authoritites.",
+		 function );
+
+		return( -1 );
+	}
+	security_identifier_size = 8 + ( (size_t) byte_stream[ 1 ] * 4 );
+
+	if( security_identifier_size > byte_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	security_identifier_view->data      = byte_stream;
+	security_identifier_view->data_size = security_identifier_size;
+
+	return( 1 );
+}
+
+/* Retrieves the revision number
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_view_get_revision_number(
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     uint8_t *revision_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_identifier_view_get_revision_number";
+
+	if( security_identifier_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( security_identifier_view->data == NULL )
+	 || ( security_identifier_view->data_size < 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security identifier view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( revision_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid revision number.",
+		 function );
+
+		return( -1 );
+	}
+	*revision_number = security_identifier_view->data[ 0 ];
+
+	return( 1 );
+}
+
+/* Retrieves the authority
+ * The authority is stored as a 48-bit big-endian value
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_view_get_authority(
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     uint64_t *authority,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_identifier_view_get_authority";
+
+	if( security_identifier_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( security_identifier_view->data == NULL )
+	 || ( security_identifier_view->data_size < 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security identifier view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( authority == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid authority.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint48_big_endian(
+	 &( security_identifier_view->data[ 2 ] ),
+	 *authority );
+
+	return( 1 );
+}
+
+/* Retrieves the number of sub authorities
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_view_get_number_of_sub_authorities(
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     uint8_t *number_of_sub_authorities,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_identifier_view_get_number_of_sub_authorities";
+
+	if( security_identifier_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( security_identifier_view->data == NULL )
+	 || ( security_identifier_view->data_size < 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security identifier view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_authorities == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sub authorities.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_sub_authorities = security_identifier_view->data[ 1 ];
+
+	return( 1 );
+}
+
+/* Retrieves a specific sub authority
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_view_get_sub_authority_by_index(
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     uint8_t sub_authority_index,
+     uint32_t *sub_authority,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfwnt_security_identifier_view_get_sub_authority_by_index";
+	size_t sub_authority_offset = 0;
+
+	if( security_identifier_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier view.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( security_identifier_view->data == NULL )
+	 || ( security_identifier_view->data_size < 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security identifier view - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	sub_authority_offset = 8 + ( (size_t) sub_authority_index * 4 );
+
+	if( ( sub_authority_index >= security_identifier_view->data[ 1 ] )
+	 || ( ( sub_authority_offset + 4 ) > security_identifier_view->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub authority index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_authority == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub authority.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( security_identifier_view->data[ sub_authority_offset ] ),
+	 *sub_authority );
+
+	return( 1 );
+}
+
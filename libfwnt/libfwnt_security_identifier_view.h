@@ -0,0 +1,74 @@
+/*
+ * Windows NT Security Identifier (SID) view functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_SECURITY_IDENTIFIER_VIEW_H )
+#define _LIBFWNT_SECURITY_IDENTIFIER_VIEW_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_view_set_from_byte_stream(
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_view_get_revision_number(
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     uint8_t *revision_number,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_view_get_authority(
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     uint64_t *authority,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_view_get_number_of_sub_authorities(
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     uint8_t *number_of_sub_authorities,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_view_get_sub_authority_by_index(
+     libfwnt_security_identifier_view_t *security_identifier_view,
+     uint8_t sub_authority_index,
+     uint32_t *sub_authority,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_SECURITY_IDENTIFIER_VIEW_H ) */
+
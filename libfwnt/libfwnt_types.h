@@ -27,26 +27,167 @@
 
 /* Define HAVE_LOCAL_LIBFWNT for local use of libfwnt
  * The definitions in <libfwnt/types.h> are copied here
- * for local use of libfwnt
+ * for local use of libfwnt, tests/fwnt_test_types.c checks
+ * at compile time that the layout of the copied structures matches
  */
 #if defined( HAVE_LOCAL_LIBFWNT )
 
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libfwnt_arena {}			libfwnt_arena_t;
 typedef struct libfwnt_access_control_entry {}	libfwnt_access_control_entry_t;
 typedef struct libfwnt_access_control_list {}	libfwnt_access_control_list_t;
+typedef struct libfwnt_access_token {}		libfwnt_access_token_t;
+typedef struct libfwnt_lznt1_stream_decoder {}	libfwnt_lznt1_stream_decoder_t;
+typedef struct libfwnt_lzx_decoder {}		libfwnt_lzx_decoder_t;
+typedef struct libfwnt_lzx_stream_decoder {}	libfwnt_lzx_stream_decoder_t;
 typedef struct libfwnt_security_descriptor {}	libfwnt_security_descriptor_t;
+typedef struct libfwnt_security_descriptor_cache {}	libfwnt_security_descriptor_cache_t;
+typedef struct libfwnt_security_descriptor_stream {}	libfwnt_security_descriptor_stream_t;
 typedef struct libfwnt_security_identifier {}	libfwnt_security_identifier_t;
+typedef struct libfwnt_security_identifier_table {}	libfwnt_security_identifier_table_t;
 
 #else
+typedef intptr_t libfwnt_arena_t;
 typedef intptr_t libfwnt_access_control_entry_t;
 typedef intptr_t libfwnt_access_control_list_t;
+typedef intptr_t libfwnt_access_token_t;
+typedef intptr_t libfwnt_lznt1_stream_decoder_t;
+typedef intptr_t libfwnt_lzx_decoder_t;
+typedef intptr_t libfwnt_lzx_stream_decoder_t;
 typedef intptr_t libfwnt_security_descriptor_t;
+typedef intptr_t libfwnt_security_descriptor_cache_t;
+typedef intptr_t libfwnt_security_descriptor_stream_t;
 typedef intptr_t libfwnt_security_identifier_t;
+typedef intptr_t libfwnt_security_identifier_table_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The following type definitions are views of data in a buffer that is owned by the caller
+ */
+typedef struct libfwnt_access_control_entry_view libfwnt_access_control_entry_view_t;
+
+struct libfwnt_access_control_entry_view
+{
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+typedef struct libfwnt_access_control_list_builder libfwnt_access_control_list_builder_t;
+
+struct libfwnt_access_control_list_builder
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size, which is the size of the access control list built so far
+	 */
+	size_t data_size;
+
+	/* The maximum data size, which is the size of the buffer
+	 */
+	size_t maximum_data_size;
+
+	/* The number of entries
+	 */
+	uint16_t number_of_entries;
+};
+
+typedef struct libfwnt_access_control_list_view libfwnt_access_control_list_view_t;
+
+struct libfwnt_access_control_list_view
+{
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+typedef struct libfwnt_security_descriptor_layout libfwnt_security_descriptor_layout_t;
+
+struct libfwnt_security_descriptor_layout
+{
+	/* The revision number
+	 */
+	uint8_t revision_number;
+
+	/* The control flags
+	 */
+	uint16_t control_flags;
+
+	/* The owner security identifier (SID) offset, 0 if not present
+	 */
+	uint32_t owner_sid_offset;
+
+	/* The owner security identifier (SID) size
+	 */
+	uint32_t owner_sid_size;
+
+	/* The group security identifier (SID) offset, 0 if not present
+	 */
+	uint32_t group_sid_offset;
+
+	/* The group security identifier (SID) size
+	 */
+	uint32_t group_sid_size;
+
+	/* The system access control list (SACL) offset, 0 if not present
+	 */
+	uint32_t system_acl_offset;
+
+	/* The system access control list (SACL) size
+	 */
+	uint32_t system_acl_size;
+
+	/* The discretionary access control list (DACL) offset, 0 if not present
+	 */
+	uint32_t discretionary_acl_offset;
+
+	/* The discretionary access control list (DACL) size
+	 */
+	uint32_t discretionary_acl_size;
+
+	/* The data size, which is the end offset of the last component
+	 */
+	size_t data_size;
+};
+
+typedef struct libfwnt_security_descriptor_view libfwnt_security_descriptor_view_t;
+
+struct libfwnt_security_descriptor_view
+{
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+typedef struct libfwnt_security_identifier_view libfwnt_security_identifier_view_t;
+
+struct libfwnt_security_identifier_view
+{
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBFWNT ) */
 
 #endif /* !defined( _LIBFWNT_INTERNAL_TYPES_H ) */
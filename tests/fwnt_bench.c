@@ -0,0 +1,1297 @@
+/*
+ * Decompression benchmark program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( WINAPI )
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#include <intrin.h>
+#define HAVE_FWNT_BENCH_CYCLE_COUNTER	1
+
+#elif ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <x86intrin.h>
+#define HAVE_FWNT_BENCH_CYCLE_COUNTER	1
+
+#endif
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ )
+#define __USE_GNU
+#include <dlfcn.h>
+#undef __USE_GNU
+#endif
+
+#include "fwnt_bench_corpus.h"
+#include "fwnt_bench_lzx_encoder.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_memory.h"
+
+/* The codecs
+ */
+enum FWNT_BENCH_CODECS
+{
+	FWNT_BENCH_CODEC_LZNT1			= 0,
+	FWNT_BENCH_CODEC_LZX			= 1,
+	FWNT_BENCH_CODEC_LZXPRESS		= 2,
+	FWNT_BENCH_CODEC_LZXPRESS_HUFFMAN	= 3
+};
+
+#define FWNT_BENCH_NUMBER_OF_CODECS		4
+
+/* The benchmark modes
+ */
+enum FWNT_BENCH_MODES
+{
+	FWNT_BENCH_MODE_DECOMPRESSION		= 0,
+	FWNT_BENCH_MODE_SECURITY_IDENTIFIER	= 1
+};
+
+#define FWNT_BENCH_NUMBER_OF_MODES		2
+
+/* The security identifier operations
+ */
+enum FWNT_BENCH_SECURITY_IDENTIFIER_OPERATIONS
+{
+	FWNT_BENCH_SECURITY_IDENTIFIER_OPERATION_FORMAT		= 0,
+	FWNT_BENCH_SECURITY_IDENTIFIER_OPERATION_FORMAT_BATCH	= 1,
+	FWNT_BENCH_SECURITY_IDENTIFIER_OPERATION_PARSE_UTF8	= 2,
+	FWNT_BENCH_SECURITY_IDENTIFIER_OPERATION_PARSE_UTF16	= 3
+};
+
+#define FWNT_BENCH_NUMBER_OF_SECURITY_IDENTIFIER_OPERATIONS	4
+
+#define FWNT_BENCH_NUMBER_OF_SECURITY_IDENTIFIERS		65536
+
+#define FWNT_BENCH_DEFAULT_CORPUS_SIZE		1048576
+#define FWNT_BENCH_DEFAULT_NUMBER_OF_ITERATIONS	10
+#define FWNT_BENCH_DEFAULT_SEED			1
+
+/* The names of the codecs
+ */
+static const char *fwnt_bench_codec_names[ FWNT_BENCH_NUMBER_OF_CODECS ] = {
+	"lznt1", "lzx", "lzxpress", "lzxpress_huffman" };
+
+/* The names of the benchmark modes
+ */
+static const char *fwnt_bench_mode_names[ FWNT_BENCH_NUMBER_OF_MODES ] = {
+	"decompression", "security_identifier" };
+
+/* The names of the security identifier operations
+ */
+static const char *fwnt_bench_security_identifier_operation_names[ FWNT_BENCH_NUMBER_OF_SECURITY_IDENTIFIER_OPERATIONS ] = {
+	"format", "format_batch", "parse_utf8", "parse_utf16" };
+
+/* The names of the kernel variants
+ */
+static const char *fwnt_bench_kernel_variant_names[ 5 ] = {
+	"automatic", "scalar", "sse2", "avx2", "neon" };
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+
+static void *(*fwnt_bench_real_malloc)(size_t)          = NULL;
+static void *(*fwnt_bench_real_realloc)(void *, size_t) = NULL;
+
+/* The number of allocations since the counter was last reset
+ */
+static uint64_t fwnt_bench_number_of_allocations        = 0;
+
+/* Custom malloc that counts the allocations
+ * Returns a pointer to newly allocated data or NULL
+ */
+void *malloc(
+       size_t size )
+{
+	if( fwnt_bench_real_malloc == NULL )
+	{
+		fwnt_bench_real_malloc = dlsym(
+		                          RTLD_NEXT,
+		                          "malloc" );
+	}
+	fwnt_bench_number_of_allocations++;
+
+	return( fwnt_bench_real_malloc(
+	         size ) );
+}
+
+/* Custom realloc that counts the allocations
+ * Returns a pointer to reallocated data or NULL
+ */
+void *realloc(
+       void *ptr,
+       size_t size )
+{
+	if( fwnt_bench_real_realloc == NULL )
+	{
+		fwnt_bench_real_realloc = dlsym(
+		                           RTLD_NEXT,
+		                           "realloc" );
+	}
+	fwnt_bench_number_of_allocations++;
+
+	return( fwnt_bench_real_realloc(
+	         ptr,
+	         size ) );
+}
+
+#endif /* defined( HAVE_FWNT_TEST_MEMORY ) */
+
+/* Prints the usage information
+ */
+void fwnt_bench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fwnt_bench to measure the decompression throughput of libfwnt.\n\n" );
+
+	fprintf( stream, "Usage: fwnt_bench [ -c codec ] [ -i iterations ] [ -k kernel_variant ]\n"
+	                 "                  [ -m mode ] [ -s size ] [ -t corpus ] [ -x seed ] [ -h ]\n\n" );
+
+	fprintf( stream, "\t-c: only benchmark the codec: lznt1, lzx, lzxpress or lzxpress_huffman\n" );
+	fprintf( stream, "\t-h: shows this help\n" );
+	fprintf( stream, "\t-i: the number of iterations that are measured (default is 10)\n" );
+	fprintf( stream, "\t-k: force the kernel variant: scalar, sse2, avx2 or neon\n" );
+	fprintf( stream, "\t-m: the benchmark mode: decompression (default) or security_identifier\n" );
+	fprintf( stream, "\t-s: the size of each corpus in bytes (default is 1048576)\n" );
+	fprintf( stream, "\t-t: only benchmark the corpus: text, executable, zeros or random\n" );
+	fprintf( stream, "\t-x: the seed of the corpus generator (default is 1)\n\n" );
+
+	fprintf( stream, "The results are written as comma separated values with the columns:\n"
+	                 "version, codec, corpus, kernel_variant, uncompressed_size, compressed_size,\n"
+	                 "iterations, megabytes_per_second, cycles_per_byte and allocations_per_call.\n"
+	                 "Cycles are measured using the time-stamp counter and are -1 if not available,\n"
+	                 "allocations are -1 if they cannot be counted.\n\n" );
+
+	fprintf( stream, "In security_identifier mode SID strings are formatted and parsed instead,\n"
+	                 "the results have the columns: version, operation, identifiers, string_size,\n"
+	                 "iterations, nanoseconds_per_identifier, megabytes_per_second and\n"
+	                 "allocations_per_call.\n" );
+}
+
+/* Retrieves a monotonic time in nanoseconds
+ * Returns the time
+ */
+uint64_t fwnt_bench_get_time(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	QueryPerformanceCounter(
+	 &counter );
+
+	QueryPerformanceFrequency(
+	 &frequency );
+
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+#else
+	struct timespec time_value;
+
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &time_value );
+
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+#endif
+}
+
+/* Retrieves the value of the cycle counter
+ * Returns the number of cycles or 0 if not available
+ */
+uint64_t fwnt_bench_get_cycles(
+          void )
+{
+#if defined( HAVE_FWNT_BENCH_CYCLE_COUNTER )
+	return( (uint64_t) __rdtsc() );
+#else
+	return( 0 );
+#endif
+}
+
+/* Compresses the corpus
+ * Returns 1 if successful or -1 on error
+ */
+int fwnt_bench_compress(
+     int codec,
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size )
+{
+	libfwnt_error_t *error = NULL;
+	int result             = 0;
+
+	switch( codec )
+	{
+		case FWNT_BENCH_CODEC_LZNT1:
+			result = libfwnt_lznt1_compress(
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          compressed_data,
+			          compressed_data_size,
+			          &error );
+			break;
+
+		case FWNT_BENCH_CODEC_LZX:
+			result = fwnt_bench_lzx_encoder_compress(
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          compressed_data,
+			          compressed_data_size );
+			break;
+
+		case FWNT_BENCH_CODEC_LZXPRESS:
+			result = libfwnt_lzxpress_compress(
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          compressed_data,
+			          compressed_data_size,
+			          &error );
+			break;
+
+		case FWNT_BENCH_CODEC_LZXPRESS_HUFFMAN:
+			result = libfwnt_lzxpress_huffman_compress(
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          compressed_data,
+			          compressed_data_size,
+			          &error );
+			break;
+
+		default:
+			result = -1;
+			break;
+	}
+	if( error != NULL )
+	{
+		libfwnt_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libfwnt_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Decompresses the corpus
+ * Returns 1 if successful or -1 on error
+ */
+int fwnt_bench_decompress(
+     int codec,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size )
+{
+	libfwnt_error_t *error = NULL;
+	int result             = 0;
+
+	switch( codec )
+	{
+		case FWNT_BENCH_CODEC_LZNT1:
+			result = libfwnt_lznt1_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          &error );
+			break;
+
+		case FWNT_BENCH_CODEC_LZX:
+			result = libfwnt_lzx_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          &error );
+			break;
+
+		case FWNT_BENCH_CODEC_LZXPRESS:
+			result = libfwnt_lzxpress_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          &error );
+			break;
+
+		case FWNT_BENCH_CODEC_LZXPRESS_HUFFMAN:
+			result = libfwnt_lzxpress_huffman_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          &error );
+			break;
+
+		default:
+			result = -1;
+			break;
+	}
+	if( error != NULL )
+	{
+		libfwnt_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libfwnt_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Benchmarks the decompression of a corpus
+ * Returns 1 if successful or -1 on error
+ */
+int fwnt_bench_run(
+     int codec,
+     int corpus_type,
+     const uint8_t *corpus_data,
+     size_t corpus_data_size,
+     uint8_t *compressed_data,
+     size_t compressed_data_buffer_size,
+     uint8_t *uncompressed_data,
+     int number_of_iterations,
+     int kernel_variant )
+{
+	double allocations_per_call   = -1.0;
+	double cycles_per_byte        = -1.0;
+	double megabytes_per_second   = 0.0;
+	uint64_t end_cycles           = 0;
+	uint64_t end_time             = 0;
+	uint64_t start_cycles         = 0;
+	uint64_t start_time           = 0;
+	size_t compressed_data_size   = compressed_data_buffer_size;
+	size_t uncompressed_data_size = 0;
+	int iteration                 = 0;
+
+	if( fwnt_bench_compress(
+	     codec,
+	     corpus_data,
+	     corpus_data_size,
+	     compressed_data,
+	     &compressed_data_size ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to compress %s corpus using %s.\n",
+		 fwnt_bench_corpus_get_name( corpus_type ),
+		 fwnt_bench_codec_names[ codec ] );
+
+		return( -1 );
+	}
+	/* The first decompression warms up the caches and is used to verify the result
+	 */
+	uncompressed_data_size = corpus_data_size;
+
+	if( fwnt_bench_decompress(
+	     codec,
+	     compressed_data,
+	     compressed_data_size,
+	     uncompressed_data,
+	     &uncompressed_data_size ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to decompress %s corpus using %s.\n",
+		 fwnt_bench_corpus_get_name( corpus_type ),
+		 fwnt_bench_codec_names[ codec ] );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size != corpus_data_size )
+	 || ( memory_compare(
+	       uncompressed_data,
+	       corpus_data,
+	       corpus_data_size ) != 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Decompressed %s corpus using %s does not match the corpus.\n",
+		 fwnt_bench_corpus_get_name( corpus_type ),
+		 fwnt_bench_codec_names[ codec ] );
+
+		return( -1 );
+	}
+#if defined( HAVE_FWNT_TEST_MEMORY )
+	fwnt_bench_number_of_allocations = 0;
+#endif
+	start_time   = fwnt_bench_get_time();
+	start_cycles = fwnt_bench_get_cycles();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		uncompressed_data_size = corpus_data_size;
+
+		if( fwnt_bench_decompress(
+		     codec,
+		     compressed_data,
+		     compressed_data_size,
+		     uncompressed_data,
+		     &uncompressed_data_size ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	end_cycles = fwnt_bench_get_cycles();
+	end_time   = fwnt_bench_get_time();
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+	allocations_per_call = (double) fwnt_bench_number_of_allocations / (double) number_of_iterations;
+#endif
+	if( end_time > start_time )
+	{
+		megabytes_per_second = ( (double) corpus_data_size * (double) number_of_iterations * 1000.0 ) / (double) ( end_time - start_time );
+	}
+#if defined( HAVE_FWNT_BENCH_CYCLE_COUNTER )
+	cycles_per_byte = (double) ( end_cycles - start_cycles ) / ( (double) corpus_data_size * (double) number_of_iterations );
+#endif
+	fprintf(
+	 stdout,
+	 "%s,%s,%s,%s,%" PRIzd ",%" PRIzd ",%d,%.1f,%.2f,%.1f\n",
+	 libfwnt_get_version(),
+	 fwnt_bench_codec_names[ codec ],
+	 fwnt_bench_corpus_get_name( corpus_type ),
+	 fwnt_bench_kernel_variant_names[ kernel_variant ],
+	 corpus_data_size,
+	 compressed_data_size,
+	 number_of_iterations,
+	 megabytes_per_second,
+	 cycles_per_byte,
+	 allocations_per_call );
+
+	return( 1 );
+}
+
+/* Formats or parses the security identifiers
+ * Returns 1 if successful or -1 on error
+ */
+int fwnt_bench_security_identifier_operation(
+     int operation,
+     libfwnt_security_identifier_t **security_identifiers,
+     int number_of_security_identifiers,
+     uint8_t *utf8_strings,
+     size_t utf8_strings_size,
+     size_t *utf8_string_offsets,
+     uint16_t *utf16_strings,
+     libfwnt_security_identifier_t *security_identifier )
+{
+	libfwnt_error_t *error        = NULL;
+	size_t string_offset          = 0;
+	size_t string_size            = 0;
+	int result                    = 1;
+	int security_identifier_index = 0;
+
+	switch( operation )
+	{
+		case FWNT_BENCH_SECURITY_IDENTIFIER_OPERATION_FORMAT:
+			for( security_identifier_index = 0;
+			     security_identifier_index < number_of_security_identifiers;
+			     security_identifier_index++ )
+			{
+				if( libfwnt_security_identifier_get_string_size(
+				     security_identifiers[ security_identifier_index ],
+				     &string_size,
+				     0,
+				     &error ) != 1 )
+				{
+					result = -1;
+
+					break;
+				}
+				if( libfwnt_security_identifier_copy_to_utf8_string(
+				     security_identifiers[ security_identifier_index ],
+				     &( utf8_strings[ string_offset ] ),
+				     string_size,
+				     0,
+				     &error ) != 1 )
+				{
+					result = -1;
+
+					break;
+				}
+				string_offset += string_size;
+			}
+			break;
+
+		case FWNT_BENCH_SECURITY_IDENTIFIER_OPERATION_FORMAT_BATCH:
+			result = libfwnt_security_identifier_copy_to_utf8_strings(
+			          security_identifiers,
+			          number_of_security_identifiers,
+			          utf8_strings,
+			          utf8_strings_size,
+			          utf8_string_offsets,
+			          0,
+			          &error );
+			break;
+
+		case FWNT_BENCH_SECURITY_IDENTIFIER_OPERATION_PARSE_UTF8:
+			for( security_identifier_index = 0;
+			     security_identifier_index < number_of_security_identifiers;
+			     security_identifier_index++ )
+			{
+				string_offset = utf8_string_offsets[ security_identifier_index ];
+
+				if( libfwnt_security_identifier_copy_from_utf8_string(
+				     security_identifier,
+				     &( utf8_strings[ string_offset ] ),
+				     utf8_strings_size - string_offset,
+				     0,
+				     &error ) != 1 )
+				{
+					result = -1;
+
+					break;
+				}
+			}
+			break;
+
+		case FWNT_BENCH_SECURITY_IDENTIFIER_OPERATION_PARSE_UTF16:
+			for( security_identifier_index = 0;
+			     security_identifier_index < number_of_security_identifiers;
+			     security_identifier_index++ )
+			{
+				string_offset = utf8_string_offsets[ security_identifier_index ];
+
+				if( libfwnt_security_identifier_copy_from_utf16_string(
+				     security_identifier,
+				     &( utf16_strings[ string_offset ] ),
+				     utf8_strings_size - string_offset,
+				     0,
+				     &error ) != 1 )
+				{
+					result = -1;
+
+					break;
+				}
+			}
+			break;
+
+		default:
+			result = -1;
+			break;
+	}
+	if( error != NULL )
+	{
+		libfwnt_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libfwnt_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Benchmarks formatting and parsing security identifier strings
+ * Returns 1 if successful or -1 on error
+ */
+int fwnt_bench_run_security_identifiers(
+     uint32_t seed,
+     int number_of_iterations )
+{
+	uint8_t utf8_string[ 256 ];
+
+	libfwnt_error_t *error                               = NULL;
+	libfwnt_security_identifier_t **security_identifiers = NULL;
+	libfwnt_security_identifier_t *security_identifier   = NULL;
+	uint16_t *utf16_strings                              = NULL;
+	uint8_t *data                                        = NULL;
+	uint8_t *utf8_strings                                = NULL;
+	size_t *data_offsets                                 = NULL;
+	size_t *utf8_string_offsets                          = NULL;
+	double allocations_per_call                          = -1.0;
+	double megabytes_per_second                          = 0.0;
+	double nanoseconds_per_identifier                    = 0.0;
+	uint64_t end_time                                    = 0;
+	uint64_t start_time                                  = 0;
+	size_t data_size                                     = 0;
+	size_t string_index                                  = 0;
+	size_t string_size                                   = 0;
+	size_t utf8_strings_size                             = 0;
+	int iteration                                        = 0;
+	int number_of_security_identifiers                   = FWNT_BENCH_NUMBER_OF_SECURITY_IDENTIFIERS;
+	int operation                                        = 0;
+	int result                                           = -1;
+	int security_identifier_index                        = 0;
+
+	data_size = (size_t) number_of_security_identifiers * 68;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	data_offsets = (size_t *) memory_allocate(
+	                           sizeof( size_t ) * number_of_security_identifiers );
+
+	utf8_string_offsets = (size_t *) memory_allocate(
+	                                  sizeof( size_t ) * number_of_security_identifiers );
+
+	security_identifiers = (libfwnt_security_identifier_t **) memory_allocate(
+	                                                           sizeof( libfwnt_security_identifier_t * ) * number_of_security_identifiers );
+
+	if( ( data == NULL )
+	 || ( data_offsets == NULL )
+	 || ( utf8_string_offsets == NULL )
+	 || ( security_identifiers == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffers.\n" );
+
+		goto on_error;
+	}
+	memory_set(
+	 security_identifiers,
+	 0,
+	 sizeof( libfwnt_security_identifier_t * ) * number_of_security_identifiers );
+
+	if( fwnt_bench_corpus_generate_security_identifiers(
+	     seed,
+	     data,
+	     data_size,
+	     data_offsets,
+	     number_of_security_identifiers ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate security identifiers.\n" );
+
+		goto on_error;
+	}
+	for( security_identifier_index = 0;
+	     security_identifier_index < number_of_security_identifiers;
+	     security_identifier_index++ )
+	{
+		if( libfwnt_security_identifier_initialize(
+		     &( security_identifiers[ security_identifier_index ] ),
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libfwnt_security_identifier_copy_from_byte_stream(
+		     security_identifiers[ security_identifier_index ],
+		     &( data[ data_offsets[ security_identifier_index ] ] ),
+		     data_size - data_offsets[ security_identifier_index ],
+		     LIBFWNT_ENDIAN_LITTLE,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libfwnt_security_identifier_initialize(
+	     &security_identifier,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfwnt_security_identifier_get_utf8_strings_size(
+	     security_identifiers,
+	     number_of_security_identifiers,
+	     &utf8_strings_size,
+	     0,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	utf8_strings = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * utf8_strings_size );
+
+	utf16_strings = (uint16_t *) memory_allocate(
+	                              sizeof( uint16_t ) * utf8_strings_size );
+
+	if( ( utf8_strings == NULL )
+	 || ( utf16_strings == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffers.\n" );
+
+		goto on_error;
+	}
+	if( libfwnt_security_identifier_copy_to_utf8_strings(
+	     security_identifiers,
+	     number_of_security_identifiers,
+	     utf8_strings,
+	     utf8_strings_size,
+	     utf8_string_offsets,
+	     0,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( string_index = 0;
+	     string_index < utf8_strings_size;
+	     string_index++ )
+	{
+		utf16_strings[ string_index ] = (uint16_t) utf8_strings[ string_index ];
+	}
+	/* Verify that every string is parsed into the security identifier it was formatted from
+	 */
+	for( security_identifier_index = 0;
+	     security_identifier_index < number_of_security_identifiers;
+	     security_identifier_index++ )
+	{
+		string_index = utf8_string_offsets[ security_identifier_index ];
+
+		if( ( security_identifier_index + 1 ) < number_of_security_identifiers )
+		{
+			string_size = utf8_string_offsets[ security_identifier_index + 1 ] - string_index;
+		}
+		else
+		{
+			string_size = utf8_strings_size - string_index;
+		}
+		if( libfwnt_security_identifier_copy_from_utf8_string(
+		     security_identifier,
+		     &( utf8_strings[ string_index ] ),
+		     string_size,
+		     0,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libfwnt_security_identifier_copy_to_utf8_string(
+		     security_identifier,
+		     utf8_string,
+		     256,
+		     0,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( memory_compare(
+		     utf8_string,
+		     &( utf8_strings[ string_index ] ),
+		     string_size ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Parsed security identifier: %d does not match the formatted string.\n",
+			 security_identifier_index );
+
+			goto on_error;
+		}
+	}
+	for( operation = 0;
+	     operation < FWNT_BENCH_NUMBER_OF_SECURITY_IDENTIFIER_OPERATIONS;
+	     operation++ )
+	{
+		/* The first run warms up the caches
+		 */
+		if( fwnt_bench_security_identifier_operation(
+		     operation,
+		     security_identifiers,
+		     number_of_security_identifiers,
+		     utf8_strings,
+		     utf8_strings_size,
+		     utf8_string_offsets,
+		     utf16_strings,
+		     security_identifier ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run security identifier operation: %s.\n",
+			 fwnt_bench_security_identifier_operation_names[ operation ] );
+
+			goto on_error;
+		}
+#if defined( HAVE_FWNT_TEST_MEMORY )
+		fwnt_bench_number_of_allocations = 0;
+#endif
+		start_time = fwnt_bench_get_time();
+
+		for( iteration = 0;
+		     iteration < number_of_iterations;
+		     iteration++ )
+		{
+			if( fwnt_bench_security_identifier_operation(
+			     operation,
+			     security_identifiers,
+			     number_of_security_identifiers,
+			     utf8_strings,
+			     utf8_strings_size,
+			     utf8_string_offsets,
+			     utf16_strings,
+			     security_identifier ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		end_time = fwnt_bench_get_time();
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+		allocations_per_call = (double) fwnt_bench_number_of_allocations / ( (double) number_of_iterations * (double) number_of_security_identifiers );
+#endif
+		nanoseconds_per_identifier = (double) ( end_time - start_time ) / ( (double) number_of_iterations * (double) number_of_security_identifiers );
+
+		if( end_time > start_time )
+		{
+			megabytes_per_second = ( (double) utf8_strings_size * (double) number_of_iterations * 1000.0 ) / (double) ( end_time - start_time );
+		}
+		fprintf(
+		 stdout,
+		 "%s,%s,%d,%" PRIzd ",%d,%.1f,%.1f,%.1f\n",
+		 libfwnt_get_version(),
+		 fwnt_bench_security_identifier_operation_names[ operation ],
+		 number_of_security_identifiers,
+		 utf8_strings_size,
+		 number_of_iterations,
+		 nanoseconds_per_identifier,
+		 megabytes_per_second,
+		 allocations_per_call );
+	}
+	result = 1;
+
+on_error:
+	if( error != NULL )
+	{
+		libfwnt_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libfwnt_error_free(
+		 &error );
+	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	if( security_identifiers != NULL )
+	{
+		for( security_identifier_index = 0;
+		     security_identifier_index < number_of_security_identifiers;
+		     security_identifier_index++ )
+		{
+			if( security_identifiers[ security_identifier_index ] != NULL )
+			{
+				libfwnt_security_identifier_free(
+				 &( security_identifiers[ security_identifier_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 security_identifiers );
+	}
+	if( utf16_strings != NULL )
+	{
+		memory_free(
+		 utf16_strings );
+	}
+	if( utf8_strings != NULL )
+	{
+		memory_free(
+		 utf8_strings );
+	}
+	if( utf8_string_offsets != NULL )
+	{
+		memory_free(
+		 utf8_string_offsets );
+	}
+	if( data_offsets != NULL )
+	{
+		memory_free(
+		 data_offsets );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( result );
+}
+
+/* The main program
+ */
+int main(
+     int argc,
+     char * const argv[] )
+{
+	libfwnt_error_t *error      = NULL;
+	uint8_t *compressed_data    = NULL;
+	uint8_t *corpus_data        = NULL;
+	uint8_t *uncompressed_data  = NULL;
+	size_t compressed_data_size = 0;
+	size_t corpus_data_size     = FWNT_BENCH_DEFAULT_CORPUS_SIZE;
+	uint32_t seed               = FWNT_BENCH_DEFAULT_SEED;
+	int argument_index          = 0;
+	int codec                   = 0;
+	int corpus_type             = 0;
+	int kernel_variant          = 0;
+	int mode                    = 0;
+	int number_of_iterations    = FWNT_BENCH_DEFAULT_NUMBER_OF_ITERATIONS;
+	int option_codec            = -1;
+	int option_corpus_type      = -1;
+	int option_kernel_variant   = 0;
+	int option_mode             = -1;
+
+	for( argument_index = 1;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		if( ( argv[ argument_index ][ 0 ] != '-' )
+		 || ( argv[ argument_index ][ 1 ] == 0 )
+		 || ( argv[ argument_index ][ 2 ] != 0 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid argument: %s.\n",
+			 argv[ argument_index ] );
+
+			fwnt_bench_usage_fprint(
+			 stderr );
+
+			return( EXIT_FAILURE );
+		}
+		if( argv[ argument_index ][ 1 ] == 'h' )
+		{
+			fwnt_bench_usage_fprint(
+			 stdout );
+
+			return( EXIT_SUCCESS );
+		}
+		if( ( argument_index + 1 ) >= argc )
+		{
+			fprintf(
+			 stderr,
+			 "Missing value for option: %s.\n",
+			 argv[ argument_index ] );
+
+			return( EXIT_FAILURE );
+		}
+		argument_index++;
+
+		switch( argv[ argument_index - 1 ][ 1 ] )
+		{
+			case 'c':
+				for( codec = 0;
+				     codec < FWNT_BENCH_NUMBER_OF_CODECS;
+				     codec++ )
+				{
+					if( narrow_string_compare(
+					     argv[ argument_index ],
+					     fwnt_bench_codec_names[ codec ],
+					     narrow_string_length( fwnt_bench_codec_names[ codec ] ) + 1 ) == 0 )
+					{
+						option_codec = codec;
+					}
+				}
+				if( option_codec == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported codec: %s.\n",
+					 argv[ argument_index ] );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case 'i':
+				number_of_iterations = atoi(
+				                        argv[ argument_index ] );
+
+				if( number_of_iterations <= 0 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of iterations: %s.\n",
+					 argv[ argument_index ] );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case 'k':
+				for( kernel_variant = LIBFWNT_KERNEL_VARIANT_SCALAR;
+				     kernel_variant <= LIBFWNT_KERNEL_VARIANT_NEON;
+				     kernel_variant++ )
+				{
+					if( narrow_string_compare(
+					     argv[ argument_index ],
+					     fwnt_bench_kernel_variant_names[ kernel_variant ],
+					     narrow_string_length( fwnt_bench_kernel_variant_names[ kernel_variant ] ) + 1 ) == 0 )
+					{
+						option_kernel_variant = kernel_variant;
+					}
+				}
+				if( option_kernel_variant == 0 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported kernel variant: %s.\n",
+					 argv[ argument_index ] );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case 'm':
+				for( mode = 0;
+				     mode < FWNT_BENCH_NUMBER_OF_MODES;
+				     mode++ )
+				{
+					if( narrow_string_compare(
+					     argv[ argument_index ],
+					     fwnt_bench_mode_names[ mode ],
+					     narrow_string_length( fwnt_bench_mode_names[ mode ] ) + 1 ) == 0 )
+					{
+						option_mode = mode;
+					}
+				}
+				if( option_mode == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported mode: %s.\n",
+					 argv[ argument_index ] );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case 's':
+				corpus_data_size = (size_t) strtoul(
+				                             argv[ argument_index ],
+				                             NULL,
+				                             10 );
+
+				/* LZX requires at least 6 bytes and the encoder supports
+				 * up to 2 GiB of data
+				 */
+				if( ( corpus_data_size < 4096 )
+				 || ( corpus_data_size > (size_t) INT32_MAX ) )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported corpus size: %s.\n",
+					 argv[ argument_index ] );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case 't':
+				for( corpus_type = 0;
+				     corpus_type < FWNT_BENCH_NUMBER_OF_CORPUS_TYPES;
+				     corpus_type++ )
+				{
+					if( narrow_string_compare(
+					     argv[ argument_index ],
+					     fwnt_bench_corpus_get_name( corpus_type ),
+					     narrow_string_length( fwnt_bench_corpus_get_name( corpus_type ) ) + 1 ) == 0 )
+					{
+						option_corpus_type = corpus_type;
+					}
+				}
+				if( option_corpus_type == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported corpus: %s.\n",
+					 argv[ argument_index ] );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case 'x':
+				seed = (uint32_t) strtoul(
+				                   argv[ argument_index ],
+				                   NULL,
+				                   10 );
+				break;
+
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %s.\n",
+				 argv[ argument_index - 1 ] );
+
+				fwnt_bench_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( libfwnt_set_kernel_variant(
+	     option_kernel_variant,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set kernel variant.\n" );
+
+		goto on_error;
+	}
+	if( libfwnt_get_kernel_variant(
+	     &kernel_variant,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve kernel variant.\n" );
+
+		goto on_error;
+	}
+	if( option_mode == FWNT_BENCH_MODE_SECURITY_IDENTIFIER )
+	{
+		fprintf(
+		 stdout,
+		 "version,operation,identifiers,string_size,iterations,nanoseconds_per_identifier,megabytes_per_second,allocations_per_call\n" );
+
+		if( fwnt_bench_run_security_identifiers(
+		     seed,
+		     number_of_iterations ) != 1 )
+		{
+			goto on_error;
+		}
+		return( EXIT_SUCCESS );
+	}
+	/* Leave room for data that does not compress
+	 */
+	compressed_data_size = corpus_data_size + ( corpus_data_size / 4 ) + 65536;
+
+	corpus_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * corpus_data_size );
+
+	compressed_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * compressed_data_size );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * corpus_data_size );
+
+	if( ( corpus_data == NULL )
+	 || ( compressed_data == NULL )
+	 || ( uncompressed_data == NULL ) )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create buffers.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "version,codec,corpus,kernel_variant,uncompressed_size,compressed_size,iterations,megabytes_per_second,cycles_per_byte,allocations_per_call\n" );
+
+	for( corpus_type = 0;
+	     corpus_type < FWNT_BENCH_NUMBER_OF_CORPUS_TYPES;
+	     corpus_type++ )
+	{
+		if( ( option_corpus_type != -1 )
+		 && ( option_corpus_type != corpus_type ) )
+		{
+			continue;
+		}
+		if( fwnt_bench_corpus_generate(
+		     corpus_type,
+		     seed,
+		     corpus_data,
+		     corpus_data_size ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to generate %s corpus.\n",
+			 fwnt_bench_corpus_get_name( corpus_type ) );
+
+			goto on_error;
+		}
+		for( codec = 0;
+		     codec < FWNT_BENCH_NUMBER_OF_CODECS;
+		     codec++ )
+		{
+			if( ( option_codec != -1 )
+			 && ( option_codec != codec ) )
+			{
+				continue;
+			}
+			if( fwnt_bench_run(
+			     codec,
+			     corpus_type,
+			     corpus_data,
+			     corpus_data_size,
+			     compressed_data,
+			     compressed_data_size,
+			     uncompressed_data,
+			     number_of_iterations,
+			     kernel_variant ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	memory_free(
+	 uncompressed_data );
+	memory_free(
+	 compressed_data );
+	memory_free(
+	 corpus_data );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libfwnt_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libfwnt_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( compressed_data != NULL )
+	{
+		memory_free(
+		 compressed_data );
+	}
+	if( corpus_data != NULL )
+	{
+		memory_free(
+		 corpus_data );
+	}
+	return( EXIT_FAILURE );
+}
+
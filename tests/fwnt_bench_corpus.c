@@ -0,0 +1,611 @@
+/*
+ * Benchmark corpus functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "fwnt_bench_corpus.h"
+
+/* The words the text corpus is made of
+ */
+static const char *fwnt_bench_corpus_words[ 64 ] = {
+	"the", "of", "and", "to", "a", "in", "is", "that", "for", "it", "as", "was", "with", "be", "by", "on",
+	"not", "he", "this", "are", "or", "his", "from", "at", "which", "but", "have", "an", "had", "they", "you", "were",
+	"their", "one", "all", "we", "can", "her", "has", "there", "been", "if", "more", "when", "will", "would", "who", "so",
+	"file", "system", "volume", "record", "attribute", "stream", "compressed", "security", "descriptor", "directory", "index", "cluster", "journal", "snapshot", "sector", "header" };
+
+/* The strings that are embedded in the executable corpus
+ */
+static const char *fwnt_bench_corpus_executable_strings[ 8 ] = {
+	"kernel32.dll", "ntdll.dll", "GetProcAddress", "LoadLibraryW",
+	"CreateFileW", "ReadFile", "CloseHandle", "HeapAlloc" };
+
+/* The number of functions the executable corpus keeps track of as call targets
+ */
+#define FWNT_BENCH_CORPUS_MAXIMUM_NUMBER_OF_FUNCTIONS	256
+
+/* Retrieves the name of a corpus type
+ * Returns a string or NULL if the corpus type is not supported
+ */
+const char *fwnt_bench_corpus_get_name(
+             int corpus_type )
+{
+	switch( corpus_type )
+	{
+		case FWNT_BENCH_CORPUS_TYPE_TEXT:
+			return( "text" );
+
+		case FWNT_BENCH_CORPUS_TYPE_EXECUTABLE:
+			return( "executable" );
+
+		case FWNT_BENCH_CORPUS_TYPE_ZEROS:
+			return( "zeros" );
+
+		case FWNT_BENCH_CORPUS_TYPE_RANDOM:
+			return( "random" );
+
+		default:
+			break;
+	}
+	return( NULL );
+}
+
+/* Retrieves the next value of a xorshift32 pseudo random number generator
+ * The state must be non-zero
+ * Returns the random value
+ */
+uint32_t fwnt_bench_corpus_get_random_value(
+          uint32_t *random_state )
+{
+	uint32_t value = *random_state;
+
+	value ^= value << 13;
+	value ^= value >> 17;
+	value ^= value << 5;
+
+	*random_state = value;
+
+	return( value );
+}
+
+/* Appends data to the corpus data, the data is truncated at the end of the corpus data
+ */
+static void fwnt_bench_corpus_append(
+             uint8_t *data,
+             size_t data_size,
+             size_t *data_offset,
+             const uint8_t *append_data,
+             size_t append_data_size )
+{
+	if( append_data_size > ( data_size - *data_offset ) )
+	{
+		append_data_size = data_size - *data_offset;
+	}
+	memory_copy(
+	 &( data[ *data_offset ] ),
+	 append_data,
+	 append_data_size );
+
+	*data_offset += append_data_size;
+}
+
+/* Generates the text corpus, which consists of sentences of frequently used words
+ */
+static void fwnt_bench_corpus_generate_text(
+             uint32_t *random_state,
+             uint8_t *data,
+             size_t data_size )
+{
+	const char *word         = NULL;
+	size_t data_offset       = 0;
+	size_t word_length       = 0;
+	uint32_t number_of_words = 0;
+	uint32_t word_index      = 0;
+	uint32_t random_value    = 0;
+	uint8_t sentence_index   = 0;
+
+	while( data_offset < data_size )
+	{
+		number_of_words = 4 + ( fwnt_bench_corpus_get_random_value( random_state ) % 12 );
+
+		while( number_of_words > 0 )
+		{
+			/* Favor the words at the start of the list, as in natural language
+			 */
+			random_value = fwnt_bench_corpus_get_random_value( random_state );
+			word_index   = ( ( random_value & 0x3f ) * ( ( random_value >> 8 ) & 0x3f ) ) / 64;
+
+			if( ( random_value >> 24 ) < 16 )
+			{
+				word_index = 48 + ( ( random_value >> 16 ) % 16 );
+			}
+			word        = fwnt_bench_corpus_words[ word_index ];
+			word_length = narrow_string_length( word );
+
+			fwnt_bench_corpus_append(
+			 data,
+			 data_size,
+			 &data_offset,
+			 (const uint8_t *) word,
+			 word_length );
+
+			number_of_words--;
+
+			if( number_of_words > 0 )
+			{
+				fwnt_bench_corpus_append(
+				 data,
+				 data_size,
+				 &data_offset,
+				 (const uint8_t *) ( ( ( random_value >> 28 ) == 0 ) ? ", " : " " ),
+				 ( ( random_value >> 28 ) == 0 ) ? 2 : 1 );
+			}
+		}
+		sentence_index++;
+
+		if( ( sentence_index % 6 ) == 0 )
+		{
+			fwnt_bench_corpus_append(
+			 data,
+			 data_size,
+			 &data_offset,
+			 (const uint8_t *) ".\n\n",
+			 3 );
+		}
+		else
+		{
+			fwnt_bench_corpus_append(
+			 data,
+			 data_size,
+			 &data_offset,
+			 (const uint8_t *) ". ",
+			 2 );
+		}
+	}
+}
+
+/* Generates the executable corpus, which consists of 32-bit x86 functions with
+ * call (0xe8) instructions to preceding functions, import names and address tables
+ */
+static void fwnt_bench_corpus_generate_executable(
+             uint32_t *random_state,
+             uint8_t *data,
+             size_t data_size )
+{
+	uint8_t instruction_data[ 16 ];
+
+	size_t function_offsets[ FWNT_BENCH_CORPUS_MAXIMUM_NUMBER_OF_FUNCTIONS ];
+
+	const char *string          = NULL;
+	size_t data_offset          = 0;
+	size_t function_index       = 0;
+	size_t instruction_size     = 0;
+	size_t number_of_functions  = 0;
+	uint32_t address            = 0;
+	uint32_t number_of_entries  = 0;
+	uint32_t random_value       = 0;
+
+	while( data_offset < data_size )
+	{
+		random_value = fwnt_bench_corpus_get_random_value( random_state );
+
+		/* Add an import name or address table between the functions
+		 */
+		if( ( random_value & 0x0f ) == 0 )
+		{
+			number_of_entries = 2 + ( ( random_value >> 4 ) % 8 );
+
+			while( number_of_entries > 0 )
+			{
+				random_value = fwnt_bench_corpus_get_random_value( random_state );
+
+				if( ( random_value & 0x01 ) == 0 )
+				{
+					string = fwnt_bench_corpus_executable_strings[ ( random_value >> 1 ) % 8 ];
+
+					fwnt_bench_corpus_append(
+					 data,
+					 data_size,
+					 &data_offset,
+					 (const uint8_t *) string,
+					 narrow_string_length( string ) + 1 );
+				}
+				else
+				{
+					address = 0x00401000UL + ( ( random_value >> 1 ) & 0x0000fff0UL );
+
+					byte_stream_copy_from_uint32_little_endian(
+					 instruction_data,
+					 address );
+
+					fwnt_bench_corpus_append(
+					 data,
+					 data_size,
+					 &data_offset,
+					 instruction_data,
+					 4 );
+				}
+				number_of_entries--;
+			}
+		}
+		/* Functions are aligned to 16 bytes using int3 (0xcc) instructions
+		 */
+		while( ( data_offset < data_size )
+		    && ( ( data_offset % 16 ) != 0 ) )
+		{
+			data[ data_offset++ ] = 0xcc;
+		}
+		if( data_offset >= data_size )
+		{
+			break;
+		}
+		function_offsets[ number_of_functions % FWNT_BENCH_CORPUS_MAXIMUM_NUMBER_OF_FUNCTIONS ] = data_offset;
+
+		number_of_functions++;
+
+		/* push ebp, mov ebp, esp, sub esp, imm8
+		 */
+		instruction_data[ 0 ] = 0x55;
+		instruction_data[ 1 ] = 0x8b;
+		instruction_data[ 2 ] = 0xec;
+		instruction_data[ 3 ] = 0x83;
+		instruction_data[ 4 ] = 0xec;
+		instruction_data[ 5 ] = (uint8_t) ( ( random_value >> 8 ) & 0x3c );
+
+		fwnt_bench_corpus_append(
+		 data,
+		 data_size,
+		 &data_offset,
+		 instruction_data,
+		 6 );
+
+		number_of_entries = 4 + ( ( random_value >> 16 ) % 24 );
+
+		while( number_of_entries > 0 )
+		{
+			random_value = fwnt_bench_corpus_get_random_value( random_state );
+
+			switch( random_value % 8 )
+			{
+				case 0:
+				case 1:
+					/* call rel32 to a preceding function
+					 */
+					function_index = ( random_value >> 8 ) % FWNT_BENCH_CORPUS_MAXIMUM_NUMBER_OF_FUNCTIONS;
+
+					if( function_index >= number_of_functions )
+					{
+						function_index = number_of_functions - 1;
+					}
+					address = (uint32_t) function_offsets[ function_index ] - (uint32_t) ( data_offset + 5 );
+
+					instruction_data[ 0 ] = 0xe8;
+
+					byte_stream_copy_from_uint32_little_endian(
+					 &( instruction_data[ 1 ] ),
+					 address );
+
+					instruction_size = 5;
+
+					break;
+
+				case 2:
+					/* mov eax, dword ptr [ebp + disp8]
+					 */
+					instruction_data[ 0 ] = 0x8b;
+					instruction_data[ 1 ] = 0x45;
+					instruction_data[ 2 ] = (uint8_t) ( 0x08 + ( ( random_value >> 8 ) & 0x1c ) );
+					instruction_size      = 3;
+
+					break;
+
+				case 3:
+					/* mov dword ptr [ebp - disp8], ecx
+					 */
+					instruction_data[ 0 ] = 0x89;
+					instruction_data[ 1 ] = 0x4d;
+					instruction_data[ 2 ] = (uint8_t) ( 0x100 - ( 4 + ( ( random_value >> 8 ) & 0x3c ) ) );
+					instruction_size      = 3;
+
+					break;
+
+				case 4:
+					/* push imm32 with an address in the image
+					 */
+					address = 0x00401000UL + ( ( random_value >> 8 ) & 0x0000fffcUL );
+
+					instruction_data[ 0 ] = 0x68;
+
+					byte_stream_copy_from_uint32_little_endian(
+					 &( instruction_data[ 1 ] ),
+					 address );
+
+					instruction_size = 5;
+
+					break;
+
+				case 5:
+					/* test eax, eax, je rel8
+					 */
+					instruction_data[ 0 ] = 0x85;
+					instruction_data[ 1 ] = 0xc0;
+					instruction_data[ 2 ] = 0x74;
+					instruction_data[ 3 ] = (uint8_t) ( ( random_value >> 8 ) & 0x1f );
+					instruction_size      = 4;
+
+					break;
+
+				case 6:
+					/* xor eax, eax, add esp, imm8
+					 */
+					instruction_data[ 0 ] = 0x33;
+					instruction_data[ 1 ] = 0xc0;
+					instruction_data[ 2 ] = 0x83;
+					instruction_data[ 3 ] = 0xc4;
+					instruction_data[ 4 ] = (uint8_t) ( ( random_value >> 8 ) & 0x1c );
+					instruction_size      = 5;
+
+					break;
+
+				default:
+					/* mov ecx, dword ptr [imm32]
+					 */
+					address = 0x00410000UL + ( ( random_value >> 8 ) & 0x00000ffcUL );
+
+					instruction_data[ 0 ] = 0x8b;
+					instruction_data[ 1 ] = 0x0d;
+
+					byte_stream_copy_from_uint32_little_endian(
+					 &( instruction_data[ 2 ] ),
+					 address );
+
+					instruction_size = 6;
+
+					break;
+			}
+			fwnt_bench_corpus_append(
+			 data,
+			 data_size,
+			 &data_offset,
+			 instruction_data,
+			 instruction_size );
+
+			number_of_entries--;
+		}
+		/* mov esp, ebp, pop ebp, ret
+		 */
+		instruction_data[ 0 ] = 0x8b;
+		instruction_data[ 1 ] = 0xe5;
+		instruction_data[ 2 ] = 0x5d;
+		instruction_data[ 3 ] = 0xc3;
+
+		fwnt_bench_corpus_append(
+		 data,
+		 data_size,
+		 &data_offset,
+		 instruction_data,
+		 4 );
+	}
+}
+
+/* Generates a corpus
+ * The same corpus type, seed and size always result in the same data
+ * Returns 1 if successful or -1 on error
+ */
+int fwnt_bench_corpus_generate(
+     int corpus_type,
+     uint32_t seed,
+     uint8_t *data,
+     size_t data_size )
+{
+	size_t data_offset    = 0;
+	uint32_t random_state = 0;
+	uint32_t random_value = 0;
+
+	if( data == NULL )
+	{
+		return( -1 );
+	}
+	/* The state of the random number generator must be non-zero
+	 */
+	random_state = seed ^ 0x9e3779b9UL;
+
+	if( random_state == 0 )
+	{
+		random_state = 0x9e3779b9UL;
+	}
+	switch( corpus_type )
+	{
+		case FWNT_BENCH_CORPUS_TYPE_TEXT:
+			fwnt_bench_corpus_generate_text(
+			 &random_state,
+			 data,
+			 data_size );
+
+			break;
+
+		case FWNT_BENCH_CORPUS_TYPE_EXECUTABLE:
+			fwnt_bench_corpus_generate_executable(
+			 &random_state,
+			 data,
+			 data_size );
+
+			break;
+
+		case FWNT_BENCH_CORPUS_TYPE_ZEROS:
+			memory_set(
+			 data,
+			 0,
+			 data_size );
+
+			break;
+
+		case FWNT_BENCH_CORPUS_TYPE_RANDOM:
+			for( data_offset = 0;
+			     data_offset < data_size;
+			     data_offset++ )
+			{
+				if( ( data_offset % 4 ) == 0 )
+				{
+					random_value = fwnt_bench_corpus_get_random_value(
+					                &random_state );
+				}
+				data[ data_offset ] = (uint8_t) ( random_value & 0xff );
+
+				random_value >>= 8;
+			}
+			break;
+
+		default:
+			return( -1 );
+	}
+	return( 1 );
+}
+
+/* Generates a corpus of security identifiers
+ * The security identifiers are stored consecutively in binary form, most of
+ * them are domain account security identifiers and the others well-known ones
+ * The data offsets must contain number of security identifiers elements
+ * The same seed always results in the same security identifiers
+ * Returns 1 if successful or -1 on error
+ */
+int fwnt_bench_corpus_generate_security_identifiers(
+     uint32_t seed,
+     uint8_t *data,
+     size_t data_size,
+     size_t *data_offsets,
+     int number_of_security_identifiers )
+{
+	size_t data_offset                = 0;
+	uint32_t random_state             = 0;
+	uint32_t random_value             = 0;
+	int security_identifier_index     = 0;
+	uint8_t number_of_sub_authorities = 0;
+	uint8_t sub_authority_index       = 0;
+
+	if( ( data == NULL )
+	 || ( data_offsets == NULL )
+	 || ( number_of_security_identifiers < 0 ) )
+	{
+		return( -1 );
+	}
+	random_state = seed ^ 0x9e3779b9UL;
+
+	if( random_state == 0 )
+	{
+		random_state = 0x9e3779b9UL;
+	}
+	for( security_identifier_index = 0;
+	     security_identifier_index < number_of_security_identifiers;
+	     security_identifier_index++ )
+	{
+		/* Reserve space for the largest security identifier
+		 */
+		if( ( data_size - data_offset ) < 68 )
+		{
+			return( -1 );
+		}
+		data_offsets[ security_identifier_index ] = data_offset;
+
+		random_value = fwnt_bench_corpus_get_random_value(
+		                &random_state );
+
+		if( ( random_value % 8 ) == 0 )
+		{
+			/* S-1-5-18 or S-1-5-32-544
+			 */
+			number_of_sub_authorities = (uint8_t) ( 1 + ( ( random_value >> 3 ) % 2 ) );
+
+			data[ data_offset++ ] = 1;
+			data[ data_offset++ ] = number_of_sub_authorities;
+
+			byte_stream_copy_from_uint48_big_endian(
+			 &( data[ data_offset ] ),
+			 (uint64_t) 5 );
+
+			data_offset += 6;
+
+			if( number_of_sub_authorities == 1 )
+			{
+				byte_stream_copy_from_uint32_little_endian(
+				 &( data[ data_offset ] ),
+				 18 );
+			}
+			else
+			{
+				byte_stream_copy_from_uint32_little_endian(
+				 &( data[ data_offset ] ),
+				 32 );
+
+				byte_stream_copy_from_uint32_little_endian(
+				 &( data[ data_offset + 4 ] ),
+				 544 );
+			}
+			data_offset += 4 * (size_t) number_of_sub_authorities;
+		}
+		else
+		{
+			/* S-1-5-21-domain-domain-domain-rid
+			 */
+			data[ data_offset++ ] = 1;
+			data[ data_offset++ ] = 5;
+
+			byte_stream_copy_from_uint48_big_endian(
+			 &( data[ data_offset ] ),
+			 (uint64_t) 5 );
+
+			data_offset += 6;
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( data[ data_offset ] ),
+			 21 );
+
+			data_offset += 4;
+
+			for( sub_authority_index = 0;
+			     sub_authority_index < 3;
+			     sub_authority_index++ )
+			{
+				random_value = fwnt_bench_corpus_get_random_value(
+				                &random_state );
+
+				byte_stream_copy_from_uint32_little_endian(
+				 &( data[ data_offset ] ),
+				 random_value );
+
+				data_offset += 4;
+			}
+			random_value = fwnt_bench_corpus_get_random_value(
+			                &random_state );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( data[ data_offset ] ),
+			 500 + ( random_value % 100000 ) );
+
+			data_offset += 4;
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,68 @@
+/*
+ * Benchmark corpus functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FWNT_BENCH_CORPUS_H )
+#define _FWNT_BENCH_CORPUS_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The corpus types
+ */
+enum FWNT_BENCH_CORPUS_TYPES
+{
+	FWNT_BENCH_CORPUS_TYPE_TEXT		= 0,
+	FWNT_BENCH_CORPUS_TYPE_EXECUTABLE	= 1,
+	FWNT_BENCH_CORPUS_TYPE_ZEROS		= 2,
+	FWNT_BENCH_CORPUS_TYPE_RANDOM		= 3
+};
+
+#define FWNT_BENCH_NUMBER_OF_CORPUS_TYPES	4
+
+const char *fwnt_bench_corpus_get_name(
+             int corpus_type );
+
+uint32_t fwnt_bench_corpus_get_random_value(
+          uint32_t *random_state );
+
+int fwnt_bench_corpus_generate(
+     int corpus_type,
+     uint32_t seed,
+     uint8_t *data,
+     size_t data_size );
+
+int fwnt_bench_corpus_generate_security_identifiers(
+     uint32_t seed,
+     uint8_t *data,
+     size_t data_size,
+     size_t *data_offsets,
+     int number_of_security_identifiers );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FWNT_BENCH_CORPUS_H ) */
+
@@ -0,0 +1,501 @@
+/*
+ * Benchmark LZX encoder functions
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "fwnt_bench_lzx_encoder.h"
+
+/* The library only provides LZX decompression, hence the benchmark uses this
+ * encoder to create LZX compressed data. It writes verbatim blocks with fixed
+ * code sizes and greedy matches, which the decoder handles the same as the
+ * output of a full encoder.
+ */
+
+/* The number of position slots of a 32 KiB window
+ */
+#define FWNT_BENCH_LZX_NUMBER_OF_POSITION_SLOTS	30
+
+#define FWNT_BENCH_LZX_BLOCK_SIZE		32768
+#define FWNT_BENCH_LZX_MINIMUM_MATCH_SIZE	3
+#define FWNT_BENCH_LZX_MAXIMUM_MATCH_SIZE	257
+#define FWNT_BENCH_LZX_MAXIMUM_MATCH_OFFSET	32765
+#define FWNT_BENCH_LZX_MAXIMUM_CHAIN_LENGTH	16
+#define FWNT_BENCH_LZX_HASH_TABLE_SIZE		65536
+#define FWNT_BENCH_LZX_TRANSLATION_SIZE		12000000
+
+/* Base position - 2
+ */
+static const int32_t fwnt_bench_lzx_position_base[ FWNT_BENCH_LZX_NUMBER_OF_POSITION_SLOTS ] = {
+	-2, -1, 0, 1, 2, 4, 6, 10, 14, 22, 30, 46, 62, 94, 126, 190,
+	254, 382, 510, 766, 1022, 1534, 2046, 3070, 4094, 6142, 8190, 12286, 16382, 24574 };
+
+static const uint8_t fwnt_bench_lzx_number_of_footer_bits[ FWNT_BENCH_LZX_NUMBER_OF_POSITION_SLOTS ] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+typedef struct fwnt_bench_lzx_bit_writer fwnt_bench_lzx_bit_writer_t;
+
+struct fwnt_bench_lzx_bit_writer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The data offset
+	 */
+	size_t data_offset;
+
+	/* The bits that have not been written yet
+	 */
+	uint32_t bit_buffer;
+
+	/* The number of bits in the bit buffer
+	 */
+	uint8_t bit_buffer_size;
+
+	/* Value to indicate the data was too small
+	 */
+	uint8_t overflow;
+};
+
+/* Writes bits, the most significant bit first, into 16-bit little-endian words
+ */
+static void fwnt_bench_lzx_bit_writer_put(
+             fwnt_bench_lzx_bit_writer_t *bit_writer,
+             uint32_t value,
+             uint8_t number_of_bits )
+{
+	uint16_t word = 0;
+
+	if( number_of_bits == 0 )
+	{
+		return;
+	}
+	bit_writer->bit_buffer     = ( bit_writer->bit_buffer << number_of_bits ) | ( value & ( ( 1UL << number_of_bits ) - 1 ) );
+	bit_writer->bit_buffer_size += number_of_bits;
+
+	while( bit_writer->bit_buffer_size >= 16 )
+	{
+		bit_writer->bit_buffer_size -= 16;
+
+		word = (uint16_t) ( bit_writer->bit_buffer >> bit_writer->bit_buffer_size );
+
+		if( ( bit_writer->data_size - bit_writer->data_offset ) < 2 )
+		{
+			bit_writer->overflow = 1;
+
+			continue;
+		}
+		byte_stream_copy_from_uint16_little_endian(
+		 &( bit_writer->data[ bit_writer->data_offset ] ),
+		 word );
+
+		bit_writer->data_offset += 2;
+	}
+}
+
+/* Writes the code sizes of a Huffman tree, preceded by the pre-codes
+ * Every code size is written as the difference with the previous code size
+ */
+static void fwnt_bench_lzx_write_code_sizes(
+             fwnt_bench_lzx_bit_writer_t *bit_writer,
+             uint8_t *code_size_array,
+             int number_of_code_sizes,
+             uint8_t code_size )
+{
+	int code_size_index = 0;
+
+	/* Every pre-code has a code size of 5 bits, hence its code is the pre-code
+	 */
+	for( code_size_index = 0;
+	     code_size_index < 20;
+	     code_size_index++ )
+	{
+		fwnt_bench_lzx_bit_writer_put(
+		 bit_writer,
+		 5,
+		 4 );
+	}
+	for( code_size_index = 0;
+	     code_size_index < number_of_code_sizes;
+	     code_size_index++ )
+	{
+		fwnt_bench_lzx_bit_writer_put(
+		 bit_writer,
+		 (uint32_t) ( ( 17 + code_size_array[ code_size_index ] - code_size ) % 17 ),
+		 5 );
+
+		code_size_array[ code_size_index ] = code_size;
+	}
+}
+
+/* Applies the call (0xe8) instruction translation, which is reversed by the decoder
+ */
+static void fwnt_bench_lzx_translate_call_instructions(
+             uint8_t *data,
+             size_t data_size )
+{
+	size_t data_offset   = 0;
+	int64_t address      = 0;
+	uint32_t value_32bit = 0;
+
+	if( data_size < 6 )
+	{
+		return;
+	}
+	for( data_offset = 0;
+	     data_offset < ( data_size - 6 );
+	     data_offset++ )
+	{
+		if( data[ data_offset ] != 0xe8 )
+		{
+			continue;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset + 1 ] ),
+		 value_32bit );
+
+		address = (int64_t) (int32_t) value_32bit;
+
+		if( ( address >= -( (int64_t) data_offset ) )
+		 && ( address < FWNT_BENCH_LZX_TRANSLATION_SIZE ) )
+		{
+			if( address < ( FWNT_BENCH_LZX_TRANSLATION_SIZE - (int64_t) data_offset ) )
+			{
+				address += (int64_t) data_offset;
+			}
+			else
+			{
+				address -= FWNT_BENCH_LZX_TRANSLATION_SIZE;
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 &( data[ data_offset + 1 ] ),
+			 (uint32_t) address );
+		}
+		data_offset += 4;
+	}
+}
+
+/* Determines the hash of the 3 bytes at the start of the data
+ */
+#define fwnt_bench_lzx_get_hash( data ) \
+	(size_t) ( ( ( ( (uint32_t) ( data )[ 0 ] << 16 ) | ( (uint32_t) ( data )[ 1 ] << 8 ) | (uint32_t) ( data )[ 2 ] ) * 2654435761UL ) >> 16 ) & ( FWNT_BENCH_LZX_HASH_TABLE_SIZE - 1 )
+
+/* Compresses data using LZX compression
+ * Returns 1 on success or -1 on error
+ */
+int fwnt_bench_lzx_encoder_compress(
+     const uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     uint8_t *compressed_data,
+     size_t *compressed_data_size )
+{
+	uint8_t lengths_code_size_array[ 249 ];
+	uint8_t main_code_size_array[ 256 + 240 ];
+
+	fwnt_bench_lzx_bit_writer_t bit_writer;
+
+	uint8_t *data                = NULL;
+	uint32_t *hash_table         = NULL;
+	uint32_t *previous_positions = NULL;
+	size_t block_end_offset      = 0;
+	size_t block_size            = 0;
+	size_t candidate_offset      = 0;
+	size_t data_offset           = 0;
+	size_t hash                  = 0;
+	size_t match_offset          = 0;
+	size_t match_size            = 0;
+	size_t maximum_match_size    = 0;
+	size_t size                  = 0;
+	uint32_t chain_length        = 0;
+	uint32_t match_header        = 0;
+	int position_slot            = 0;
+
+	if( ( uncompressed_data == NULL )
+	 || ( uncompressed_data_size > (size_t) INT32_MAX )
+	 || ( compressed_data == NULL )
+	 || ( compressed_data_size == NULL ) )
+	{
+		return( -1 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    uncompressed_data_size + 1 );
+
+	hash_table = (uint32_t *) memory_allocate(
+	                           sizeof( uint32_t ) * FWNT_BENCH_LZX_HASH_TABLE_SIZE );
+
+	previous_positions = (uint32_t *) memory_allocate(
+	                                   sizeof( uint32_t ) * ( uncompressed_data_size + 1 ) );
+
+	if( ( data == NULL )
+	 || ( hash_table == NULL )
+	 || ( previous_positions == NULL ) )
+	{
+		goto on_error;
+	}
+	memory_copy(
+	 data,
+	 uncompressed_data,
+	 uncompressed_data_size );
+
+	memory_set(
+	 hash_table,
+	 0,
+	 sizeof( uint32_t ) * FWNT_BENCH_LZX_HASH_TABLE_SIZE );
+
+	memory_set(
+	 main_code_size_array,
+	 0,
+	 sizeof( uint8_t ) * ( 256 + 240 ) );
+
+	memory_set(
+	 lengths_code_size_array,
+	 0,
+	 sizeof( uint8_t ) * 249 );
+
+	memory_set(
+	 &bit_writer,
+	 0,
+	 sizeof( fwnt_bench_lzx_bit_writer_t ) );
+
+	bit_writer.data      = compressed_data;
+	bit_writer.data_size = *compressed_data_size;
+
+	fwnt_bench_lzx_translate_call_instructions(
+	 data,
+	 uncompressed_data_size );
+
+	while( data_offset < uncompressed_data_size )
+	{
+		block_size = uncompressed_data_size - data_offset;
+
+		if( block_size > FWNT_BENCH_LZX_BLOCK_SIZE )
+		{
+			block_size = FWNT_BENCH_LZX_BLOCK_SIZE;
+		}
+		block_end_offset = data_offset + block_size;
+
+		/* Verbatim block type
+		 */
+		fwnt_bench_lzx_bit_writer_put(
+		 &bit_writer,
+		 1,
+		 3 );
+
+		if( block_size == FWNT_BENCH_LZX_BLOCK_SIZE )
+		{
+			fwnt_bench_lzx_bit_writer_put(
+			 &bit_writer,
+			 1,
+			 1 );
+		}
+		else
+		{
+			fwnt_bench_lzx_bit_writer_put(
+			 &bit_writer,
+			 0,
+			 1 );
+
+			fwnt_bench_lzx_bit_writer_put(
+			 &bit_writer,
+			 (uint32_t) block_size,
+			 16 );
+		}
+		/* Every main tree symbol has a code size of 9 bits and every lengths tree symbol
+		 * a code size of 8 bits, hence the code of a symbol is the symbol itself
+		 */
+		fwnt_bench_lzx_write_code_sizes(
+		 &bit_writer,
+		 main_code_size_array,
+		 256,
+		 9 );
+
+		fwnt_bench_lzx_write_code_sizes(
+		 &bit_writer,
+		 &( main_code_size_array[ 256 ] ),
+		 240,
+		 9 );
+
+		fwnt_bench_lzx_write_code_sizes(
+		 &bit_writer,
+		 lengths_code_size_array,
+		 249,
+		 8 );
+
+		while( data_offset < block_end_offset )
+		{
+			match_size   = 0;
+			match_offset = 0;
+
+			maximum_match_size = block_end_offset - data_offset;
+
+			if( maximum_match_size > FWNT_BENCH_LZX_MAXIMUM_MATCH_SIZE )
+			{
+				maximum_match_size = FWNT_BENCH_LZX_MAXIMUM_MATCH_SIZE;
+			}
+			if( maximum_match_size >= FWNT_BENCH_LZX_MINIMUM_MATCH_SIZE )
+			{
+				hash             = fwnt_bench_lzx_get_hash( &( data[ data_offset ] ) );
+				candidate_offset = hash_table[ hash ];
+
+				for( chain_length = 0;
+				     ( candidate_offset > 0 ) && ( chain_length < FWNT_BENCH_LZX_MAXIMUM_CHAIN_LENGTH );
+				     chain_length++ )
+				{
+					candidate_offset -= 1;
+
+					if( ( data_offset - candidate_offset ) > FWNT_BENCH_LZX_MAXIMUM_MATCH_OFFSET )
+					{
+						break;
+					}
+					for( size = 0;
+					     size < maximum_match_size;
+					     size++ )
+					{
+						if( data[ candidate_offset + size ] != data[ data_offset + size ] )
+						{
+							break;
+						}
+					}
+					if( size > match_size )
+					{
+						match_size   = size;
+						match_offset = data_offset - candidate_offset;
+
+						if( size == maximum_match_size )
+						{
+							break;
+						}
+					}
+					candidate_offset = previous_positions[ candidate_offset ];
+				}
+			}
+			if( match_size < FWNT_BENCH_LZX_MINIMUM_MATCH_SIZE )
+			{
+				match_size = 1;
+
+				fwnt_bench_lzx_bit_writer_put(
+				 &bit_writer,
+				 data[ data_offset ],
+				 9 );
+			}
+			else
+			{
+				/* Recent match offsets are not used, hence position slots 0 to 2 are not either
+				 */
+				for( position_slot = FWNT_BENCH_LZX_NUMBER_OF_POSITION_SLOTS - 1;
+				     position_slot > 3;
+				     position_slot-- )
+				{
+					if( fwnt_bench_lzx_position_base[ position_slot ] <= (int32_t) match_offset )
+					{
+						break;
+					}
+				}
+				match_header = (uint32_t) match_size - 2;
+
+				if( match_header > 7 )
+				{
+					match_header = 7;
+				}
+				fwnt_bench_lzx_bit_writer_put(
+				 &bit_writer,
+				 256 + ( (uint32_t) position_slot * 8 ) + match_header,
+				 9 );
+
+				if( match_header == 7 )
+				{
+					fwnt_bench_lzx_bit_writer_put(
+					 &bit_writer,
+					 (uint32_t) match_size - 9,
+					 8 );
+				}
+				fwnt_bench_lzx_bit_writer_put(
+				 &bit_writer,
+				 (uint32_t) ( (int32_t) match_offset - fwnt_bench_lzx_position_base[ position_slot ] ),
+				 fwnt_bench_lzx_number_of_footer_bits[ position_slot ] );
+			}
+			/* Add the positions of the literal or match to the hash chains
+			 */
+			while( match_size > 0 )
+			{
+				if( ( uncompressed_data_size - data_offset ) >= 3 )
+				{
+					hash = fwnt_bench_lzx_get_hash( &( data[ data_offset ] ) );
+
+					previous_positions[ data_offset ] = hash_table[ hash ];
+					hash_table[ hash ]                = (uint32_t) ( data_offset + 1 );
+				}
+				data_offset++;
+				match_size--;
+			}
+		}
+	}
+	/* Pad the last 16-bit word
+	 */
+	if( bit_writer.bit_buffer_size > 0 )
+	{
+		fwnt_bench_lzx_bit_writer_put(
+		 &bit_writer,
+		 0,
+		 16 - bit_writer.bit_buffer_size );
+	}
+	if( bit_writer.overflow != 0 )
+	{
+		goto on_error;
+	}
+	*compressed_data_size = bit_writer.data_offset;
+
+	memory_free(
+	 previous_positions );
+	memory_free(
+	 hash_table );
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( previous_positions != NULL )
+	{
+		memory_free(
+		 previous_positions );
+	}
+	if( hash_table != NULL )
+	{
+		memory_free(
+		 hash_table );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
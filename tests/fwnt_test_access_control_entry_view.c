@@ -0,0 +1,782 @@
+/*
+ * Library access_control_entry_view functions test program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_access_control_entry_view.h"
+
+uint8_t fwnt_test_access_control_entry_view_data1[ 20 ] = {
+	0x00, 0x00, 0x14, 0x00, 0x9f, 0x01, 0x12, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x12, 0x00, 0x00, 0x00 };
+
+/* Object access control entry with an object type
+ */
+uint8_t fwnt_test_access_control_entry_view_data2[ 40 ] = {
+	0x05, 0x00, 0x28, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x42, 0x16, 0x4c, 0xc0,
+	0x20, 0xd0, 0x11, 0xa7, 0x68, 0x00, 0xaa, 0x00, 0x6e, 0x05, 0x29, 0x14, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x0b, 0x00, 0x00, 0x00 };
+
+/* Access allowed compound access control entry
+ */
+uint8_t fwnt_test_access_control_entry_view_data3[ 8 ] = {
+	0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwnt_access_control_entry_view_set_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_entry_view_set_from_byte_stream(
+     void )
+{
+	libfwnt_access_control_entry_view_t access_control_entry_view;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          &access_control_entry_view,
+	          fwnt_test_access_control_entry_view_data1,
+	          20,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "access_control_entry_view.data_size",
+	 access_control_entry_view.data_size,
+	 (size_t) 20 );
+
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          &access_control_entry_view,
+	          fwnt_test_access_control_entry_view_data2,
+	          40,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          &access_control_entry_view,
+	          fwnt_test_access_control_entry_view_data3,
+	          8,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          NULL,
+	          fwnt_test_access_control_entry_view_data1,
+	          20,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          &access_control_entry_view,
+	          NULL,
+	          20,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          &access_control_entry_view,
+	          fwnt_test_access_control_entry_view_data1,
+	          0,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          &access_control_entry_view,
+	          fwnt_test_access_control_entry_view_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          &access_control_entry_view,
+	          fwnt_test_access_control_entry_view_data1,
+	          16,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          &access_control_entry_view,
+	          fwnt_test_access_control_entry_view_data1,
+	          20,
+	          (uint8_t) 'X',
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_control_entry_view_get_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_entry_view_get_type(
+     void )
+{
+	libfwnt_access_control_entry_view_t access_control_entry_view;
+
+	libcerror_error_t *error = NULL;
+	uint8_t type             = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          &access_control_entry_view,
+	          fwnt_test_access_control_entry_view_data1,
+	          20,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_entry_view_get_type(
+	          &access_control_entry_view,
+	          &type,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "type",
+	 type,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_entry_view_get_type(
+	          NULL,
+	          &type,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_view_get_type(
+	          &access_control_entry_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_control_entry_view_get_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_entry_view_get_flags(
+     void )
+{
+	libfwnt_access_control_entry_view_t access_control_entry_view;
+
+	libcerror_error_t *error = NULL;
+	uint8_t flags            = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          &access_control_entry_view,
+	          fwnt_test_access_control_entry_view_data1,
+	          20,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_entry_view_get_flags(
+	          &access_control_entry_view,
+	          &flags,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "flags",
+	 flags,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_entry_view_get_flags(
+	          NULL,
+	          &flags,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_view_get_flags(
+	          &access_control_entry_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_control_entry_view_get_access_mask function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_entry_view_get_access_mask(
+     void )
+{
+	libfwnt_access_control_entry_view_t access_control_entry_view;
+
+	libcerror_error_t *error = NULL;
+	uint32_t access_mask     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          &access_control_entry_view,
+	          fwnt_test_access_control_entry_view_data1,
+	          20,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_entry_view_get_access_mask(
+	          &access_control_entry_view,
+	          &access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "access_mask",
+	 access_mask,
+	 (uint32_t) 0x0012019fUL );
+
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          &access_control_entry_view,
+	          fwnt_test_access_control_entry_view_data3,
+	          8,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_view_get_access_mask(
+	          &access_control_entry_view,
+	          &access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_entry_view_get_access_mask(
+	          NULL,
+	          &access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_view_get_access_mask(
+	          &access_control_entry_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_control_entry_view_get_security_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_entry_view_get_security_identifier(
+     void )
+{
+	libfwnt_access_control_entry_view_t access_control_entry_view;
+	libfwnt_security_identifier_view_t security_identifier_view;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          &access_control_entry_view,
+	          fwnt_test_access_control_entry_view_data1,
+	          20,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_entry_view_get_security_identifier(
+	          &access_control_entry_view,
+	          &security_identifier_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "security_identifier_view.data",
+	 (int) ( security_identifier_view.data - fwnt_test_access_control_entry_view_data1 ),
+	 8 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "security_identifier_view.data_size",
+	 security_identifier_view.data_size,
+	 (size_t) 12 );
+
+	/* Test an object access control entry where the security identifier follows the object type
+	 */
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          &access_control_entry_view,
+	          fwnt_test_access_control_entry_view_data2,
+	          40,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_view_get_security_identifier(
+	          &access_control_entry_view,
+	          &security_identifier_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "security_identifier_view.data",
+	 (int) ( security_identifier_view.data - fwnt_test_access_control_entry_view_data2 ),
+	 28 );
+
+	/* Test an access control entry type without a security identifier
+	 */
+	result = libfwnt_access_control_entry_view_set_from_byte_stream(
+	          &access_control_entry_view,
+	          fwnt_test_access_control_entry_view_data3,
+	          8,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_view_get_security_identifier(
+	          &access_control_entry_view,
+	          &security_identifier_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_entry_view_get_security_identifier(
+	          NULL,
+	          &security_identifier_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_view_get_security_identifier(
+	          &access_control_entry_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_entry_view_set_from_byte_stream",
+	 fwnt_test_access_control_entry_view_set_from_byte_stream );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_entry_view_get_type",
+	 fwnt_test_access_control_entry_view_get_type );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_entry_view_get_flags",
+	 fwnt_test_access_control_entry_view_get_flags );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_entry_view_get_access_mask",
+	 fwnt_test_access_control_entry_view_get_access_mask );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_entry_view_get_security_identifier",
+	 fwnt_test_access_control_entry_view_get_security_identifier );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
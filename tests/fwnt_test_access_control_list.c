@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -713,6 +714,231 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwnt_access_control_list_get_byte_stream_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_list_get_byte_stream_size(
+     libfwnt_access_control_list_t *access_control_list )
+{
+	libcerror_error_t *error = NULL;
+	size_t byte_stream_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_list_get_byte_stream_size(
+	          access_control_list,
+	          &byte_stream_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 52 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_list_get_byte_stream_size(
+	          NULL,
+	          &byte_stream_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_get_byte_stream_size(
+	          access_control_list,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_control_list_copy_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_list_copy_to_byte_stream(
+     libfwnt_access_control_list_t *access_control_list )
+{
+	uint8_t byte_stream[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_list_copy_to_byte_stream(
+	          access_control_list,
+	          byte_stream,
+	          64,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_access_control_list_data1,
+	          52 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_list_copy_to_byte_stream(
+	          NULL,
+	          byte_stream,
+	          64,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_copy_to_byte_stream(
+	          access_control_list,
+	          NULL,
+	          64,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_copy_to_byte_stream(
+	          access_control_list,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_copy_to_byte_stream(
+	          access_control_list,
+	          byte_stream,
+	          51,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_copy_to_byte_stream(
+	          access_control_list,
+	          byte_stream,
+	          64,
+	          -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
 
 /* The main program
@@ -799,6 +1025,16 @@ int main(
 
 	/* Run tests
 	 */
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_access_control_list_get_byte_stream_size",
+	 fwnt_test_access_control_list_get_byte_stream_size,
+	 access_control_list );
+
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_access_control_list_copy_to_byte_stream",
+	 fwnt_test_access_control_list_copy_to_byte_stream,
+	 access_control_list );
+
 	FWNT_TEST_RUN_WITH_ARGS(
 	 "libfwnt_access_control_list_get_number_of_entries",
 	 fwnt_test_access_control_list_get_number_of_entries,
@@ -0,0 +1,561 @@
+/*
+ * Library access_control_list_builder functions test program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_access_control_list_builder.h"
+
+uint8_t fwnt_test_access_control_list_builder_data1[ 52 ] = {
+	0x02, 0x00, 0x34, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x9f, 0x01, 0x12, 0x00,
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+	0x9f, 0x01, 0x12, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00 };
+
+/* Tests the libfwnt_access_control_list_builder_set_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_list_builder_set_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ 64 ];
+	libfwnt_access_control_list_builder_t access_control_list_builder;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_list_builder_set_byte_stream(
+	          &access_control_list_builder,
+	          byte_stream,
+	          64,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "access_control_list_builder.data_size",
+	 access_control_list_builder.data_size,
+	 (size_t) 8 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT16(
+	 "access_control_list_builder.number_of_entries",
+	 access_control_list_builder.number_of_entries,
+	 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "byte_stream[ 0 ]",
+	 byte_stream[ 0 ],
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_list_builder_set_byte_stream(
+	          NULL,
+	          byte_stream,
+	          64,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_builder_set_byte_stream(
+	          &access_control_list_builder,
+	          NULL,
+	          64,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_builder_set_byte_stream(
+	          &access_control_list_builder,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_builder_set_byte_stream(
+	          &access_control_list_builder,
+	          byte_stream,
+	          7,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_builder_set_byte_stream(
+	          &access_control_list_builder,
+	          byte_stream,
+	          64,
+	          -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_control_list_builder_append_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_list_builder_append_entry(
+     void )
+{
+	uint8_t byte_stream[ 64 ];
+	libfwnt_access_control_list_builder_t access_control_list_builder;
+	libfwnt_access_control_list_view_t access_control_list_view;
+
+	libcerror_error_t *error                            = NULL;
+	libfwnt_security_identifier_t *security_identifier1 = NULL;
+	libfwnt_security_identifier_t *security_identifier2 = NULL;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier1",
+	 security_identifier1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          security_identifier1,
+	          &( fwnt_test_access_control_list_builder_data1[ 16 ] ),
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier2",
+	 security_identifier2 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          security_identifier2,
+	          &( fwnt_test_access_control_list_builder_data1[ 36 ] ),
+	          16,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_list_builder_set_byte_stream(
+	          &access_control_list_builder,
+	          byte_stream,
+	          64,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_list_builder_append_entry(
+	          &access_control_list_builder,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0,
+	          0x0012019fUL,
+	          security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_list_builder_append_entry(
+	          &access_control_list_builder,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0,
+	          0x0012019fUL,
+	          security_identifier2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "access_control_list_builder.data_size",
+	 access_control_list_builder.data_size,
+	 (size_t) 52 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT16(
+	 "access_control_list_builder.number_of_entries",
+	 access_control_list_builder.number_of_entries,
+	 2 );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_access_control_list_builder_data1,
+	          52 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_access_control_list_view_set_from_byte_stream(
+	          &access_control_list_view,
+	          byte_stream,
+	          access_control_list_builder.data_size,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_list_builder_append_entry(
+	          NULL,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0,
+	          0x0012019fUL,
+	          security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_builder_append_entry(
+	          &access_control_list_builder,
+	          LIBFWNT_ACCESS_ALLOWED_OBJECT,
+	          0,
+	          0x0012019fUL,
+	          security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_builder_append_entry(
+	          &access_control_list_builder,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0,
+	          0x0012019fUL,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test append entry with a byte stream that is too small
+	 */
+	result = libfwnt_access_control_list_builder_set_byte_stream(
+	          &access_control_list_builder,
+	          byte_stream,
+	          20,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_list_builder_append_entry(
+	          &access_control_list_builder,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0,
+	          0x0012019fUL,
+	          security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "access_control_list_builder.data_size",
+	 access_control_list_builder.data_size,
+	 (size_t) 8 );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier1",
+	 security_identifier1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_free(
+	          &security_identifier2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier2",
+	 security_identifier2 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier2 != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier2,
+		 NULL );
+	}
+	if( security_identifier1 != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier1,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_list_builder_set_byte_stream",
+	 fwnt_test_access_control_list_builder_set_byte_stream );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_list_builder_append_entry",
+	 fwnt_test_access_control_list_builder_append_entry );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
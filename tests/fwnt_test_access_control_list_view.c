@@ -0,0 +1,635 @@
+/*
+ * Library access_control_list_view functions test program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_access_control_list_view.h"
+
+uint8_t fwnt_test_access_control_list_view_data1[ 52 ] = {
+	0x02, 0x00, 0x34, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x9f, 0x01, 0x12, 0x00,
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+	0x9f, 0x01, 0x12, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00 };
+
+/* Tests the libfwnt_access_control_list_view_set_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_list_view_set_from_byte_stream(
+     void )
+{
+	uint8_t data[ 52 ];
+	libfwnt_access_control_list_view_t access_control_list_view;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_list_view_set_from_byte_stream(
+	          &access_control_list_view,
+	          fwnt_test_access_control_list_view_data1,
+	          52,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "access_control_list_view.data_size",
+	 access_control_list_view.data_size,
+	 (size_t) 52 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_list_view_set_from_byte_stream(
+	          NULL,
+	          fwnt_test_access_control_list_view_data1,
+	          52,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_view_set_from_byte_stream(
+	          &access_control_list_view,
+	          NULL,
+	          52,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_view_set_from_byte_stream(
+	          &access_control_list_view,
+	          fwnt_test_access_control_list_view_data1,
+	          0,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_view_set_from_byte_stream(
+	          &access_control_list_view,
+	          fwnt_test_access_control_list_view_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_view_set_from_byte_stream(
+	          &access_control_list_view,
+	          fwnt_test_access_control_list_view_data1,
+	          48,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_view_set_from_byte_stream(
+	          &access_control_list_view,
+	          fwnt_test_access_control_list_view_data1,
+	          52,
+	          (uint8_t) 'X',
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with more entries than stored in the access control list
+	 */
+	if( memory_copy(
+	     data,
+	     fwnt_test_access_control_list_view_data1,
+	     52 ) == NULL )
+	{
+		goto on_error;
+	}
+	data[ 4 ] = 0x03;
+
+	result = libfwnt_access_control_list_view_set_from_byte_stream(
+	          &access_control_list_view,
+	          data,
+	          52,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_control_list_view_get_revision_number function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_list_view_get_revision_number(
+     void )
+{
+	libfwnt_access_control_list_view_t access_control_list_view;
+
+	libcerror_error_t *error = NULL;
+	uint8_t revision_number  = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_control_list_view_set_from_byte_stream(
+	          &access_control_list_view,
+	          fwnt_test_access_control_list_view_data1,
+	          52,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_list_view_get_revision_number(
+	          &access_control_list_view,
+	          &revision_number,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "revision_number",
+	 revision_number,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_list_view_get_revision_number(
+	          NULL,
+	          &revision_number,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_view_get_revision_number(
+	          &access_control_list_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_control_list_view_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_list_view_get_number_of_entries(
+     void )
+{
+	libfwnt_access_control_list_view_t access_control_list_view;
+
+	libcerror_error_t *error = NULL;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_control_list_view_set_from_byte_stream(
+	          &access_control_list_view,
+	          fwnt_test_access_control_list_view_data1,
+	          52,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_list_view_get_number_of_entries(
+	          &access_control_list_view,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_list_view_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_view_get_number_of_entries(
+	          &access_control_list_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_control_list_view_get_entry_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_list_view_get_entry_by_index(
+     void )
+{
+	libfwnt_access_control_entry_view_t access_control_entry_view;
+	libfwnt_access_control_list_view_t access_control_list_view;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_control_list_view_set_from_byte_stream(
+	          &access_control_list_view,
+	          fwnt_test_access_control_list_view_data1,
+	          52,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_list_view_get_entry_by_index(
+	          &access_control_list_view,
+	          0,
+	          &access_control_entry_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "access_control_entry_view.data",
+	 (int) ( access_control_entry_view.data - fwnt_test_access_control_list_view_data1 ),
+	 8 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "access_control_entry_view.data_size",
+	 access_control_entry_view.data_size,
+	 (size_t) 20 );
+
+	result = libfwnt_access_control_list_view_get_entry_by_index(
+	          &access_control_list_view,
+	          1,
+	          &access_control_entry_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "access_control_entry_view.data",
+	 (int) ( access_control_entry_view.data - fwnt_test_access_control_list_view_data1 ),
+	 28 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "access_control_entry_view.data_size",
+	 access_control_entry_view.data_size,
+	 (size_t) 24 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_list_view_get_entry_by_index(
+	          NULL,
+	          0,
+	          &access_control_entry_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_view_get_entry_by_index(
+	          &access_control_list_view,
+	          -1,
+	          &access_control_entry_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_view_get_entry_by_index(
+	          &access_control_list_view,
+	          2,
+	          &access_control_entry_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_list_view_get_entry_by_index(
+	          &access_control_list_view,
+	          0,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_list_view_set_from_byte_stream",
+	 fwnt_test_access_control_list_view_set_from_byte_stream );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_list_view_get_revision_number",
+	 fwnt_test_access_control_list_view_get_revision_number );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_list_view_get_number_of_entries",
+	 fwnt_test_access_control_list_view_get_number_of_entries );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_list_view_get_entry_by_index",
+	 fwnt_test_access_control_list_view_get_entry_by_index );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2005 @@
+/*
+ * Library access_token functions test program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_access_token.h"
+
+uint8_t fwnt_test_access_token_data1[ 116 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x48, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x34, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x9f, 0x01, 0x12, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x9f, 0x01, 0x12, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x15, 0x00, 0x00, 0x00, 0x52, 0xaa, 0xc8, 0x68, 0xdd, 0xe8, 0xe4, 0x1c, 0x8a, 0xa7, 0x32, 0x3f,
+	0xeb, 0x03, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00 };
+
+/* Tests the libfwnt_access_token_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_token_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfwnt_access_token_t *access_token = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 1;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_token_initialize(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_free(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_token_initialize(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	access_token = (libfwnt_access_token_t *) 0x12345678UL;
+
+	result = libfwnt_access_token_initialize(
+	          &access_token,
+	          &error );
+
+	access_token = NULL;
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_access_token_initialize with malloc failing
+		 */
+		fwnt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwnt_access_token_initialize(
+		          &access_token,
+		          &error );
+
+		if( fwnt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwnt_test_malloc_attempts_before_fail = -1;
+
+			if( access_token != NULL )
+			{
+				libfwnt_access_token_free(
+				 &access_token,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "access_token",
+			 access_token );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_access_token_initialize with memset failing
+		 */
+		fwnt_test_memset_attempts_before_fail = test_number;
+
+		result = libfwnt_access_token_initialize(
+		          &access_token,
+		          &error );
+
+		if( fwnt_test_memset_attempts_before_fail != -1 )
+		{
+			fwnt_test_memset_attempts_before_fail = -1;
+
+			if( access_token != NULL )
+			{
+				libfwnt_access_token_free(
+				 &access_token,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "access_token",
+			 access_token );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWNT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_token != NULL )
+	{
+		libfwnt_access_token_free(
+		 &access_token,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_token_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_token_free(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_token_free(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_token_append_security_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_token_append_security_identifier(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error                            = NULL;
+	libfwnt_access_token_t *access_token                = NULL;
+	libfwnt_security_identifier_t *security_identifier1 = NULL;
+	libfwnt_security_identifier_t *security_identifier2 = NULL;
+	int number_of_security_identifiers                  = 0;
+	int result                                          = 0;
+	int string_length                                   = 0;
+	int sub_authority                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_token_initialize(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier1,
+	          (uint8_t *) "S-1-5-18",
+	          9,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier2,
+	          (uint8_t *) "S-1-5-32-544",
+	          13,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_token_append_security_identifier(
+	          access_token,
+	          security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_get_number_of_security_identifiers(
+	          access_token,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 1 );
+
+	/* Test that appending the same security identifier has no effect
+	 */
+	result = libfwnt_access_token_append_security_identifier(
+	          access_token,
+	          security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_get_number_of_security_identifiers(
+	          access_token,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 1 );
+
+	/* Test that the hash table grows while retaining the security identifiers
+	 */
+	for( sub_authority = 1000;
+	     sub_authority < 1100;
+	     sub_authority++ )
+	{
+		string_length = narrow_string_snprintf(
+		                 (char *) utf8_string,
+		                 64,
+		                 "S-1-5-21-1-2-3-%d",
+		                 sub_authority );
+
+		FWNT_TEST_ASSERT_GREATER_THAN_INT(
+		 "string_length",
+		 string_length,
+		 0 );
+
+		result = libfwnt_security_identifier_copy_from_utf8_string(
+		          security_identifier2,
+		          utf8_string,
+		          (size_t) string_length + 1,
+		          0,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwnt_access_token_append_security_identifier(
+		          access_token,
+		          security_identifier2,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	result = libfwnt_access_token_get_number_of_security_identifiers(
+	          access_token,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 101 );
+
+	for( sub_authority = 1000;
+	     sub_authority < 1100;
+	     sub_authority++ )
+	{
+		string_length = narrow_string_snprintf(
+		                 (char *) utf8_string,
+		                 64,
+		                 "S-1-5-21-1-2-3-%d",
+		                 sub_authority );
+
+		FWNT_TEST_ASSERT_GREATER_THAN_INT(
+		 "string_length",
+		 string_length,
+		 0 );
+
+		result = libfwnt_security_identifier_copy_from_utf8_string(
+		          security_identifier2,
+		          utf8_string,
+		          (size_t) string_length + 1,
+		          0,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwnt_access_token_has_security_identifier(
+		          access_token,
+		          security_identifier2,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_token_append_security_identifier(
+	          NULL,
+	          security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_append_security_identifier(
+	          access_token,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_free(
+	          &security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_free(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier2 != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier2,
+		 NULL );
+	}
+	if( security_identifier1 != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier1,
+		 NULL );
+	}
+	if( access_token != NULL )
+	{
+		libfwnt_access_token_free(
+		 &access_token,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_token_get_number_of_security_identifiers function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_token_get_number_of_security_identifiers(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfwnt_access_token_t *access_token = NULL;
+	int number_of_security_identifiers   = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_token_initialize(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_token_get_number_of_security_identifiers(
+	          access_token,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_token_get_number_of_security_identifiers(
+	          NULL,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_get_number_of_security_identifiers(
+	          access_token,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_access_token_free(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_token != NULL )
+	{
+		libfwnt_access_token_free(
+		 &access_token,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_token_has_security_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_token_has_security_identifier(
+     void )
+{
+	libcerror_error_t *error                            = NULL;
+	libfwnt_access_token_t *access_token                = NULL;
+	libfwnt_security_identifier_t *security_identifier1 = NULL;
+	libfwnt_security_identifier_t *security_identifier2 = NULL;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_token_initialize(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier1,
+	          (uint8_t *) "S-1-5-18",
+	          9,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier2,
+	          (uint8_t *) "S-1-5-32-544",
+	          13,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_token_has_security_identifier(
+	          access_token,
+	          security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_security_identifier(
+	          access_token,
+	          security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_has_security_identifier(
+	          access_token,
+	          security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_has_security_identifier(
+	          access_token,
+	          security_identifier2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_token_has_security_identifier(
+	          NULL,
+	          security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_has_security_identifier(
+	          access_token,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_free(
+	          &security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_free(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier2 != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier2,
+		 NULL );
+	}
+	if( security_identifier1 != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier1,
+		 NULL );
+	}
+	if( access_token != NULL )
+	{
+		libfwnt_access_token_free(
+		 &access_token,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_token_get_granted_access_mask function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_token_get_granted_access_mask(
+     void )
+{
+	uint8_t data[ 116 ];
+
+	libcerror_error_t *error                            = NULL;
+	libfwnt_access_token_t *access_token                = NULL;
+	libfwnt_security_identifier_t *security_identifier1 = NULL;
+	libfwnt_security_identifier_t *security_identifier2 = NULL;
+	uint32_t granted_access_mask                        = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_token_initialize(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier1,
+	          (uint8_t *) "S-1-5-18",
+	          9,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier2,
+	          (uint8_t *) "S-1-5-32-544",
+	          13,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* Test that an access token without matching security identifiers is granted no access
+	 */
+	result = libfwnt_access_token_get_granted_access_mask(
+	          access_token,
+	          fwnt_test_access_token_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &granted_access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_mask",
+	 granted_access_mask,
+	 (uint32_t) 0 );
+
+	result = libfwnt_access_token_append_security_identifier(
+	          access_token,
+	          security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_get_granted_access_mask(
+	          access_token,
+	          fwnt_test_access_token_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &granted_access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_mask",
+	 granted_access_mask,
+	 (uint32_t) 0x0012019fUL );
+
+	/* Test that a deny entry takes precedence over a subsequent allow entry
+	 */
+	if( memory_copy(
+	     data,
+	     fwnt_test_access_token_data1,
+	     116 ) == NULL )
+	{
+		goto on_error;
+	}
+	data[ 28 ] = 0x01;
+
+	result = libfwnt_access_token_get_granted_access_mask(
+	          access_token,
+	          data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &granted_access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_mask",
+	 granted_access_mask,
+	 (uint32_t) 0 );
+
+	/* Test that a deny entry only denies the rights that were not granted before
+	 */
+	if( memory_copy(
+	     data,
+	     fwnt_test_access_token_data1,
+	     116 ) == NULL )
+	{
+		goto on_error;
+	}
+	data[ 48 ] = 0x01;
+
+	result = libfwnt_access_token_append_security_identifier(
+	          access_token,
+	          security_identifier2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_get_granted_access_mask(
+	          access_token,
+	          data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &granted_access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_mask",
+	 granted_access_mask,
+	 (uint32_t) 0x0012019fUL );
+
+	/* Test that an inherit-only entry is skipped
+	 */
+	if( memory_copy(
+	     data,
+	     fwnt_test_access_token_data1,
+	     116 ) == NULL )
+	{
+		goto on_error;
+	}
+	data[ 28 ] = 0x01;
+	data[ 29 ] = 0x08;
+
+	result = libfwnt_access_token_get_granted_access_mask(
+	          access_token,
+	          data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &granted_access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_mask",
+	 granted_access_mask,
+	 (uint32_t) 0x0012019fUL );
+
+	if( memory_copy(
+	     data,
+	     fwnt_test_access_token_data1,
+	     116 ) == NULL )
+	{
+		goto on_error;
+	}
+	data[ 29 ] = 0x08;
+	data[ 48 ] = 0x01;
+
+	result = libfwnt_access_token_get_granted_access_mask(
+	          access_token,
+	          data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &granted_access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_mask",
+	 granted_access_mask,
+	 (uint32_t) 0 );
+
+	/* Test that a security descriptor without a discretionary access control list grants all access
+	 */
+	if( memory_copy(
+	     data,
+	     fwnt_test_access_token_data1,
+	     116 ) == NULL )
+	{
+		goto on_error;
+	}
+	data[ 2 ] = 0x00;
+
+	result = libfwnt_access_token_get_granted_access_mask(
+	          access_token,
+	          data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &granted_access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_mask",
+	 granted_access_mask,
+	 (uint32_t) 0x001fffffUL );
+
+	/* Test that an empty discretionary access control list grants no access
+	 */
+	if( memory_copy(
+	     data,
+	     fwnt_test_access_token_data1,
+	     116 ) == NULL )
+	{
+		goto on_error;
+	}
+	data[ 24 ] = 0x00;
+
+	result = libfwnt_access_token_get_granted_access_mask(
+	          access_token,
+	          data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &granted_access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_mask",
+	 granted_access_mask,
+	 (uint32_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_token_get_granted_access_mask(
+	          NULL,
+	          fwnt_test_access_token_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &granted_access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_get_granted_access_mask(
+	          access_token,
+	          NULL,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &granted_access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_get_granted_access_mask(
+	          access_token,
+	          fwnt_test_access_token_data1,
+	          0,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &granted_access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_get_granted_access_mask(
+	          access_token,
+	          fwnt_test_access_token_data1,
+	          116,
+	          (uint8_t) 'X',
+	          &granted_access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_get_granted_access_mask(
+	          access_token,
+	          fwnt_test_access_token_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with data that is not a valid security descriptor
+	 */
+	if( memory_copy(
+	     data,
+	     fwnt_test_access_token_data1,
+	     116 ) == NULL )
+	{
+		goto on_error;
+	}
+	data[ 22 ] = 0xff;
+
+	result = libfwnt_access_token_get_granted_access_mask(
+	          access_token,
+	          data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &granted_access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_free(
+	          &security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_free(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier2 != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier2,
+		 NULL );
+	}
+	if( security_identifier1 != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier1,
+		 NULL );
+	}
+	if( access_token != NULL )
+	{
+		libfwnt_access_token_free(
+		 &access_token,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_token_get_granted_access_masks function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_token_get_granted_access_masks(
+     void )
+{
+	const uint8_t *byte_streams[ 3 ];
+	size_t byte_stream_sizes[ 3 ];
+	uint32_t granted_access_masks[ 3 ];
+	uint8_t data[ 116 ];
+
+	libcerror_error_t *error                           = NULL;
+	libfwnt_access_token_t *access_token               = NULL;
+	libfwnt_security_identifier_t *security_identifier = NULL;
+	int result                                         = 0;
+
+	byte_streams[ 0 ]      = fwnt_test_access_token_data1;
+	byte_streams[ 1 ]      = data;
+	byte_streams[ 2 ]      = fwnt_test_access_token_data1;
+	byte_stream_sizes[ 0 ] = 116;
+	byte_stream_sizes[ 1 ] = 116;
+	byte_stream_sizes[ 2 ] = 116;
+
+	if( memory_copy(
+	     data,
+	     fwnt_test_access_token_data1,
+	     116 ) == NULL )
+	{
+		goto on_error;
+	}
+	data[ 2 ] = 0x00;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_token_initialize(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          (uint8_t *) "S-1-5-18",
+	          9,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_security_identifier(
+	          access_token,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_token_get_granted_access_masks(
+	          access_token,
+	          byte_streams,
+	          byte_stream_sizes,
+	          3,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          granted_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_masks[ 0 ]",
+	 granted_access_masks[ 0 ],
+	 (uint32_t) 0x0012019fUL );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_masks[ 1 ]",
+	 granted_access_masks[ 1 ],
+	 (uint32_t) 0x001fffffUL );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_masks[ 2 ]",
+	 granted_access_masks[ 2 ],
+	 (uint32_t) 0x0012019fUL );
+
+	result = libfwnt_access_token_get_granted_access_masks(
+	          access_token,
+	          byte_streams,
+	          byte_stream_sizes,
+	          0,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          granted_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_token_get_granted_access_masks(
+	          NULL,
+	          byte_streams,
+	          byte_stream_sizes,
+	          3,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          granted_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_get_granted_access_masks(
+	          access_token,
+	          NULL,
+	          byte_stream_sizes,
+	          3,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          granted_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_get_granted_access_masks(
+	          access_token,
+	          byte_streams,
+	          NULL,
+	          3,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          granted_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_get_granted_access_masks(
+	          access_token,
+	          byte_streams,
+	          byte_stream_sizes,
+	          -1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          granted_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_get_granted_access_masks(
+	          access_token,
+	          byte_streams,
+	          byte_stream_sizes,
+	          3,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a byte stream that is not a valid security descriptor
+	 */
+	byte_stream_sizes[ 1 ] = 0;
+
+	result = libfwnt_access_token_get_granted_access_masks(
+	          access_token,
+	          byte_streams,
+	          byte_stream_sizes,
+	          3,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          granted_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_free(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	if( access_token != NULL )
+	{
+		libfwnt_access_token_free(
+		 &access_token,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_token_initialize",
+	 fwnt_test_access_token_initialize );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_token_free",
+	 fwnt_test_access_token_free );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_token_append_security_identifier",
+	 fwnt_test_access_token_append_security_identifier );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_token_get_number_of_security_identifiers",
+	 fwnt_test_access_token_get_number_of_security_identifiers );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_token_has_security_identifier",
+	 fwnt_test_access_token_has_security_identifier );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_token_get_granted_access_mask",
+	 fwnt_test_access_token_get_granted_access_mask );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_token_get_granted_access_masks",
+	 fwnt_test_access_token_get_granted_access_masks );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,841 @@
+/*
+ * Library arena functions test program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_arena.h"
+
+/* Tests the libfwnt_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_arena_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfwnt_arena_t *arena          = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwnt_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_arena_free(
+	          &arena,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_arena_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = (libfwnt_arena_t *) 0x12345678UL;
+
+	result = libfwnt_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	arena = NULL;
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_arena_initialize with malloc failing
+		 */
+		fwnt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwnt_arena_initialize(
+		          &arena,
+		          0,
+		          &error );
+
+		if( fwnt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwnt_test_malloc_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libfwnt_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_arena_initialize with memset failing
+		 */
+		fwnt_test_memset_attempts_before_fail = test_number;
+
+		result = libfwnt_arena_initialize(
+		          &arena,
+		          0,
+		          &error );
+
+		if( fwnt_test_memset_attempts_before_fail != -1 )
+		{
+			fwnt_test_memset_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libfwnt_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWNT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfwnt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_arena_free(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+	/* Test error cases
+	 */
+	result = libfwnt_arena_free(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+/* Tests the libfwnt_arena_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_arena_allocate(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwnt_arena_t *arena   = NULL;
+	void *data               = NULL;
+	size_t allocated_size    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_arena_initialize(
+	          &arena,
+	          64,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_arena_allocate(
+	          arena,
+	          24,
+	          &data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "data_alignment",
+	 (size_t) ( (intptr_t) data % LIBFWNT_ARENA_ALIGNMENT ),
+	 (size_t) 0 );
+
+	result = libfwnt_arena_get_allocated_size(
+	          arena,
+	          &allocated_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "allocated_size",
+	 allocated_size,
+	 (size_t) 32 );
+
+	/* Test an allocation that exceeds the block size
+	 */
+	result = libfwnt_arena_allocate(
+	          arena,
+	          256,
+	          &data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_arena_get_allocated_size(
+	          arena,
+	          &allocated_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "allocated_size",
+	 allocated_size,
+	 (size_t) 288 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_arena_allocate(
+	          NULL,
+	          24,
+	          &data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_arena_allocate(
+	          arena,
+	          0,
+	          &data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_arena_allocate(
+	          arena,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_arena_allocate(
+	          arena,
+	          24,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_arena_free(
+	          &arena,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfwnt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+/* Tests the libfwnt_arena_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_arena_reset(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwnt_arena_t *arena   = NULL;
+	size_t allocated_size    = 0;
+	int result               = 0;
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+	void *data               = NULL;
+	void *reused_data        = NULL;
+#endif
+
+	/* Initialize test
+	 */
+	result = libfwnt_arena_initialize(
+	          &arena,
+	          64,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+	result = libfwnt_arena_allocate(
+	          arena,
+	          24,
+	          &data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif
+	result = libfwnt_arena_reset(
+	          arena,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_arena_get_allocated_size(
+	          arena,
+	          &allocated_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "allocated_size",
+	 allocated_size,
+	 (size_t) 0 );
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+	/* Test that the memory of the arena is reused after reset
+	 */
+	result = libfwnt_arena_allocate(
+	          arena,
+	          24,
+	          &reused_data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "reused_data",
+	 ( reused_data == data ),
+	 1 );
+
+#endif
+	/* Test error cases
+	 */
+	result = libfwnt_arena_reset(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_arena_free(
+	          &arena,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfwnt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_arena_get_allocated_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_arena_get_allocated_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwnt_arena_t *arena   = NULL;
+	size_t allocated_size    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_arena_initialize(
+	          &arena,
+	          64,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_arena_get_allocated_size(
+	          arena,
+	          &allocated_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "allocated_size",
+	 allocated_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_arena_get_allocated_size(
+	          NULL,
+	          &allocated_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_arena_get_allocated_size(
+	          arena,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_arena_free(
+	          &arena,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfwnt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_arena_initialize",
+	 fwnt_test_arena_initialize );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_arena_free",
+	 fwnt_test_arena_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_arena_allocate",
+	 fwnt_test_arena_allocate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+	FWNT_TEST_RUN(
+	 "libfwnt_arena_reset",
+	 fwnt_test_arena_reset );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_arena_get_allocated_size",
+	 fwnt_test_arena_get_allocated_size );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
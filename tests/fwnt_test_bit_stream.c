@@ -356,10 +356,10 @@ int fwnt_test_bit_stream_read(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 2 );
 
-	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	FWNT_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x0000da78UL );
+	 (uint64_t) 0x0000da78ULL );
 
 	FWNT_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -446,6 +446,217 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwnt_bit_stream_refill function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_bit_stream_refill(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfwnt_bit_stream_t *bit_stream = NULL;
+	uint32_t value_32bit             = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_bit_stream_initialize(
+	          &bit_stream,
+	          fwnt_test_bit_stream_data1,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_bit_stream_refill(
+	          bit_stream,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 6 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x0000da7859bd8f6dULL );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 48 );
+
+	value_32bit = libfwnt_bit_stream_peek_value(
+	               bit_stream,
+	               4 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0x0000000dUL );
+
+	libfwnt_bit_stream_consume_bits(
+	 bit_stream,
+	 4 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x00000a7859bd8f6dULL );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 44 );
+
+	result = libfwnt_bit_stream_refill(
+	          bit_stream,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 8 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x0a7859bd8f6db8dbULL );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 60 );
+
+	result = libfwnt_bit_stream_get_value(
+	          bit_stream,
+	          32,
+	          &value_32bit,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 0xa7859bd8UL );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test refill of the tail of the byte stream
+	 */
+	bit_stream->byte_stream_offset = 12;
+
+	result = libfwnt_bit_stream_refill(
+	          bit_stream,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "bit_stream->byte_stream_offset",
+	 bit_stream->byte_stream_offset,
+	 (size_t) 16 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT64(
+	 "bit_stream->bit_buffer",
+	 bit_stream->bit_buffer,
+	 (uint64_t) 0x0f6db8dbc415b97eULL );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "bit_stream->bit_buffer_size",
+	 bit_stream->bit_buffer_size,
+	 (uint8_t) 60 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_bit_stream_refill(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( bit_stream != NULL )
+	{
+		libfwnt_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfwnt_bit_stream_get_value function
  * Returns 1 if successful or 0 if not
  */
@@ -483,10 +694,10 @@ int fwnt_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 0 );
 
-	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	FWNT_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x00000000ULL );
 
 	FWNT_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -518,10 +729,10 @@ int fwnt_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 2 );
 
-	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	FWNT_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000a78UL );
+	 (uint64_t) 0x00000a78ULL );
 
 	FWNT_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -553,10 +764,10 @@ int fwnt_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 2 );
 
-	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	FWNT_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x00000000ULL );
 
 	FWNT_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -588,10 +799,10 @@ int fwnt_test_bit_stream_get_value(
 	 bit_stream->byte_stream_offset,
 	 (size_t) 6 );
 
-	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	FWNT_TEST_ASSERT_EQUAL_UINT64(
 	 "bit_stream->bit_buffer",
 	 bit_stream->bit_buffer,
-	 (uint32_t) 0x00000000UL );
+	 (uint64_t) 0x00000000ULL );
 
 	FWNT_TEST_ASSERT_EQUAL_UINT8(
 	 "bit_stream->bit_buffer_size",
@@ -707,6 +918,10 @@ int main(
 	 "libfwnt_bit_stream_read",
 	 fwnt_test_bit_stream_read );
 
+	FWNT_TEST_RUN(
+	 "libfwnt_bit_stream_refill",
+	 fwnt_test_bit_stream_refill );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize bit_stream for tests
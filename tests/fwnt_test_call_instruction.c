@@ -0,0 +1,359 @@
+/*
+ * Library call instruction functions test program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_call_instruction.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+/* Tests the libfwnt_call_instruction_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_call_instruction_scan(
+     void )
+{
+	uint8_t data[ 128 ];
+
+	int kernel_variants[ 4 ] = {
+		LIBFWNT_KERNEL_VARIANT_SCALAR,
+		LIBFWNT_KERNEL_VARIANT_SSE2,
+		LIBFWNT_KERNEL_VARIANT_AVX2,
+		LIBFWNT_KERNEL_VARIANT_NEON };
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	size_t data_size         = 0;
+	size_t opcode_offset     = 0;
+	size_t scan_offset       = 0;
+	int kernel_variant_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 * A single 0xe8 byte is placed at every offset, including past the data size,
+	 * for every kernel variant supported by the CPU
+	 */
+	for( kernel_variant_index = 0;
+	     kernel_variant_index < 4;
+	     kernel_variant_index++ )
+	{
+		result = libfwnt_set_kernel_variant(
+		          kernel_variants[ kernel_variant_index ],
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			continue;
+		}
+		for( data_size = 0;
+		     data_size <= 96;
+		     data_size++ )
+		{
+			for( opcode_offset = 0;
+			     opcode_offset < 128;
+			     opcode_offset++ )
+			{
+				for( data_offset = 0;
+				     data_offset < 128;
+				     data_offset++ )
+				{
+					data[ data_offset ] = (uint8_t) ( 0xe0 + ( data_offset % 8 ) );
+				}
+				/* 0xe8 is part of the fill pattern, so replace it
+				 */
+				for( data_offset = 0;
+				     data_offset < 128;
+				     data_offset++ )
+				{
+					if( data[ data_offset ] == 0xe8 )
+					{
+						data[ data_offset ] = 0xe9;
+					}
+				}
+				data[ opcode_offset ] = 0xe8;
+
+				scan_offset = libfwnt_call_instruction_scan(
+				               data,
+				               data_size );
+
+				if( opcode_offset < data_size )
+				{
+					FWNT_TEST_ASSERT_EQUAL_SIZE(
+					 "scan_offset",
+					 scan_offset,
+					 opcode_offset );
+				}
+				else
+				{
+					FWNT_TEST_ASSERT_EQUAL_SIZE(
+					 "scan_offset",
+					 scan_offset,
+					 data_size );
+				}
+			}
+		}
+	}
+	result = libfwnt_set_kernel_variant(
+	          LIBFWNT_KERNEL_VARIANT_AUTOMATIC,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	scan_offset = libfwnt_call_instruction_scan(
+	               NULL,
+	               16 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "scan_offset",
+	 scan_offset,
+	 (size_t) 16 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libfwnt_set_kernel_variant(
+	 LIBFWNT_KERNEL_VARIANT_AUTOMATIC,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libfwnt_call_instruction_translate_address function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_call_instruction_translate_address(
+     void )
+{
+	uint32_t address = 0;
+
+	/* Test an absolute address that is converted to a relative address
+	 */
+	address = libfwnt_call_instruction_translate_address(
+	           0x00001000UL,
+	           0x00000100UL );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "address",
+	 address,
+	 (uint32_t) 0x00000f00UL );
+
+	/* Test a negative address within the preceding data that is converted
+	 */
+	address = libfwnt_call_instruction_translate_address(
+	           0xffffff80UL,
+	           0x00000100UL );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "address",
+	 address,
+	 (uint32_t) ( 0xffffff80UL + 12000000UL ) );
+
+	/* Test addresses that are not converted
+	 */
+	address = libfwnt_call_instruction_translate_address(
+	           0xfffffe00UL,
+	           0x00000100UL );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "address",
+	 address,
+	 (uint32_t) 0xfffffe00UL );
+
+	address = libfwnt_call_instruction_translate_address(
+	           12000000UL,
+	           0x00000100UL );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "address",
+	 address,
+	 (uint32_t) 12000000UL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwnt_call_instruction_translate function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_call_instruction_translate(
+     void )
+{
+	uint8_t data[ 512 ];
+	uint8_t expected_data[ 512 ];
+
+	size_t data_offset         = 0;
+	size_t end_offset          = 0;
+	size_t expected_end_offset = 0;
+	uint32_t address           = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 * The result is compared with that of a byte by byte translation
+	 */
+	for( data_offset = 0;
+	     data_offset < 512;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 73 ) + 5 );
+
+		if( ( data_offset % 7 ) == 3 )
+		{
+			data[ data_offset ] = 0xe8;
+		}
+		expected_data[ data_offset ] = data[ data_offset ];
+	}
+	for( data_offset = 0;
+	     data_offset < ( 512 - 6 );
+	     data_offset++ )
+	{
+		if( expected_data[ data_offset ] != 0xe8 )
+		{
+			continue;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( expected_data[ data_offset + 1 ] ),
+		 address );
+
+		address = libfwnt_call_instruction_translate_address(
+		           address,
+		           data_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( expected_data[ data_offset + 1 ] ),
+		 address );
+
+		data_offset += 4;
+	}
+	expected_end_offset = data_offset;
+
+	end_offset = libfwnt_call_instruction_translate(
+	              data,
+	              0,
+	              512 - 6 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "end_offset",
+	 end_offset,
+	 expected_end_offset );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          512 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	end_offset = libfwnt_call_instruction_translate(
+	              NULL,
+	              0,
+	              16 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "end_offset",
+	 end_offset,
+	 (size_t) 16 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_call_instruction_scan",
+	 fwnt_test_call_instruction_scan );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_call_instruction_translate_address",
+	 fwnt_test_call_instruction_translate_address );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_call_instruction_translate",
+	 fwnt_test_call_instruction_translate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+}
+
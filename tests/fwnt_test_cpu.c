@@ -0,0 +1,311 @@
+/*
+ * Library CPU dispatch functions test program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_unused.h"
+
+/* Tests the libfwnt_get_cpu_features function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_get_cpu_features(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t cpu_features    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_get_cpu_features(
+	          &cpu_features,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* AVX2 is only reported together with SSE2
+	 */
+	if( ( cpu_features & LIBFWNT_CPU_FEATURE_AVX2 ) != 0 )
+	{
+		FWNT_TEST_ASSERT_NOT_EQUAL_INT(
+		 "cpu_features & LIBFWNT_CPU_FEATURE_SSE2",
+		 (int) ( cpu_features & LIBFWNT_CPU_FEATURE_SSE2 ),
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libfwnt_get_cpu_features(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_get_kernel_variant function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_get_kernel_variant(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int kernel_variant       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_get_kernel_variant(
+	          &kernel_variant,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The automatic kernel variant is resolved to the selected variant
+	 */
+	FWNT_TEST_ASSERT_GREATER_THAN_INT(
+	 "kernel_variant",
+	 kernel_variant,
+	 (int) LIBFWNT_KERNEL_VARIANT_AUTOMATIC );
+
+	/* Test error cases
+	 */
+	result = libfwnt_get_kernel_variant(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_set_kernel_variant function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_set_kernel_variant(
+     void )
+{
+	int kernel_variants[ 4 ] = {
+		LIBFWNT_KERNEL_VARIANT_SCALAR,
+		LIBFWNT_KERNEL_VARIANT_SSE2,
+		LIBFWNT_KERNEL_VARIANT_AVX2,
+		LIBFWNT_KERNEL_VARIANT_NEON };
+
+	libcerror_error_t *error = NULL;
+	int kernel_variant       = 0;
+	int kernel_variant_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 * A kernel variant that is not supported by the CPU is expected to fail
+	 */
+	for( kernel_variant_index = 0;
+	     kernel_variant_index < 4;
+	     kernel_variant_index++ )
+	{
+		result = libfwnt_set_kernel_variant(
+		          kernel_variants[ kernel_variant_index ],
+		          &error );
+
+		if( result == 1 )
+		{
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libfwnt_get_kernel_variant(
+			          &kernel_variant,
+			          &error );
+
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "kernel_variant",
+			 kernel_variant,
+			 kernel_variants[ kernel_variant_index ] );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+
+			/* The scalar kernel variant is always supported
+			 */
+			FWNT_TEST_ASSERT_NOT_EQUAL_INT(
+			 "kernel_variant",
+			 kernel_variants[ kernel_variant_index ],
+			 LIBFWNT_KERNEL_VARIANT_SCALAR );
+		}
+	}
+	result = libfwnt_set_kernel_variant(
+	          LIBFWNT_KERNEL_VARIANT_AUTOMATIC,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_set_kernel_variant(
+	          -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libfwnt_set_kernel_variant(
+	 LIBFWNT_KERNEL_VARIANT_AUTOMATIC,
+	 NULL );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_get_cpu_features",
+	 fwnt_test_get_cpu_features );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_get_kernel_variant",
+	 fwnt_test_get_kernel_variant );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_set_kernel_variant",
+	 fwnt_test_set_kernel_variant );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -764,6 +764,397 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwnt_huffman_tree_get_symbol_from_bit_stream_canonical function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_huffman_tree_get_symbol_from_bit_stream_canonical(
+     void )
+{
+	uint8_t code_size_array[ 512 ];
+
+	libcerror_error_t *error                   = NULL;
+	libfwnt_bit_stream_t *bit_stream           = NULL;
+	libfwnt_bit_stream_t *canonical_bit_stream = NULL;
+	libfwnt_huffman_tree_t *huffman_tree       = NULL;
+	size_t byte_offset                         = 0;
+	uint32_t canonical_symbol                  = 0;
+	uint32_t symbol                            = 0;
+	uint8_t byte_value                         = 0;
+	int result                                 = 0;
+	int symbol_index                           = 0;
+
+	/* Initialize test
+	 */
+	for( byte_offset = 0;
+	     byte_offset < 256;
+	     byte_offset++ )
+	{
+		byte_value = fwnt_test_huffman_tree_data1[ byte_offset ];
+
+		code_size_array[ symbol++ ] = byte_value & 0x0f;
+
+		byte_value >>= 4;
+
+		code_size_array[ symbol++ ] = byte_value & 0x0f;
+	}
+	result = libfwnt_huffman_tree_initialize(
+	          &huffman_tree,
+	          512,
+	          15,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "huffman_tree",
+	 huffman_tree );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_huffman_tree_build(
+	          huffman_tree,
+	          code_size_array,
+	          512,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_bit_stream_initialize(
+	          &bit_stream,
+	          &( fwnt_test_huffman_tree_data1[ 256 ] ),
+	          276 - 256,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "bit_stream",
+	 bit_stream );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_bit_stream_initialize(
+	          &canonical_bit_stream,
+	          &( fwnt_test_huffman_tree_data1[ 256 ] ),
+	          276 - 256,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "canonical_bit_stream",
+	 canonical_bit_stream );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the lookup table and canonical Huffman code must decode the same symbols
+	 */
+	for( symbol_index = 0;
+	     symbol_index < 27;
+	     symbol_index++ )
+	{
+		result = libfwnt_huffman_tree_get_symbol_from_bit_stream(
+		          huffman_tree,
+		          bit_stream,
+		          &symbol,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwnt_huffman_tree_get_symbol_from_bit_stream_canonical(
+		          huffman_tree,
+		          canonical_bit_stream,
+		          &canonical_symbol,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FWNT_TEST_ASSERT_EQUAL_UINT32(
+		 "symbol",
+		 symbol,
+		 canonical_symbol );
+
+		FWNT_TEST_ASSERT_EQUAL_SIZE(
+		 "bit_stream->byte_stream_offset",
+		 bit_stream->byte_stream_offset,
+		 canonical_bit_stream->byte_stream_offset );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "bit_stream->bit_buffer_size",
+		 (int) bit_stream->bit_buffer_size,
+		 (int) canonical_bit_stream->bit_buffer_size );
+	}
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "symbol",
+	 symbol,
+	 (uint32_t) 256 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_huffman_tree_get_symbol_from_bit_stream_canonical(
+	          NULL,
+	          bit_stream,
+	          &symbol,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_bit_stream_free(
+	          &canonical_bit_stream,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_bit_stream_free(
+	          &bit_stream,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_huffman_tree_free(
+	          &huffman_tree,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( canonical_bit_stream != NULL )
+	{
+		libfwnt_bit_stream_free(
+		 &canonical_bit_stream,
+		 NULL );
+	}
+	if( bit_stream != NULL )
+	{
+		libfwnt_bit_stream_free(
+		 &bit_stream,
+		 NULL );
+	}
+	if( huffman_tree != NULL )
+	{
+		libfwnt_huffman_tree_free(
+		 &huffman_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_huffman_tree_get_code_sizes_from_frequencies function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_huffman_tree_get_code_sizes_from_frequencies(
+     void )
+{
+	uint32_t symbol_frequencies[ 32 ];
+	uint8_t code_size_array[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	uint32_t code_space      = 0;
+	int result               = 0;
+	int symbol               = 0;
+
+	/* Initialize test
+	 * Fibonacci frequencies result in a Huffman tree that is deeper than 15 levels
+	 */
+	symbol_frequencies[ 0 ] = 1;
+	symbol_frequencies[ 1 ] = 1;
+
+	for( symbol = 2;
+	     symbol < 32;
+	     symbol++ )
+	{
+		symbol_frequencies[ symbol ] = symbol_frequencies[ symbol - 1 ] + symbol_frequencies[ symbol - 2 ];
+	}
+	/* Test regular cases
+	 */
+	result = libfwnt_huffman_tree_get_code_sizes_from_frequencies(
+	          symbol_frequencies,
+	          32,
+	          15,
+	          code_size_array,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( symbol = 0;
+	     symbol < 32;
+	     symbol++ )
+	{
+		FWNT_TEST_ASSERT_NOT_EQUAL_INT(
+		 "code_size_array[ symbol ]",
+		 (int) code_size_array[ symbol ],
+		 0 );
+
+		FWNT_TEST_ASSERT_LESS_THAN_UINT8(
+		 "code_size_array[ symbol ]",
+		 code_size_array[ symbol ],
+		 16 );
+
+		code_space += (uint32_t) 1 << ( 15 - code_size_array[ symbol ] );
+	}
+	/* The code sizes must be usable as a prefix code
+	 */
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "code_space",
+	 code_space,
+	 (uint32_t) 1 << 15 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_huffman_tree_get_code_sizes_from_frequencies(
+	          NULL,
+	          32,
+	          15,
+	          code_size_array,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_huffman_tree_get_code_sizes_from_frequencies(
+	          symbol_frequencies,
+	          32,
+	          15,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test 32 symbols that do not fit in 4-bit codes
+	 */
+	result = libfwnt_huffman_tree_get_code_sizes_from_frequencies(
+	          symbol_frequencies,
+	          32,
+	          4,
+	          code_size_array,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
 
 /* The main program
@@ -807,6 +1198,14 @@ int main(
 	 "libfwnt_huffman_tree_get_symbol_from_bit_stream",
 	 fwnt_test_huffman_tree_get_symbol_from_bit_stream );
 
+	FWNT_TEST_RUN(
+	 "libfwnt_huffman_tree_get_symbol_from_bit_stream_canonical",
+	 fwnt_test_huffman_tree_get_symbol_from_bit_stream_canonical );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_huffman_tree_get_code_sizes_from_frequencies",
+	 fwnt_test_huffman_tree_get_code_sizes_from_frequencies );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
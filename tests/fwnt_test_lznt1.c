@@ -35,6 +35,7 @@
 #include "fwnt_test_unused.h"
 
 #include "../libfwnt/libfwnt_lznt1.h"
+#include "../libfwnt/libfwnt_lznt1_stream_decoder.h"
 
 /* Define to make fwnt_test_lznt1 generate verbose output
 #define FWNT_TEST_LZNT1
@@ -301,27 +302,643 @@ uint8_t fwnt_test_lznt1_compressed_byte_stream[ 4135 ] = {
 	0x20, 0x66, 0xff, 0x7f, 0x00, 0x00, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x0a, 0x4c, 0x69, 0x62, 
 	0x72, 0x61, 0x72, 0x79, 0x2e, 0x0a, 0x0a };
 
+/* Tests the libfwnt_lznt1_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lznt1_compress(
+     void )
+{
+	uint8_t compressed_data[ 8192 ];
+	uint8_t uncompressed_data[ 8192 ];
+	uint8_t verification_data[ 8192 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 8192;
+	size_t uncompressed_data_size = 7640;
+	size_t verification_data_size = 8192;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_lznt1_decompress(
+	          fwnt_test_lznt1_compressed_byte_stream,
+	          4135,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_lznt1_compress(
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_LESS_THAN_UINT32(
+	 "compressed_data_size",
+	 (uint32_t) compressed_data_size,
+	 (uint32_t) 4135 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_lznt1_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          verification_data,
+	          &verification_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "verification_data_size",
+	 verification_data_size,
+	 (size_t) 7640 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          verification_data,
+	          uncompressed_data,
+	          7640 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 8192;
+
+	result = libfwnt_lznt1_compress(
+	          NULL,
+	          uncompressed_data_size,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lznt1_compress(
+	          uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lznt1_compress(
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lznt1_compress(
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          compressed_data,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data too small
+	 */
+	compressed_data_size = 1024;
+
+	result = libfwnt_lznt1_compress(
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_lznt1_compress_with_level function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lznt1_compress_with_level(
+     void )
+{
+	uint8_t compressed_data[ 16400 ];
+	uint8_t uncompressed_data[ 16384 ];
+	uint8_t verification_data[ 16384 ];
+
+	int compression_levels[ 4 ] = {
+		LIBFWNT_COMPRESSION_LEVEL_DEFAULT,
+		LIBFWNT_COMPRESSION_LEVEL_FAST,
+		LIBFWNT_COMPRESSION_LEVEL_NORMAL,
+		LIBFWNT_COMPRESSION_LEVEL_BEST };
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t data_offset            = 0;
+	size_t uncompressed_data_size = 7640;
+	size_t verification_data_size = 0;
+	uint32_t random_value         = 0x12345678UL;
+	int compression_level_index   = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 * The test data contains text, a run of 0-byte values and data that does not compress
+	 */
+	result = libfwnt_lznt1_decompress(
+	          fwnt_test_lznt1_compressed_byte_stream,
+	          4135,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 7640;
+	     data_offset < 12000;
+	     data_offset++ )
+	{
+		uncompressed_data[ data_offset ] = 0;
+	}
+	for( data_offset = 12000;
+	     data_offset < 16384;
+	     data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345UL;
+
+		uncompressed_data[ data_offset ] = (uint8_t) ( random_value >> 24 );
+	}
+	uncompressed_data_size = 16384;
+
+	/* Test regular cases
+	 */
+	for( compression_level_index = 0;
+	     compression_level_index < 4;
+	     compression_level_index++ )
+	{
+		compressed_data_size = 16400;
+
+		result = libfwnt_lznt1_compress_with_level(
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          compressed_data,
+		          &compressed_data_size,
+		          compression_levels[ compression_level_index ],
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		verification_data_size = 16384;
+
+		result = libfwnt_lznt1_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          verification_data,
+		          &verification_data_size,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_EQUAL_SIZE(
+		 "verification_data_size",
+		 verification_data_size,
+		 uncompressed_data_size );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          verification_data,
+		          uncompressed_data,
+		          uncompressed_data_size );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	compressed_data_size = 16400;
+
+	result = libfwnt_lznt1_compress_with_level(
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          compressed_data,
+	          &compressed_data_size,
+	          -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfwnt_lznt1_decompress function
  * Returns 1 if successful or 0 if not
  */
-int fwnt_test_lznt1_decompress(
+int fwnt_test_lznt1_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 8192 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 7640;
+	int result                    = 0;
+
+	result = libfwnt_lznt1_decompress(
+	          fwnt_test_lznt1_compressed_byte_stream,
+	          4135,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_FPRINT_ERROR( error )
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 7640 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_lznt1_decompress(
+	          NULL,
+	          4135,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lznt1_decompress(
+	          fwnt_test_lznt1_compressed_byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lznt1_decompress(
+	          fwnt_test_lznt1_compressed_byte_stream,
+	          4135,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lznt1_decompress(
+	          fwnt_test_lznt1_compressed_byte_stream,
+	          4135,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwnt_lznt1_decompress_parallel function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lznt1_decompress_parallel(
      void )
 {
-	uint8_t uncompressed_data[ 8192 ];
+	uint8_t compressed_data[ 32768 ];
+	uint8_t expected_data[ 32768 ];
+	uint8_t uncompressed_data[ 32768 ];
 
-	libcerror_error_t *error      = NULL;
-	size_t uncompressed_data_size = 7640;
-	int result                    = 0;
+	int number_of_threads_values[ 4 ]    = { 0, 1, 2, 4 };
+
+	libcerror_error_t *error             = NULL;
+	libcerror_error_t *sequential_error  = NULL;
+	size_t chunk_data_size               = 0;
+	size_t compressed_data_size          = 0;
+	size_t expected_data_offset          = 0;
+	size_t expected_data_size            = 7640;
+	size_t first_compressed_data_size    = 0;
+	size_t uncompressed_data_size        = 0;
+	int number_of_threads_index          = 0;
+	int result                           = 0;
+	int sequential_result                = 0;
+	int test_index                       = 0;
 
+	/* Initialize test
+	 */
 	result = libfwnt_lznt1_decompress(
 	          fwnt_test_lznt1_compressed_byte_stream,
 	          4135,
+	          expected_data,
+	          &expected_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( expected_data_offset = expected_data_size;
+	     expected_data_offset < 32768;
+	     expected_data_offset++ )
+	{
+		expected_data[ expected_data_offset ] = expected_data[ ( expected_data_offset * 7 ) % expected_data_size ];
+	}
+	compressed_data_size = 32768;
+
+	result = libfwnt_lznt1_compress(
+	          expected_data,
+	          32768,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads_index = 0;
+	     number_of_threads_index < 4;
+	     number_of_threads_index++ )
+	{
+		uncompressed_data_size = 32768;
+
+		result = libfwnt_lznt1_decompress_parallel(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          number_of_threads_values[ number_of_threads_index ],
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 32768 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          expected_data,
+		          32768 );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test decompressing data where a chunk, other than the last, decompresses
+	 * to less than the compression chunk size, which requires sequential decompression
+	 */
+	first_compressed_data_size = 32768;
+
+	result = libfwnt_lznt1_compress(
+	          expected_data,
+	          100,
+	          compressed_data,
+	          &first_compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_size = 32768 - first_compressed_data_size;
+
+	result = libfwnt_lznt1_compress(
+	          &( expected_data[ 100 ] ),
+	          16384,
+	          &( compressed_data[ first_compressed_data_size ] ),
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_size  += first_compressed_data_size;
+	uncompressed_data_size = 32768;
+
+	result = libfwnt_lznt1_decompress_parallel(
+	          compressed_data,
+	          compressed_data_size,
 	          uncompressed_data,
 	          &uncompressed_data_size,
+	          4,
 	          &error );
 
-	FWNT_TEST_FPRINT_ERROR( error )
-
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -330,15 +947,32 @@ int fwnt_test_lznt1_decompress(
 	FWNT_TEST_ASSERT_EQUAL_SIZE(
 	 "uncompressed_data_size",
 	 uncompressed_data_size,
-	 (size_t) 7640 );
+	 (size_t) 16484 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          expected_data,
+	          16484 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	/* Test error cases
 	 */
-	result = libfwnt_lznt1_decompress(
+	uncompressed_data_size = 32768;
+
+	result = libfwnt_lznt1_decompress_parallel(
 	          NULL,
-	          4135,
+	          compressed_data_size,
 	          uncompressed_data,
 	          &uncompressed_data_size,
+	          4,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -353,11 +987,12 @@ int fwnt_test_lznt1_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_lznt1_decompress(
-	          fwnt_test_lznt1_compressed_byte_stream,
+	result = libfwnt_lznt1_decompress_parallel(
+	          compressed_data,
 	          (size_t) SSIZE_MAX + 1,
 	          uncompressed_data,
 	          &uncompressed_data_size,
+	          4,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -372,11 +1007,12 @@ int fwnt_test_lznt1_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_lznt1_decompress(
-	          fwnt_test_lznt1_compressed_byte_stream,
-	          4135,
+	result = libfwnt_lznt1_decompress_parallel(
+	          compressed_data,
+	          compressed_data_size,
 	          NULL,
 	          &uncompressed_data_size,
+	          4,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -391,11 +1027,54 @@ int fwnt_test_lznt1_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_lznt1_decompress(
-	          fwnt_test_lznt1_compressed_byte_stream,
-	          4135,
+	result = libfwnt_lznt1_decompress_parallel(
+	          compressed_data,
+	          compressed_data_size,
 	          uncompressed_data,
 	          NULL,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lznt1_decompress_parallel(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with truncated compressed data
+	 */
+	result = libfwnt_lznt1_decompress_parallel(
+	          compressed_data,
+	          first_compressed_data_size + 100,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          4,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -410,9 +1089,327 @@ int fwnt_test_lznt1_decompress(
 	libcerror_error_free(
 	 &error );
 
+	/* Test with data of which the last chunk is truncated and with data that
+	 * contains a chunk that decompresses to less than the compression chunk size
+	 * followed by a truncated chunk, which should fail the same way as
+	 * sequential decompression
+	 */
+	for( test_index = 0;
+	     test_index < 2;
+	     test_index++ )
+	{
+		compressed_data[ 0 ] = 0xff;
+		compressed_data[ 1 ] = 0x3f;
+
+		if( memory_copy(
+		     &( compressed_data[ 2 ] ),
+		     expected_data,
+		     4096 ) == NULL )
+		{
+			goto on_error;
+		}
+		compressed_data_size = 4098;
+
+		if( test_index == 1 )
+		{
+			chunk_data_size = 32768 - compressed_data_size;
+
+			result = libfwnt_lznt1_compress(
+			          &( expected_data[ 4096 ] ),
+			          4090,
+			          &( compressed_data[ compressed_data_size ] ),
+			          &chunk_data_size,
+			          &error );
+
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			compressed_data_size += chunk_data_size;
+		}
+		compressed_data[ compressed_data_size ]     = 0xff;
+		compressed_data[ compressed_data_size + 1 ] = 0x3f;
+		compressed_data[ compressed_data_size + 2 ] = 0x01;
+		compressed_data[ compressed_data_size + 3 ] = 0x02;
+
+		compressed_data_size += 4;
+
+		uncompressed_data_size = 8192;
+
+		sequential_result = libfwnt_lznt1_decompress(
+		                     compressed_data,
+		                     compressed_data_size,
+		                     uncompressed_data,
+		                     &uncompressed_data_size,
+		                     &sequential_error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "sequential_result",
+		 sequential_result,
+		 -1 );
+
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "sequential_error",
+		 sequential_error );
+
+		uncompressed_data_size = 8192;
+
+		result = libfwnt_lznt1_decompress_parallel(
+		          compressed_data,
+		          compressed_data_size,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          4,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 sequential_result );
+
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		result = libcerror_error_matches(
+		          sequential_error,
+		          LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		          LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libcerror_error_matches(
+		          error,
+		          LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		          LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		libcerror_error_free(
+		 &sequential_error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( sequential_error != NULL )
+	{
+		libcerror_error_free(
+		 &sequential_error );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests decompressing data in slices with a libfwnt_lznt1_stream_decoder
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lznt1_decompress_with_stream_decoder(
+     void )
+{
+	uint8_t compressed_data[ 8192 ];
+	uint8_t expected_data[ 8192 ];
+	uint8_t uncompressed_data[ 8192 ];
+
+	size_t compressed_data_slice_sizes[ 3 ]        = { 7, 4096, 8192 };
+	size_t uncompressed_data_slice_sizes[ 3 ]      = { 13, 4096, 8192 };
+
+	libcerror_error_t *error                       = NULL;
+	libfwnt_lznt1_stream_decoder_t *stream_decoder = NULL;
+	size_t compressed_data_offset                  = 0;
+	size_t compressed_data_size                    = 8192;
+	size_t compressed_slice_size                   = 0;
+	size_t expected_data_size                      = 7640;
+	size_t uncompressed_data_offset                = 0;
+	size_t uncompressed_slice_size                 = 0;
+	uint8_t flags                                  = 0;
+	int slice_index                                = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_lznt1_decompress(
+	          fwnt_test_lznt1_compressed_byte_stream,
+	          4135,
+	          expected_data,
+	          &expected_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_lznt1_compress(
+	          expected_data,
+	          expected_data_size,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_lznt1_stream_decoder_initialize(
+	          &stream_decoder,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_decoder",
+	 stream_decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( slice_index = 0;
+	     slice_index < 3;
+	     slice_index++ )
+	{
+		result = libfwnt_lznt1_stream_decoder_reset(
+		          stream_decoder,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		compressed_data_offset   = 0;
+		uncompressed_data_offset = 0;
+		result                   = 0;
+
+		while( result == 0 )
+		{
+			compressed_slice_size = compressed_data_size - compressed_data_offset;
+			flags                 = LIBFWNT_STREAM_FLAG_END_OF_INPUT;
+
+			if( compressed_slice_size > compressed_data_slice_sizes[ slice_index ] )
+			{
+				compressed_slice_size = compressed_data_slice_sizes[ slice_index ];
+				flags                 = 0;
+			}
+			uncompressed_slice_size = 8192 - uncompressed_data_offset;
+
+			if( uncompressed_slice_size > uncompressed_data_slice_sizes[ slice_index ] )
+			{
+				uncompressed_slice_size = uncompressed_data_slice_sizes[ slice_index ];
+			}
+			result = libfwnt_lznt1_stream_decoder_decompress(
+			          stream_decoder,
+			          &( compressed_data[ compressed_data_offset ] ),
+			          &compressed_slice_size,
+			          &( uncompressed_data[ uncompressed_data_offset ] ),
+			          &uncompressed_slice_size,
+			          flags,
+			          &error );
+
+			FWNT_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( ( result == 0 )
+			 && ( compressed_slice_size == 0 )
+			 && ( uncompressed_slice_size == 0 ) )
+			{
+				/* The stream decoder did not make any progress
+				 */
+				goto on_error;
+			}
+			compressed_data_offset   += compressed_slice_size;
+			uncompressed_data_offset += uncompressed_slice_size;
+		}
+		FWNT_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_offset",
+		 uncompressed_data_offset,
+		 expected_data_size );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          expected_data,
+		          expected_data_size );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Clean up
+	 */
+	result = libfwnt_lznt1_stream_decoder_free(
+	          &stream_decoder,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "stream_decoder",
+	 stream_decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_decoder != NULL )
+	{
+		libfwnt_lznt1_stream_decoder_free(
+		 &stream_decoder,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -439,12 +1436,26 @@ int main(
 	 NULL );
 #endif
 
-	/* TODO add tests for libfwnt_lznt1_compress */
+	FWNT_TEST_RUN(
+	 "libfwnt_lznt1_compress",
+	 fwnt_test_lznt1_compress );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lznt1_compress_with_level",
+	 fwnt_test_lznt1_compress_with_level );
 
 	FWNT_TEST_RUN(
 	 "libfwnt_lznt1_decompress",
 	 fwnt_test_lznt1_decompress );
 
+	FWNT_TEST_RUN(
+	 "libfwnt_lznt1_decompress_parallel",
+	 fwnt_test_lznt1_decompress_parallel );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lznt1_stream_decoder_decompress",
+	 fwnt_test_lznt1_decompress_with_stream_decoder );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,653 @@
+/*
+ * Library lznt1_stream_decoder type test program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_lznt1_stream_decoder.h"
+
+/* Tests the libfwnt_lznt1_stream_decoder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lznt1_stream_decoder_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfwnt_lznt1_stream_decoder_t *stream_decoder = NULL;
+	int result                                     = 0;
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+	int number_of_malloc_fail_tests                = 1;
+	int number_of_memset_fail_tests                = 1;
+	int test_number                                = 0;
+#endif
+
+	/* Test libfwnt_lznt1_stream_decoder_initialize
+	 */
+	result = libfwnt_lznt1_stream_decoder_initialize(
+	          &stream_decoder,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_decoder",
+	 stream_decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_lznt1_stream_decoder_free(
+	          &stream_decoder,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "stream_decoder",
+	 stream_decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_lznt1_stream_decoder_initialize(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	stream_decoder = (libfwnt_lznt1_stream_decoder_t *) 0x12345678UL;
+
+	result = libfwnt_lznt1_stream_decoder_initialize(
+	          &stream_decoder,
+	          &error );
+
+	stream_decoder = NULL;
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_lznt1_stream_decoder_initialize with malloc failing
+		 */
+		fwnt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwnt_lznt1_stream_decoder_initialize(
+		          &stream_decoder,
+		          &error );
+
+		if( fwnt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwnt_test_malloc_attempts_before_fail = -1;
+
+			if( stream_decoder != NULL )
+			{
+				libfwnt_lznt1_stream_decoder_free(
+				 &stream_decoder,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "stream_decoder",
+			 stream_decoder );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_lznt1_stream_decoder_initialize with memset failing
+		 */
+		fwnt_test_memset_attempts_before_fail = test_number;
+
+		result = libfwnt_lznt1_stream_decoder_initialize(
+		          &stream_decoder,
+		          &error );
+
+		if( fwnt_test_memset_attempts_before_fail != -1 )
+		{
+			fwnt_test_memset_attempts_before_fail = -1;
+
+			if( stream_decoder != NULL )
+			{
+				libfwnt_lznt1_stream_decoder_free(
+				 &stream_decoder,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "stream_decoder",
+			 stream_decoder );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWNT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_decoder != NULL )
+	{
+		libfwnt_lznt1_stream_decoder_free(
+		 &stream_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_lznt1_stream_decoder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lznt1_stream_decoder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwnt_lznt1_stream_decoder_free(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_lznt1_stream_decoder_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lznt1_stream_decoder_reset(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfwnt_lznt1_stream_decoder_t *stream_decoder = NULL;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_lznt1_stream_decoder_initialize(
+	          &stream_decoder,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_decoder",
+	 stream_decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_lznt1_stream_decoder_reset(
+	          stream_decoder,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_lznt1_stream_decoder_reset(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_lznt1_stream_decoder_free(
+	          &stream_decoder,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "stream_decoder",
+	 stream_decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_decoder != NULL )
+	{
+		libfwnt_lznt1_stream_decoder_free(
+		 &stream_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_lznt1_stream_decoder_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lznt1_stream_decoder_decompress(
+     void )
+{
+	uint8_t compressed_data[ 16 ];
+	uint8_t uncompressed_data[ 64 ];
+
+	libcerror_error_t *error                       = NULL;
+	libfwnt_lznt1_stream_decoder_t *stream_decoder = NULL;
+	size_t compressed_data_size                    = 16;
+	size_t uncompressed_data_size                  = 64;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_lznt1_stream_decoder_initialize(
+	          &stream_decoder,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_decoder",
+	 stream_decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_lznt1_stream_decoder_decompress(
+	          NULL,
+	          compressed_data,
+	          &compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lznt1_stream_decoder_decompress(
+	          stream_decoder,
+	          NULL,
+	          &compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lznt1_stream_decoder_decompress(
+	          stream_decoder,
+	          compressed_data,
+	          NULL,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lznt1_stream_decoder_decompress(
+	          stream_decoder,
+	          compressed_data,
+	          &compressed_data_size,
+	          NULL,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lznt1_stream_decoder_decompress(
+	          stream_decoder,
+	          compressed_data,
+	          &compressed_data_size,
+	          uncompressed_data,
+	          NULL,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lznt1_stream_decoder_decompress(
+	          stream_decoder,
+	          compressed_data,
+	          &compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0xff,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_size = (size_t) SSIZE_MAX + 1;
+
+	result = libfwnt_lznt1_stream_decoder_decompress(
+	          stream_decoder,
+	          compressed_data,
+	          &compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	compressed_data_size   = 16;
+	uncompressed_data_size = (size_t) SSIZE_MAX + 1;
+
+	result = libfwnt_lznt1_stream_decoder_decompress(
+	          stream_decoder,
+	          compressed_data,
+	          &compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_lznt1_stream_decoder_free(
+	          &stream_decoder,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "stream_decoder",
+	 stream_decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_decoder != NULL )
+	{
+		libfwnt_lznt1_stream_decoder_free(
+		 &stream_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lznt1_stream_decoder_initialize",
+	 fwnt_test_lznt1_stream_decoder_initialize );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lznt1_stream_decoder_free",
+	 fwnt_test_lznt1_stream_decoder_free );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lznt1_stream_decoder_reset",
+	 fwnt_test_lznt1_stream_decoder_reset );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lznt1_stream_decoder_decompress",
+	 fwnt_test_lznt1_stream_decoder_decompress );
+
+	/* The regular decompress cases are tested by fwnt_test_lznt1
+	 */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
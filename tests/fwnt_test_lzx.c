@@ -30,10 +30,13 @@
 
 #include "fwnt_test_libcerror.h"
 #include "fwnt_test_libcnotify.h"
+#include "fwnt_test_libfwnt.h"
 #include "fwnt_test_macros.h"
 #include "fwnt_test_unused.h"
 
 #include "../libfwnt/libfwnt_lzx.h"
+#include "../libfwnt/libfwnt_lzx_decoder.h"
+#include "../libfwnt/libfwnt_lzx_stream_decoder.h"
 
 /* Define to make fwnt_test_lzx generate verbose output
 #define FWNT_TEST_LZX_VERBOSE
@@ -3694,6 +3697,628 @@ on_error:
 	return( 0 );
 }
 
+/* Tests decompressing multiple frames with a single libfwnt_lzx_decoder
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lzx_decompress_with_decoder(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libfwnt_lzx_decoder_t *decoder = NULL;
+	uint8_t *uncompressed_data     = NULL;
+	size_t uncompressed_data_size  = 0;
+	int frame_index                = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * 32768 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	result = libfwnt_lzx_decoder_initialize(
+	          &decoder,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "decoder",
+	 decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The decoder state must be reset between frames
+	 */
+	for( frame_index = 0;
+	     frame_index < 4;
+	     frame_index++ )
+	{
+		uncompressed_data_size = 32768;
+
+		result = libfwnt_lzx_decoder_decompress(
+		          decoder,
+		          fwnt_test_lzx_compressed_data1,
+		          7520,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 28672 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          fwnt_test_lzx_uncompressed_data1,
+		          28672 );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		uncompressed_data_size = 32768;
+
+		result = libfwnt_lzx_decoder_decompress(
+		          decoder,
+		          fwnt_test_lzx_compressed_data2,
+		          8054,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 10752 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          fwnt_test_lzx_uncompressed_data2,
+		          10752 );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Clean up
+	 */
+	result = libfwnt_lzx_decoder_free(
+	          &decoder,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "decoder",
+	 decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 uncompressed_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoder != NULL )
+	{
+		libfwnt_lzx_decoder_free(
+		 &decoder,
+		 NULL );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( 0 );
+}
+
+/* Tests decompressing data in small slices with a libfwnt_lzx_stream_decoder
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lzx_decompress_with_stream_decoder(
+     void )
+{
+	uint8_t *compressed_data_sets[ 2 ]                = {
+		fwnt_test_lzx_compressed_data1,
+		fwnt_test_lzx_compressed_data2 };
+
+	uint8_t *uncompressed_data_sets[ 2 ]              = {
+		fwnt_test_lzx_uncompressed_data1,
+		fwnt_test_lzx_uncompressed_data2 };
+
+	size_t compressed_data_set_sizes[ 2 ]             = { 7520, 8054 };
+	size_t uncompressed_data_set_sizes[ 2 ]           = { 28672, 10752 };
+
+	libcerror_error_t *error                         = NULL;
+	libfwnt_lzx_stream_decoder_t *stream_decoder     = NULL;
+	uint8_t *uncompressed_data                       = NULL;
+	size_t compressed_data_offset                    = 0;
+	size_t compressed_data_size                      = 0;
+	size_t uncompressed_data_offset                  = 0;
+	size_t uncompressed_data_size                    = 0;
+	uint8_t flags                                    = 0;
+	int data_set_index                               = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * 32768 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	result = libfwnt_lzx_stream_decoder_initialize(
+	          &stream_decoder,
+	          uncompressed_data_set_sizes[ 0 ],
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_decoder",
+	 stream_decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The compressed data is provided in slices of 7 bytes and
+	 * the uncompressed data is retrieved in slices of 13 bytes
+	 */
+	for( data_set_index = 0;
+	     data_set_index < 2;
+	     data_set_index++ )
+	{
+		if( data_set_index > 0 )
+		{
+			result = libfwnt_lzx_stream_decoder_reset(
+			          stream_decoder,
+			          uncompressed_data_set_sizes[ data_set_index ],
+			          &error );
+
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		compressed_data_offset   = 0;
+		uncompressed_data_offset = 0;
+		result                   = 0;
+
+		while( result == 0 )
+		{
+			compressed_data_size = compressed_data_set_sizes[ data_set_index ] - compressed_data_offset;
+			flags                = LIBFWNT_STREAM_FLAG_END_OF_INPUT;
+
+			if( compressed_data_size > 7 )
+			{
+				compressed_data_size = 7;
+				flags                = 0;
+			}
+			uncompressed_data_size = 32768 - uncompressed_data_offset;
+
+			if( uncompressed_data_size > 13 )
+			{
+				uncompressed_data_size = 13;
+			}
+			result = libfwnt_lzx_stream_decoder_decompress(
+			          stream_decoder,
+			          &( ( compressed_data_sets[ data_set_index ] )[ compressed_data_offset ] ),
+			          &compressed_data_size,
+			          &( uncompressed_data[ uncompressed_data_offset ] ),
+			          &uncompressed_data_size,
+			          flags,
+			          &error );
+
+			FWNT_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( ( result == 0 )
+			 && ( compressed_data_size == 0 )
+			 && ( uncompressed_data_size == 0 ) )
+			{
+				/* The stream decoder did not make any progress
+				 */
+				goto on_error;
+			}
+			compressed_data_offset   += compressed_data_size;
+			uncompressed_data_offset += uncompressed_data_size;
+		}
+		FWNT_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_offset",
+		 uncompressed_data_offset,
+		 uncompressed_data_set_sizes[ data_set_index ] );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          uncompressed_data_sets[ data_set_index ],
+		          uncompressed_data_set_sizes[ data_set_index ] );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Clean up
+	 */
+	result = libfwnt_lzx_stream_decoder_free(
+	          &stream_decoder,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "stream_decoder",
+	 stream_decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 uncompressed_data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_decoder != NULL )
+	{
+		libfwnt_lzx_stream_decoder_free(
+		 &stream_decoder,
+		 NULL );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( 0 );
+}
+
+/* Tests decompressing frames smaller than the call instruction translation minimum
+ * with both libfwnt_lzx_decompress and a libfwnt_lzx_stream_decoder
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lzx_decompress_small_frame(
+     void )
+{
+	/* A frame consisting of an uncompressed block of 3 bytes that starts with a call instruction
+	 */
+	uint8_t compressed_data[ 19 ] = {
+		0x00, 0x60, 0x00, 0x30, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+		0xe8, 0x01, 0x00 };
+
+	uint8_t expected_uncompressed_data[ 3 ] = {
+		0xe8, 0x01, 0x00 };
+
+	uint8_t stream_uncompressed_data[ 16 ];
+	uint8_t uncompressed_data[ 16 ];
+
+	libcerror_error_t *error                     = NULL;
+	libfwnt_lzx_stream_decoder_t *stream_decoder = NULL;
+	size_t compressed_data_size                  = 0;
+	size_t stream_uncompressed_data_size         = 0;
+	size_t uncompressed_data_size                = 0;
+	int result                                   = 0;
+
+	/* Test decompress
+	 */
+	uncompressed_data_size = 3;
+
+	result = libfwnt_lzx_decompress(
+	          compressed_data,
+	          19,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 3 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          expected_uncompressed_data,
+	          3 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test decompress with a stream decoder
+	 */
+	result = libfwnt_lzx_stream_decoder_initialize(
+	          &stream_decoder,
+	          3,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_decoder",
+	 stream_decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_size          = 19;
+	stream_uncompressed_data_size = 16;
+
+	result = libfwnt_lzx_stream_decoder_decompress(
+	          stream_decoder,
+	          compressed_data,
+	          &compressed_data_size,
+	          stream_uncompressed_data,
+	          &stream_uncompressed_data_size,
+	          LIBFWNT_STREAM_FLAG_END_OF_INPUT,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "stream_uncompressed_data_size",
+	 stream_uncompressed_data_size,
+	 uncompressed_data_size );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          stream_uncompressed_data,
+	          uncompressed_data,
+	          uncompressed_data_size );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libfwnt_lzx_stream_decoder_free(
+	          &stream_decoder,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "stream_decoder",
+	 stream_decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_decoder != NULL )
+	{
+		libfwnt_lzx_stream_decoder_free(
+		 &stream_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests decompressing a frame with a block that is larger than the uncompressed data
+ * with both libfwnt_lzx_decompress and a libfwnt_lzx_stream_decoder
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lzx_decompress_oversized_block(
+     void )
+{
+	/* A frame consisting of an uncompressed block of 12 bytes
+	 */
+	uint8_t compressed_data[ 28 ] = {
+		0x00, 0x60, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+		0xe8, 0x10, 0x00, 0x00, 0x00, 0xe8, 0x20, 0x00, 0x00, 0x00, 0x90, 0x90 };
+
+	uint8_t uncompressed_data[ 16 ];
+
+	libcerror_error_t *error                     = NULL;
+	libfwnt_lzx_stream_decoder_t *stream_decoder = NULL;
+	size_t compressed_data_size                  = 0;
+	size_t uncompressed_data_size                = 0;
+	int result                                   = 0;
+
+	/* Test decompress
+	 */
+	uncompressed_data_size = 11;
+
+	result = libfwnt_lzx_decompress(
+	          compressed_data,
+	          28,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompress with a stream decoder
+	 */
+	result = libfwnt_lzx_stream_decoder_initialize(
+	          &stream_decoder,
+	          11,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_decoder",
+	 stream_decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	compressed_data_size   = 28;
+	uncompressed_data_size = 16;
+
+	result = libfwnt_lzx_stream_decoder_decompress(
+	          stream_decoder,
+	          compressed_data,
+	          &compressed_data_size,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          LIBFWNT_STREAM_FLAG_END_OF_INPUT,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_lzx_stream_decoder_free(
+	          &stream_decoder,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "stream_decoder",
+	 stream_decoder );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_decoder != NULL )
+	{
+		libfwnt_lzx_stream_decoder_free(
+		 &stream_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -3735,6 +4360,22 @@ int main(
 	 "libfwnt_lzx_decompress",
 	 fwnt_test_lzx_decompress );
 
+	FWNT_TEST_RUN(
+	 "libfwnt_lzx_decoder_decompress",
+	 fwnt_test_lzx_decompress_with_decoder );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lzx_stream_decoder_decompress",
+	 fwnt_test_lzx_decompress_with_stream_decoder );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lzx_decompress_small_frame",
+	 fwnt_test_lzx_decompress_small_frame );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lzx_decompress_oversized_block",
+	 fwnt_test_lzx_decompress_oversized_block );
+
 	return( EXIT_SUCCESS );
 
 on_error:
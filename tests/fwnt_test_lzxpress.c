@@ -0,0 +1,1738 @@
+/*
+ * Library LZXPRESS (de)compression testing program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libcnotify.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_lzxpress.h"
+
+/* Define to make fwnt_test_lzxpress generate verbose output
+#define FWNT_TEST_LZXPRESS
+ */
+
+uint8_t fwnt_test_lzxpress_uncompressed_data1[ 26 ] = {
+	'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p',
+	'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z' };
+
+uint8_t fwnt_test_lzxpress_compressed_data1[ 30 ] = {
+	0x3f, 0x00, 0x00, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+	0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a };
+
+/* The uncompressed data 2 consists of 100 times "abc"
+ */
+uint8_t fwnt_test_lzxpress_compressed_data2[ 13 ] = {
+	0xff, 0xff, 0xff, 0x1f, 0x61, 0x62, 0x63, 0x17, 0x00, 0x0f, 0xff, 0x26, 0x01 };
+
+/* The uncompressed data 1 compressed in LZXPRESS Huffman, from the MS-XCA examples
+ */
+uint8_t fwnt_test_lzxpress_huffman_compressed_data1[ 276 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x04, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xd8, 0x52, 0x3e, 0xd7, 0x94, 0x11, 0x5b, 0xe9, 0x19, 0x5f, 0xf9, 0xd6, 0x7c, 0xdf, 0x8d, 0x04,
+	0x00, 0x00, 0x00, 0x00 };
+
+/* The uncompressed data 2 compressed in LZXPRESS Huffman, from the MS-XCA examples
+ */
+uint8_t fwnt_test_lzxpress_huffman_compressed_data2[ 263 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xa8, 0xdc, 0x00, 0x00, 0xff, 0x26, 0x01 };
+
+/* Tests the libfwnt_lzxpress_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lzxpress_compress(
+     void )
+{
+	uint8_t compressed_data[ 512 ];
+	uint8_t uncompressed_data[ 300 ];
+
+	libcerror_error_t *error    = NULL;
+	size_t compressed_data_size = 512;
+	size_t data_offset          = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_lzxpress_compress(
+	          fwnt_test_lzxpress_uncompressed_data1,
+	          26,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 30 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          compressed_data,
+	          fwnt_test_lzxpress_compressed_data1,
+	          30 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	for( data_offset = 0;
+	     data_offset < 300;
+	     data_offset++ )
+	{
+		uncompressed_data[ data_offset ] = (uint8_t) ( 'a' + ( data_offset % 3 ) );
+	}
+	compressed_data_size = 512;
+
+	result = libfwnt_lzxpress_compress(
+	          uncompressed_data,
+	          300,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "compressed_data_size",
+	 compressed_data_size,
+	 (size_t) 13 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          compressed_data,
+	          fwnt_test_lzxpress_compressed_data2,
+	          13 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 512;
+
+	result = libfwnt_lzxpress_compress(
+	          NULL,
+	          26,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_compress(
+	          fwnt_test_lzxpress_uncompressed_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_compress(
+	          fwnt_test_lzxpress_uncompressed_data1,
+	          26,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_compress(
+	          fwnt_test_lzxpress_uncompressed_data1,
+	          26,
+	          compressed_data,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data too small
+	 */
+	compressed_data_size = 16;
+
+	result = libfwnt_lzxpress_compress(
+	          fwnt_test_lzxpress_uncompressed_data1,
+	          26,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_lzxpress_compress_with_level function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lzxpress_compress_with_level(
+     void )
+{
+	uint8_t compressed_data[ 65536 ];
+	uint8_t uncompressed_data[ 49152 ];
+	uint8_t verification_data[ 49152 ];
+
+	int compression_levels[ 4 ] = {
+		LIBFWNT_COMPRESSION_LEVEL_DEFAULT,
+		LIBFWNT_COMPRESSION_LEVEL_FAST,
+		LIBFWNT_COMPRESSION_LEVEL_NORMAL,
+		LIBFWNT_COMPRESSION_LEVEL_BEST };
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t data_offset            = 0;
+	size_t uncompressed_data_size = 49152;
+	size_t verification_data_size = 0;
+	uint32_t random_value         = 0x12345678UL;
+	int compression_level_index   = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 * The test data contains text-like data, a run of 0-byte values
+	 * longer than the largest match size and data that does not compress
+	 */
+	for( data_offset = 0;
+	     data_offset < 8192;
+	     data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345UL;
+
+		uncompressed_data[ data_offset ] = (uint8_t) "the quick brown fox jumps\n"[ ( random_value >> 16 ) % 26 ];
+	}
+	for( data_offset = 8192;
+	     data_offset < 45056;
+	     data_offset++ )
+	{
+		uncompressed_data[ data_offset ] = 0;
+	}
+	for( data_offset = 45056;
+	     data_offset < 49152;
+	     data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345UL;
+
+		uncompressed_data[ data_offset ] = (uint8_t) ( random_value >> 24 );
+	}
+	/* Test regular cases
+	 */
+	for( compression_level_index = 0;
+	     compression_level_index < 4;
+	     compression_level_index++ )
+	{
+		compressed_data_size = 65536;
+
+		result = libfwnt_lzxpress_compress_with_level(
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          compressed_data,
+		          &compressed_data_size,
+		          compression_levels[ compression_level_index ],
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		verification_data_size = 49152;
+
+		result = libfwnt_lzxpress_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          verification_data,
+		          &verification_data_size,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_EQUAL_SIZE(
+		 "verification_data_size",
+		 verification_data_size,
+		 uncompressed_data_size );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          verification_data,
+		          uncompressed_data,
+		          uncompressed_data_size );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	compressed_data_size = 65536;
+
+	result = libfwnt_lzxpress_compress_with_level(
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          compressed_data,
+	          &compressed_data_size,
+	          -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_lzxpress_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lzxpress_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 512 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t data_offset            = 0;
+	size_t uncompressed_data_size = 512;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_lzxpress_decompress(
+	          fwnt_test_lzxpress_compressed_data1,
+	          30,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 26 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          fwnt_test_lzxpress_uncompressed_data1,
+	          26 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	uncompressed_data_size = 512;
+
+	result = libfwnt_lzxpress_decompress(
+	          fwnt_test_lzxpress_compressed_data2,
+	          13,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 300 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 300;
+	     data_offset++ )
+	{
+		FWNT_TEST_ASSERT_EQUAL_UINT8(
+		 "uncompressed_data[ data_offset ]",
+		 uncompressed_data[ data_offset ],
+		 (uint8_t) ( 'a' + ( data_offset % 3 ) ) );
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = 512;
+
+	result = libfwnt_lzxpress_decompress(
+	          NULL,
+	          30,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_decompress(
+	          fwnt_test_lzxpress_compressed_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_decompress(
+	          fwnt_test_lzxpress_compressed_data1,
+	          30,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_decompress(
+	          fwnt_test_lzxpress_compressed_data1,
+	          30,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_lzxpress_huffman_compress function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lzxpress_huffman_compress(
+     void )
+{
+	uint8_t compressed_data[ 512 ];
+	uint8_t uncompressed_data[ 300 ];
+	uint8_t verification_data[ 300 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 512;
+	size_t data_offset            = 0;
+	size_t verification_data_size = 300;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 300;
+	     data_offset++ )
+	{
+		uncompressed_data[ data_offset ] = (uint8_t) ( 'a' + ( data_offset % 3 ) );
+	}
+	/* Test regular cases
+	 */
+	result = libfwnt_lzxpress_huffman_compress(
+	          uncompressed_data,
+	          300,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The compressed data contains the 256 bytes code size table
+	 * followed by the Huffman encoded literals and the match
+	 */
+	FWNT_TEST_ASSERT_LESS_THAN_INT(
+	 "compressed_data_size",
+	 (int) compressed_data_size,
+	 280 );
+
+	result = libfwnt_lzxpress_huffman_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          verification_data,
+	          &verification_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "verification_data_size",
+	 verification_data_size,
+	 (size_t) 300 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          verification_data,
+	          uncompressed_data,
+	          300 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	compressed_data_size = 512;
+
+	result = libfwnt_lzxpress_huffman_compress(
+	          NULL,
+	          300,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_huffman_compress(
+	          uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_huffman_compress(
+	          uncompressed_data,
+	          300,
+	          NULL,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_huffman_compress(
+	          uncompressed_data,
+	          300,
+	          compressed_data,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test compressed data too small
+	 */
+	compressed_data_size = 64;
+
+	result = libfwnt_lzxpress_huffman_compress(
+	          uncompressed_data,
+	          300,
+	          compressed_data,
+	          &compressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_lzxpress_huffman_compress_with_level function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lzxpress_huffman_compress_with_level(
+     void )
+{
+	uint8_t compressed_data[ 102400 ];
+	uint8_t uncompressed_data[ 98304 ];
+	uint8_t verification_data[ 98304 ];
+
+	int compression_levels[ 4 ] = {
+		LIBFWNT_COMPRESSION_LEVEL_DEFAULT,
+		LIBFWNT_COMPRESSION_LEVEL_FAST,
+		LIBFWNT_COMPRESSION_LEVEL_NORMAL,
+		LIBFWNT_COMPRESSION_LEVEL_BEST };
+
+	libcerror_error_t *error      = NULL;
+	size_t compressed_data_size   = 0;
+	size_t data_offset            = 0;
+	size_t uncompressed_data_size = 98304;
+	size_t verification_data_size = 0;
+	uint32_t random_value         = 0x12345678UL;
+	int compression_level_index   = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 * The test data spans 2 chunks and contains text-like data, a run of 0-byte values
+	 * that crosses the chunk boundary and data that does not compress
+	 */
+	for( data_offset = 0;
+	     data_offset < 16384;
+	     data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345UL;
+
+		uncompressed_data[ data_offset ] = (uint8_t) "the quick brown fox jumps\n"[ ( random_value >> 16 ) % 26 ];
+	}
+	for( data_offset = 16384;
+	     data_offset < 81920;
+	     data_offset++ )
+	{
+		uncompressed_data[ data_offset ] = 0;
+	}
+	for( data_offset = 81920;
+	     data_offset < 98304;
+	     data_offset++ )
+	{
+		random_value = ( random_value * 1103515245UL ) + 12345UL;
+
+		uncompressed_data[ data_offset ] = (uint8_t) ( random_value >> 24 );
+	}
+	/* Test regular cases
+	 */
+	for( compression_level_index = 0;
+	     compression_level_index < 4;
+	     compression_level_index++ )
+	{
+		compressed_data_size = 102400;
+
+		result = libfwnt_lzxpress_huffman_compress_with_level(
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          compressed_data,
+		          &compressed_data_size,
+		          compression_levels[ compression_level_index ],
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		verification_data_size = 98304;
+
+		result = libfwnt_lzxpress_huffman_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          verification_data,
+		          &verification_data_size,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_EQUAL_SIZE(
+		 "verification_data_size",
+		 verification_data_size,
+		 uncompressed_data_size );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          verification_data,
+		          uncompressed_data,
+		          uncompressed_data_size );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test data that ends before, on and after a chunk boundary decompressed into
+	 * uncompressed data that is larger than the data, where the decoder relies on
+	 * the end-of-stream symbol
+	 */
+	for( uncompressed_data_size = 65535;
+	     uncompressed_data_size <= 65537;
+	     uncompressed_data_size++ )
+	{
+		compressed_data_size = 102400;
+
+		result = libfwnt_lzxpress_huffman_compress_with_level(
+		          uncompressed_data,
+		          uncompressed_data_size,
+		          compressed_data,
+		          &compressed_data_size,
+		          LIBFWNT_COMPRESSION_LEVEL_DEFAULT,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		verification_data_size = 98304;
+
+		result = libfwnt_lzxpress_huffman_decompress(
+		          compressed_data,
+		          compressed_data_size,
+		          verification_data,
+		          &verification_data_size,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_EQUAL_SIZE(
+		 "verification_data_size",
+		 verification_data_size,
+		 uncompressed_data_size );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          verification_data,
+		          uncompressed_data,
+		          uncompressed_data_size );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	compressed_data_size = 102400;
+
+	result = libfwnt_lzxpress_huffman_compress_with_level(
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          compressed_data,
+	          &compressed_data_size,
+	          -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_lzxpress_huffman_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lzxpress_huffman_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 512 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t data_offset            = 0;
+	size_t uncompressed_data_size = 512;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_lzxpress_huffman_decompress(
+	          fwnt_test_lzxpress_huffman_compressed_data1,
+	          276,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 26 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          fwnt_test_lzxpress_uncompressed_data1,
+	          26 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	uncompressed_data_size = 512;
+
+	result = libfwnt_lzxpress_huffman_decompress(
+	          fwnt_test_lzxpress_huffman_compressed_data2,
+	          263,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 300 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 300;
+	     data_offset++ )
+	{
+		FWNT_TEST_ASSERT_EQUAL_UINT8(
+		 "uncompressed_data[ data_offset ]",
+		 uncompressed_data[ data_offset ],
+		 (uint8_t) ( 'a' + ( data_offset % 3 ) ) );
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = 512;
+
+	result = libfwnt_lzxpress_huffman_decompress(
+	          NULL,
+	          276,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_huffman_decompress(
+	          fwnt_test_lzxpress_huffman_compressed_data1,
+	          276,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_huffman_decompress(
+	          fwnt_test_lzxpress_huffman_compressed_data1,
+	          276,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with compressed data that is truncated within the Huffman table
+	 */
+	result = libfwnt_lzxpress_huffman_decompress(
+	          fwnt_test_lzxpress_huffman_compressed_data1,
+	          200,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_lzxpress_huffman_decompress_parallel function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_lzxpress_huffman_decompress_parallel(
+     void )
+{
+	uint8_t compressed_data[ 32768 ];
+	uint8_t expected_data[ 13288 ];
+	uint8_t uncompressed_data[ 16384 ];
+
+	uint8_t corrupt_data[ 7 ]                   = {
+		0x01, 0x02, 0x03, 0xff, 0xff, 0xff, 0xff };
+
+	size_t chunk_offsets[ 4 ];
+	size_t corrupt_data_sizes[ 2 ]              = { 3, 7 };
+	int number_of_threads_values[ 4 ]           = { 0, 1, 2, 4 };
+
+	libcerror_error_t *error                    = NULL;
+	size_t chunk_compressed_data_size           = 0;
+	size_t compressed_data_size                 = 0;
+	size_t data_offset                          = 0;
+	size_t sequential_uncompressed_data_size    = 0;
+	size_t uncompressed_data_size               = 0;
+	int chunk_index                             = 0;
+	int corrupt_data_index                      = 0;
+	int number_of_threads_index                 = 0;
+	int result                                  = 0;
+	int sequential_result                       = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 13288;
+	     data_offset++ )
+	{
+		expected_data[ data_offset ] = (uint8_t) ( 'a' + ( ( data_offset / 5 ) % 7 ) + ( ( data_offset / 1021 ) % 13 ) );
+	}
+	/* Every chunk, except the last, contains 4096 bytes of uncompressed data
+	 */
+	for( chunk_index = 0;
+	     chunk_index < 4;
+	     chunk_index++ )
+	{
+		data_offset                = (size_t) chunk_index * 4096;
+		chunk_compressed_data_size = 32768 - compressed_data_size;
+
+		chunk_offsets[ chunk_index ] = compressed_data_size;
+
+		result = libfwnt_lzxpress_huffman_compress(
+		          &( expected_data[ data_offset ] ),
+		          ( chunk_index < 3 ) ? 4096 : 13288 - data_offset,
+		          &( compressed_data[ compressed_data_size ] ),
+		          &chunk_compressed_data_size,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		compressed_data_size += chunk_compressed_data_size;
+	}
+	/* Test regular cases
+	 */
+	for( number_of_threads_index = 0;
+	     number_of_threads_index < 4;
+	     number_of_threads_index++ )
+	{
+		uncompressed_data_size = 13288;
+
+		result = libfwnt_lzxpress_huffman_decompress_parallel(
+		          compressed_data,
+		          compressed_data_size,
+		          chunk_offsets,
+		          4,
+		          4096,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          number_of_threads_values[ number_of_threads_index ],
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 (size_t) 13288 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          uncompressed_data,
+		          expected_data,
+		          13288 );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test decompressing less data than the chunks contain, where the remaining chunks are ignored
+	 */
+	uncompressed_data_size = 8192;
+
+	result = libfwnt_lzxpress_huffman_decompress_parallel(
+	          compressed_data,
+	          compressed_data_size,
+	          chunk_offsets,
+	          4,
+	          4096,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 8192 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          expected_data,
+	          8192 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a single chunk that contains less data than the uncompressed data,
+	 * which is decompressed the same way as libfwnt_lzxpress_huffman_decompress
+	 */
+	uncompressed_data_size = 13288;
+
+	result = libfwnt_lzxpress_huffman_decompress_parallel(
+	          compressed_data,
+	          chunk_offsets[ 1 ],
+	          chunk_offsets,
+	          1,
+	          13288,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 4096 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          expected_data,
+	          4096 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a single chunk of corrupt data, which should result in the same
+	 * as libfwnt_lzxpress_huffman_decompress
+	 */
+	for( corrupt_data_index = 0;
+	     corrupt_data_index < 2;
+	     corrupt_data_index++ )
+	{
+		sequential_uncompressed_data_size = 4096;
+
+		sequential_result = libfwnt_lzxpress_huffman_decompress(
+		                     corrupt_data,
+		                     corrupt_data_sizes[ corrupt_data_index ],
+		                     uncompressed_data,
+		                     &sequential_uncompressed_data_size,
+		                     &error );
+
+		if( error != NULL )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+		chunk_offsets[ 0 ]     = 0;
+		uncompressed_data_size = 4096;
+
+		result = libfwnt_lzxpress_huffman_decompress_parallel(
+		          corrupt_data,
+		          corrupt_data_sizes[ corrupt_data_index ],
+		          chunk_offsets,
+		          1,
+		          4096,
+		          uncompressed_data,
+		          &uncompressed_data_size,
+		          4,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 sequential_result );
+
+		FWNT_TEST_ASSERT_EQUAL_SIZE(
+		 "uncompressed_data_size",
+		 uncompressed_data_size,
+		 sequential_uncompressed_data_size );
+
+		if( result == 1 )
+		{
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Test error cases
+	 */
+	uncompressed_data_size = 13288;
+
+	result = libfwnt_lzxpress_huffman_decompress_parallel(
+	          NULL,
+	          compressed_data_size,
+	          chunk_offsets,
+	          4,
+	          4096,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_huffman_decompress_parallel(
+	          compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          chunk_offsets,
+	          4,
+	          4096,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_huffman_decompress_parallel(
+	          compressed_data,
+	          compressed_data_size,
+	          NULL,
+	          4,
+	          4096,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_huffman_decompress_parallel(
+	          compressed_data,
+	          compressed_data_size,
+	          chunk_offsets,
+	          -1,
+	          4096,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_huffman_decompress_parallel(
+	          compressed_data,
+	          compressed_data_size,
+	          chunk_offsets,
+	          4,
+	          0,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_huffman_decompress_parallel(
+	          compressed_data,
+	          compressed_data_size,
+	          chunk_offsets,
+	          4,
+	          4096,
+	          NULL,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_huffman_decompress_parallel(
+	          compressed_data,
+	          compressed_data_size,
+	          chunk_offsets,
+	          4,
+	          4096,
+	          uncompressed_data,
+	          NULL,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_lzxpress_huffman_decompress_parallel(
+	          compressed_data,
+	          compressed_data_size,
+	          chunk_offsets,
+	          4,
+	          4096,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test chunk offsets out of bounds
+	 */
+	result = libfwnt_lzxpress_huffman_decompress_parallel(
+	          compressed_data,
+	          chunk_offsets[ 3 ],
+	          chunk_offsets,
+	          4,
+	          4096,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test uncompressed data too large for the chunks
+	 */
+	uncompressed_data_size = 16384;
+
+	result = libfwnt_lzxpress_huffman_decompress_parallel(
+	          compressed_data,
+	          compressed_data_size,
+	          chunk_offsets,
+	          4,
+	          4096,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( FWNT_TEST_LZXPRESS )
+	libcnotify_verbose_set(
+	 1 );
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+#endif
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lzxpress_compress",
+	 fwnt_test_lzxpress_compress );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lzxpress_compress_with_level",
+	 fwnt_test_lzxpress_compress_with_level );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lzxpress_decompress",
+	 fwnt_test_lzxpress_decompress );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lzxpress_huffman_compress",
+	 fwnt_test_lzxpress_huffman_compress );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lzxpress_huffman_compress_with_level",
+	 fwnt_test_lzxpress_huffman_compress_with_level );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lzxpress_huffman_decompress",
+	 fwnt_test_lzxpress_huffman_decompress );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_lzxpress_huffman_decompress_parallel",
+	 fwnt_test_lzxpress_huffman_decompress_parallel );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
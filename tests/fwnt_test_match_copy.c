@@ -0,0 +1,220 @@
+/*
+ * Library match copy functions test program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_match_copy.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+/* Tests the libfwnt_match_copy function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_match_copy(
+     void )
+{
+	uint8_t data[ 256 ];
+	uint8_t expected_data[ 256 ];
+
+	int kernel_variants[ 4 ] = {
+		LIBFWNT_KERNEL_VARIANT_SCALAR,
+		LIBFWNT_KERNEL_VARIANT_SSE2,
+		LIBFWNT_KERNEL_VARIANT_AVX2,
+		LIBFWNT_KERNEL_VARIANT_NEON };
+
+	libcerror_error_t *error = NULL;
+	size_t data_index        = 0;
+	size_t match_offset      = 0;
+	size_t match_size        = 0;
+	int kernel_variant_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 * The match is copied to data offset 64 and the result is compared
+	 * with that of a byte by byte copy, for every kernel variant supported by the CPU
+	 */
+	for( kernel_variant_index = 0;
+	     kernel_variant_index < 4;
+	     kernel_variant_index++ )
+	{
+		result = libfwnt_set_kernel_variant(
+		          kernel_variants[ kernel_variant_index ],
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_free(
+			 &error );
+
+			continue;
+		}
+		for( match_offset = 1;
+		     match_offset <= 64;
+		     match_offset++ )
+		{
+			for( match_size = 0;
+			     match_size <= 160;
+			     match_size++ )
+			{
+				for( data_index = 0;
+				     data_index < 256;
+				     data_index++ )
+				{
+					data[ data_index ]          = (uint8_t) ( ( data_index * 37 ) + 11 );
+					expected_data[ data_index ] = data[ data_index ];
+				}
+				for( data_index = 64;
+				     data_index < ( 64 + match_size );
+				     data_index++ )
+				{
+					expected_data[ data_index ] = expected_data[ data_index - match_offset ];
+				}
+				libfwnt_match_copy(
+				 data,
+				 64,
+				 match_offset,
+				 match_size );
+
+				result = memory_compare(
+				          data,
+				          expected_data,
+				          256 );
+
+				FWNT_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 0 );
+			}
+		}
+	}
+	result = libfwnt_set_kernel_variant(
+	          LIBFWNT_KERNEL_VARIANT_AUTOMATIC,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 * A match offset that refers to data before the start of the data is ignored
+	 */
+	for( data_index = 0;
+	     data_index < 256;
+	     data_index++ )
+	{
+		data[ data_index ]          = (uint8_t) data_index;
+		expected_data[ data_index ] = data[ data_index ];
+	}
+	libfwnt_match_copy(
+	 data,
+	 16,
+	 17,
+	 8 );
+
+	libfwnt_match_copy(
+	 data,
+	 16,
+	 0,
+	 8 );
+
+	libfwnt_match_copy(
+	 NULL,
+	 16,
+	 1,
+	 8 );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          256 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libfwnt_set_kernel_variant(
+	 LIBFWNT_KERNEL_VARIANT_AUTOMATIC,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_match_copy",
+	 fwnt_test_match_copy );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -278,6 +279,299 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwnt_security_descriptor_initialize_with_arena function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_initialize_with_arena(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libfwnt_access_control_entry_t *access_control_entry = NULL;
+	libfwnt_access_control_list_t *access_control_list   = NULL;
+	libfwnt_arena_t *arena                               = NULL;
+	libfwnt_security_descriptor_t *security_descriptor   = NULL;
+	int number_of_entries                                = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_initialize_with_arena(
+	          &security_descriptor,
+	          arena,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_security_descriptor_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_get_discretionary_acl(
+	          security_descriptor,
+	          &access_control_list,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_list_get_number_of_entries(
+	          access_control_list,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	result = libfwnt_access_control_list_get_entry_by_index(
+	          access_control_list,
+	          1,
+	          &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_control_entry",
+	 access_control_entry );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_free(
+	          &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_list_free(
+	          &access_control_list,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that parsing after reset reuses the memory of the arena
+	 */
+	result = libfwnt_arena_reset(
+	          arena,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+	fwnt_test_malloc_attempts_before_fail = 0;
+#endif
+
+	result = libfwnt_security_descriptor_initialize_with_arena(
+	          &security_descriptor,
+	          arena,
+	          &error );
+
+	if( result == 1 )
+	{
+		result = libfwnt_security_descriptor_copy_from_byte_stream(
+		          security_descriptor,
+		          fwnt_test_security_descriptor_data1,
+		          116,
+		          LIBFWNT_ENDIAN_LITTLE,
+		          &error );
+	}
+#if defined( HAVE_FWNT_TEST_MEMORY )
+	if( fwnt_test_malloc_attempts_before_fail == -1 )
+	{
+		result = 0;
+	}
+	fwnt_test_malloc_attempts_before_fail = -1;
+#endif
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_initialize_with_arena(
+	          NULL,
+	          arena,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_arena_free(
+	          &arena,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	if( arena != NULL )
+	{
+		libfwnt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfwnt_security_descriptor_copy_from_byte_stream function
  * Returns 1 if successful or 0 if not
  */
@@ -915,6 +1209,231 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwnt_security_descriptor_get_byte_stream_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_get_byte_stream_size(
+     libfwnt_security_descriptor_t *security_descriptor )
+{
+	libcerror_error_t *error = NULL;
+	size_t byte_stream_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_get_byte_stream_size(
+	          security_descriptor,
+	          &byte_stream_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 116 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_get_byte_stream_size(
+	          NULL,
+	          &byte_stream_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_get_byte_stream_size(
+	          security_descriptor,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_copy_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_copy_to_byte_stream(
+     libfwnt_security_descriptor_t *security_descriptor )
+{
+	uint8_t byte_stream[ 128 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor,
+	          byte_stream,
+	          128,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_security_descriptor_data1,
+	          116 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          NULL,
+	          byte_stream,
+	          128,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor,
+	          NULL,
+	          128,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor,
+	          byte_stream,
+	          115,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor,
+	          byte_stream,
+	          128,
+	          -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -942,6 +1461,10 @@ int main(
 	 "libfwnt_security_descriptor_free",
 	 fwnt_test_security_descriptor_free );
 
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_initialize_with_arena",
+	 fwnt_test_security_descriptor_initialize_with_arena );
+
 	FWNT_TEST_RUN(
 	 "libfwnt_security_descriptor_copy_from_byte_stream",
 	 fwnt_test_security_descriptor_copy_from_byte_stream );
@@ -983,6 +1506,16 @@ int main(
 	 "error",
 	 error );
 
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_security_descriptor_get_byte_stream_size",
+	 fwnt_test_security_descriptor_get_byte_stream_size,
+	 security_descriptor );
+
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_security_descriptor_copy_to_byte_stream",
+	 fwnt_test_security_descriptor_copy_to_byte_stream,
+	 security_descriptor );
+
 	FWNT_TEST_RUN_WITH_ARGS(
 	 "libfwnt_security_descriptor_get_owner",
 	 fwnt_test_security_descriptor_get_owner,
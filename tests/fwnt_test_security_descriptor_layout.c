@@ -0,0 +1,961 @@
+/*
+ * Library security_descriptor_layout functions test program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_security_descriptor_layout.h"
+#include "../libfwnt/libfwnt_security_descriptor_view.h"
+
+uint8_t fwnt_test_security_descriptor_layout_data1[ 116 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x48, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x34, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x9f, 0x01, 0x12, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x9f, 0x01, 0x12, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x15, 0x00, 0x00, 0x00, 0x52, 0xaa, 0xc8, 0x68, 0xdd, 0xe8, 0xe4, 0x1c, 0x8a, 0xa7, 0x32, 0x3f,
+	0xeb, 0x03, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00 };
+
+/* Predicate that matches a security descriptor without a discretionary access control list (DACL)
+ * Returns 1 if the security descriptor matches, 0 if not or -1 on error
+ */
+int fwnt_test_security_descriptor_layout_discretionary_acl_absent_predicate(
+     const uint8_t *byte_stream FWNT_TEST_ATTRIBUTE_UNUSED,
+     size_t byte_stream_size FWNT_TEST_ATTRIBUTE_UNUSED,
+     libfwnt_security_descriptor_layout_t *security_descriptor_layout,
+     void *predicate_arguments FWNT_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error FWNT_TEST_ATTRIBUTE_UNUSED )
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( byte_stream )
+	FWNT_TEST_UNREFERENCED_PARAMETER( byte_stream_size )
+	FWNT_TEST_UNREFERENCED_PARAMETER( predicate_arguments )
+	FWNT_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( security_descriptor_layout->discretionary_acl_offset == 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Predicate that matches a security descriptor of which the owner security identifier (SID)
+ * equals the SID data in the predicate arguments
+ * Returns 1 if the security descriptor matches, 0 if not or -1 on error
+ */
+int fwnt_test_security_descriptor_layout_owner_predicate(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size FWNT_TEST_ATTRIBUTE_UNUSED,
+     libfwnt_security_descriptor_layout_t *security_descriptor_layout,
+     void *predicate_arguments,
+     libcerror_error_t **error FWNT_TEST_ATTRIBUTE_UNUSED )
+{
+	const uint8_t *security_identifier_data = NULL;
+
+	FWNT_TEST_UNREFERENCED_PARAMETER( byte_stream_size )
+	FWNT_TEST_UNREFERENCED_PARAMETER( error )
+
+	security_identifier_data = (const uint8_t *) predicate_arguments;
+
+	if( ( security_descriptor_layout->owner_sid_offset == 0 )
+	 || ( security_descriptor_layout->owner_sid_size != ( 8 + ( (uint32_t) security_identifier_data[ 1 ] * 4 ) ) ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     &( byte_stream[ security_descriptor_layout->owner_sid_offset ] ),
+	     security_identifier_data,
+	     (size_t) security_descriptor_layout->owner_sid_size ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Predicate that fails
+ * Returns 1 if the security descriptor matches, 0 if not or -1 on error
+ */
+int fwnt_test_security_descriptor_layout_failing_predicate(
+     const uint8_t *byte_stream FWNT_TEST_ATTRIBUTE_UNUSED,
+     size_t byte_stream_size FWNT_TEST_ATTRIBUTE_UNUSED,
+     libfwnt_security_descriptor_layout_t *security_descriptor_layout FWNT_TEST_ATTRIBUTE_UNUSED,
+     void *predicate_arguments FWNT_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	static char *function = "fwnt_test_security_descriptor_layout_failing_predicate";
+
+	FWNT_TEST_UNREFERENCED_PARAMETER( byte_stream )
+	FWNT_TEST_UNREFERENCED_PARAMETER( byte_stream_size )
+	FWNT_TEST_UNREFERENCED_PARAMETER( security_descriptor_layout )
+	FWNT_TEST_UNREFERENCED_PARAMETER( predicate_arguments )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: predicate failed.",
+	 function );
+
+	return( -1 );
+}
+
+/* Tests the libfwnt_security_descriptor_layout_set_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_layout_set_from_byte_stream(
+     void )
+{
+	uint8_t data[ 116 ];
+	libfwnt_security_descriptor_layout_t security_descriptor_layout;
+	libfwnt_security_descriptor_view_t security_descriptor_view;
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	int mutation_index       = 0;
+	int result               = 0;
+	int view_result          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_layout_set_from_byte_stream(
+	          &security_descriptor_layout,
+	          fwnt_test_security_descriptor_layout_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "security_descriptor_layout.revision_number",
+	 (int) security_descriptor_layout.revision_number,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "security_descriptor_layout.control_flags",
+	 (int) security_descriptor_layout.control_flags,
+	 0x8004 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "security_descriptor_layout.owner_sid_offset",
+	 security_descriptor_layout.owner_sid_offset,
+	 (uint32_t) 0x00000048UL );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "security_descriptor_layout.owner_sid_size",
+	 security_descriptor_layout.owner_sid_size,
+	 (uint32_t) 28 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "security_descriptor_layout.group_sid_offset",
+	 security_descriptor_layout.group_sid_offset,
+	 (uint32_t) 0x00000064UL );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "security_descriptor_layout.group_sid_size",
+	 security_descriptor_layout.group_sid_size,
+	 (uint32_t) 16 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "security_descriptor_layout.system_acl_offset",
+	 security_descriptor_layout.system_acl_offset,
+	 (uint32_t) 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "security_descriptor_layout.system_acl_size",
+	 security_descriptor_layout.system_acl_size,
+	 (uint32_t) 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "security_descriptor_layout.discretionary_acl_offset",
+	 security_descriptor_layout.discretionary_acl_offset,
+	 (uint32_t) 0x00000014UL );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "security_descriptor_layout.discretionary_acl_size",
+	 security_descriptor_layout.discretionary_acl_size,
+	 (uint32_t) 0x00000034UL );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "security_descriptor_layout.data_size",
+	 security_descriptor_layout.data_size,
+	 (size_t) 116 );
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+
+	/* Test libfwnt_security_descriptor_layout_set_from_byte_stream with malloc failing
+	 * to ensure that no memory is allocated
+	 */
+	fwnt_test_malloc_attempts_before_fail = 0;
+
+	result = libfwnt_security_descriptor_layout_set_from_byte_stream(
+	          &security_descriptor_layout,
+	          fwnt_test_security_descriptor_layout_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	/* The value is only changed when malloc was called
+	 */
+	if( fwnt_test_malloc_attempts_before_fail == -1 )
+	{
+		result = 0;
+	}
+	fwnt_test_malloc_attempts_before_fail = -1;
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( HAVE_FWNT_TEST_MEMORY ) */
+
+	/* Test malformed data, for which no error is set
+	 */
+	result = libfwnt_security_descriptor_layout_set_from_byte_stream(
+	          &security_descriptor_layout,
+	          fwnt_test_security_descriptor_layout_data1,
+	          19,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( memory_copy(
+	     data,
+	     fwnt_test_security_descriptor_layout_data1,
+	     116 ) == NULL )
+	{
+		goto on_error;
+	}
+	data[ 0x49 ] = 0x0b;
+
+	result = libfwnt_security_descriptor_layout_set_from_byte_stream(
+	          &security_descriptor_layout,
+	          data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a security identifier that contains more than 15 sub authorities
+	 */
+	data[ 0x49 ] = 0x10;
+
+	result = libfwnt_security_descriptor_layout_set_from_byte_stream(
+	          &security_descriptor_layout,
+	          data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an owner security identifier offset that exceeds the data
+	 */
+	data[ 0x49 ] = 0x05;
+	data[ 0x04 ] = 0x74;
+
+	result = libfwnt_security_descriptor_layout_set_from_byte_stream(
+	          &security_descriptor_layout,
+	          data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an access control entry that exceeds the access control list
+	 */
+	data[ 0x04 ] = 0x48;
+	data[ 0x32 ] = 0x28;
+
+	result = libfwnt_security_descriptor_layout_set_from_byte_stream(
+	          &security_descriptor_layout,
+	          data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an access control list that exceeds the data
+	 */
+	data[ 0x32 ] = 0x18;
+	data[ 0x16 ] = 0x80;
+
+	result = libfwnt_security_descriptor_layout_set_from_byte_stream(
+	          &security_descriptor_layout,
+	          data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an object access control entry that is too small for its object flags
+	 */
+	data[ 0x16 ] = 0x34;
+	data[ 0x1c ] = LIBFWNT_ACCESS_ALLOWED_OBJECT;
+	data[ 0x1e ] = 0x08;
+
+	result = libfwnt_security_descriptor_layout_set_from_byte_stream(
+	          &security_descriptor_layout,
+	          data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that data is rejected the same as by libfwnt_security_descriptor_view_set_from_byte_stream
+	 */
+	for( data_offset = 0;
+	     data_offset < 116;
+	     data_offset++ )
+	{
+		for( mutation_index = 0;
+		     mutation_index < 4;
+		     mutation_index++ )
+		{
+			if( memory_copy(
+			     data,
+			     fwnt_test_security_descriptor_layout_data1,
+			     116 ) == NULL )
+			{
+				goto on_error;
+			}
+			data[ data_offset ] ^= (uint8_t) ( 1 << ( mutation_index * 2 ) );
+
+			result = libfwnt_security_descriptor_layout_set_from_byte_stream(
+			          &security_descriptor_layout,
+			          data,
+			          116,
+			          LIBFWNT_ENDIAN_LITTLE,
+			          &error );
+
+			view_result = libfwnt_security_descriptor_view_set_from_byte_stream(
+			               &security_descriptor_view,
+			               data,
+			               116,
+			               LIBFWNT_ENDIAN_LITTLE,
+			               &error );
+
+			if( error != NULL )
+			{
+				libcerror_error_free(
+				 &error );
+			}
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 (int) ( view_result == 1 ) );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_layout_set_from_byte_stream(
+	          NULL,
+	          fwnt_test_security_descriptor_layout_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_layout_set_from_byte_stream(
+	          &security_descriptor_layout,
+	          NULL,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_layout_set_from_byte_stream(
+	          &security_descriptor_layout,
+	          fwnt_test_security_descriptor_layout_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_layout_set_from_byte_stream(
+	          &security_descriptor_layout,
+	          fwnt_test_security_descriptor_layout_data1,
+	          116,
+	          (uint8_t) 'X',
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_layout_scan_byte_streams function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_layout_scan_byte_streams(
+     void )
+{
+	const uint8_t *byte_streams[ 3 ];
+	size_t byte_stream_sizes[ 3 ];
+	uint8_t data[ 116 ];
+	uint8_t matches[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	int number_of_matches    = 0;
+	int result               = 0;
+
+	if( memory_copy(
+	     data,
+	     fwnt_test_security_descriptor_layout_data1,
+	     116 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Remove the discretionary access control list (DACL)
+	 */
+	data[ 0x02 ] = 0x00;
+	data[ 0x10 ] = 0x00;
+
+	byte_streams[ 0 ] = fwnt_test_security_descriptor_layout_data1;
+	byte_streams[ 1 ] = fwnt_test_security_descriptor_layout_data1;
+	byte_streams[ 2 ] = data;
+
+	byte_stream_sizes[ 0 ] = 116;
+	byte_stream_sizes[ 1 ] = 19;
+	byte_stream_sizes[ 2 ] = 116;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_layout_scan_byte_streams(
+	          byte_streams,
+	          byte_stream_sizes,
+	          3,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          NULL,
+	          NULL,
+	          matches,
+	          &number_of_matches,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 2 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "matches[ 0 ]",
+	 (int) matches[ 0 ],
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "matches[ 1 ]",
+	 (int) matches[ 1 ],
+	 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "matches[ 2 ]",
+	 (int) matches[ 2 ],
+	 1 );
+
+	result = libfwnt_security_descriptor_layout_scan_byte_streams(
+	          byte_streams,
+	          byte_stream_sizes,
+	          3,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &fwnt_test_security_descriptor_layout_discretionary_acl_absent_predicate,
+	          NULL,
+	          matches,
+	          &number_of_matches,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "matches[ 0 ]",
+	 (int) matches[ 0 ],
+	 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "matches[ 1 ]",
+	 (int) matches[ 1 ],
+	 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "matches[ 2 ]",
+	 (int) matches[ 2 ],
+	 1 );
+
+	result = libfwnt_security_descriptor_layout_scan_byte_streams(
+	          byte_streams,
+	          byte_stream_sizes,
+	          3,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &fwnt_test_security_descriptor_layout_owner_predicate,
+	          (void *) &( fwnt_test_security_descriptor_layout_data1[ 0x48 ] ),
+	          matches,
+	          &number_of_matches,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 2 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "matches[ 0 ]",
+	 (int) matches[ 0 ],
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "matches[ 1 ]",
+	 (int) matches[ 1 ],
+	 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "matches[ 2 ]",
+	 (int) matches[ 2 ],
+	 1 );
+
+	result = libfwnt_security_descriptor_layout_scan_byte_streams(
+	          byte_streams,
+	          byte_stream_sizes,
+	          3,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &fwnt_test_security_descriptor_layout_owner_predicate,
+	          (void *) &( fwnt_test_security_descriptor_layout_data1[ 0x64 ] ),
+	          matches,
+	          &number_of_matches,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "matches[ 0 ]",
+	 (int) matches[ 0 ],
+	 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "matches[ 1 ]",
+	 (int) matches[ 1 ],
+	 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "matches[ 2 ]",
+	 (int) matches[ 2 ],
+	 0 );
+
+	result = libfwnt_security_descriptor_layout_scan_byte_streams(
+	          byte_streams,
+	          byte_stream_sizes,
+	          3,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &number_of_matches,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 2 );
+
+	result = libfwnt_security_descriptor_layout_scan_byte_streams(
+	          byte_streams,
+	          byte_stream_sizes,
+	          0,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          NULL,
+	          NULL,
+	          matches,
+	          &number_of_matches,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_layout_scan_byte_streams(
+	          NULL,
+	          byte_stream_sizes,
+	          3,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          NULL,
+	          NULL,
+	          matches,
+	          &number_of_matches,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_layout_scan_byte_streams(
+	          byte_streams,
+	          NULL,
+	          3,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          NULL,
+	          NULL,
+	          matches,
+	          &number_of_matches,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_layout_scan_byte_streams(
+	          byte_streams,
+	          byte_stream_sizes,
+	          -1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          NULL,
+	          NULL,
+	          matches,
+	          &number_of_matches,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_layout_scan_byte_streams(
+	          byte_streams,
+	          byte_stream_sizes,
+	          3,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          NULL,
+	          NULL,
+	          matches,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_layout_scan_byte_streams(
+	          byte_streams,
+	          byte_stream_sizes,
+	          3,
+	          (uint8_t) 'X',
+	          NULL,
+	          NULL,
+	          matches,
+	          &number_of_matches,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_layout_scan_byte_streams(
+	          byte_streams,
+	          byte_stream_sizes,
+	          3,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &fwnt_test_security_descriptor_layout_failing_predicate,
+	          NULL,
+	          matches,
+	          &number_of_matches,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_layout_set_from_byte_stream",
+	 fwnt_test_security_descriptor_layout_set_from_byte_stream );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_layout_scan_byte_streams",
+	 fwnt_test_security_descriptor_layout_scan_byte_streams );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1221 @@
+/*
+ * Library security_descriptor_stream functions test program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_security_descriptor_stream.h"
+
+/* The size of the test stream data, which consists of a block, its mirror and a partial block
+ */
+#define FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_DATA_SIZE	( ( 2 * 0x00040000UL ) + 0x00001000UL )
+
+/* The number of entries in the first block of the test stream data
+ */
+#define FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_NUMBER_OF_ENTRIES	1000
+
+uint8_t fwnt_test_security_descriptor_stream_descriptor_data1[ 116 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x48, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x34, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x9f, 0x01, 0x12, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x9f, 0x01, 0x12, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x15, 0x00, 0x00, 0x00, 0x52, 0xaa, 0xc8, 0x68, 0xdd, 0xe8, 0xe4, 0x1c, 0x8a, 0xa7, 0x32, 0x3f,
+	0xeb, 0x03, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00 };
+
+/* Writes a security descriptor stream entry into the test stream data
+ * The entry offset is the offset stored in the entry header, which differs
+ * from the data offset for an entry in a mirror block
+ * Returns the aligned size of the entry
+ */
+size_t fwnt_test_security_descriptor_stream_write_entry(
+        uint8_t *data,
+        size_t data_offset,
+        size_t entry_offset,
+        uint32_t security_descriptor_identifier )
+{
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ data_offset ] ),
+	 security_descriptor_identifier ^ 0x5a5a5a5aUL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ data_offset + 4 ] ),
+	 security_descriptor_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ data_offset + 8 ] ),
+	 (uint64_t) entry_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ data_offset + 16 ] ),
+	 20 + 116 );
+
+	memory_copy(
+	 &( data[ data_offset + 20 ] ),
+	 fwnt_test_security_descriptor_stream_descriptor_data1,
+	 116 );
+
+	return( 144 );
+}
+
+/* Creates the test stream data
+ * The first block contains 1000 entries and is mirrored, the third block contains 1 entry
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_stream_create_data(
+     uint8_t **data )
+{
+	size_t data_offset = 0;
+	int entry_index    = 0;
+
+	*data = (uint8_t *) memory_allocate(
+	                     FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_DATA_SIZE );
+
+	if( *data == NULL )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     *data,
+	     0,
+	     FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_DATA_SIZE ) == NULL )
+	{
+		memory_free(
+		 *data );
+
+		*data = NULL;
+
+		return( 0 );
+	}
+	for( entry_index = 0;
+	     entry_index < FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_NUMBER_OF_ENTRIES;
+	     entry_index++ )
+	{
+		fwnt_test_security_descriptor_stream_write_entry(
+		 *data,
+		 0x00040000UL + data_offset,
+		 data_offset,
+		 0x00000100UL + (uint32_t) entry_index );
+
+		data_offset += fwnt_test_security_descriptor_stream_write_entry(
+		                *data,
+		                data_offset,
+		                data_offset,
+		                0x00000100UL + (uint32_t) entry_index );
+	}
+	fwnt_test_security_descriptor_stream_write_entry(
+	 *data,
+	 0x00080000UL,
+	 0x00080000UL,
+	 0x00000100UL + FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_NUMBER_OF_ENTRIES );
+
+	return( 1 );
+}
+
+/* Tests the libfwnt_security_descriptor_stream_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_stream_initialize(
+     void )
+{
+	libcerror_error_t *error                                         = NULL;
+	libfwnt_security_descriptor_stream_t *security_descriptor_stream = NULL;
+	int result                                                       = 0;
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+	int number_of_malloc_fail_tests                                  = 1;
+	int number_of_memset_fail_tests                                  = 1;
+	int test_number                                                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_stream_initialize(
+	          &security_descriptor_stream,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_stream",
+	 security_descriptor_stream );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_stream_free(
+	          &security_descriptor_stream,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor_stream",
+	 security_descriptor_stream );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_stream_initialize(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	security_descriptor_stream = (libfwnt_security_descriptor_stream_t *) 0x12345678UL;
+
+	result = libfwnt_security_descriptor_stream_initialize(
+	          &security_descriptor_stream,
+	          &error );
+
+	security_descriptor_stream = NULL;
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_security_descriptor_stream_initialize with malloc failing
+		 */
+		fwnt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwnt_security_descriptor_stream_initialize(
+		          &security_descriptor_stream,
+		          &error );
+
+		if( fwnt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwnt_test_malloc_attempts_before_fail = -1;
+
+			if( security_descriptor_stream != NULL )
+			{
+				libfwnt_security_descriptor_stream_free(
+				 &security_descriptor_stream,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "security_descriptor_stream",
+			 security_descriptor_stream );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_security_descriptor_stream_initialize with memset failing
+		 */
+		fwnt_test_memset_attempts_before_fail = test_number;
+
+		result = libfwnt_security_descriptor_stream_initialize(
+		          &security_descriptor_stream,
+		          &error );
+
+		if( fwnt_test_memset_attempts_before_fail != -1 )
+		{
+			fwnt_test_memset_attempts_before_fail = -1;
+
+			if( security_descriptor_stream != NULL )
+			{
+				libfwnt_security_descriptor_stream_free(
+				 &security_descriptor_stream,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "security_descriptor_stream",
+			 security_descriptor_stream );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWNT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor_stream != NULL )
+	{
+		libfwnt_security_descriptor_stream_free(
+		 &security_descriptor_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_stream_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_stream_free(
+     void )
+{
+	libcerror_error_t *error                                         = NULL;
+	int result                                                       = 0;
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_stream_free(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_stream_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_stream_read_data(
+     void )
+{
+	libfwnt_security_descriptor_t *security_descriptor               = NULL;
+	libfwnt_security_descriptor_stream_t *security_descriptor_stream = NULL;
+	libcerror_error_t *error                                         = NULL;
+	uint8_t *data                                                    = NULL;
+	uint32_t security_descriptor_identifier                          = 0;
+	int entry_index                                                  = 0;
+	int number_of_entries                                            = 0;
+	int result                                                       = 0;
+
+	/* Initialize test
+	 */
+	result = fwnt_test_security_descriptor_stream_create_data(
+	          &data );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libfwnt_security_descriptor_stream_initialize(
+	          &security_descriptor_stream,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_stream",
+	 security_descriptor_stream );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_stream_read_data(
+	          security_descriptor_stream,
+	          data,
+	          FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_DATA_SIZE,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_stream_get_number_of_entries(
+	          security_descriptor_stream,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_NUMBER_OF_ENTRIES + 1 );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libfwnt_security_descriptor_stream_get_entry_by_index(
+		          security_descriptor_stream,
+		          entry_index,
+		          &security_descriptor_identifier,
+		          &security_descriptor,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FWNT_TEST_ASSERT_EQUAL_UINT32(
+		 "security_descriptor_identifier",
+		 security_descriptor_identifier,
+		 (uint32_t) ( 0x00000100UL + entry_index ) );
+
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "security_descriptor",
+		 security_descriptor );
+	}
+	result = libfwnt_security_descriptor_stream_read_data(
+	          security_descriptor_stream,
+	          data,
+	          FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_DATA_SIZE,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_stream_get_number_of_entries(
+	          security_descriptor_stream,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_NUMBER_OF_ENTRIES + 1 );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		result = libfwnt_security_descriptor_stream_get_entry_by_index(
+		          security_descriptor_stream,
+		          entry_index,
+		          &security_descriptor_identifier,
+		          &security_descriptor,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FWNT_TEST_ASSERT_EQUAL_UINT32(
+		 "security_descriptor_identifier",
+		 security_descriptor_identifier,
+		 (uint32_t) ( 0x00000100UL + entry_index ) );
+
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "security_descriptor",
+		 security_descriptor );
+	}
+	/* Test with data without entries
+	 */
+	result = libfwnt_security_descriptor_stream_read_data(
+	          security_descriptor_stream,
+	          data,
+	          16,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_stream_get_number_of_entries(
+	          security_descriptor_stream,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_stream_read_data(
+	          NULL,
+	          data,
+	          FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_DATA_SIZE,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_stream_read_data(
+	          security_descriptor_stream,
+	          NULL,
+	          FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_DATA_SIZE,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_stream_read_data(
+	          security_descriptor_stream,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_stream_read_data(
+	          security_descriptor_stream,
+	          data,
+	          FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_DATA_SIZE,
+	          -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an entry that exceeds the block
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 0x00080000UL + 16 ] ),
+	 0x00002000UL );
+
+	result = libfwnt_security_descriptor_stream_read_data(
+	          security_descriptor_stream,
+	          data,
+	          FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_DATA_SIZE,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 0x00080000UL + 16 ] ),
+	 20 + 116 );
+
+	/* Test with a security descriptor that is corrupt
+	 */
+	data[ ( 144 * 500 ) + 20 + 0x04 ] = 0xff;
+
+	result = libfwnt_security_descriptor_stream_read_data(
+	          security_descriptor_stream,
+	          data,
+	          FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_DATA_SIZE,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_stream_get_number_of_entries(
+	          security_descriptor_stream,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_stream_free(
+	          &security_descriptor_stream,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor_stream",
+	 security_descriptor_stream );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor_stream != NULL )
+	{
+		libfwnt_security_descriptor_stream_free(
+		 &security_descriptor_stream,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_stream_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_stream_get_number_of_entries(
+     void )
+{
+	libfwnt_security_descriptor_stream_t *security_descriptor_stream = NULL;
+	libcerror_error_t *error                                         = NULL;
+	int number_of_entries                                            = 0;
+	int result                                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_stream_initialize(
+	          &security_descriptor_stream,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_stream",
+	 security_descriptor_stream );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_stream_get_number_of_entries(
+	          security_descriptor_stream,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_stream_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_stream_get_number_of_entries(
+	          security_descriptor_stream,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_stream_free(
+	          &security_descriptor_stream,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor_stream",
+	 security_descriptor_stream );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor_stream != NULL )
+	{
+		libfwnt_security_descriptor_stream_free(
+		 &security_descriptor_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_stream_get_entry_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_stream_get_entry_by_index(
+     void )
+{
+	libfwnt_security_descriptor_t *security_descriptor               = NULL;
+	libfwnt_security_descriptor_stream_t *security_descriptor_stream = NULL;
+	libfwnt_security_identifier_t *security_identifier               = NULL;
+	libcerror_error_t *error                                         = NULL;
+	uint8_t *data                                                    = NULL;
+	uint32_t security_descriptor_identifier                          = 0;
+	int result                                                       = 0;
+
+	/* Initialize test
+	 */
+	result = fwnt_test_security_descriptor_stream_create_data(
+	          &data );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libfwnt_security_descriptor_stream_initialize(
+	          &security_descriptor_stream,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_stream",
+	 security_descriptor_stream );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_stream_read_data(
+	          security_descriptor_stream,
+	          data,
+	          FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_DATA_SIZE,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The security descriptors are copied, the data is no longer needed
+	 */
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_stream_get_entry_by_index(
+	          security_descriptor_stream,
+	          FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_NUMBER_OF_ENTRIES,
+	          &security_descriptor_identifier,
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "security_descriptor_identifier",
+	 security_descriptor_identifier,
+	 (uint32_t) ( 0x00000100UL + FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_NUMBER_OF_ENTRIES ) );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	result = libfwnt_security_descriptor_get_owner(
+	          security_descriptor,
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_stream_get_entry_by_index(
+	          NULL,
+	          0,
+	          &security_descriptor_identifier,
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_stream_get_entry_by_index(
+	          security_descriptor_stream,
+	          -1,
+	          &security_descriptor_identifier,
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_stream_get_entry_by_index(
+	          security_descriptor_stream,
+	          FWNT_TEST_SECURITY_DESCRIPTOR_STREAM_NUMBER_OF_ENTRIES + 1,
+	          &security_descriptor_identifier,
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_stream_get_entry_by_index(
+	          security_descriptor_stream,
+	          0,
+	          NULL,
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_stream_get_entry_by_index(
+	          security_descriptor_stream,
+	          0,
+	          &security_descriptor_identifier,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_stream_free(
+	          &security_descriptor_stream,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor_stream",
+	 security_descriptor_stream );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	if( security_descriptor_stream != NULL )
+	{
+		libfwnt_security_descriptor_stream_free(
+		 &security_descriptor_stream,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_stream_initialize",
+	 fwnt_test_security_descriptor_stream_initialize );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_stream_free",
+	 fwnt_test_security_descriptor_stream_free );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_stream_read_data",
+	 fwnt_test_security_descriptor_stream_read_data );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_stream_get_number_of_entries",
+	 fwnt_test_security_descriptor_stream_get_number_of_entries );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_stream_get_entry_by_index",
+	 fwnt_test_security_descriptor_stream_get_entry_by_index );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,944 @@
+/*
+ * Library security_descriptor_view functions test program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_security_descriptor_view.h"
+
+uint8_t fwnt_test_security_descriptor_view_data1[ 116 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x48, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x34, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x9f, 0x01, 0x12, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x9f, 0x01, 0x12, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x15, 0x00, 0x00, 0x00, 0x52, 0xaa, 0xc8, 0x68, 0xdd, 0xe8, 0xe4, 0x1c, 0x8a, 0xa7, 0x32, 0x3f,
+	0xeb, 0x03, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00 };
+
+/* Tests the libfwnt_security_descriptor_view_set_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_set_from_byte_stream(
+     void )
+{
+	uint8_t data[ 116 ];
+	libfwnt_security_descriptor_view_t security_descriptor_view;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          &security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "security_descriptor_view.data_size",
+	 security_descriptor_view.data_size,
+	 (size_t) 116 );
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+
+	/* Test libfwnt_security_descriptor_view_set_from_byte_stream with malloc failing
+	 * to ensure that no memory is allocated
+	 */
+	fwnt_test_malloc_attempts_before_fail = 0;
+
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          &security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	/* The value is only changed when malloc was called
+	 */
+	if( fwnt_test_malloc_attempts_before_fail == -1 )
+	{
+		result = 0;
+	}
+	fwnt_test_malloc_attempts_before_fail = -1;
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( HAVE_FWNT_TEST_MEMORY ) */
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          NULL,
+	          fwnt_test_security_descriptor_view_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          &security_descriptor_view,
+	          NULL,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          &security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          0,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          &security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          &security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          20,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          &security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          116,
+	          (uint8_t) 'X',
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an owner security identifier that exceeds the data
+	 */
+	if( memory_copy(
+	     data,
+	     fwnt_test_security_descriptor_view_data1,
+	     116 ) == NULL )
+	{
+		goto on_error;
+	}
+	data[ 0x49 ] = 0x0b;
+
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          &security_descriptor_view,
+	          data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an access control entry that exceeds the access control list
+	 */
+	data[ 0x49 ] = 0x05;
+	data[ 0x32 ] = 0x28;
+
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          &security_descriptor_view,
+	          data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_get_revision_number function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_get_revision_number(
+     void )
+{
+	libfwnt_security_descriptor_view_t security_descriptor_view;
+
+	libcerror_error_t *error = NULL;
+	uint8_t revision_number  = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          &security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_get_revision_number(
+	          &security_descriptor_view,
+	          &revision_number,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "revision_number",
+	 revision_number,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_get_revision_number(
+	          NULL,
+	          &revision_number,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_revision_number(
+	          &security_descriptor_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_get_control_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_get_control_flags(
+     void )
+{
+	libfwnt_security_descriptor_view_t security_descriptor_view;
+
+	libcerror_error_t *error = NULL;
+	uint16_t control_flags   = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          &security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_get_control_flags(
+	          &security_descriptor_view,
+	          &control_flags,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT16(
+	 "control_flags",
+	 control_flags,
+	 0x8004 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_get_control_flags(
+	          NULL,
+	          &control_flags,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_control_flags(
+	          &security_descriptor_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_get_owner function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_get_owner(
+     void )
+{
+	libfwnt_security_identifier_view_t security_identifier_view;
+	libfwnt_security_descriptor_view_t security_descriptor_view;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          &security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_get_owner(
+	          &security_descriptor_view,
+	          &security_identifier_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "security_identifier_view.data",
+	 (int) ( security_identifier_view.data - fwnt_test_security_descriptor_view_data1 ),
+	 0x48 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "security_identifier_view.data_size",
+	 security_identifier_view.data_size,
+	 (size_t) 28 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_get_owner(
+	          NULL,
+	          &security_identifier_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_owner(
+	          &security_descriptor_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_get_group function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_get_group(
+     void )
+{
+	libfwnt_security_identifier_view_t security_identifier_view;
+	libfwnt_security_descriptor_view_t security_descriptor_view;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          &security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_get_group(
+	          &security_descriptor_view,
+	          &security_identifier_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "security_identifier_view.data",
+	 (int) ( security_identifier_view.data - fwnt_test_security_descriptor_view_data1 ),
+	 0x64 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "security_identifier_view.data_size",
+	 security_identifier_view.data_size,
+	 (size_t) 16 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_get_group(
+	          NULL,
+	          &security_identifier_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_group(
+	          &security_descriptor_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_get_discretionary_acl function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_get_discretionary_acl(
+     void )
+{
+	libfwnt_access_control_list_view_t access_control_list_view;
+	libfwnt_security_descriptor_view_t security_descriptor_view;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          &security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_get_discretionary_acl(
+	          &security_descriptor_view,
+	          &access_control_list_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "access_control_list_view.data",
+	 (int) ( access_control_list_view.data - fwnt_test_security_descriptor_view_data1 ),
+	 0x14 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "access_control_list_view.data_size",
+	 access_control_list_view.data_size,
+	 (size_t) 0x34 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_get_discretionary_acl(
+	          NULL,
+	          &access_control_list_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl(
+	          &security_descriptor_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_get_system_acl function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_get_system_acl(
+     void )
+{
+	libfwnt_access_control_list_view_t access_control_list_view;
+	libfwnt_security_descriptor_view_t security_descriptor_view;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_view_set_from_byte_stream(
+	          &security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_get_system_acl(
+	          &security_descriptor_view,
+	          &access_control_list_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_get_system_acl(
+	          NULL,
+	          &access_control_list_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_system_acl(
+	          &security_descriptor_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_view_set_from_byte_stream",
+	 fwnt_test_security_descriptor_view_set_from_byte_stream );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_view_get_revision_number",
+	 fwnt_test_security_descriptor_view_get_revision_number );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_view_get_control_flags",
+	 fwnt_test_security_descriptor_view_get_control_flags );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_view_get_owner",
+	 fwnt_test_security_descriptor_view_get_owner );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_view_get_group",
+	 fwnt_test_security_descriptor_view_get_group );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_view_get_discretionary_acl",
+	 fwnt_test_security_descriptor_view_get_discretionary_acl );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_view_get_system_acl",
+	 fwnt_test_security_descriptor_view_get_system_acl );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,8 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -506,21 +508,1444 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwnt_security_identifier_get_byte_stream_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_get_byte_stream_size(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_identifier_t *security_identifier = NULL;
+	size_t byte_stream_size                            = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          security_identifier,
+	          fwnt_test_security_identifier_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_get_byte_stream_size(
+	          security_identifier,
+	          &byte_stream_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 28 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_get_byte_stream_size(
+	          NULL,
+	          &byte_stream_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_get_byte_stream_size(
+	          security_identifier,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_copy_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_copy_to_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ 32 ];
+
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_identifier_t *security_identifier = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          security_identifier,
+	          fwnt_test_security_identifier_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_copy_to_byte_stream(
+	          security_identifier,
+	          byte_stream,
+	          32,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_security_identifier_data1,
+	          28 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_copy_to_byte_stream(
+	          NULL,
+	          byte_stream,
+	          32,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_byte_stream(
+	          security_identifier,
+	          NULL,
+	          32,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_byte_stream(
+	          security_identifier,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_byte_stream(
+	          security_identifier,
+	          byte_stream,
+	          27,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_byte_stream(
+	          security_identifier,
+	          byte_stream,
+	          32,
+	          (uint8_t) 'X',
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfwnt_security_identifier_get_string_size function
  * Returns 1 if successful or 0 if not
  */
-int fwnt_test_security_identifier_get_string_size(
+int fwnt_test_security_identifier_get_string_size(
+     libfwnt_security_identifier_t *security_identifier )
+{
+	libcerror_error_t *error = NULL;
+	size_t string_size       = 0;
+	int result               = 0;
+
+	/* Test retrieve string size
+	 */
+	result = libfwnt_security_identifier_get_string_size(
+	          security_identifier,
+	          &string_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_get_string_size(
+	          NULL,
+	          &string_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_get_string_size(
+	          security_identifier,
+	          NULL,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_get_string_size(
+	          security_identifier,
+	          &string_size,
+	          0xffffffffUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_copy_to_utf8_string(
+     libfwnt_security_identifier_t *security_identifier )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test copy to UTF-8 string
+	 */
+	result = libfwnt_security_identifier_copy_to_utf8_string(
+	          security_identifier,
+	          utf8_string,
+	          47,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_copy_to_utf8_string(
+	          NULL,
+	          utf8_string,
+	          47,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_string(
+	          security_identifier,
+	          NULL,
+	          47,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_string(
+	          security_identifier,
+	          utf8_string,
+	          18,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_string(
+	          security_identifier,
+	          utf8_string,
+	          47,
+	          0xffffffffUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_copy_to_utf8_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_copy_to_utf8_string_with_index(
+     libfwnt_security_identifier_t *security_identifier )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test copy to UTF-8 string
+	 */
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	          security_identifier,
+	          utf8_string,
+	          47,
+	          &utf8_string_index,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	          NULL,
+	          utf8_string,
+	          47,
+	          &utf8_string_index,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	          security_identifier,
+	          NULL,
+	          47,
+	          &utf8_string_index,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	          security_identifier,
+	          utf8_string,
+	          18,
+	          &utf8_string_index,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	          security_identifier,
+	          utf8_string,
+	          47,
+	          NULL,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	          security_identifier,
+	          utf8_string,
+	          47,
+	          &utf8_string_index,
+	          0xffffffffUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_copy_to_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_copy_to_utf16_string(
+     libfwnt_security_identifier_t *security_identifier )
+{
+	uint16_t utf16_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test copy to UTF-16 string
+	 */
+	result = libfwnt_security_identifier_copy_to_utf16_string(
+	          security_identifier,
+	          utf16_string,
+	          47,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_copy_to_utf16_string(
+	          NULL,
+	          utf16_string,
+	          47,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf16_string(
+	          security_identifier,
+	          NULL,
+	          47,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf16_string(
+	          security_identifier,
+	          utf16_string,
+	          18,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf16_string(
+	          security_identifier,
+	          utf16_string,
+	          47,
+	          0xffffffffUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_copy_to_utf16_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_copy_to_utf16_string_with_index(
+     libfwnt_security_identifier_t *security_identifier )
+{
+	uint16_t utf16_string[ 64 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t utf16_string_index = 0;
+	int result                = 0;
+
+	/* Test copy to UTF-16 string
+	 */
+	result = libfwnt_security_identifier_copy_to_utf16_string_with_index(
+	          security_identifier,
+	          utf16_string,
+	          47,
+	          &utf16_string_index,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_copy_to_utf16_string_with_index(
+	          NULL,
+	          utf16_string,
+	          47,
+	          &utf16_string_index,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf16_string_with_index(
+	          security_identifier,
+	          NULL,
+	          47,
+	          &utf16_string_index,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf16_string_with_index(
+	          security_identifier,
+	          utf16_string,
+	          18,
+	          &utf16_string_index,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf16_string_with_index(
+	          security_identifier,
+	          utf16_string,
+	          47,
+	          NULL,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf16_string_with_index(
+	          security_identifier,
+	          utf16_string,
+	          47,
+	          &utf16_string_index,
+	          0xffffffffUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_copy_to_utf32_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_copy_to_utf32_string(
+     libfwnt_security_identifier_t *security_identifier )
+{
+	uint32_t utf32_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test copy to UTF-32 string
+	 */
+	result = libfwnt_security_identifier_copy_to_utf32_string(
+	          security_identifier,
+	          utf32_string,
+	          47,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_copy_to_utf32_string(
+	          NULL,
+	          utf32_string,
+	          47,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf32_string(
+	          security_identifier,
+	          NULL,
+	          47,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf32_string(
+	          security_identifier,
+	          utf32_string,
+	          18,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf32_string(
+	          security_identifier,
+	          utf32_string,
+	          47,
+	          0xffffffffUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_copy_to_utf32_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_copy_to_utf32_string_with_index(
+     libfwnt_security_identifier_t *security_identifier )
+{
+	uint32_t utf32_string[ 64 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t utf32_string_index = 0;
+	int result                = 0;
+
+	/* Test copy to UTF-32 string
+	 */
+	result = libfwnt_security_identifier_copy_to_utf32_string_with_index(
+	          security_identifier,
+	          utf32_string,
+	          47,
+	          &utf32_string_index,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_copy_to_utf32_string_with_index(
+	          NULL,
+	          utf32_string,
+	          47,
+	          &utf32_string_index,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf32_string_with_index(
+	          security_identifier,
+	          NULL,
+	          47,
+	          &utf32_string_index,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf32_string_with_index(
+	          security_identifier,
+	          utf32_string,
+	          18,
+	          &utf32_string_index,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf32_string_with_index(
+	          security_identifier,
+	          utf32_string,
+	          47,
+	          NULL,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf32_string_with_index(
+	          security_identifier,
+	          utf32_string,
+	          47,
+	          &utf32_string_index,
+	          0xffffffffUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_get_utf8_strings_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_get_utf8_strings_size(
+     libfwnt_security_identifier_t *security_identifier )
+{
+	libfwnt_security_identifier_t *security_identifiers[ 2 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_strings_size = 0;
+	int result               = 0;
+
+	security_identifiers[ 0 ] = security_identifier;
+	security_identifiers[ 1 ] = security_identifier;
+
+	/* Test get UTF-8 strings size
+	 */
+	result = libfwnt_security_identifier_get_utf8_strings_size(
+	          security_identifiers,
+	          2,
+	          &utf8_strings_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_strings_size",
+	 utf8_strings_size,
+	 (size_t) 88 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_get_utf8_strings_size(
+	          security_identifiers,
+	          0,
+	          &utf8_strings_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_strings_size",
+	 utf8_strings_size,
+	 (size_t) 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_get_utf8_strings_size(
+	          NULL,
+	          2,
+	          &utf8_strings_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_get_utf8_strings_size(
+	          security_identifiers,
+	          -1,
+	          &utf8_strings_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_get_utf8_strings_size(
+	          security_identifiers,
+	          2,
+	          NULL,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_get_utf8_strings_size(
+	          security_identifiers,
+	          2,
+	          &utf8_strings_size,
+	          0xffffffffUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	security_identifiers[ 1 ] = NULL;
+
+	result = libfwnt_security_identifier_get_utf8_strings_size(
+	          security_identifiers,
+	          2,
+	          &utf8_strings_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_copy_to_utf8_strings function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_copy_to_utf8_strings(
      libfwnt_security_identifier_t *security_identifier )
 {
+	uint8_t expected_utf8_string[ 64 ];
+	uint8_t utf8_strings[ 128 ];
+
+	libfwnt_security_identifier_t *security_identifiers[ 2 ];
+	size_t utf8_string_offsets[ 2 ];
+
 	libcerror_error_t *error = NULL;
-	size_t string_size       = 0;
 	int result               = 0;
 
-	/* Test retrieve string size
-	 */
-	result = libfwnt_security_identifier_get_string_size(
+	security_identifiers[ 0 ] = security_identifier;
+	security_identifiers[ 1 ] = security_identifier;
+
+	result = libfwnt_security_identifier_copy_to_utf8_string(
 	          security_identifier,
-	          &string_size,
+	          expected_utf8_string,
+	          64,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test copy to UTF-8 strings
+	 */
+	result = libfwnt_security_identifier_copy_to_utf8_strings(
+	          security_identifiers,
+	          2,
+	          utf8_strings,
+	          128,
+	          utf8_string_offsets,
 	          0,
 	          &error );
 
@@ -533,11 +1958,44 @@ int fwnt_test_security_identifier_get_string_size(
 	 "error",
 	 error );
 
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_offsets[ 0 ]",
+	 utf8_string_offsets[ 0 ],
+	 (size_t) 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_offsets[ 1 ]",
+	 utf8_string_offsets[ 1 ],
+	 (size_t) 44 );
+
+	result = memory_compare(
+	          &( utf8_strings[ 0 ] ),
+	          expected_utf8_string,
+	          44 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( utf8_strings[ 44 ] ),
+	          expected_utf8_string,
+	          44 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libfwnt_security_identifier_get_string_size(
+	result = libfwnt_security_identifier_copy_to_utf8_strings(
 	          NULL,
-	          &string_size,
+	          2,
+	          utf8_strings,
+	          128,
+	          utf8_string_offsets,
 	          0,
 	          &error );
 
@@ -553,9 +2011,33 @@ int fwnt_test_security_identifier_get_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_get_string_size(
-	          security_identifier,
+	result = libfwnt_security_identifier_copy_to_utf8_strings(
+	          security_identifiers,
+	          -1,
+	          utf8_strings,
+	          128,
+	          utf8_string_offsets,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_strings(
+	          security_identifiers,
+	          2,
 	          NULL,
+	          128,
+	          utf8_string_offsets,
 	          0,
 	          &error );
 
@@ -571,9 +2053,75 @@ int fwnt_test_security_identifier_get_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_get_string_size(
-	          security_identifier,
-	          &string_size,
+	result = libfwnt_security_identifier_copy_to_utf8_strings(
+	          security_identifiers,
+	          2,
+	          utf8_strings,
+	          (size_t) SSIZE_MAX + 1,
+	          utf8_string_offsets,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_strings(
+	          security_identifiers,
+	          2,
+	          utf8_strings,
+	          87,
+	          utf8_string_offsets,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_strings(
+	          security_identifiers,
+	          2,
+	          utf8_strings,
+	          128,
+	          NULL,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_strings(
+	          security_identifiers,
+	          2,
+	          utf8_strings,
+	          128,
+	          utf8_string_offsets,
 	          0xffffffffUL,
 	          &error );
 
@@ -589,6 +2137,29 @@ int fwnt_test_security_identifier_get_string_size(
 	libcerror_error_free(
 	 &error );
 
+	security_identifiers[ 1 ] = NULL;
+
+	result = libfwnt_security_identifier_copy_to_utf8_strings(
+	          security_identifiers,
+	          2,
+	          utf8_strings,
+	          128,
+	          utf8_string_offsets,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -600,23 +2171,127 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfwnt_security_identifier_copy_to_utf8_string function
+/* Tests the libfwnt_security_identifier_copy_from_utf8_string function
  * Returns 1 if successful or 0 if not
  */
-int fwnt_test_security_identifier_copy_to_utf8_string(
-     libfwnt_security_identifier_t *security_identifier )
+int fwnt_test_security_identifier_copy_from_utf8_string(
+     void )
 {
 	uint8_t utf8_string[ 64 ];
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	const char *expected_strings[ 5 ] = {
+		"S-1-5-21-623811015-3229964156-30300820-1013",
+		"S-1-5-32-544",
+		"S-1-281474976710655",
+		"S-1-0-4294967295",
+		"S-1-5-1-2-3-4-5-6-7-8-9-10-11-12-13-14-15" };
+
+	const char *input_strings[ 5 ] = {
+		"S-1-5-21-623811015-3229964156-30300820-1013",
+		"S-1-0x000000000005-32-544",
+		"s-1-0xFFFFffffFFFF",
+		"S-1-0-04294967295",
+		"S-1-5-1-2-3-4-5-6-7-8-9-10-11-12-13-14-15" };
+
+	const char *invalid_strings[ 12 ] = {
+		"",
+		"S",
+		"X-1-5-21",
+		"S-2-5-21",
+		"S-1",
+		"S-1-",
+		"S-1-5-",
+		"S-1-5-21x",
+		"S-1-281474976710656",
+		"S-1-0x1000000000000",
+		"S-1-5-4294967296",
+		"S-1-5-1-2-3-4-5-6-7-8-9-10-11-12-13-14-15-16" };
 
-	/* Test copy to UTF-8 string
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_identifier_t *security_identifier = NULL;
+	size_t string_length                               = 0;
+	int result                                         = 0;
+	int string_index                                   = 0;
+
+	/* Initialize test
 	 */
-	result = libfwnt_security_identifier_copy_to_utf8_string(
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test copy from UTF-8 string
+	 */
+	for( string_index = 0;
+	     string_index < 5;
+	     string_index++ )
+	{
+		string_length = narrow_string_length(
+		                 input_strings[ string_index ] );
+
+		result = libfwnt_security_identifier_copy_from_utf8_string(
+		          security_identifier,
+		          (uint8_t *) input_strings[ string_index ],
+		          string_length + 1,
+		          0,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwnt_security_identifier_copy_to_utf8_string(
+		          security_identifier,
+		          utf8_string,
+		          64,
+		          0,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		string_length = narrow_string_length(
+		                 expected_strings[ string_index ] );
+
+		result = memory_compare(
+		          utf8_string,
+		          expected_strings[ string_index ],
+		          string_length + 1 );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test copy from UTF-8 string without end of string character
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
 	          security_identifier,
-	          utf8_string,
-	          47,
+	          (uint8_t *) "S-1-5-18",
+	          8,
 	          0,
 	          &error );
 
@@ -631,10 +2306,60 @@ int fwnt_test_security_identifier_copy_to_utf8_string(
 
 	/* Test error cases
 	 */
+	for( string_index = 0;
+	     string_index < 12;
+	     string_index++ )
+	{
+		string_length = narrow_string_length(
+		                 invalid_strings[ string_index ] );
+
+		result = libfwnt_security_identifier_copy_from_utf8_string(
+		          security_identifier,
+		          (uint8_t *) invalid_strings[ string_index ],
+		          string_length + 1,
+		          0,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test that a failed copy leaves the security identifier unchanged
+	 */
 	result = libfwnt_security_identifier_copy_to_utf8_string(
-	          NULL,
+	          security_identifier,
 	          utf8_string,
-	          47,
+	          64,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "S-1-5-18",
+	          9 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          NULL,
+	          (uint8_t *) "S-1-5-18",
+	          9,
 	          0,
 	          &error );
 
@@ -650,10 +2375,10 @@ int fwnt_test_security_identifier_copy_to_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf8_string(
+	result = libfwnt_security_identifier_copy_from_utf8_string(
 	          security_identifier,
 	          NULL,
-	          47,
+	          9,
 	          0,
 	          &error );
 
@@ -669,10 +2394,10 @@ int fwnt_test_security_identifier_copy_to_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf8_string(
+	result = libfwnt_security_identifier_copy_from_utf8_string(
 	          security_identifier,
-	          utf8_string,
-	          18,
+	          (uint8_t *) "S-1-5-18",
+	          (size_t) SSIZE_MAX + 1,
 	          0,
 	          &error );
 
@@ -688,10 +2413,10 @@ int fwnt_test_security_identifier_copy_to_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf8_string(
+	result = libfwnt_security_identifier_copy_from_utf8_string(
 	          security_identifier,
-	          utf8_string,
-	          47,
+	          (uint8_t *) "S-1-5-18",
+	          9,
 	          0xffffffffUL,
 	          &error );
 
@@ -707,6 +2432,25 @@ int fwnt_test_security_identifier_copy_to_utf8_string(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -715,29 +2459,34 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfwnt_security_identifier_copy_to_utf8_string_with_index function
+/* Tests the libfwnt_security_identifier_copy_from_utf8_string_with_index function
  * Returns 1 if successful or 0 if not
  */
-int fwnt_test_security_identifier_copy_to_utf8_string_with_index(
-     libfwnt_security_identifier_t *security_identifier )
+int fwnt_test_security_identifier_copy_from_utf8_string_with_index(
+     void )
 {
-	uint8_t utf8_string[ 64 ];
+	uint8_t utf8_strings[ 22 ] = {
+		'S', '-', '1', '-', '5', '-', '1', '8', 0,
+		'S', '-', '1', '-', '5', '-', '3', '2', '-', '5', '4', '4', 0 };
 
-	libcerror_error_t *error = NULL;
-	size_t utf8_string_index = 0;
-	int result               = 0;
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_identifier_t *security_identifier = NULL;
+	size_t utf8_string_index                           = 0;
+	int result                                         = 0;
 
-	/* Test copy to UTF-8 string
+	/* Initialize test
 	 */
-	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
-	          security_identifier,
-	          utf8_string,
-	          47,
-	          &utf8_string_index,
-	          0,
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -745,16 +2494,20 @@ int fwnt_test_security_identifier_copy_to_utf8_string_with_index(
 	 result,
 	 1 );
 
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
 	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test copy from consecutive UTF-8 strings
 	 */
-	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
-	          NULL,
-	          utf8_string,
-	          47,
+	result = libfwnt_security_identifier_copy_from_utf8_string_with_index(
+	          security_identifier,
+	          utf8_strings,
+	          22,
 	          &utf8_string_index,
 	          0,
 	          &error );
@@ -762,19 +2515,21 @@ int fwnt_test_security_identifier_copy_to_utf8_string_with_index(
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 9 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	result = libfwnt_security_identifier_copy_from_utf8_string_with_index(
 	          security_identifier,
-	          NULL,
-	          47,
+	          utf8_strings,
+	          22,
 	          &utf8_string_index,
 	          0,
 	          &error );
@@ -782,19 +2537,23 @@ int fwnt_test_security_identifier_copy_to_utf8_string_with_index(
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 22 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string_with_index(
 	          security_identifier,
-	          utf8_string,
-	          18,
+	          utf8_strings,
+	          22,
 	          &utf8_string_index,
 	          0,
 	          &error );
@@ -811,10 +2570,10 @@ int fwnt_test_security_identifier_copy_to_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	result = libfwnt_security_identifier_copy_from_utf8_string_with_index(
 	          security_identifier,
-	          utf8_string,
-	          47,
+	          utf8_strings,
+	          22,
 	          NULL,
 	          0,
 	          &error );
@@ -831,26 +2590,25 @@ int fwnt_test_security_identifier_copy_to_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
-	          security_identifier,
-	          utf8_string,
-	          47,
-	          &utf8_string_index,
-	          0xffffffffUL,
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -859,27 +2617,34 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfwnt_security_identifier_copy_to_utf16_string function
+/* Tests the libfwnt_security_identifier_copy_from_utf16_string function
  * Returns 1 if successful or 0 if not
  */
-int fwnt_test_security_identifier_copy_to_utf16_string(
-     libfwnt_security_identifier_t *security_identifier )
+int fwnt_test_security_identifier_copy_from_utf16_string(
+     void )
 {
-	uint16_t utf16_string[ 64 ];
+	uint16_t utf16_string[ 288 ];
+	uint8_t utf8_string[ 64 ];
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	const char *expected_string                        = "S-1-5-21-623811015-3229964156-30300820-1013";
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_identifier_t *security_identifier = NULL;
+	size_t string_index                                = 0;
+	int result                                         = 0;
 
-	/* Test copy to UTF-16 string
+	/* Initialize test
 	 */
-	result = libfwnt_security_identifier_copy_to_utf16_string(
-	          security_identifier,
-	          utf16_string,
-	          47,
-	          0,
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -887,54 +2652,70 @@ int fwnt_test_security_identifier_copy_to_utf16_string(
 	 result,
 	 1 );
 
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
 	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test copy from UTF-16 string
 	 */
-	result = libfwnt_security_identifier_copy_to_utf16_string(
-	          NULL,
+	for( string_index = 0;
+	     string_index < 44;
+	     string_index++ )
+	{
+		utf16_string[ string_index ] = (uint16_t) expected_string[ string_index ];
+	}
+	result = libfwnt_security_identifier_copy_from_utf16_string(
+	          security_identifier,
 	          utf16_string,
-	          47,
+	          44,
 	          0,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfwnt_security_identifier_copy_to_utf16_string(
+	result = libfwnt_security_identifier_copy_to_utf8_string(
 	          security_identifier,
-	          NULL,
-	          47,
+	          utf8_string,
+	          64,
 	          0,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = memory_compare(
+	          utf8_string,
+	          expected_string,
+	          44 );
 
-	result = libfwnt_security_identifier_copy_to_utf16_string(
-	          security_identifier,
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_copy_from_utf16_string(
+	          NULL,
 	          utf16_string,
-	          18,
+	          44,
 	          0,
 	          &error );
 
@@ -950,11 +2731,11 @@ int fwnt_test_security_identifier_copy_to_utf16_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf16_string(
+	result = libfwnt_security_identifier_copy_from_utf16_string(
 	          security_identifier,
-	          utf16_string,
-	          47,
-	          0xffffffffUL,
+	          NULL,
+	          44,
+	          0,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -969,55 +2750,33 @@ int fwnt_test_security_identifier_copy_to_utf16_string(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libfwnt_security_identifier_copy_to_utf16_string_with_index function
- * Returns 1 if successful or 0 if not
- */
-int fwnt_test_security_identifier_copy_to_utf16_string_with_index(
-     libfwnt_security_identifier_t *security_identifier )
-{
-	uint16_t utf16_string[ 64 ];
-
-	libcerror_error_t *error  = NULL;
-	size_t utf16_string_index = 0;
-	int result                = 0;
-
-	/* Test copy to UTF-16 string
-	 */
-	result = libfwnt_security_identifier_copy_to_utf16_string_with_index(
+	result = libfwnt_security_identifier_copy_from_utf16_string(
 	          security_identifier,
 	          utf16_string,
-	          47,
-	          &utf16_string_index,
+	          (size_t) SSIZE_MAX + 1,
 	          0,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	FWNT_TEST_ASSERT_IS_NULL(
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	libcerror_error_free(
+	 &error );
+
+	/* Test a character outside the ASCII range, where 0x0132 would be '2' if truncated
 	 */
-	result = libfwnt_security_identifier_copy_to_utf16_string_with_index(
-	          NULL,
+	utf16_string[ 6 ] = 0x0132;
+
+	result = libfwnt_security_identifier_copy_from_utf16_string(
+	          security_identifier,
 	          utf16_string,
-	          47,
-	          &utf16_string_index,
+	          44,
 	          0,
 	          &error );
 
@@ -1033,51 +2792,79 @@ int fwnt_test_security_identifier_copy_to_utf16_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf16_string_with_index(
+	/* Test the longest string that can be parsed, with 15 digits per value
+	 */
+	utf16_string[ 0 ] = (uint16_t) 'S';
+	utf16_string[ 1 ] = (uint16_t) '-';
+
+	for( string_index = 2;
+	     string_index < 272;
+	     string_index++ )
+	{
+		if( ( string_index % 16 ) == 1 )
+		{
+			utf16_string[ string_index ] = (uint16_t) '-';
+		}
+		else
+		{
+			utf16_string[ string_index ] = (uint16_t) '0';
+		}
+	}
+	utf16_string[ 16 ]  = (uint16_t) '1';
+	utf16_string[ 272 ] = (uint16_t) '9';
+	utf16_string[ 273 ] = 0;
+
+	result = libfwnt_security_identifier_copy_from_utf16_string(
 	          security_identifier,
-	          NULL,
-	          47,
-	          &utf16_string_index,
+	          utf16_string,
+	          274,
 	          0,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfwnt_security_identifier_copy_to_utf16_string_with_index(
+	result = libfwnt_security_identifier_copy_to_utf8_string(
 	          security_identifier,
-	          utf16_string,
-	          18,
-	          &utf16_string_index,
+	          utf8_string,
+	          64,
 	          0,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = memory_compare(
+	          utf8_string,
+	          "S-1-0-0-0-0-0-0-0-0-0-0-0-0-0-0-0-9",
+	          36 );
 
-	result = libfwnt_security_identifier_copy_to_utf16_string_with_index(
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a string that is longer than the longest string that can be parsed
+	 */
+	utf16_string[ 273 ] = (uint16_t) '9';
+	utf16_string[ 274 ] = 0;
+
+	result = libfwnt_security_identifier_copy_from_utf16_string(
 	          security_identifier,
 	          utf16_string,
-	          47,
-	          NULL,
+	          275,
 	          0,
 	          &error );
 
@@ -1093,26 +2880,25 @@ int fwnt_test_security_identifier_copy_to_utf16_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf16_string_with_index(
-	          security_identifier,
-	          utf16_string,
-	          47,
-	          &utf16_string_index,
-	          0xffffffffUL,
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -1121,27 +2907,34 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfwnt_security_identifier_copy_to_utf32_string function
+/* Tests the libfwnt_security_identifier_copy_from_utf16_string_with_index function
  * Returns 1 if successful or 0 if not
  */
-int fwnt_test_security_identifier_copy_to_utf32_string(
-     libfwnt_security_identifier_t *security_identifier )
+int fwnt_test_security_identifier_copy_from_utf16_string_with_index(
+     void )
 {
-	uint32_t utf32_string[ 64 ];
+	uint16_t utf16_strings[ 22 ] = {
+		'S', '-', '1', '-', '5', '-', '1', '8', 0,
+		'S', '-', '1', '-', '5', '-', '3', '2', '-', '5', '4', '4', 0 };
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_identifier_t *security_identifier = NULL;
+	size_t utf16_string_index                          = 0;
+	int result                                         = 0;
 
-	/* Test copy to UTF-32 string
+	/* Initialize test
 	 */
-	result = libfwnt_security_identifier_copy_to_utf32_string(
-	          security_identifier,
-	          utf32_string,
-	          47,
-	          0,
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -1149,54 +2942,67 @@ int fwnt_test_security_identifier_copy_to_utf32_string(
 	 result,
 	 1 );
 
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
 	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test copy from consecutive UTF-16 strings
 	 */
-	result = libfwnt_security_identifier_copy_to_utf32_string(
-	          NULL,
-	          utf32_string,
-	          47,
+	result = libfwnt_security_identifier_copy_from_utf16_string_with_index(
+	          security_identifier,
+	          utf16_strings,
+	          22,
+	          &utf16_string_index,
 	          0,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 9 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfwnt_security_identifier_copy_to_utf32_string(
+	result = libfwnt_security_identifier_copy_from_utf16_string_with_index(
 	          security_identifier,
-	          NULL,
-	          47,
+	          utf16_strings,
+	          22,
+	          &utf16_string_index,
 	          0,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 22 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfwnt_security_identifier_copy_to_utf32_string(
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_copy_from_utf16_string_with_index(
 	          security_identifier,
-	          utf32_string,
-	          18,
+	          utf16_strings,
+	          22,
+	          &utf16_string_index,
 	          0,
 	          &error );
 
@@ -1212,11 +3018,12 @@ int fwnt_test_security_identifier_copy_to_utf32_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf32_string(
+	result = libfwnt_security_identifier_copy_from_utf16_string_with_index(
 	          security_identifier,
-	          utf32_string,
-	          47,
-	          0xffffffffUL,
+	          utf16_strings,
+	          22,
+	          NULL,
+	          0,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -1231,6 +3038,25 @@ int fwnt_test_security_identifier_copy_to_utf32_string(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -1239,88 +3065,98 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfwnt_security_identifier_copy_to_utf32_string_with_index function
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+/* Tests the libfwnt_security_identifier_parse_utf8_decimal function
  * Returns 1 if successful or 0 if not
  */
-int fwnt_test_security_identifier_copy_to_utf32_string_with_index(
-     libfwnt_security_identifier_t *security_identifier )
+int fwnt_test_security_identifier_parse_utf8_decimal(
+     void )
 {
-	uint32_t utf32_string[ 64 ];
-
-	libcerror_error_t *error  = NULL;
-	size_t utf32_string_index = 0;
-	int result                = 0;
-
-	/* Test copy to UTF-32 string
-	 */
-	result = libfwnt_security_identifier_copy_to_utf32_string_with_index(
-	          security_identifier,
-	          utf32_string,
-	          47,
-	          &utf32_string_index,
-	          0,
-	          &error );
+	char value_string[ 32 ];
 
-	FWNT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FWNT_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	libcerror_error_t *error = NULL;
+	uint64_t expected_value  = 0;
+	uint64_t value           = 0;
+	size_t string_index      = 0;
+	size_t value_string_size = 0;
+	int number_of_digits     = 0;
+	int result               = 0;
 
-	/* Test error cases
+	/* Test regular cases with and without trailing characters, which covers
+	 * values that are parsed 8 digits at a time
 	 */
-	result = libfwnt_security_identifier_copy_to_utf32_string_with_index(
-	          NULL,
-	          utf32_string,
-	          47,
-	          &utf32_string_index,
-	          0,
-	          &error );
+	for( number_of_digits = 1;
+	     number_of_digits <= 15;
+	     number_of_digits++ )
+	{
+		expected_value = 0;
 
-	FWNT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		for( string_index = 0;
+		     string_index < (size_t) number_of_digits;
+		     string_index++ )
+		{
+			value_string[ string_index ] = (char) ( '1' + ( ( string_index * 7 ) % 9 ) );
 
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+			expected_value = ( expected_value * 10 ) + (uint64_t) ( value_string[ string_index ] - '0' );
+		}
+		value_string[ number_of_digits ]     = '-';
+		value_string[ number_of_digits + 1 ] = '1';
+		value_string[ number_of_digits + 2 ] = 0;
 
-	libcerror_error_free(
-	 &error );
+		for( value_string_size = (size_t) number_of_digits;
+		     value_string_size <= (size_t) number_of_digits + 3;
+		     value_string_size++ )
+		{
+			string_index = 0;
 
-	result = libfwnt_security_identifier_copy_to_utf32_string_with_index(
-	          security_identifier,
-	          NULL,
-	          47,
-	          &utf32_string_index,
-	          0,
-	          &error );
+			result = libfwnt_security_identifier_parse_utf8_decimal(
+			          (uint8_t *) value_string,
+			          value_string_size,
+			          &string_index,
+			          0xffffffffffffffffULL,
+			          &value,
+			          &error );
 
-	FWNT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
 
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+			FWNT_TEST_ASSERT_EQUAL_UINT64(
+			 "value",
+			 value,
+			 expected_value );
 
-	libcerror_error_free(
-	 &error );
+			FWNT_TEST_ASSERT_EQUAL_SIZE(
+			 "string_index",
+			 string_index,
+			 (size_t) number_of_digits );
 
-	result = libfwnt_security_identifier_copy_to_utf32_string_with_index(
-	          security_identifier,
-	          utf32_string,
-	          18,
-	          &utf32_string_index,
-	          0,
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfwnt_security_identifier_parse_utf8_decimal(
+	          (uint8_t *) "-1",
+	          3,
+	          &string_index,
+	          0xffffffffffffffffULL,
+	          &value,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -1335,12 +3171,14 @@ int fwnt_test_security_identifier_copy_to_utf32_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf32_string_with_index(
-	          security_identifier,
-	          utf32_string,
-	          47,
-	          NULL,
-	          0,
+	string_index = 0;
+
+	result = libfwnt_security_identifier_parse_utf8_decimal(
+	          (uint8_t *) "4294967296",
+	          11,
+	          &string_index,
+	          0xffffffffUL,
+	          &value,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -1355,12 +3193,14 @@ int fwnt_test_security_identifier_copy_to_utf32_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf32_string_with_index(
-	          security_identifier,
-	          utf32_string,
-	          47,
-	          &utf32_string_index,
-	          0xffffffffUL,
+	string_index = 0;
+
+	result = libfwnt_security_identifier_parse_utf8_decimal(
+	          (uint8_t *) "1234567890123456",
+	          17,
+	          &string_index,
+	          0xffffffffffffffffULL,
+	          &value,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -1386,6 +3226,8 @@ on_error:
 	return( 0 );
 }
 
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1425,6 +3267,38 @@ int main(
 	 "libfwnt_security_identifier_copy_from_byte_stream",
 	 fwnt_test_security_identifier_copy_from_byte_stream );
 
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_get_byte_stream_size",
+	 fwnt_test_security_identifier_get_byte_stream_size );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_copy_to_byte_stream",
+	 fwnt_test_security_identifier_copy_to_byte_stream );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_copy_from_utf8_string",
+	 fwnt_test_security_identifier_copy_from_utf8_string );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_copy_from_utf8_string_with_index",
+	 fwnt_test_security_identifier_copy_from_utf8_string_with_index );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_copy_from_utf16_string",
+	 fwnt_test_security_identifier_copy_from_utf16_string );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_copy_from_utf16_string_with_index",
+	 fwnt_test_security_identifier_copy_from_utf16_string_with_index );
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_parse_utf8_decimal",
+	 fwnt_test_security_identifier_parse_utf8_decimal );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize security_identifier for tests
@@ -1497,6 +3371,16 @@ int main(
 	 fwnt_test_security_identifier_copy_to_utf32_string_with_index,
 	 security_identifier );
 
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_security_identifier_get_utf8_strings_size",
+	 fwnt_test_security_identifier_get_utf8_strings_size,
+	 security_identifier );
+
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_security_identifier_copy_to_utf8_strings",
+	 fwnt_test_security_identifier_copy_to_utf8_strings,
+	 security_identifier );
+
 	/* Clean up
 	 */
 	result = libfwnt_security_identifier_free(
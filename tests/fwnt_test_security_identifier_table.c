@@ -0,0 +1,1922 @@
+/*
+ * Library security_identifier_table functions test program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_security_identifier_table.h"
+
+uint8_t fwnt_test_security_identifier_table_data1[ 32 ] = {
+	0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x15, 0x00, 0x00, 0x00, 0xc7, 0x99, 0x2e, 0x25,
+	0x7c, 0x57, 0x85, 0xc0, 0x94, 0x5a, 0xce, 0x01, 0xf5, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff };
+
+/* Tests the libfwnt_security_identifier_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_table_initialize(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfwnt_security_identifier_table_t *security_identifier_table = NULL;
+	int result                                                     = 0;
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+	int number_of_malloc_fail_tests                                = 1;
+	int number_of_memset_fail_tests                                = 1;
+	int test_number                                                = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_table_initialize(
+	          &security_identifier_table,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier_table",
+	 security_identifier_table );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_table_free(
+	          &security_identifier_table,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier_table",
+	 security_identifier_table );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_table_initialize(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	security_identifier_table = (libfwnt_security_identifier_table_t *) 0x12345678UL;
+
+	result = libfwnt_security_identifier_table_initialize(
+	          &security_identifier_table,
+	          &error );
+
+	security_identifier_table = NULL;
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_security_identifier_table_initialize with malloc failing
+		 */
+		fwnt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwnt_security_identifier_table_initialize(
+		          &security_identifier_table,
+		          &error );
+
+		if( fwnt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwnt_test_malloc_attempts_before_fail = -1;
+
+			if( security_identifier_table != NULL )
+			{
+				libfwnt_security_identifier_table_free(
+				 &security_identifier_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "security_identifier_table",
+			 security_identifier_table );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_security_identifier_table_initialize with memset failing
+		 */
+		fwnt_test_memset_attempts_before_fail = test_number;
+
+		result = libfwnt_security_identifier_table_initialize(
+		          &security_identifier_table,
+		          &error );
+
+		if( fwnt_test_memset_attempts_before_fail != -1 )
+		{
+			fwnt_test_memset_attempts_before_fail = -1;
+
+			if( security_identifier_table != NULL )
+			{
+				libfwnt_security_identifier_table_free(
+				 &security_identifier_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "security_identifier_table",
+			 security_identifier_table );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWNT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier_table != NULL )
+	{
+		libfwnt_security_identifier_table_free(
+		 &security_identifier_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_table_free(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	int result                                                     = 0;
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_table_free(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_table_intern_security_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_table_intern_security_identifier(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error                                       = NULL;
+	libfwnt_security_identifier_t *security_identifier1            = NULL;
+	libfwnt_security_identifier_t *security_identifier2            = NULL;
+	libfwnt_security_identifier_table_t *security_identifier_table = NULL;
+	uint32_t identifier                                            = 0;
+	int number_of_security_identifiers                             = 0;
+	int result                                                     = 0;
+	int string_length                                              = 0;
+	int sub_authority                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_table_initialize(
+	          &security_identifier_table,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier_table",
+	 security_identifier_table );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier1,
+	          (uint8_t *) "S-1-5-18",
+	          9,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier2,
+	          (uint8_t *) "S-1-5-32-544",
+	          13,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_table_intern_security_identifier(
+	          security_identifier_table,
+	          security_identifier1,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 (uint32_t) 0 );
+
+	result = libfwnt_security_identifier_table_intern_security_identifier(
+	          security_identifier_table,
+	          security_identifier2,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 (uint32_t) 1 );
+
+	/* Test that interning the same security identifier returns the same identifier
+	 */
+	result = libfwnt_security_identifier_table_intern_security_identifier(
+	          security_identifier_table,
+	          security_identifier1,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 (uint32_t) 0 );
+
+	result = libfwnt_security_identifier_table_get_number_of_security_identifiers(
+	          security_identifier_table,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 2 );
+
+	/* Test that the identifiers are dense and stable while the table grows
+	 */
+	for( sub_authority = 0;
+	     sub_authority < 3000;
+	     sub_authority++ )
+	{
+		string_length = narrow_string_snprintf(
+		                 (char *) utf8_string,
+		                 64,
+		                 "S-1-5-21-1-2-3-%d",
+		                 sub_authority );
+
+		FWNT_TEST_ASSERT_GREATER_THAN_INT(
+		 "string_length",
+		 string_length,
+		 0 );
+
+		result = libfwnt_security_identifier_copy_from_utf8_string(
+		          security_identifier2,
+		          utf8_string,
+		          (size_t) string_length + 1,
+		          0,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwnt_security_identifier_table_intern_security_identifier(
+		          security_identifier_table,
+		          security_identifier2,
+		          &identifier,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FWNT_TEST_ASSERT_EQUAL_UINT32(
+		 "identifier",
+		 identifier,
+		 (uint32_t) sub_authority + 2 );
+	}
+
+	for( sub_authority = 0;
+	     sub_authority < 3000;
+	     sub_authority++ )
+	{
+		string_length = narrow_string_snprintf(
+		                 (char *) utf8_string,
+		                 64,
+		                 "S-1-5-21-1-2-3-%d",
+		                 sub_authority );
+
+		FWNT_TEST_ASSERT_GREATER_THAN_INT(
+		 "string_length",
+		 string_length,
+		 0 );
+
+		result = libfwnt_security_identifier_copy_from_utf8_string(
+		          security_identifier2,
+		          utf8_string,
+		          (size_t) string_length + 1,
+		          0,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwnt_security_identifier_table_get_identifier(
+		          security_identifier_table,
+		          security_identifier2,
+		          &identifier,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FWNT_TEST_ASSERT_EQUAL_UINT32(
+		 "identifier",
+		 identifier,
+		 (uint32_t) sub_authority + 2 );
+	}
+
+	result = libfwnt_security_identifier_table_get_number_of_security_identifiers(
+	          security_identifier_table,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 3002 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_table_intern_security_identifier(
+	          NULL,
+	          security_identifier1,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_table_intern_security_identifier(
+	          security_identifier_table,
+	          NULL,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_table_intern_security_identifier(
+	          security_identifier_table,
+	          security_identifier1,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_free(
+	          &security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_table_free(
+	          &security_identifier_table,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier_table",
+	 security_identifier_table );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier2 != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier2,
+		 NULL );
+	}
+	if( security_identifier1 != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier1,
+		 NULL );
+	}
+	if( security_identifier_table != NULL )
+	{
+		libfwnt_security_identifier_table_free(
+		 &security_identifier_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_table_intern_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_table_intern_byte_stream(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfwnt_security_identifier_t *security_identifier             = NULL;
+	libfwnt_security_identifier_table_t *security_identifier_table = NULL;
+	uint32_t identifier                                            = 0;
+	int number_of_security_identifiers                             = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_table_initialize(
+	          &security_identifier_table,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier_table",
+	 security_identifier_table );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          (uint8_t *) "S-1-5-18",
+	          9,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_table_intern_security_identifier(
+	          security_identifier_table,
+	          security_identifier,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 (uint32_t) 0 );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_table_intern_byte_stream(
+	          security_identifier_table,
+	          fwnt_test_security_identifier_table_data1,
+	          32,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 (uint32_t) 1 );
+
+	/* Test that the byte stream and the security identifier it contains are interned as the same security identifier
+	 */
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          security_identifier,
+	          fwnt_test_security_identifier_table_data1,
+	          32,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_table_intern_security_identifier(
+	          security_identifier_table,
+	          security_identifier,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 (uint32_t) 1 );
+
+	result = libfwnt_security_identifier_table_get_number_of_security_identifiers(
+	          security_identifier_table,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_table_intern_byte_stream(
+	          NULL,
+	          fwnt_test_security_identifier_table_data1,
+	          32,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_table_intern_byte_stream(
+	          security_identifier_table,
+	          NULL,
+	          32,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_table_intern_byte_stream(
+	          security_identifier_table,
+	          fwnt_test_security_identifier_table_data1,
+	          27,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_table_intern_byte_stream(
+	          security_identifier_table,
+	          fwnt_test_security_identifier_table_data1,
+	          32,
+	          (uint8_t) 'X',
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_table_intern_byte_stream(
+	          security_identifier_table,
+	          fwnt_test_security_identifier_table_data1,
+	          32,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_table_free(
+	          &security_identifier_table,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier_table",
+	 security_identifier_table );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	if( security_identifier_table != NULL )
+	{
+		libfwnt_security_identifier_table_free(
+		 &security_identifier_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_table_get_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_table_get_identifier(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfwnt_security_identifier_t *security_identifier1            = NULL;
+	libfwnt_security_identifier_t *security_identifier2            = NULL;
+	libfwnt_security_identifier_table_t *security_identifier_table = NULL;
+	uint32_t identifier                                            = 0;
+	int number_of_security_identifiers                             = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_table_initialize(
+	          &security_identifier_table,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier_table",
+	 security_identifier_table );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier1,
+	          (uint8_t *) "S-1-5-18",
+	          9,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier2,
+	          (uint8_t *) "S-1-5-32-544",
+	          13,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_table_get_identifier(
+	          security_identifier_table,
+	          security_identifier1,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_table_intern_security_identifier(
+	          security_identifier_table,
+	          security_identifier2,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 (uint32_t) 0 );
+
+	result = libfwnt_security_identifier_table_intern_security_identifier(
+	          security_identifier_table,
+	          security_identifier1,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 (uint32_t) 1 );
+
+	result = libfwnt_security_identifier_table_get_identifier(
+	          security_identifier_table,
+	          security_identifier1,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 (uint32_t) 1 );
+
+	/* Test that a security identifier that is not in the table is not interned
+	 */
+	result = libfwnt_security_identifier_table_get_number_of_security_identifiers(
+	          security_identifier_table,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_table_get_identifier(
+	          NULL,
+	          security_identifier1,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_table_get_identifier(
+	          security_identifier_table,
+	          NULL,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_table_get_identifier(
+	          security_identifier_table,
+	          security_identifier1,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_free(
+	          &security_identifier1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_table_free(
+	          &security_identifier_table,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier_table",
+	 security_identifier_table );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier2 != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier2,
+		 NULL );
+	}
+	if( security_identifier1 != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier1,
+		 NULL );
+	}
+	if( security_identifier_table != NULL )
+	{
+		libfwnt_security_identifier_table_free(
+		 &security_identifier_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_table_get_number_of_security_identifiers function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_table_get_number_of_security_identifiers(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfwnt_security_identifier_table_t *security_identifier_table = NULL;
+	int number_of_security_identifiers                             = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_table_initialize(
+	          &security_identifier_table,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier_table",
+	 security_identifier_table );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_table_get_number_of_security_identifiers(
+	          security_identifier_table,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_table_get_number_of_security_identifiers(
+	          NULL,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_table_get_number_of_security_identifiers(
+	          security_identifier_table,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_table_free(
+	          &security_identifier_table,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier_table",
+	 security_identifier_table );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier_table != NULL )
+	{
+		libfwnt_security_identifier_table_free(
+		 &security_identifier_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_table_get_security_identifier_view_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_table_get_security_identifier_view_by_identifier(
+     void )
+{
+	libfwnt_security_identifier_view_t security_identifier_view;
+
+	libcerror_error_t *error                                       = NULL;
+	libfwnt_security_identifier_table_t *security_identifier_table = NULL;
+	uint32_t identifier                                            = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_table_initialize(
+	          &security_identifier_table,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier_table",
+	 security_identifier_table );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_table_intern_byte_stream(
+	          security_identifier_table,
+	          fwnt_test_security_identifier_table_data1,
+	          32,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_table_get_security_identifier_view_by_identifier(
+	          security_identifier_table,
+	          0,
+	          &security_identifier_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "security_identifier_view.data_size",
+	 security_identifier_view.data_size,
+	 (size_t) 28 );
+
+	result = memory_compare(
+	          security_identifier_view.data,
+	          fwnt_test_security_identifier_table_data1,
+	          28 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_table_get_security_identifier_view_by_identifier(
+	          NULL,
+	          0,
+	          &security_identifier_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_table_get_security_identifier_view_by_identifier(
+	          security_identifier_table,
+	          1,
+	          &security_identifier_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_table_get_security_identifier_view_by_identifier(
+	          security_identifier_table,
+	          0,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_table_free(
+	          &security_identifier_table,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier_table",
+	 security_identifier_table );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier_table != NULL )
+	{
+		libfwnt_security_identifier_table_free(
+		 &security_identifier_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_table_get_security_identifier_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_table_get_security_identifier_by_identifier(
+     void )
+{
+	uint8_t byte_stream[ 32 ];
+
+	libcerror_error_t *error                                       = NULL;
+	libfwnt_security_identifier_t *security_identifier             = NULL;
+	libfwnt_security_identifier_table_t *security_identifier_table = NULL;
+	uint32_t identifier                                            = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_table_initialize(
+	          &security_identifier_table,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier_table",
+	 security_identifier_table );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_table_intern_byte_stream(
+	          security_identifier_table,
+	          fwnt_test_security_identifier_table_data1,
+	          32,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_table_get_security_identifier_by_identifier(
+	          security_identifier_table,
+	          0,
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_to_byte_stream(
+	          security_identifier,
+	          byte_stream,
+	          32,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_security_identifier_table_data1,
+	          28 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_table_get_security_identifier_by_identifier(
+	          NULL,
+	          0,
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_table_get_security_identifier_by_identifier(
+	          security_identifier_table,
+	          0,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_table_get_security_identifier_by_identifier(
+	          security_identifier_table,
+	          0,
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_table_get_security_identifier_by_identifier(
+	          security_identifier_table,
+	          1,
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_table_free(
+	          &security_identifier_table,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier_table",
+	 security_identifier_table );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	if( security_identifier_table != NULL )
+	{
+		libfwnt_security_identifier_table_free(
+		 &security_identifier_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_table_initialize",
+	 fwnt_test_security_identifier_table_initialize );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_table_free",
+	 fwnt_test_security_identifier_table_free );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_table_intern_security_identifier",
+	 fwnt_test_security_identifier_table_intern_security_identifier );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_table_intern_byte_stream",
+	 fwnt_test_security_identifier_table_intern_byte_stream );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_table_get_identifier",
+	 fwnt_test_security_identifier_table_get_identifier );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_table_get_number_of_security_identifiers",
+	 fwnt_test_security_identifier_table_get_number_of_security_identifiers );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_table_get_security_identifier_view_by_identifier",
+	 fwnt_test_security_identifier_table_get_security_identifier_view_by_identifier );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_table_get_security_identifier_by_identifier",
+	 fwnt_test_security_identifier_table_get_security_identifier_by_identifier );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,707 @@
+/*
+ * Library security_identifier_view functions test program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_security_identifier_view.h"
+
+uint8_t fwnt_test_security_identifier_view_data1[ 28 ] = {
+	0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x15, 0x00, 0x00, 0x00, 0x52, 0xaa, 0xc8, 0x68,
+	0xdd, 0xe8, 0xe4, 0x1c, 0x8a, 0xa7, 0x32, 0x3f, 0xeb, 0x03, 0x00, 0x00 };
+
+/* Tests the libfwnt_security_identifier_view_set_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_view_set_from_byte_stream(
+     void )
+{
+	uint8_t data[ 28 ];
+	libfwnt_security_identifier_view_t security_identifier_view;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_view_set_from_byte_stream(
+	          &security_identifier_view,
+	          fwnt_test_security_identifier_view_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "security_identifier_view.data_size",
+	 security_identifier_view.data_size,
+	 (size_t) 28 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_view_set_from_byte_stream(
+	          NULL,
+	          fwnt_test_security_identifier_view_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_view_set_from_byte_stream(
+	          &security_identifier_view,
+	          NULL,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_view_set_from_byte_stream(
+	          &security_identifier_view,
+	          fwnt_test_security_identifier_view_data1,
+	          0,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_view_set_from_byte_stream(
+	          &security_identifier_view,
+	          fwnt_test_security_identifier_view_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_view_set_from_byte_stream(
+	          &security_identifier_view,
+	          fwnt_test_security_identifier_view_data1,
+	          24,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_view_set_from_byte_stream(
+	          &security_identifier_view,
+	          fwnt_test_security_identifier_view_data1,
+	          28,
+	          (uint8_t) 'X',
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with more than 15 sub authorities
+	 */
+	if( memory_copy(
+	     data,
+	     fwnt_test_security_identifier_view_data1,
+	     28 ) == NULL )
+	{
+		goto on_error;
+	}
+	data[ 1 ] = 0x10;
+
+	result = libfwnt_security_identifier_view_set_from_byte_stream(
+	          &security_identifier_view,
+	          data,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_view_get_revision_number function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_view_get_revision_number(
+     void )
+{
+	libfwnt_security_identifier_view_t security_identifier_view;
+
+	libcerror_error_t *error = NULL;
+	uint8_t revision_number  = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_view_set_from_byte_stream(
+	          &security_identifier_view,
+	          fwnt_test_security_identifier_view_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_view_get_revision_number(
+	          &security_identifier_view,
+	          &revision_number,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "revision_number",
+	 revision_number,
+	 (uint8_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_view_get_revision_number(
+	          NULL,
+	          &revision_number,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_view_get_revision_number(
+	          &security_identifier_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_view_get_authority function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_view_get_authority(
+     void )
+{
+	libfwnt_security_identifier_view_t security_identifier_view;
+
+	libcerror_error_t *error = NULL;
+	uint64_t authority       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_view_set_from_byte_stream(
+	          &security_identifier_view,
+	          fwnt_test_security_identifier_view_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_view_get_authority(
+	          &security_identifier_view,
+	          &authority,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT64(
+	 "authority",
+	 authority,
+	 (uint64_t) 5 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_view_get_authority(
+	          NULL,
+	          &authority,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_view_get_authority(
+	          &security_identifier_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_view_get_number_of_sub_authorities function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_view_get_number_of_sub_authorities(
+     void )
+{
+	libfwnt_security_identifier_view_t security_identifier_view;
+
+	libcerror_error_t *error          = NULL;
+	uint8_t number_of_sub_authorities = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_view_set_from_byte_stream(
+	          &security_identifier_view,
+	          fwnt_test_security_identifier_view_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_view_get_number_of_sub_authorities(
+	          &security_identifier_view,
+	          &number_of_sub_authorities,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_sub_authorities",
+	 number_of_sub_authorities,
+	 (uint8_t) 5 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_view_get_number_of_sub_authorities(
+	          NULL,
+	          &number_of_sub_authorities,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_view_get_number_of_sub_authorities(
+	          &security_identifier_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_view_get_sub_authority_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_view_get_sub_authority_by_index(
+     void )
+{
+	libfwnt_security_identifier_view_t security_identifier_view;
+
+	libcerror_error_t *error = NULL;
+	uint32_t sub_authority   = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_view_set_from_byte_stream(
+	          &security_identifier_view,
+	          fwnt_test_security_identifier_view_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_view_get_sub_authority_by_index(
+	          &security_identifier_view,
+	          0,
+	          &sub_authority,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "sub_authority",
+	 sub_authority,
+	 (uint32_t) 21 );
+
+	result = libfwnt_security_identifier_view_get_sub_authority_by_index(
+	          &security_identifier_view,
+	          4,
+	          &sub_authority,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "sub_authority",
+	 sub_authority,
+	 (uint32_t) 1003 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_view_get_sub_authority_by_index(
+	          NULL,
+	          0,
+	          &sub_authority,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_view_get_sub_authority_by_index(
+	          &security_identifier_view,
+	          5,
+	          &sub_authority,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_view_get_sub_authority_by_index(
+	          &security_identifier_view,
+	          0,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_view_set_from_byte_stream",
+	 fwnt_test_security_identifier_view_set_from_byte_stream );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_view_get_revision_number",
+	 fwnt_test_security_identifier_view_get_revision_number );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_view_get_authority",
+	 fwnt_test_security_identifier_view_get_authority );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_view_get_number_of_sub_authorities",
+	 fwnt_test_security_identifier_view_get_number_of_sub_authorities );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_view_get_sub_authority_by_index",
+	 fwnt_test_security_identifier_view_get_sub_authority_by_index );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,293 @@
+/*
+ * Library type definitions test program
+ *
+ * Copyright (C) 2009-2021, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include <stddef.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_unused.h"
+
+/* The type definitions for local use of libfwnt are included under different names
+ * so that they can be compared with the type definitions in <libfwnt/types.h>
+ */
+#define HAVE_LOCAL_LIBFWNT
+
+#define libfwnt_arena_t				fwnt_test_local_arena_t
+#define libfwnt_access_control_entry_t		fwnt_test_local_access_control_entry_t
+#define libfwnt_access_control_list_t		fwnt_test_local_access_control_list_t
+#define libfwnt_access_token_t			fwnt_test_local_access_token_t
+#define libfwnt_lznt1_stream_decoder_t		fwnt_test_local_lznt1_stream_decoder_t
+#define libfwnt_lzx_decoder_t			fwnt_test_local_lzx_decoder_t
+#define libfwnt_lzx_stream_decoder_t		fwnt_test_local_lzx_stream_decoder_t
+#define libfwnt_security_descriptor_t		fwnt_test_local_security_descriptor_t
+#define libfwnt_security_descriptor_cache_t	fwnt_test_local_security_descriptor_cache_t
+#define libfwnt_security_descriptor_stream_t	fwnt_test_local_security_descriptor_stream_t
+#define libfwnt_security_identifier_t		fwnt_test_local_security_identifier_t
+#define libfwnt_security_identifier_table_t	fwnt_test_local_security_identifier_table_t
+#define libfwnt_access_control_entry_view	fwnt_test_local_access_control_entry_view
+#define libfwnt_access_control_entry_view_t	fwnt_test_local_access_control_entry_view_t
+#define libfwnt_access_control_list_builder	fwnt_test_local_access_control_list_builder
+#define libfwnt_access_control_list_builder_t	fwnt_test_local_access_control_list_builder_t
+#define libfwnt_access_control_list_view	fwnt_test_local_access_control_list_view
+#define libfwnt_access_control_list_view_t	fwnt_test_local_access_control_list_view_t
+#define libfwnt_security_descriptor_layout	fwnt_test_local_security_descriptor_layout
+#define libfwnt_security_descriptor_layout_t	fwnt_test_local_security_descriptor_layout_t
+#define libfwnt_security_descriptor_view	fwnt_test_local_security_descriptor_view
+#define libfwnt_security_descriptor_view_t	fwnt_test_local_security_descriptor_view_t
+#define libfwnt_security_identifier_view	fwnt_test_local_security_identifier_view
+#define libfwnt_security_identifier_view_t	fwnt_test_local_security_identifier_view_t
+
+#include "../libfwnt/libfwnt_types.h"
+
+#undef libfwnt_arena_t
+#undef libfwnt_access_control_entry_t
+#undef libfwnt_access_control_list_t
+#undef libfwnt_access_token_t
+#undef libfwnt_lznt1_stream_decoder_t
+#undef libfwnt_lzx_decoder_t
+#undef libfwnt_lzx_stream_decoder_t
+#undef libfwnt_security_descriptor_t
+#undef libfwnt_security_descriptor_cache_t
+#undef libfwnt_security_descriptor_stream_t
+#undef libfwnt_security_identifier_t
+#undef libfwnt_security_identifier_table_t
+#undef libfwnt_access_control_entry_view
+#undef libfwnt_access_control_entry_view_t
+#undef libfwnt_access_control_list_builder
+#undef libfwnt_access_control_list_builder_t
+#undef libfwnt_access_control_list_view
+#undef libfwnt_access_control_list_view_t
+#undef libfwnt_security_descriptor_layout
+#undef libfwnt_security_descriptor_layout_t
+#undef libfwnt_security_descriptor_view
+#undef libfwnt_security_descriptor_view_t
+#undef libfwnt_security_identifier_view
+#undef libfwnt_security_identifier_view_t
+
+#undef HAVE_LOCAL_LIBFWNT
+
+/* Fails to compile if the condition is false
+ */
+#define FWNT_TEST_TYPES_COMPILE_TIME_ASSERT( name, condition ) \
+	typedef char fwnt_test_types_assert_ ## name[ ( condition ) ? 1 : -1 ]
+
+/* The layout of libfwnt_access_control_entry_view_t must be the same in both definitions
+ */
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ access_control_entry_view_size,
+ sizeof( libfwnt_access_control_entry_view_t ) == sizeof( fwnt_test_local_access_control_entry_view_t ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ access_control_entry_view_data,
+ offsetof( libfwnt_access_control_entry_view_t, data ) == offsetof( fwnt_test_local_access_control_entry_view_t, data ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ access_control_entry_view_data_size,
+ offsetof( libfwnt_access_control_entry_view_t, data_size ) == offsetof( fwnt_test_local_access_control_entry_view_t, data_size ) );
+
+/* The layout of libfwnt_access_control_list_builder_t must be the same in both definitions
+ */
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ access_control_list_builder_size,
+ sizeof( libfwnt_access_control_list_builder_t ) == sizeof( fwnt_test_local_access_control_list_builder_t ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ access_control_list_builder_data,
+ offsetof( libfwnt_access_control_list_builder_t, data ) == offsetof( fwnt_test_local_access_control_list_builder_t, data ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ access_control_list_builder_data_size,
+ offsetof( libfwnt_access_control_list_builder_t, data_size ) == offsetof( fwnt_test_local_access_control_list_builder_t, data_size ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ access_control_list_builder_maximum_data_size,
+ offsetof( libfwnt_access_control_list_builder_t, maximum_data_size ) == offsetof( fwnt_test_local_access_control_list_builder_t, maximum_data_size ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ access_control_list_builder_number_of_entries,
+ offsetof( libfwnt_access_control_list_builder_t, number_of_entries ) == offsetof( fwnt_test_local_access_control_list_builder_t, number_of_entries ) );
+
+/* The layout of libfwnt_access_control_list_view_t must be the same in both definitions
+ */
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ access_control_list_view_size,
+ sizeof( libfwnt_access_control_list_view_t ) == sizeof( fwnt_test_local_access_control_list_view_t ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ access_control_list_view_data,
+ offsetof( libfwnt_access_control_list_view_t, data ) == offsetof( fwnt_test_local_access_control_list_view_t, data ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ access_control_list_view_data_size,
+ offsetof( libfwnt_access_control_list_view_t, data_size ) == offsetof( fwnt_test_local_access_control_list_view_t, data_size ) );
+
+/* The layout of libfwnt_security_descriptor_layout_t must be the same in both definitions
+ */
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_descriptor_layout_size,
+ sizeof( libfwnt_security_descriptor_layout_t ) == sizeof( fwnt_test_local_security_descriptor_layout_t ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_descriptor_layout_revision_number,
+ offsetof( libfwnt_security_descriptor_layout_t, revision_number ) == offsetof( fwnt_test_local_security_descriptor_layout_t, revision_number ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_descriptor_layout_control_flags,
+ offsetof( libfwnt_security_descriptor_layout_t, control_flags ) == offsetof( fwnt_test_local_security_descriptor_layout_t, control_flags ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_descriptor_layout_owner_sid_offset,
+ offsetof( libfwnt_security_descriptor_layout_t, owner_sid_offset ) == offsetof( fwnt_test_local_security_descriptor_layout_t, owner_sid_offset ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_descriptor_layout_owner_sid_size,
+ offsetof( libfwnt_security_descriptor_layout_t, owner_sid_size ) == offsetof( fwnt_test_local_security_descriptor_layout_t, owner_sid_size ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_descriptor_layout_group_sid_offset,
+ offsetof( libfwnt_security_descriptor_layout_t, group_sid_offset ) == offsetof( fwnt_test_local_security_descriptor_layout_t, group_sid_offset ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_descriptor_layout_group_sid_size,
+ offsetof( libfwnt_security_descriptor_layout_t, group_sid_size ) == offsetof( fwnt_test_local_security_descriptor_layout_t, group_sid_size ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_descriptor_layout_system_acl_offset,
+ offsetof( libfwnt_security_descriptor_layout_t, system_acl_offset ) == offsetof( fwnt_test_local_security_descriptor_layout_t, system_acl_offset ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_descriptor_layout_system_acl_size,
+ offsetof( libfwnt_security_descriptor_layout_t, system_acl_size ) == offsetof( fwnt_test_local_security_descriptor_layout_t, system_acl_size ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_descriptor_layout_discretionary_acl_offset,
+ offsetof( libfwnt_security_descriptor_layout_t, discretionary_acl_offset ) == offsetof( fwnt_test_local_security_descriptor_layout_t, discretionary_acl_offset ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_descriptor_layout_discretionary_acl_size,
+ offsetof( libfwnt_security_descriptor_layout_t, discretionary_acl_size ) == offsetof( fwnt_test_local_security_descriptor_layout_t, discretionary_acl_size ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_descriptor_layout_data_size,
+ offsetof( libfwnt_security_descriptor_layout_t, data_size ) == offsetof( fwnt_test_local_security_descriptor_layout_t, data_size ) );
+
+/* The layout of libfwnt_security_descriptor_view_t must be the same in both definitions
+ */
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_descriptor_view_size,
+ sizeof( libfwnt_security_descriptor_view_t ) == sizeof( fwnt_test_local_security_descriptor_view_t ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_descriptor_view_data,
+ offsetof( libfwnt_security_descriptor_view_t, data ) == offsetof( fwnt_test_local_security_descriptor_view_t, data ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_descriptor_view_data_size,
+ offsetof( libfwnt_security_descriptor_view_t, data_size ) == offsetof( fwnt_test_local_security_descriptor_view_t, data_size ) );
+
+/* The layout of libfwnt_security_identifier_view_t must be the same in both definitions
+ */
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_identifier_view_size,
+ sizeof( libfwnt_security_identifier_view_t ) == sizeof( fwnt_test_local_security_identifier_view_t ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_identifier_view_data,
+ offsetof( libfwnt_security_identifier_view_t, data ) == offsetof( fwnt_test_local_security_identifier_view_t, data ) );
+
+FWNT_TEST_TYPES_COMPILE_TIME_ASSERT(
+ security_identifier_view_data_size,
+ offsetof( libfwnt_security_identifier_view_t, data_size ) == offsetof( fwnt_test_local_security_identifier_view_t, data_size ) );
+
+/* Tests the size of the view type definitions
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_types_views(
+     void )
+{
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sizeof( libfwnt_access_control_entry_view_t )",
+	 sizeof( libfwnt_access_control_entry_view_t ),
+	 sizeof( fwnt_test_local_access_control_entry_view_t ) );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sizeof( libfwnt_access_control_list_builder_t )",
+	 sizeof( libfwnt_access_control_list_builder_t ),
+	 sizeof( fwnt_test_local_access_control_list_builder_t ) );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sizeof( libfwnt_access_control_list_view_t )",
+	 sizeof( libfwnt_access_control_list_view_t ),
+	 sizeof( fwnt_test_local_access_control_list_view_t ) );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sizeof( libfwnt_security_descriptor_layout_t )",
+	 sizeof( libfwnt_security_descriptor_layout_t ),
+	 sizeof( fwnt_test_local_security_descriptor_layout_t ) );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sizeof( libfwnt_security_descriptor_view_t )",
+	 sizeof( libfwnt_security_descriptor_view_t ),
+	 sizeof( fwnt_test_local_security_descriptor_view_t ) );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sizeof( libfwnt_security_identifier_view_t )",
+	 sizeof( libfwnt_security_identifier_view_t ),
+	 sizeof( fwnt_test_local_security_identifier_view_t ) );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_types_views",
+	 fwnt_test_types_views );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "access_control_entry access_control_list bit_stream error huffman_tree lznt1 lzx lzxpress notify security_descriptor security_identifier support"
+$LibraryTests = "access_control_entry access_control_entry_view access_control_list access_control_list_builder access_control_list_view access_token arena bit_stream call_instruction cpu error huffman_tree lznt1 lznt1_stream_decoder lzx lzx_decoder lzx_stream_decoder lzxpress lzxpress_huffman_decoder match_copy notify security_descriptor security_descriptor_cache security_descriptor_layout security_descriptor_stream security_descriptor_view security_identifier security_identifier_table security_identifier_view support types"
 $LibraryTestsWithInput = ""
 $OptionSets = ""
 